@@ -0,0 +1,266 @@
+#include "Core/RadixSort.h"
+#include "Fixture.h"
+#include "Math/FastMath.h"
+#include "Math/VectorPacket.h"
+#include "Renderer/MipGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+namespace Engine {
+namespace Bench {
+
+using namespace Engine::Math;
+
+namespace {
+
+// Depth keys per sort, about what a busy frame queues
+const size_t kSortCount = 16384;
+// Base level edge for the mip chains
+const uint32_t kMipSize = 2048;
+
+// The fixture's Vec3 inputs split into x/y/z streams
+struct VectorStreams {
+  std::vector<float> ax, ay, az, bx, by, bz;
+};
+
+const VectorStreams &GetVectorStreams() {
+  static const VectorStreams streams = []() {
+    const Fixture &f = GetFixture();
+    VectorStreams s;
+    for (size_t i = 0; i < Fixture::kSize; ++i) {
+      s.ax.push_back(f.vec3A[i].x);
+      s.ay.push_back(f.vec3A[i].y);
+      s.az.push_back(f.vec3A[i].z);
+      s.bx.push_back(f.vec3B[i].x);
+      s.by.push_back(f.vec3B[i].y);
+      s.bz.push_back(f.vec3B[i].z);
+    }
+    return s;
+  }();
+  return streams;
+}
+
+const std::vector<float> &GetSortKeys() {
+  static const std::vector<float> keys = []() {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> depth(0.1f, 1000.0f);
+    std::vector<float> k(kSortCount);
+    for (float &key : k) {
+      key = depth(rng);
+    }
+    return k;
+  }();
+  return keys;
+}
+
+// Random RGBA texels, so the filters see no flat regions
+const Image &GetMipBase() {
+  static const Image base = []() {
+    Image image(kMipSize, kMipSize);
+    std::mt19937 rng(9);
+    for (uint8_t &byte : image.Pixels) {
+      byte = static_cast<uint8_t>(rng() >> 24);
+    }
+    return image;
+  }();
+  return base;
+}
+
+Vec3x8 LoadStreams(const float *x, const float *y, const float *z) {
+  return Vec3x8(SimdFloat8::LoadU(x), SimdFloat8::LoadU(y),
+                SimdFloat8::LoadU(z));
+}
+
+// Times 'body' over the whole fixture, so per-item times compare directly
+// with the per-call rows
+template <typename Body>
+void AddBatch(Registry &registry, const std::string &name, size_t items,
+              Body body) {
+  registry.Add(name, [items, body](State &state) {
+    state.SetItemsPerIteration(items);
+    body(state);
+  });
+}
+
+template <Accuracy A> void AddSinCos(Registry &registry, const char *tier) {
+  const size_t n = Fixture::kSize;
+  AddBatch(registry, std::string("FastMath/SinCos") + tier, n,
+           [n](State &state) {
+             const Fixture &f = GetFixture();
+             std::vector<float> sines(n), cosines(n);
+             while (state.KeepRunning()) {
+               for (size_t i = 0; i < n; ++i) {
+                 FastMath::SinCos<A>(f.angles[i], sines[i], cosines[i]);
+               }
+               ClobberMemory();
+             }
+           });
+  AddBatch(registry, std::string("FastMath/SinCos") + tier + "x8", n,
+           [n](State &state) {
+             const Fixture &f = GetFixture();
+             std::vector<float> sines(n), cosines(n);
+             while (state.KeepRunning()) {
+               for (size_t i = 0; i < n; i += SimdFloat8::Width) {
+                 SimdFloat8 s, c;
+                 FastMath::SinCos<A>(SimdFloat8::LoadU(&f.angles[i]), s, c);
+                 s.StoreU(&sines[i]);
+                 c.StoreU(&cosines[i]);
+               }
+               ClobberMemory();
+             }
+           });
+}
+
+} // namespace
+
+void RegisterBatchBenchmarks(Registry &registry) {
+  const size_t n = Fixture::kSize;
+
+  //==========================================================================
+  // Vec3 loops against eight-wide packets
+  //==========================================================================
+  AddBatch(registry, "Vec3x8/DotLoopVec3", n, [n](State &state) {
+    const Fixture &f = GetFixture();
+    std::vector<float> dots(n);
+    while (state.KeepRunning()) {
+      for (size_t i = 0; i < n; ++i) {
+        dots[i] = f.vec3A[i].Dot(f.vec3B[i]);
+      }
+      ClobberMemory();
+    }
+  });
+  AddBatch(registry, "Vec3x8/DotSoA", n, [n](State &state) {
+    const VectorStreams &s = GetVectorStreams();
+    std::vector<float> dots(n);
+    while (state.KeepRunning()) {
+      for (size_t i = 0; i < n; i += 8) {
+        Dot(LoadStreams(&s.ax[i], &s.ay[i], &s.az[i]),
+            LoadStreams(&s.bx[i], &s.by[i], &s.bz[i]))
+            .StoreU(&dots[i]);
+      }
+      ClobberMemory();
+    }
+  });
+  AddBatch(registry, "Vec3x8/CrossNormalizeLoopVec3", n, [n](State &state) {
+    const Fixture &f = GetFixture();
+    std::vector<Vec3> out(n);
+    while (state.KeepRunning()) {
+      for (size_t i = 0; i < n; ++i) {
+        out[i] = f.vec3A[i].Cross(f.vec3B[i]).Normalized();
+      }
+      ClobberMemory();
+    }
+  });
+  AddBatch(registry, "Vec3x8/CrossNormalizeAoS", n, [n](State &state) {
+    const Fixture &f = GetFixture();
+    std::vector<Vec3> out(n);
+    while (state.KeepRunning()) {
+      for (size_t i = 0; i < n; i += 8) {
+        Normalize(Cross(Vec3x8::Load(&f.vec3A[i]), Vec3x8::Load(&f.vec3B[i])))
+            .Store(&out[i]);
+      }
+      ClobberMemory();
+    }
+  });
+  AddBatch(registry, "Vec3x8/CrossNormalizeSoA", n, [n](State &state) {
+    const VectorStreams &s = GetVectorStreams();
+    std::vector<float> x(n), y(n), z(n);
+    while (state.KeepRunning()) {
+      for (size_t i = 0; i < n; i += 8) {
+        Vec3x8 v = Normalize(Cross(LoadStreams(&s.ax[i], &s.ay[i], &s.az[i]),
+                                   LoadStreams(&s.bx[i], &s.by[i], &s.bz[i])));
+        v.x.StoreU(&x[i]);
+        v.y.StoreU(&y[i]);
+        v.z.StoreU(&z[i]);
+      }
+      ClobberMemory();
+    }
+  });
+
+  //==========================================================================
+  // FastMath tiers against libm
+  //==========================================================================
+  AddSinCos<Accuracy::Fast>(registry, "Fast");
+  AddSinCos<Accuracy::Medium>(registry, "Medium");
+  AddSinCos<Accuracy::Precise>(registry, "Precise");
+  AddBatch(registry, "FastMath/SinCosLibm", n, [n](State &state) {
+    const Fixture &f = GetFixture();
+    std::vector<float> sines(n), cosines(n);
+    while (state.KeepRunning()) {
+      for (size_t i = 0; i < n; ++i) {
+        sines[i] = std::sin(f.angles[i]);
+        cosines[i] = std::cos(f.angles[i]);
+      }
+      ClobberMemory();
+    }
+  });
+  AddBatch(registry, "FastMath/Atan2Precisex8", n, [n](State &state) {
+    const Fixture &f = GetFixture();
+    std::vector<float> out(n);
+    while (state.KeepRunning()) {
+      for (size_t i = 0; i < n; i += SimdFloat8::Width) {
+        FastMath::Atan2<Accuracy::Precise>(SimdFloat8::LoadU(&f.angles[i]),
+                                           SimdFloat8(3.0f))
+            .StoreU(&out[i]);
+      }
+      ClobberMemory();
+    }
+  });
+  AddBatch(registry, "FastMath/Atan2Libm", n, [n](State &state) {
+    const Fixture &f = GetFixture();
+    std::vector<float> out(n);
+    while (state.KeepRunning()) {
+      for (size_t i = 0; i < n; ++i) {
+        out[i] = std::atan2(f.angles[i], 3.0f);
+      }
+      ClobberMemory();
+    }
+  });
+
+  //==========================================================================
+  // Full mip chains, timed per base-level texel
+  //==========================================================================
+  const size_t texels = static_cast<size_t>(kMipSize) * kMipSize;
+  for (MipFilter filter : {MipFilter::Box, MipFilter::Kaiser}) {
+    AddBatch(registry,
+             filter == MipFilter::Box ? "Mips/BoxChain" : "Mips/KaiserChain",
+             texels, [filter](State &state) {
+               const Image &base = GetMipBase();
+               while (state.KeepRunning()) {
+                 DoNotOptimize(MipGenerator::Generate(base, filter).size());
+                 ClobberMemory();
+               }
+             });
+  }
+
+  //==========================================================================
+  // Draw-order sorting, descending depth
+  //==========================================================================
+  AddBatch(registry, "Sort/RadixSort", kSortCount, [](State &state) {
+    const std::vector<float> &keys = GetSortKeys();
+    RadixSort sorter;
+    while (state.KeepRunning()) {
+      DoNotOptimize(sorter.Sort(keys.data(), kSortCount,
+                                SortOrder::Descending)
+                        .data());
+      ClobberMemory();
+    }
+  });
+  AddBatch(registry, "Sort/StableSort", kSortCount, [](State &state) {
+    const std::vector<float> &keys = GetSortKeys();
+    std::vector<uint32_t> indices(kSortCount);
+    while (state.KeepRunning()) {
+      std::iota(indices.begin(), indices.end(), 0u);
+      std::stable_sort(indices.begin(), indices.end(),
+                       [&keys](uint32_t a, uint32_t b) {
+                         return keys[a] > keys[b];
+                       });
+      ClobberMemory();
+    }
+  });
+}
+
+} // namespace Bench
+} // namespace Engine
\ No newline at end of file
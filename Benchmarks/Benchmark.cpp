@@ -0,0 +1,257 @@
+#include "Benchmark.h"
+#include "Fixture.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+
+#ifndef ENGINE_BENCH_BUILD_TYPE
+#define ENGINE_BENCH_BUILD_TYPE "Unknown"
+#endif
+
+namespace Engine {
+namespace Bench {
+
+#if defined(_MSC_VER) && !defined(__clang__)
+namespace Detail {
+void UseCharPointer(const volatile char *) {}
+} // namespace Detail
+#endif
+
+namespace {
+
+// Stops calibration of a benchmark whose body is too cheap to measure, or
+// that returns from KeepRunning() early
+const uint64_t kMaxIterations = 1000000000;
+
+double TimeIterations(const Benchmark &benchmark, uint64_t iterations,
+                      uint64_t &itemsPerIteration) {
+  State state(iterations);
+  benchmark.Function(state);
+  itemsPerIteration = state.GetItemsPerIteration();
+  return state.GetElapsedNanoseconds();
+}
+
+// Smallest iteration count whose run takes at least the minimum time
+uint64_t Calibrate(const Benchmark &benchmark, double minTimeNs) {
+  uint64_t iterations = 1;
+  for (;;) {
+    uint64_t items = 1;
+    double elapsed = TimeIterations(benchmark, iterations, items);
+    if (elapsed >= minTimeNs || iterations >= kMaxIterations) {
+      return iterations;
+    }
+    // Aim 20% past the target, growing at most 10x per step so a short
+    // run that the timer barely saw can't overshoot
+    double scale = elapsed > 0.0 ? minTimeNs * 1.2 / elapsed : 10.0;
+    scale = std::min(std::max(scale, 2.0), 10.0);
+    iterations = std::min(
+        kMaxIterations,
+        static_cast<uint64_t>(static_cast<double>(iterations) * scale));
+  }
+}
+
+Result RunBenchmark(const Benchmark &benchmark, const RunOptions &options) {
+  Result result;
+  result.Name = benchmark.Name;
+  result.Iterations = Calibrate(benchmark, options.MinTimeSeconds * 1e9);
+
+  double warmup = 0.0;
+  while (warmup < options.WarmupSeconds * 1e9) {
+    uint64_t items = 1;
+    warmup += TimeIterations(benchmark, result.Iterations, items);
+  }
+
+  for (int i = 0; i < std::max(options.Repetitions, 1); ++i) {
+    double elapsed = TimeIterations(benchmark, result.Iterations,
+                                    result.ItemsPerIteration);
+    result.Samples.push_back(
+        elapsed / (static_cast<double>(result.Iterations) *
+                   static_cast<double>(result.ItemsPerIteration)));
+  }
+  result.Stats = Summarize(result.Samples);
+  return result;
+}
+
+// Items per second at the median, e.g. "412.5 M"
+std::string Rate(double nanosecondsPerItem) {
+  if (nanosecondsPerItem <= 0.0) {
+    return "-";
+  }
+  double rate = 1e9 / nanosecondsPerItem;
+  const char *units[] = {"", "k", "M", "G", "T"};
+  int unit = 0;
+  for (; rate >= 1000.0 && unit < 4; ++unit) {
+    rate /= 1000.0;
+  }
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.1f %s", rate, units[unit]);
+  return buffer;
+}
+
+void PrintHeader() {
+  std::printf("%-44s %12s %10s %10s %10s %10s %7s %9s\n", "Benchmark",
+              "Iterations", "Median", "Min", "Mean", "StdDev", "CV",
+              "Items/s");
+  std::printf("%s\n", std::string(44 + 13 + 4 * 11 + 8 + 10, '-').c_str());
+}
+
+void PrintRow(const Result &result) {
+  const Statistics &stats = result.Stats;
+  std::printf(
+      "%-44s %12llu %7.2f ns %7.2f ns %7.2f ns %7.2f ns %6.2f%% %9s\n",
+      result.Name.c_str(), static_cast<unsigned long long>(result.Iterations),
+      stats.Median, stats.Min, stats.Mean, stats.StdDev, stats.CV * 100.0,
+      Rate(stats.Median).c_str());
+  std::fflush(stdout);
+}
+
+std::string CompilerName() {
+#if defined(__clang__)
+  return std::string("Clang ") + __clang_version__;
+#elif defined(__GNUC__)
+  return std::string("GCC ") + __VERSION__;
+#elif defined(_MSC_VER)
+  return "MSVC " + std::to_string(_MSC_FULL_VER);
+#else
+  return "Unknown";
+#endif
+}
+
+std::string UtcTimestamp() {
+  std::time_t now = std::time(nullptr);
+  std::tm utc = {};
+#if defined(_WIN32)
+  gmtime_s(&utc, &now);
+#else
+  gmtime_r(&now, &utc);
+#endif
+  char buffer[32];
+  std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &utc);
+  return buffer;
+}
+
+std::string Quoted(const std::string &text) {
+  std::string quoted = "\"";
+  for (char c : text) {
+    if (c == '"' || c == '\\') {
+      quoted += '\\';
+    }
+    quoted += c;
+  }
+  return quoted + "\"";
+}
+
+std::string Number(double value) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.4f", value);
+  return buffer;
+}
+
+} // namespace
+
+Statistics Summarize(std::vector<double> samples) {
+  Statistics stats;
+  if (samples.empty()) {
+    return stats;
+  }
+
+  std::sort(samples.begin(), samples.end());
+  size_t count = samples.size();
+  stats.Min = samples.front();
+  stats.Max = samples.back();
+  stats.Median = count % 2 ? samples[count / 2]
+                            : 0.5 * (samples[count / 2 - 1] +
+                                     samples[count / 2]);
+
+  double sum = 0.0;
+  for (double sample : samples) {
+    sum += sample;
+  }
+  stats.Mean = sum / static_cast<double>(count);
+
+  // Sample standard deviation; zero for a single repetition
+  if (count > 1) {
+    double squares = 0.0;
+    for (double sample : samples) {
+      squares += (sample - stats.Mean) * (sample - stats.Mean);
+    }
+    stats.StdDev = std::sqrt(squares / static_cast<double>(count - 1));
+  }
+  stats.CV = stats.Mean > 0.0 ? stats.StdDev / stats.Mean : 0.0;
+  return stats;
+}
+
+std::vector<Result> Run(const Registry &registry, const RunOptions &options) {
+  std::vector<Result> results;
+  PrintHeader();
+  for (const Benchmark &benchmark : registry.GetBenchmarks()) {
+    if (benchmark.Name.find(options.Filter) == std::string::npos) {
+      continue;
+    }
+    results.push_back(RunBenchmark(benchmark, options));
+    PrintRow(results.back());
+  }
+  return results;
+}
+
+bool WriteJson(const std::string &path, const std::vector<Result> &results,
+               const RunOptions &options) {
+  std::ofstream file(path);
+  if (!file) {
+    return false;
+  }
+
+  std::string levels;
+  for (const Math::MathKernelTable *table : AvailableKernelTables()) {
+    levels += (levels.empty() ? "" : ", ") +
+              Quoted(Math::GetSimdLevelName(table->Level));
+  }
+
+  file << "{\n";
+  file << "  \"context\": {\n";
+  file << "    \"date\": " << Quoted(UtcTimestamp()) << ",\n";
+  file << "    \"compiler\": " << Quoted(CompilerName()) << ",\n";
+  file << "    \"build_type\": " << Quoted(ENGINE_BENCH_BUILD_TYPE) << ",\n";
+  file << "    \"simd_level\": "
+       << Quoted(Math::GetSimdLevelName(Math::MathKernels::GetLevel()))
+       << ",\n";
+  file << "    \"kernel_levels\": [" << levels << "],\n";
+  file << "    \"repetitions\": " << options.Repetitions << ",\n";
+  file << "    \"min_time_seconds\": " << Number(options.MinTimeSeconds)
+       << ",\n";
+  file << "    \"warmup_seconds\": " << Number(options.WarmupSeconds)
+       << ",\n";
+  file << "    \"time_unit\": \"ns\"\n";
+  file << "  },\n";
+
+  file << "  \"benchmarks\": [";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const Result &result = results[i];
+    const Statistics &stats = result.Stats;
+    file << (i ? ",\n" : "\n") << "    {\n";
+    file << "      \"name\": " << Quoted(result.Name) << ",\n";
+    file << "      \"iterations\": " << result.Iterations << ",\n";
+    file << "      \"items_per_iteration\": " << result.ItemsPerIteration
+         << ",\n";
+    file << "      \"min\": " << Number(stats.Min) << ",\n";
+    file << "      \"median\": " << Number(stats.Median) << ",\n";
+    file << "      \"mean\": " << Number(stats.Mean) << ",\n";
+    file << "      \"stddev\": " << Number(stats.StdDev) << ",\n";
+    file << "      \"max\": " << Number(stats.Max) << ",\n";
+    file << "      \"cv\": " << Number(stats.CV) << ",\n";
+    file << "      \"items_per_second\": "
+         << Number(stats.Median > 0.0 ? 1e9 / stats.Median : 0.0) << ",\n";
+    file << "      \"samples\": [";
+    for (size_t j = 0; j < result.Samples.size(); ++j) {
+      file << (j ? ", " : "") << Number(result.Samples[j]);
+    }
+    file << "]\n    }";
+  }
+  file << "\n  ]\n}\n";
+  return static_cast<bool>(file);
+}
+
+} // namespace Bench
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,168 @@
+#pragma once
+
+// Microbenchmark harness for the math library. Each benchmark is a function
+// that runs its body once per State::KeepRunning() iteration; the runner
+// calibrates an iteration count that fills the minimum sample time, runs a
+// warmup pass, then times a number of repetitions and reports statistics
+// of the per-item time. DoNotOptimize() and ClobberMemory() keep the
+// compiler from deleting or hoisting the work being measured.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace Engine {
+namespace Bench {
+
+//============================================================================
+// Optimization barriers
+//============================================================================
+#if defined(_MSC_VER) && !defined(__clang__)
+namespace Detail {
+// Defined in Benchmark.cpp so the optimizer can't see that it does nothing
+void UseCharPointer(const volatile char *pointer);
+} // namespace Detail
+
+// Forces 'value' to be computed and treated as read
+template <typename T> inline void DoNotOptimize(const T &value) {
+  Detail::UseCharPointer(&reinterpret_cast<const volatile char &>(value));
+  _ReadWriteBarrier();
+}
+
+// Forces every pending store to memory and every later load to reread it
+inline void ClobberMemory() { _ReadWriteBarrier(); }
+#else
+// Small trivially copyable results stay in a register; anything larger is
+// spilled, which costs the same store for every benchmark that returns it
+template <typename T> inline void DoNotOptimize(const T &value) {
+  if constexpr (sizeof(T) <= sizeof(void *) &&
+                std::is_trivially_copyable<T>::value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+  } else {
+    asm volatile("" : : "m"(value) : "memory");
+  }
+}
+
+inline void ClobberMemory() { asm volatile("" : : : "memory"); }
+#endif
+
+//============================================================================
+// State - One timed run of a benchmark
+//============================================================================
+class State {
+public:
+  explicit State(uint64_t iterations) : m_Remaining(iterations) {}
+
+  // True while iterations remain. The first call starts the clock and the
+  // last one stops it, so setup before the loop is not timed.
+  bool KeepRunning() {
+    if (!m_Started) {
+      m_Started = true;
+      m_Start = Clock::now();
+    }
+    if (m_Remaining != 0) {
+      --m_Remaining;
+      return true;
+    }
+    m_Elapsed = Clock::now() - m_Start;
+    return false;
+  }
+
+  // Elements each iteration processes, for batch kernels; results are
+  // reported per element
+  void SetItemsPerIteration(uint64_t items) { m_ItemsPerIteration = items; }
+  uint64_t GetItemsPerIteration() const { return m_ItemsPerIteration; }
+
+  double GetElapsedNanoseconds() const {
+    return std::chrono::duration<double, std::nano>(m_Elapsed).count();
+  }
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  uint64_t m_Remaining;
+  uint64_t m_ItemsPerIteration = 1;
+  bool m_Started = false;
+  Clock::time_point m_Start;
+  Clock::duration m_Elapsed{};
+};
+
+//============================================================================
+// Registry - Every benchmark the executable knows about
+//============================================================================
+struct Benchmark {
+  std::string Name;
+  std::function<void(State &)> Function;
+};
+
+class Registry {
+public:
+  void Add(std::string name, std::function<void(State &)> function) {
+    m_Benchmarks.push_back({std::move(name), std::move(function)});
+  }
+
+  const std::vector<Benchmark> &GetBenchmarks() const {
+    return m_Benchmarks;
+  }
+
+private:
+  std::vector<Benchmark> m_Benchmarks;
+};
+
+//============================================================================
+// Running and reporting
+//============================================================================
+struct RunOptions {
+  // Only benchmarks whose name contains this run; empty runs them all
+  std::string Filter;
+  // Timed repetitions per benchmark after the warmup
+  int Repetitions = 10;
+  // Each repetition runs enough iterations to take at least this long
+  double MinTimeSeconds = 0.05;
+  // Untimed running before the first repetition, to settle clocks and
+  // caches
+  double WarmupSeconds = 0.05;
+};
+
+// Summary of nanoseconds per item over the repetitions
+struct Statistics {
+  double Min = 0.0;
+  double Median = 0.0;
+  double Mean = 0.0;
+  double StdDev = 0.0;
+  double Max = 0.0;
+  // StdDev / Mean; above a few percent the machine was noisy
+  double CV = 0.0;
+};
+
+struct Result {
+  std::string Name;
+  uint64_t Iterations = 0;
+  uint64_t ItemsPerIteration = 1;
+  std::vector<double> Samples;
+  Statistics Stats;
+};
+
+Statistics Summarize(std::vector<double> samples);
+
+// Runs the benchmarks matching the filter in registration order, printing
+// a table row on stdout as each one finishes
+std::vector<Result> Run(const Registry &registry, const RunOptions &options);
+
+// The results and the build that produced them (compiler, build type,
+// kernel level) as JSON, for comparing runs across flags and machines.
+// Returns false if the file can't be written.
+bool WriteJson(const std::string &path, const std::vector<Result> &results,
+               const RunOptions &options);
+
+} // namespace Bench
+} // namespace Engine
\ No newline at end of file
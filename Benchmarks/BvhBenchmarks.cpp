@@ -0,0 +1,179 @@
+#include "Fixture.h"
+#include "Math/Bvh.h"
+#include "Math/Random.h"
+
+// BVH build, refit and query costs on a 1M-object scene: half the boxes in
+// sixteen tight clusters, the rest spread uniformly. Build and refit count
+// objects per second, the ray rows rays per second, and Cull one frustum
+// per item. Random rays cross the whole scene in arbitrary directions and
+// miss the cache on almost every node; primary rays come from a pinhole
+// camera in scanline order, so neighbours walk the same nodes.
+
+namespace Engine {
+namespace Bench {
+
+using namespace Engine::Math;
+
+namespace {
+
+const size_t kObjectCount = 1000000;
+const size_t kRayCount = 4096;
+const float kRange = 1000.0f;
+
+struct BvhScene {
+  std::vector<AABB> boxes;
+  std::vector<Ray> randomRays;
+  std::vector<Ray> primaryRays;
+  std::vector<Frustum> frustums;
+  Bvh4 bvh4;
+  Bvh8 bvh8;
+};
+
+Vec3 RandomPoint(Pcg32 &random, float range) {
+  return Vec3(random.NextFloat(-range, range), random.NextFloat(-range, range),
+              random.NextFloat(-range, range));
+}
+
+const BvhScene &GetBvhScene() {
+  static const BvhScene scene = []() {
+    BvhScene s;
+    Pcg32 random(47);
+    std::vector<Vec3> clusters(16);
+    for (Vec3 &center : clusters) {
+      center = RandomPoint(random, kRange);
+    }
+    s.boxes.resize(kObjectCount);
+    for (size_t i = 0; i < kObjectCount; ++i) {
+      Vec3 center = i % 2 == 0 ? clusters[i % clusters.size()] +
+                                     RandomPoint(random, kRange * 0.05f)
+                               : RandomPoint(random, kRange);
+      Vec3 half(random.NextFloat(0.01f, 0.5f), random.NextFloat(0.01f, 0.5f),
+                random.NextFloat(0.01f, 0.5f));
+      s.boxes[i] = AABB(center - half, center + half);
+    }
+
+    for (size_t i = 0; i < kRayCount; ++i) {
+      Vec3 origin = RandomPoint(random, kRange);
+      s.randomRays.push_back(Ray(origin, RandomPoint(random, kRange) - origin));
+    }
+    // 64 x 64 pixels looking down +z over the whole scene
+    const Vec3 eye(0.0f, 0.0f, -2.0f * kRange);
+    for (size_t y = 0; y < 64; ++y) {
+      for (size_t x = 0; x < 64; ++x) {
+        Vec3 target((x + 0.5f) / 32.0f - 1.0f, (y + 0.5f) / 32.0f - 1.0f,
+                    0.0f);
+        s.primaryRays.push_back(Ray(eye, target * kRange - eye));
+      }
+    }
+    for (size_t i = 0; i < Fixture::kSize; ++i) {
+      Vec3 eye = RandomPoint(random, kRange);
+      Mat4 view = Mat4::LookAt(eye, RandomPoint(random, kRange), Vec3::Up());
+      Mat4 projection =
+          Mat4::Perspective(ToRadians(60.0f), 1.5f, 0.1f, kRange * 1.5f);
+      s.frustums.push_back(Frustum::FromMatrix(projection * view));
+    }
+
+    s.bvh4.Build(s.boxes);
+    s.bvh8.Build(s.boxes);
+    return s;
+  }();
+  return scene;
+}
+
+template <int Width> const Bvh<Width> &Tree(const BvhScene &scene);
+template <> const Bvh4 &Tree<4>(const BvhScene &scene) { return scene.bvh4; }
+template <> const Bvh8 &Tree<8>(const BvhScene &scene) { return scene.bvh8; }
+
+template <int Width>
+void AddBuild(Registry &registry, const std::string &name,
+              BvhBuilder builder) {
+  registry.Add(name, [builder](State &state) {
+    const BvhScene &scene = GetBvhScene();
+    BvhBuildSettings settings;
+    settings.Builder = builder;
+    Bvh<Width> bvh;
+    state.SetItemsPerIteration(kObjectCount);
+    while (state.KeepRunning()) {
+      bvh.Build(scene.boxes, settings);
+      DoNotOptimize(bvh.GetNodes().data());
+    }
+  });
+}
+
+template <int Width>
+void AddRefit(Registry &registry, const std::string &name) {
+  registry.Add(name, [](State &state) {
+    const BvhScene &scene = GetBvhScene();
+    Bvh<Width> bvh = Tree<Width>(scene);
+    state.SetItemsPerIteration(kObjectCount);
+    while (state.KeepRunning()) {
+      bvh.Refit(scene.boxes);
+      DoNotOptimize(bvh.GetNodes().data());
+    }
+  });
+}
+
+template <int Width>
+void AddCull(Registry &registry, const std::string &name) {
+  registry.Add(name, [](State &state) {
+    const BvhScene &scene = GetBvhScene();
+    std::vector<uint32_t> visible(kObjectCount);
+    size_t i = 0;
+    while (state.KeepRunning()) {
+      DoNotOptimize(Tree<Width>(scene).Cull(scene.frustums[i], visible));
+      i = (i + 1) & (Fixture::kSize - 1);
+    }
+  });
+}
+
+template <int Width>
+void AddRaycast(Registry &registry, const std::string &name,
+                std::vector<Ray> BvhScene::*rays, RayQuery query) {
+  registry.Add(name, [rays, query](State &state) {
+    const BvhScene &scene = GetBvhScene();
+    std::vector<RayHit> hits(kRayCount);
+    state.SetItemsPerIteration(kRayCount);
+    while (state.KeepRunning()) {
+      for (RayHit &hit : hits) {
+        hit = RayHit();
+      }
+      Tree<Width>(scene).Raycast(scene.*rays, hits, query);
+      DoNotOptimize(hits[0].T);
+    }
+  });
+}
+
+} // namespace
+
+void RegisterBvhBenchmarks(Registry &registry) {
+  //==========================================================================
+  // Build and refit
+  //==========================================================================
+  AddBuild<4>(registry, "Bvh/Build/SAH/Bvh4", BvhBuilder::BinnedSah);
+  AddBuild<8>(registry, "Bvh/Build/SAH/Bvh8", BvhBuilder::BinnedSah);
+  AddBuild<4>(registry, "Bvh/Build/Morton/Bvh4", BvhBuilder::Morton);
+  AddBuild<8>(registry, "Bvh/Build/Morton/Bvh8", BvhBuilder::Morton);
+  AddRefit<4>(registry, "Bvh/Refit/Bvh4");
+  AddRefit<8>(registry, "Bvh/Refit/Bvh8");
+
+  //==========================================================================
+  // Queries
+  //==========================================================================
+  AddCull<4>(registry, "Bvh/Cull/Bvh4");
+  AddCull<8>(registry, "Bvh/Cull/Bvh8");
+  AddRaycast<4>(registry, "Bvh/Raycast/Random/Closest/Bvh4",
+                &BvhScene::randomRays, RayQuery::Closest);
+  AddRaycast<8>(registry, "Bvh/Raycast/Random/Closest/Bvh8",
+                &BvhScene::randomRays, RayQuery::Closest);
+  AddRaycast<8>(registry, "Bvh/Raycast/Random/Any/Bvh8",
+                &BvhScene::randomRays, RayQuery::Any);
+  AddRaycast<4>(registry, "Bvh/Raycast/Primary/Closest/Bvh4",
+                &BvhScene::primaryRays, RayQuery::Closest);
+  AddRaycast<8>(registry, "Bvh/Raycast/Primary/Closest/Bvh8",
+                &BvhScene::primaryRays, RayQuery::Closest);
+  AddRaycast<8>(registry, "Bvh/Raycast/Primary/Any/Bvh8",
+                &BvhScene::primaryRays, RayQuery::Any);
+}
+
+} // namespace Bench
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include "Fixture.h"
+#include <random>
+
+namespace Engine {
+namespace Bench {
+
+using namespace Engine::Math;
+
+namespace {
+
+Fixture MakeFixture() {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+  std::uniform_real_distribution<float> angle(-PI, PI);
+  std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+  std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+  std::normal_distribution<float> gaussian(0.0f, 1.0f);
+
+  auto randomVec3 = [&]() {
+    return Vec3(coordinate(rng), coordinate(rng), coordinate(rng));
+  };
+  auto randomUnitVec3 = [&]() {
+    return Vec3(gaussian(rng), gaussian(rng), gaussian(rng)).Normalized();
+  };
+  auto randomRotation = [&]() {
+    return Quaternion(gaussian(rng), gaussian(rng), gaussian(rng),
+                      gaussian(rng))
+        .Normalized();
+  };
+
+  Fixture fixture;
+  for (size_t i = 0; i < Fixture::kSize; ++i) {
+    fixture.scalars.push_back(unit(rng));
+    fixture.angles.push_back(angle(rng));
+    fixture.vec2A.push_back(Vec2(coordinate(rng), coordinate(rng)));
+    fixture.vec2B.push_back(Vec2(coordinate(rng), coordinate(rng)));
+    fixture.vec3A.push_back(randomVec3());
+    fixture.vec3B.push_back(randomVec3());
+    fixture.normals.push_back(randomUnitVec3());
+    fixture.vec4A.push_back(Vec4(randomVec3(), coordinate(rng)));
+    fixture.vec4B.push_back(Vec4(randomVec3(), coordinate(rng)));
+    fixture.quatA.push_back(randomRotation());
+    fixture.quatB.push_back(randomRotation());
+
+    Transform transform(randomVec3(), randomRotation(),
+                        Vec3(scale(rng), scale(rng), scale(rng)));
+    fixture.transforms.push_back(transform);
+    fixture.affines.push_back(transform.ToAffine());
+    fixture.matrixA.push_back(transform.ToMatrix());
+    fixture.matrixB.push_back(
+        Transform(randomVec3(), randomRotation(), Vec3(scale(rng)))
+            .ToMatrix());
+
+    Vec3 center = randomVec3();
+    Vec3 extents(scale(rng) * 5.0f, scale(rng) * 5.0f, scale(rng) * 5.0f);
+    fixture.boxes.push_back(AABB(center - extents, center + extents));
+    fixture.spheres.push_back(Sphere(randomVec3(), scale(rng) * 5.0f));
+
+    // Aimed near this box so a good share of the ray tests hit
+    Vec3 origin = randomUnitVec3() * 10.0f;
+    fixture.rays.push_back(
+        Ray(origin, (center + randomUnitVec3() * 4.0f - origin).Normalized()));
+    fixture.inverseDirections.push_back(fixture.rays.back().InverseDirection());
+
+    Vec3 corner = randomVec3();
+    fixture.triangles.push_back(corner);
+    fixture.triangles.push_back(corner + randomUnitVec3() * 20.0f);
+    fixture.triangles.push_back(corner + randomUnitVec3() * 20.0f);
+  }
+
+  fixture.viewProjection =
+      Mat4::Perspective(ToRadians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f) *
+      Mat4::LookAt(Vec3(10.0f, 20.0f, 150.0f), Vec3::Zero(),
+                   Vec3(0.0f, 1.0f, 0.0f));
+  fixture.frustum = Frustum::FromMatrix(fixture.viewProjection);
+  return fixture;
+}
+
+} // namespace
+
+const Fixture &GetFixture() {
+  static const Fixture fixture = MakeFixture();
+  return fixture;
+}
+
+std::vector<const MathKernelTable *> AvailableKernelTables() {
+  static const SimdLevel levels[] = {SimdLevel::Scalar, SimdLevel::SSE2,
+                                     SimdLevel::SSE41, SimdLevel::AVX2,
+                                     SimdLevel::AVX512};
+  std::vector<const MathKernelTable *> tables;
+  for (SimdLevel level : levels) {
+    if (const MathKernelTable *table = MathKernels::GetTable(level)) {
+      tables.push_back(table);
+    }
+  }
+  return tables;
+}
+
+} // namespace Bench
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+// Shared inputs for the math benchmarks: kSize random values of every type,
+// generated once from a fixed seed so runs compare like for like. Per-call
+// benchmarks step through the arrays one element per iteration, which keeps
+// the inputs in L1 but stops the compiler from hoisting the work out of the
+// loop. They measure throughput of independent calls, not latency.
+
+#include "Benchmark.h"
+#include "Math/Math.h"
+#include <string>
+#include <vector>
+
+namespace Engine {
+namespace Bench {
+
+struct Fixture {
+  static constexpr size_t kSize = 1024;
+
+  std::vector<float> scalars; // In [0, 1], for Lerp/Slerp factors
+  std::vector<float> angles;  // In [-pi, pi]
+  std::vector<Math::Vec2> vec2A, vec2B;
+  std::vector<Math::Vec3> vec3A, vec3B; // Components in [-100, 100]
+  std::vector<Math::Vec3> normals;      // Unit length
+  std::vector<Math::Vec4> vec4A, vec4B;
+  std::vector<Math::Mat4> matrixA, matrixB; // Invertible TRS products
+  std::vector<Math::Quaternion> quatA, quatB; // Unit length
+  std::vector<Math::Transform> transforms;
+  std::vector<Math::Affine3x4> affines;
+  std::vector<Math::AABB> boxes;
+  std::vector<Math::Sphere> spheres;
+  std::vector<Math::Ray> rays; // rays[i] is aimed near boxes[i]
+  std::vector<Math::Vec3> inverseDirections; // Of the rays
+  std::vector<Math::Vec3> triangles; // kSize triangles, three vertices each
+  Math::Mat4 viewProjection;
+  Math::Frustum frustum;
+};
+
+const Fixture &GetFixture();
+
+// Kernel tables this build and CPU can run, scalar first
+std::vector<const Math::MathKernelTable *> AvailableKernelTables();
+
+// Registers a benchmark that calls 'operation(fixture, i)' once per
+// iteration with i cycling through the fixture, and consumes its result
+template <typename Operation>
+void AddPerCall(Registry &registry, const std::string &name,
+                Operation operation) {
+  registry.Add(name, [operation](State &state) {
+    const Fixture &fixture = GetFixture();
+    size_t i = 0;
+    while (state.KeepRunning()) {
+      DoNotOptimize(operation(fixture, i));
+      i = (i + 1) & (Fixture::kSize - 1);
+    }
+  });
+}
+
+// Shorthand for AddPerCall; 'expression' sees the fixture as 'f' and the
+// element index as 'i'
+#define BENCHMARK_PER_CALL(registry, name, expression)                         \
+  ::Engine::Bench::AddPerCall(                                                 \
+      registry, name,                                                          \
+      [](const ::Engine::Bench::Fixture &f, size_t i) { return expression; })
+
+void RegisterVectorBenchmarks(Registry &registry);
+void RegisterMatrixBenchmarks(Registry &registry);
+void RegisterQuaternionBenchmarks(Registry &registry);
+void RegisterGeometryBenchmarks(Registry &registry);
+void RegisterKernelBenchmarks(Registry &registry);
+void RegisterBatchBenchmarks(Registry &registry);
+void RegisterNoiseBenchmarks(Registry &registry);
+void RegisterBvhBenchmarks(Registry &registry);
+void RegisterSpatialBenchmarks(Registry &registry);
+void RegisterSceneBenchmarks(Registry &registry);
+#ifdef ENGINE_BENCH_GLM
+void RegisterGlmBenchmarks(Registry &registry);
+#endif
+
+} // namespace Bench
+} // namespace Engine
\ No newline at end of file
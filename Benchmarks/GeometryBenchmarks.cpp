@@ -0,0 +1,98 @@
+#include "Fixture.h"
+
+namespace Engine {
+namespace Bench {
+
+using namespace Engine::Math;
+
+namespace {
+
+// Hit distance, or -1 for a miss, so both outcomes produce a value
+template <typename Test> float HitDistance(Test test) {
+  float t = 0.0f;
+  return test(t) ? t : -1.0f;
+}
+
+} // namespace
+
+void RegisterGeometryBenchmarks(Registry &registry) {
+  //==========================================================================
+  // AABB and Sphere
+  //==========================================================================
+  BENCHMARK_PER_CALL(registry, "AABB/Center", f.boxes[i].Center());
+  BENCHMARK_PER_CALL(registry, "AABB/Extents", f.boxes[i].Extents());
+  BENCHMARK_PER_CALL(registry, "AABB/Contains",
+                     f.boxes[i].Contains(f.vec3A[i] * 0.1f));
+  BENCHMARK_PER_CALL(registry, "AABB/Intersects",
+                     f.boxes[i].Intersects(
+                         f.boxes[(i + 1) & (Fixture::kSize - 1)]));
+  BENCHMARK_PER_CALL(registry, "AABB/Transformed",
+                     f.boxes[i].Transformed(f.matrixA[i]));
+  BENCHMARK_PER_CALL(registry, "Sphere/Contains",
+                     f.spheres[i].Contains(f.vec3A[i] * 0.1f));
+  BENCHMARK_PER_CALL(registry, "Sphere/IntersectsSphere",
+                     f.spheres[i].Intersects(
+                         f.spheres[(i + 1) & (Fixture::kSize - 1)]));
+  BENCHMARK_PER_CALL(registry, "Sphere/IntersectsAABB",
+                     f.spheres[i].Intersects(f.boxes[i]));
+
+  //==========================================================================
+  // Frustum
+  //==========================================================================
+  BENCHMARK_PER_CALL(registry, "Frustum/FromMatrix",
+                     Frustum::FromMatrix(f.matrixA[i]));
+  BENCHMARK_PER_CALL(registry, "Frustum/Contains",
+                     f.frustum.Contains(f.vec3A[i]));
+  BENCHMARK_PER_CALL(registry, "Frustum/IntersectsSphere",
+                     f.frustum.Intersects(f.spheres[i]));
+  BENCHMARK_PER_CALL(registry, "Frustum/IntersectsAABB",
+                     f.frustum.Intersects(f.boxes[i]));
+
+  //==========================================================================
+  // Ray
+  //==========================================================================
+  BENCHMARK_PER_CALL(registry, "Ray/At", f.rays[i].At(f.scalars[i]));
+  BENCHMARK_PER_CALL(registry, "Ray/InverseDirection",
+                     f.rays[i].InverseDirection());
+  BENCHMARK_PER_CALL(registry, "Ray/IntersectSphere",
+                     HitDistance([&](float &t) {
+                       return f.rays[i].IntersectSphere(f.spheres[i], t);
+                     }));
+  BENCHMARK_PER_CALL(registry, "Ray/IntersectAABB",
+                     HitDistance([&](float &t) {
+                       return f.rays[i].IntersectAABB(f.boxes[i], t);
+                     }));
+  BENCHMARK_PER_CALL(registry, "Ray/IntersectAABBPrecomputed",
+                     HitDistance([&](float &t) {
+                       return f.rays[i].IntersectAABB(
+                           f.boxes[i], f.inverseDirections[i], t);
+                     }));
+  BENCHMARK_PER_CALL(registry, "Ray/IntersectTriangle",
+                     HitDistance([&](float &t) {
+                       return f.rays[i].IntersectTriangle(
+                           f.triangles[3 * i], f.triangles[3 * i + 1],
+                           f.triangles[3 * i + 2], t);
+                     }));
+
+  //==========================================================================
+  // Transform
+  //==========================================================================
+  BENCHMARK_PER_CALL(registry, "Transform/ToAffine",
+                     f.transforms[i].ToAffine());
+  BENCHMARK_PER_CALL(registry, "Transform/ToMatrix",
+                     f.transforms[i].ToMatrix());
+  BENCHMARK_PER_CALL(registry, "Transform/TransformPoint",
+                     f.transforms[i].TransformPoint(f.vec3A[i]));
+  BENCHMARK_PER_CALL(registry, "Transform/InverseTransformPoint",
+                     f.transforms[i].InverseTransformPoint(f.vec3A[i]));
+  BENCHMARK_PER_CALL(registry, "Transform/Inverse",
+                     f.transforms[i].Inverse());
+  BENCHMARK_PER_CALL(registry, "Transform/Lerp",
+                     Transform::Lerp(f.transforms[i],
+                                     f.transforms[(i + 1) &
+                                                  (Fixture::kSize - 1)],
+                                     f.scalars[i]));
+}
+
+} // namespace Bench
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,160 @@
+#include "Fixture.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// The same workloads through Engine::Math and GLM, as "Compare/<workload>/
+// Engine" and "Compare/<workload>/GLM", so each pair sits side by side in
+// the table and the JSON. GLM is in its default configuration, as
+// ThirdParty/CMakeLists.txt fetches it. Tests/GlmParityTests.cpp checks
+// that the pairs agree numerically.
+
+namespace Engine {
+namespace Bench {
+
+using namespace Engine::Math;
+
+namespace {
+
+// glm::mat4 indexes columns first: glm[c][r] is Mat4::m[r][c]
+glm::vec3 ToGlm(const Vec3 &v) { return glm::vec3(v.x, v.y, v.z); }
+
+glm::quat ToGlm(const Quaternion &q) {
+  glm::quat result;
+  result.x = q.x;
+  result.y = q.y;
+  result.z = q.z;
+  result.w = q.w;
+  return result;
+}
+
+glm::mat4 ToGlm(const Mat4 &m) {
+  glm::mat4 result(1.0f);
+  for (int row = 0; row < 4; ++row) {
+    for (int col = 0; col < 4; ++col) {
+      result[col][row] = m.m[row][col];
+    }
+  }
+  return result;
+}
+
+// The fixture's values converted once to GLM types
+struct GlmFixture {
+  std::vector<glm::vec3> vec3A, vec3B, scales;
+  std::vector<glm::quat> quatA, quatB;
+  std::vector<glm::mat4> matrixA, matrixB;
+  glm::mat4 viewProjection;
+};
+
+const GlmFixture &GetGlmFixture() {
+  static const GlmFixture fixture = []() {
+    const Fixture &f = GetFixture();
+    GlmFixture g;
+    for (size_t i = 0; i < Fixture::kSize; ++i) {
+      g.vec3A.push_back(ToGlm(f.vec3A[i]));
+      g.vec3B.push_back(ToGlm(f.vec3B[i]));
+      g.scales.push_back(ToGlm(f.transforms[i].scale));
+      g.quatA.push_back(ToGlm(f.quatA[i]));
+      g.quatB.push_back(ToGlm(f.quatB[i]));
+      g.matrixA.push_back(ToGlm(f.matrixA[i]));
+      g.matrixB.push_back(ToGlm(f.matrixB[i]));
+    }
+    g.viewProjection = ToGlm(f.viewProjection);
+    return g;
+  }();
+  return fixture;
+}
+
+// Like BENCHMARK_PER_CALL, with the GLM fixture as 'g'
+#define GLM_BENCHMARK_PER_CALL(registry, name, expression)                    \
+  AddPerCall(registry, name, [](const Fixture &, size_t i) {                   \
+    const GlmFixture &g = GetGlmFixture();                                     \
+    return expression;                                                         \
+  })
+
+const size_t kBatchCount = 4096;
+
+} // namespace
+
+void RegisterGlmBenchmarks(Registry &registry) {
+  GetGlmFixture();
+
+  BENCHMARK_PER_CALL(registry, "Compare/TRS/Engine",
+                     f.transforms[i].ToMatrix());
+  GLM_BENCHMARK_PER_CALL(registry, "Compare/TRS/GLM",
+                         glm::translate(glm::mat4(1.0f), g.vec3A[i]) *
+                             glm::mat4_cast(g.quatA[i]) *
+                             glm::scale(glm::mat4(1.0f), g.scales[i]));
+
+  BENCHMARK_PER_CALL(registry, "Compare/Multiply/Engine",
+                     f.matrixA[i] * f.matrixB[i]);
+  GLM_BENCHMARK_PER_CALL(registry, "Compare/Multiply/GLM",
+                         g.matrixA[i] * g.matrixB[i]);
+
+  BENCHMARK_PER_CALL(registry, "Compare/Inverse/Engine",
+                     f.matrixA[i].Inverted());
+  GLM_BENCHMARK_PER_CALL(registry, "Compare/Inverse/GLM",
+                         glm::inverse(g.matrixA[i]));
+
+  BENCHMARK_PER_CALL(registry, "Compare/LookAt/Engine",
+                     Mat4::LookAt(f.vec3A[i], f.vec3B[i], Vec3::Up()));
+  GLM_BENCHMARK_PER_CALL(registry, "Compare/LookAt/GLM",
+                         glm::lookAt(g.vec3A[i], g.vec3B[i],
+                                     glm::vec3(0.0f, 1.0f, 0.0f)));
+
+  BENCHMARK_PER_CALL(registry, "Compare/Perspective/Engine",
+                     Mat4::Perspective(f.scalars[i] + 0.5f, 16.0f / 9.0f,
+                                       0.1f, 500.0f));
+  AddPerCall(registry, "Compare/Perspective/GLM",
+             [](const Fixture &f, size_t i) {
+               return glm::perspective(f.scalars[i] + 0.5f, 16.0f / 9.0f,
+                                       0.1f, 500.0f);
+             });
+
+  BENCHMARK_PER_CALL(registry, "Compare/Slerp/Engine",
+                     Quaternion::Slerp(f.quatA[i], f.quatB[i], f.scalars[i]));
+  BENCHMARK_PER_CALL(registry, "Compare/SlerpFast/Engine",
+                     Quaternion::SlerpFast(f.quatA[i], f.quatB[i],
+                                           f.scalars[i]));
+  AddPerCall(registry, "Compare/Slerp/GLM", [](const Fixture &f, size_t i) {
+    const GlmFixture &g = GetGlmFixture();
+    return glm::slerp(g.quatA[i], g.quatB[i], f.scalars[i]);
+  });
+
+  BENCHMARK_PER_CALL(registry, "Compare/RotateVector/Engine",
+                     f.quatA[i].RotateVector(f.vec3A[i]));
+  GLM_BENCHMARK_PER_CALL(registry, "Compare/RotateVector/GLM",
+                         g.quatA[i] * g.vec3A[i]);
+
+  // Batch transform: the active kernel against a GLM loop, per point
+  registry.Add("Compare/TransformPoints/Engine", [](State &state) {
+    const Fixture &f = GetFixture();
+    std::vector<Vec3> points(kBatchCount), out(kBatchCount);
+    for (size_t i = 0; i < kBatchCount; ++i) {
+      points[i] = f.vec3A[i & (Fixture::kSize - 1)];
+    }
+    state.SetItemsPerIteration(kBatchCount);
+    while (state.KeepRunning()) {
+      f.viewProjection.TransformPoints(points, out);
+      ClobberMemory();
+    }
+  });
+  registry.Add("Compare/TransformPoints/GLM", [](State &state) {
+    const GlmFixture &g = GetGlmFixture();
+    std::vector<glm::vec3> points(kBatchCount), out(kBatchCount);
+    for (size_t i = 0; i < kBatchCount; ++i) {
+      points[i] = g.vec3A[i & (Fixture::kSize - 1)];
+    }
+    state.SetItemsPerIteration(kBatchCount);
+    while (state.KeepRunning()) {
+      for (size_t i = 0; i < kBatchCount; ++i) {
+        glm::vec4 p = g.viewProjection * glm::vec4(points[i], 1.0f);
+        out[i] = glm::vec3(p.x, p.y, p.z);
+      }
+      ClobberMemory();
+    }
+  });
+}
+
+} // namespace Bench
+} // namespace Engine
\ No newline at end of file
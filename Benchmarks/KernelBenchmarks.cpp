@@ -0,0 +1,495 @@
+#include "Fixture.h"
+#include "Math/Noise.h"
+#include <algorithm>
+
+namespace Engine {
+namespace Bench {
+
+using namespace Engine::Math;
+
+namespace {
+
+// Elements per batch call: big enough to amortize the call and the tails,
+// small enough that inputs and outputs stay in L2
+const size_t kCount = 4096;
+// Rays against primitives, every pair tested
+const size_t kRayCount = 64;
+const size_t kPrimitiveCount = 256;
+const size_t kBoneCount = 64;
+
+// The fixture tiled up to kCount elements, plus the SoA streams and skinning
+// data the kernels take
+struct KernelInputs {
+  std::vector<Vec3> points;
+  std::vector<Vec4> spheres;
+  std::vector<Mat4> matrices;
+  std::vector<Quaternion> quatA, quatB;
+  std::vector<Transform> transforms;
+  std::vector<float> centerX, centerY, centerZ, radius;
+  std::vector<float> extentX, extentY, extentZ;
+  std::vector<float> px, py, pz, rx, ry, rz, rw, sx, sy, sz;
+  std::vector<SkinInfluences> influences;
+  std::vector<Float3> float3s;
+  std::vector<Half3> half3s;
+  std::vector<uint32_t> triangleIndices;
+
+  SphereBoundsSoA SphereStreams() const {
+    return SphereBoundsSoA{centerX, centerY, centerZ, radius};
+  }
+
+  BoxBoundsSoA BoxStreams() const {
+    return BoxBoundsSoA{centerX, centerY, centerZ,
+                        extentX, extentY, extentZ};
+  }
+
+  TransformComponentsSoA TransformStreams() const {
+    return TransformComponentsSoA{px, py, pz, rx, ry, rz, rw, sx, sy, sz};
+  }
+};
+
+KernelInputs MakeKernelInputs() {
+  const Fixture &f = GetFixture();
+  KernelInputs in;
+  for (size_t n = 0; n < kCount; ++n) {
+    size_t i = n & (Fixture::kSize - 1);
+    const Sphere &sphere = f.spheres[i];
+    const AABB &box = f.boxes[i];
+    const Transform &transform = f.transforms[i];
+
+    in.points.push_back(f.vec3A[i]);
+    in.spheres.push_back(Vec4(sphere.center, sphere.radius));
+    in.matrices.push_back(f.matrixA[i]);
+    in.quatA.push_back(f.quatA[i]);
+    in.quatB.push_back(f.quatB[i]);
+    in.transforms.push_back(transform);
+
+    Vec3 center = box.Center(), extents = box.Extents();
+    in.centerX.push_back(center.x);
+    in.centerY.push_back(center.y);
+    in.centerZ.push_back(center.z);
+    in.radius.push_back(sphere.radius);
+    in.extentX.push_back(extents.x);
+    in.extentY.push_back(extents.y);
+    in.extentZ.push_back(extents.z);
+
+    in.px.push_back(transform.position.x);
+    in.py.push_back(transform.position.y);
+    in.pz.push_back(transform.position.z);
+    in.rx.push_back(transform.rotation.x);
+    in.ry.push_back(transform.rotation.y);
+    in.rz.push_back(transform.rotation.z);
+    in.rw.push_back(transform.rotation.w);
+    in.sx.push_back(transform.scale.x);
+    in.sy.push_back(transform.scale.y);
+    in.sz.push_back(transform.scale.z);
+
+    // Four bones with weights from the fixture's scalars, summing to one
+    SkinInfluences influence;
+    float total = 0.0f;
+    for (int b = 0; b < 4; ++b) {
+      size_t j = (i + static_cast<size_t>(b) * 7) & (Fixture::kSize - 1);
+      influence.Bones[b] = static_cast<uint16_t>(j % kBoneCount);
+      influence.Weights[b] = f.scalars[j] + 0.01f;
+      total += influence.Weights[b];
+    }
+    for (float &weight : influence.Weights) {
+      weight /= total;
+    }
+    in.influences.push_back(influence);
+
+    in.float3s.push_back(Float3(f.vec3A[i]));
+    in.half3s.push_back(Half3(f.normals[i]));
+  }
+  for (size_t n = 0; n < 3 * kPrimitiveCount; ++n) {
+    in.triangleIndices.push_back(static_cast<uint32_t>(n));
+  }
+  return in;
+}
+
+const KernelInputs &GetKernelInputs() {
+  static const KernelInputs inputs = MakeKernelInputs();
+  return inputs;
+}
+
+// Registers 'body(table, state)' once per available kernel table, as
+// "Kernels/<kernel>/<level>", timed per element
+template <typename Body>
+void AddKernel(Registry &registry, const std::string &kernel,
+               uint64_t items, Body body) {
+  for (const MathKernelTable *table : AvailableKernelTables()) {
+    registry.Add("Kernels/" + kernel + "/" + GetSimdLevelName(table->Level),
+                 [table, items, body](State &state) {
+                   state.SetItemsPerIteration(items);
+                   body(*table, state);
+                 });
+  }
+}
+
+} // namespace
+
+void RegisterKernelBenchmarks(Registry &registry) {
+  //==========================================================================
+  // Transforms
+  //==========================================================================
+  AddKernel(registry, "TransformPoints", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Vec3> out(kCount);
+              while (state.KeepRunning()) {
+                k.TransformPoints(GetFixture().viewProjection,
+                                  in.points.data(), out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "TransformVectors", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Vec3> out(kCount);
+              while (state.KeepRunning()) {
+                k.TransformVectors(GetFixture().viewProjection,
+                                   in.points.data(), out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "TransformPointsProjective", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Vec3> out(kCount);
+              while (state.KeepRunning()) {
+                k.TransformPointsProjective(GetFixture().viewProjection,
+                                            in.points.data(), out.data(),
+                                            kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "TransformPointsSoA", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<float> x(kCount), y(kCount), z(kCount);
+              while (state.KeepRunning()) {
+                k.TransformPointsSoA(GetFixture().viewProjection,
+                                     in.points.data(), x.data(), y.data(),
+                                     z.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "TransformVectorsSoA", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<float> x(kCount), y(kCount), z(kCount);
+              while (state.KeepRunning()) {
+                k.TransformVectorsSoA(GetFixture().viewProjection,
+                                      in.points.data(), x.data(), y.data(),
+                                      z.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "MultiplyMatrices", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Mat4> out(kCount);
+              while (state.KeepRunning()) {
+                k.MultiplyMatrices(in.matrices.data(),
+                                   GetFixture().viewProjection, out.data(),
+                                   kCount);
+                ClobberMemory();
+              }
+            });
+
+  //==========================================================================
+  // Culling
+  //==========================================================================
+  AddKernel(registry, "CullSpheres", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<uint8_t> visible(kCount);
+              while (state.KeepRunning()) {
+                k.CullSpheres(GetFixture().frustum.planes, in.spheres.data(),
+                              visible.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "CullSpheresSoA", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<uint32_t> visible(kCount);
+              while (state.KeepRunning()) {
+                DoNotOptimize(k.CullSpheresSoA(GetFixture().frustum.planes,
+                                               in.SphereStreams(), 0, kCount,
+                                               visible.data()));
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "CullBoxesSoA", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<uint32_t> visible(kCount);
+              while (state.KeepRunning()) {
+                DoNotOptimize(k.CullBoxesSoA(GetFixture().frustum.planes,
+                                             in.BoxStreams(), 0, kCount,
+                                             visible.data()));
+                ClobberMemory();
+              }
+            });
+
+  //==========================================================================
+  // Raycasts, timed per ray-primitive test
+  //==========================================================================
+  AddKernel(registry, "RaycastBoxes", kRayCount * kPrimitiveCount,
+            [](const MathKernelTable &k, State &state) {
+              const Fixture &f = GetFixture();
+              std::vector<RayHit> hits(kRayCount);
+              while (state.KeepRunning()) {
+                std::fill(hits.begin(), hits.end(), RayHit());
+                k.RaycastBoxes(f.rays.data(), hits.data(), kRayCount,
+                               f.boxes.data(), kPrimitiveCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "RaycastSpheres", kRayCount * kPrimitiveCount,
+            [](const MathKernelTable &k, State &state) {
+              const Fixture &f = GetFixture();
+              std::vector<RayHit> hits(kRayCount);
+              while (state.KeepRunning()) {
+                std::fill(hits.begin(), hits.end(), RayHit());
+                k.RaycastSpheres(f.rays.data(), hits.data(), kRayCount,
+                                 f.spheres.data(), kPrimitiveCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "RaycastTriangles", kRayCount * kPrimitiveCount,
+            [](const MathKernelTable &k, State &state) {
+              const Fixture &f = GetFixture();
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<RayHit> hits(kRayCount);
+              while (state.KeepRunning()) {
+                std::fill(hits.begin(), hits.end(), RayHit());
+                k.RaycastTriangles(f.rays.data(), hits.data(), kRayCount,
+                                   f.triangles.data(),
+                                   in.triangleIndices.data(),
+                                   kPrimitiveCount);
+                ClobberMemory();
+              }
+            });
+
+  //==========================================================================
+  // Skinning
+  //==========================================================================
+  AddKernel(registry, "SkinPoints", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Vec3> out(kCount);
+              while (state.KeepRunning()) {
+                k.SkinPoints(in.matrices.data(), in.influences.data(),
+                             in.points.data(), out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "SkinVectors", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Vec3> out(kCount);
+              while (state.KeepRunning()) {
+                k.SkinVectors(in.matrices.data(), in.influences.data(),
+                              in.points.data(), out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+
+  //==========================================================================
+  // Quaternions
+  //==========================================================================
+  AddKernel(registry, "MultiplyQuaternions", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Quaternion> out(kCount);
+              while (state.KeepRunning()) {
+                k.MultiplyQuaternions(in.quatA.data(), in.quatB.data(),
+                                      out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "RotateVectors", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Vec3> out(kCount);
+              while (state.KeepRunning()) {
+                k.RotateVectors(in.quatA.data(), in.points.data(),
+                                out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "LerpQuaternions", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Quaternion> out(kCount);
+              while (state.KeepRunning()) {
+                k.LerpQuaternions(in.quatA.data(), in.quatB.data(), 0.3f,
+                                  out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "SlerpQuaternions", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Quaternion> out(kCount);
+              while (state.KeepRunning()) {
+                k.SlerpQuaternions(in.quatA.data(), in.quatB.data(), 0.3f,
+                                   out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "QuaternionsToMatrices", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Mat4> out(kCount);
+              while (state.KeepRunning()) {
+                k.QuaternionsToMatrices(in.quatA.data(), out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+
+  //==========================================================================
+  // Transform composition
+  //==========================================================================
+  AddKernel(registry, "TransformsToAffine", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Affine3x4> out(kCount);
+              while (state.KeepRunning()) {
+                k.TransformsToAffine(in.transforms.data(), out.data(),
+                                     kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "TransformsToMVP", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Mat4> out(kCount);
+              while (state.KeepRunning()) {
+                k.TransformsToMVP(GetFixture().viewProjection,
+                                  in.transforms.data(), out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "TransformStreamsToAffine", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Affine3x4> out(kCount);
+              while (state.KeepRunning()) {
+                k.TransformStreamsToAffine(in.TransformStreams(), out.data(),
+                                           kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "TransformStreamsToMVP", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Mat4> out(kCount);
+              while (state.KeepRunning()) {
+                k.TransformStreamsToMVP(GetFixture().viewProjection,
+                                        in.TransformStreams(), out.data(),
+                                        kCount);
+                ClobberMemory();
+              }
+            });
+
+  //==========================================================================
+  // Packed storage
+  //==========================================================================
+  AddKernel(registry, "PackFloat3", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Float3> out(kCount);
+              while (state.KeepRunning()) {
+                k.PackFloat3(in.points.data(), out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "UnpackFloat3", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Vec3> out(kCount);
+              while (state.KeepRunning()) {
+                k.UnpackFloat3(in.float3s.data(), out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "PackHalf3", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Half3> out(kCount);
+              while (state.KeepRunning()) {
+                k.PackHalf3(in.points.data(), out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "UnpackHalf3", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<Vec3> out(kCount);
+              while (state.KeepRunning()) {
+                k.UnpackHalf3(in.half3s.data(), out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+
+  // Single-octave simplex noise at the transform positions
+  AddKernel(registry, "Noise2", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<float> out(kCount);
+              while (state.KeepRunning()) {
+                k.Noise2(NoiseSettings(), in.px.data(), in.py.data(),
+                         out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "Noise3", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<float> out(kCount);
+              while (state.KeepRunning()) {
+                k.Noise3(NoiseSettings(), in.px.data(), in.py.data(),
+                         in.pz.data(), out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "Noise4", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              std::vector<float> out(kCount);
+              while (state.KeepRunning()) {
+                k.Noise4(NoiseSettings(), in.px.data(), in.py.data(),
+                         in.pz.data(), in.rx.data(), out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "Noise3Value", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              NoiseSettings settings;
+              settings.Type = NoiseType::Value;
+              std::vector<float> out(kCount);
+              while (state.KeepRunning()) {
+                k.Noise3(settings, in.px.data(), in.py.data(), in.pz.data(),
+                         out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+  AddKernel(registry, "Noise3FBm", kCount,
+            [](const MathKernelTable &k, State &state) {
+              const KernelInputs &in = GetKernelInputs();
+              NoiseSettings settings;
+              settings.Fractal = FractalType::FBm;
+              std::vector<float> out(kCount);
+              while (state.KeepRunning()) {
+                k.Noise3(settings, in.px.data(), in.py.data(), in.pz.data(),
+                         out.data(), kCount);
+                ClobberMemory();
+              }
+            });
+}
+
+} // namespace Bench
+} // namespace Engine
\ No newline at end of file
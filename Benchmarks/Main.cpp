@@ -0,0 +1,98 @@
+#include "Core/Logger.h"
+#include "Fixture.h"
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+using namespace Engine;
+
+static void PrintUsage() {
+  std::printf(
+      "Usage: MathBenchmarks [options]\n"
+      "  --filter <text>     Run benchmarks whose name contains <text>\n"
+      "  --json <path>       Also write the results as JSON to <path>\n"
+      "  --repetitions <n>   Timed repetitions per benchmark (default 10)\n"
+      "  --min-time <s>      Minimum seconds per repetition (default 0.05)\n"
+      "  --warmup <s>        Untimed seconds before the repetitions "
+      "(default 0.05)\n"
+      "  --quick             One short repetition each, as a smoke test\n"
+      "  --list              Print the benchmark names and exit\n");
+}
+
+int main(int argc, char **argv) {
+  Bench::RunOptions options;
+  std::string jsonPath;
+  bool list = false;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string argument = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (argument == "--filter" && hasValue) {
+      options.Filter = argv[++i];
+    } else if (argument == "--json" && hasValue) {
+      jsonPath = argv[++i];
+    } else if (argument == "--repetitions" && hasValue) {
+      options.Repetitions = std::atoi(argv[++i]);
+    } else if (argument == "--min-time" && hasValue) {
+      options.MinTimeSeconds = std::atof(argv[++i]);
+    } else if (argument == "--warmup" && hasValue) {
+      options.WarmupSeconds = std::atof(argv[++i]);
+    } else if (argument == "--quick") {
+      options.Repetitions = 1;
+      options.MinTimeSeconds = 0.0005;
+      options.WarmupSeconds = 0.0;
+    } else if (argument == "--list") {
+      list = true;
+    } else {
+      PrintUsage();
+      return argument == "--help" ? 0 : 1;
+    }
+  }
+
+  Bench::Registry registry;
+  Bench::RegisterVectorBenchmarks(registry);
+  Bench::RegisterMatrixBenchmarks(registry);
+  Bench::RegisterQuaternionBenchmarks(registry);
+  Bench::RegisterGeometryBenchmarks(registry);
+  Bench::RegisterKernelBenchmarks(registry);
+  Bench::RegisterBatchBenchmarks(registry);
+  Bench::RegisterNoiseBenchmarks(registry);
+  Bench::RegisterBvhBenchmarks(registry);
+  Bench::RegisterSpatialBenchmarks(registry);
+  Bench::RegisterSceneBenchmarks(registry);
+#ifdef ENGINE_BENCH_GLM
+  Bench::RegisterGlmBenchmarks(registry);
+#endif
+
+  if (list) {
+    for (const Bench::Benchmark &benchmark : registry.GetBenchmarks()) {
+      std::printf("%s\n", benchmark.Name.c_str());
+    }
+    return 0;
+  }
+
+#if defined(ENGINE_DEBUG)
+  Logger::Warn("MathBenchmarks",
+               "Built without optimizations; configure with "
+               "-DCMAKE_BUILD_TYPE=Release for meaningful numbers");
+#endif
+  Logger::Info("MathBenchmarks",
+               std::string("Math kernels: ") +
+                   Math::GetSimdLevelName(Math::MathKernels::GetLevel()));
+
+  std::vector<Bench::Result> results = Bench::Run(registry, options);
+  if (results.empty()) {
+    Logger::Error("MathBenchmarks",
+                  "No benchmark matches '" + options.Filter + "'");
+    return 1;
+  }
+
+  if (!jsonPath.empty()) {
+    if (!Bench::WriteJson(jsonPath, results, options)) {
+      Logger::Error("MathBenchmarks", "Could not write " + jsonPath);
+      return 1;
+    }
+    Logger::Info("MathBenchmarks", "Wrote " + jsonPath);
+  }
+  return 0;
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include "Fixture.h"
+
+namespace Engine {
+namespace Bench {
+
+using namespace Engine::Math;
+
+void RegisterMatrixBenchmarks(Registry &registry) {
+  //==========================================================================
+  // Arithmetic
+  //==========================================================================
+  BENCHMARK_PER_CALL(registry, "Mat4/Add", f.matrixA[i] + f.matrixB[i]);
+  BENCHMARK_PER_CALL(registry, "Mat4/Subtract", f.matrixA[i] - f.matrixB[i]);
+  BENCHMARK_PER_CALL(registry, "Mat4/MultiplyScalar",
+                     f.matrixA[i] * f.scalars[i]);
+  BENCHMARK_PER_CALL(registry, "Mat4/Multiply", f.matrixA[i] * f.matrixB[i]);
+  BENCHMARK_PER_CALL(registry, "Mat4/MultiplyVec4",
+                     f.matrixA[i] * f.vec4A[i]);
+  BENCHMARK_PER_CALL(registry, "Mat4/TransformPoint",
+                     f.matrixA[i].TransformPoint(f.vec3A[i]));
+  BENCHMARK_PER_CALL(registry, "Mat4/TransformVector",
+                     f.matrixA[i].TransformVector(f.vec3A[i]));
+
+  //==========================================================================
+  // Inversion
+  //==========================================================================
+  BENCHMARK_PER_CALL(registry, "Mat4/Transposed", f.matrixA[i].Transposed());
+  BENCHMARK_PER_CALL(registry, "Mat4/Determinant",
+                     f.matrixA[i].Determinant());
+  BENCHMARK_PER_CALL(registry, "Mat4/Inverted", f.matrixA[i].Inverted());
+  BENCHMARK_PER_CALL(registry, "Mat4/InvertedAffine",
+                     f.matrixA[i].InvertedAffine());
+  BENCHMARK_PER_CALL(registry, "Mat4/InvertedRigid",
+                     f.matrixA[i].InvertedRigid());
+
+  //==========================================================================
+  // Construction
+  //==========================================================================
+  BENCHMARK_PER_CALL(registry, "Mat4/Translation",
+                     Mat4::Translation(f.vec3A[i]));
+  BENCHMARK_PER_CALL(registry, "Mat4/Scale", Mat4::Scale(f.vec3A[i]));
+  BENCHMARK_PER_CALL(registry, "Mat4/RotationX", Mat4::RotationX(f.angles[i]));
+  BENCHMARK_PER_CALL(registry, "Mat4/RotationY", Mat4::RotationY(f.angles[i]));
+  BENCHMARK_PER_CALL(registry, "Mat4/RotationZ", Mat4::RotationZ(f.angles[i]));
+  BENCHMARK_PER_CALL(registry, "Mat4/Rotation",
+                     Mat4::Rotation(f.normals[i], f.angles[i]));
+  BENCHMARK_PER_CALL(registry, "Mat4/LookAt",
+                     Mat4::LookAt(f.vec3A[i], f.vec3B[i], Vec3::Up()));
+  BENCHMARK_PER_CALL(registry, "Mat4/Perspective",
+                     Mat4::Perspective(f.scalars[i] + 0.5f, 16.0f / 9.0f,
+                                       0.1f, 500.0f));
+  BENCHMARK_PER_CALL(registry, "Mat4/Orthographic",
+                     Mat4::Orthographic(-f.vec2A[i].x, f.vec2A[i].x,
+                                        -f.vec2A[i].y, f.vec2A[i].y, 0.1f,
+                                        500.0f));
+  BENCHMARK_PER_CALL(registry, "Mat4/TRS",
+                     Mat4::TRS(f.vec3A[i], f.vec3B[i], f.vec3B[i]));
+
+  //==========================================================================
+  // Affine3x4
+  //==========================================================================
+  BENCHMARK_PER_CALL(registry, "Affine3x4/TRS",
+                     Affine3x4::TRS(f.transforms[i].position,
+                                    f.transforms[i].rotation,
+                                    f.transforms[i].scale));
+  BENCHMARK_PER_CALL(registry, "Affine3x4/Multiply",
+                     f.affines[i] * f.affines[(i + 1) & (Fixture::kSize - 1)]);
+  BENCHMARK_PER_CALL(registry, "Affine3x4/MultiplyMat4",
+                     f.viewProjection * f.affines[i]);
+  BENCHMARK_PER_CALL(registry, "Affine3x4/TransformPoint",
+                     f.affines[i].TransformPoint(f.vec3A[i]));
+  BENCHMARK_PER_CALL(registry, "Affine3x4/TransformVector",
+                     f.affines[i].TransformVector(f.vec3A[i]));
+  BENCHMARK_PER_CALL(registry, "Affine3x4/TransformNormal",
+                     f.affines[i].TransformNormal(f.normals[i]));
+  BENCHMARK_PER_CALL(registry, "Affine3x4/Determinant",
+                     f.affines[i].Determinant());
+  BENCHMARK_PER_CALL(registry, "Affine3x4/Inverted", f.affines[i].Inverted());
+  BENCHMARK_PER_CALL(registry, "Affine3x4/InvertedRigid",
+                     f.affines[i].InvertedRigid());
+  BENCHMARK_PER_CALL(registry, "Affine3x4/NormalMatrix",
+                     f.affines[i].NormalMatrix());
+}
+
+} // namespace Bench
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,179 @@
+#include "Fixture.h"
+#include "Math/Noise.h"
+#include "Math/Random.h"
+#include "Math/Sequences.h"
+
+// Per-sample noise, random number and sequence costs. The SimdFloat8 rows
+// count eight samples per call, so the Items/s column reads as samples per
+// second throughout; the Kernels/Noise* rows cover the batch entry points.
+
+namespace Engine {
+namespace Bench {
+
+using namespace Engine::Math;
+
+namespace {
+
+// Coordinates from the fixture vectors, as SoA streams for the packets
+struct NoiseInputs {
+  std::vector<float> x, y, z, w;
+};
+
+const NoiseInputs &GetNoiseInputs() {
+  static const NoiseInputs inputs = []() {
+    const Fixture &f = GetFixture();
+    NoiseInputs in;
+    for (size_t i = 0; i < Fixture::kSize; ++i) {
+      in.x.push_back(f.vec4A[i].x);
+      in.y.push_back(f.vec4A[i].y);
+      in.z.push_back(f.vec4A[i].z);
+      in.w.push_back(f.vec4A[i].w);
+    }
+    return in;
+  }();
+  return inputs;
+}
+
+// Eight samples per iteration through 'operation(x, y, z, w)'
+template <typename Operation>
+void AddPacket(Registry &registry, const std::string &name,
+               Operation operation) {
+  registry.Add(name, [operation](State &state) {
+    const NoiseInputs &in = GetNoiseInputs();
+    state.SetItemsPerIteration(8);
+    size_t i = 0;
+    while (state.KeepRunning()) {
+      DoNotOptimize(operation(
+          SimdFloat8::LoadU(&in.x[i]), SimdFloat8::LoadU(&in.y[i]),
+          SimdFloat8::LoadU(&in.z[i]), SimdFloat8::LoadU(&in.w[i])));
+      i = (i + 8) & (Fixture::kSize - 1);
+    }
+  });
+}
+
+NoiseSettings Fractal(FractalType fractal) {
+  NoiseSettings settings;
+  settings.Fractal = fractal;
+  return settings;
+}
+
+} // namespace
+
+void RegisterNoiseBenchmarks(Registry &registry) {
+  GetNoiseInputs();
+
+  //==========================================================================
+  // Noise
+  //==========================================================================
+  BENCHMARK_PER_CALL(registry, "Noise/Value2",
+                     Noise::Value(f.vec4A[i].x, f.vec4A[i].y));
+  BENCHMARK_PER_CALL(registry, "Noise/Value3",
+                     Noise::Value(f.vec4A[i].x, f.vec4A[i].y, f.vec4A[i].z));
+  BENCHMARK_PER_CALL(registry, "Noise/Simplex2",
+                     Noise::Simplex(f.vec4A[i].x, f.vec4A[i].y));
+  BENCHMARK_PER_CALL(registry, "Noise/Simplex3",
+                     Noise::Simplex(f.vec4A[i].x, f.vec4A[i].y,
+                                    f.vec4A[i].z));
+  BENCHMARK_PER_CALL(registry, "Noise/Simplex4",
+                     Noise::Simplex(f.vec4A[i].x, f.vec4A[i].y, f.vec4A[i].z,
+                                    f.vec4A[i].w));
+
+  AddPacket(registry, "Noise/Value2/SimdFloat8",
+            [](SimdFloat8 x, SimdFloat8 y, SimdFloat8, SimdFloat8) {
+              return Noise::Value(x, y);
+            });
+  AddPacket(registry, "Noise/Value3/SimdFloat8",
+            [](SimdFloat8 x, SimdFloat8 y, SimdFloat8 z, SimdFloat8) {
+              return Noise::Value(x, y, z);
+            });
+  AddPacket(registry, "Noise/Simplex2/SimdFloat8",
+            [](SimdFloat8 x, SimdFloat8 y, SimdFloat8, SimdFloat8) {
+              return Noise::Simplex(x, y);
+            });
+  AddPacket(registry, "Noise/Simplex3/SimdFloat8",
+            [](SimdFloat8 x, SimdFloat8 y, SimdFloat8 z, SimdFloat8) {
+              return Noise::Simplex(x, y, z);
+            });
+  AddPacket(registry, "Noise/Simplex4/SimdFloat8",
+            [](SimdFloat8 x, SimdFloat8 y, SimdFloat8 z, SimdFloat8 w) {
+              return Noise::Simplex(x, y, z, w);
+            });
+
+  // Four octaves each
+  AddPacket(registry, "Noise/FBm3/SimdFloat8",
+            [](SimdFloat8 x, SimdFloat8 y, SimdFloat8 z, SimdFloat8) {
+              return Noise::Evaluate(Fractal(FractalType::FBm), x, y, z);
+            });
+  AddPacket(registry, "Noise/Ridged3/SimdFloat8",
+            [](SimdFloat8 x, SimdFloat8 y, SimdFloat8 z, SimdFloat8) {
+              return Noise::Evaluate(Fractal(FractalType::Ridged), x, y, z);
+            });
+
+  //==========================================================================
+  // Random numbers
+  //==========================================================================
+  registry.Add("Random/Pcg32/Next", [](State &state) {
+    Pcg32 generator(1);
+    while (state.KeepRunning()) {
+      DoNotOptimize(generator.Next());
+    }
+  });
+  registry.Add("Random/Pcg32/NextFloat", [](State &state) {
+    Pcg32 generator(1);
+    while (state.KeepRunning()) {
+      DoNotOptimize(generator.NextFloat());
+    }
+  });
+  registry.Add("Random/Pcg32/NextBounded", [](State &state) {
+    Pcg32 generator(1);
+    while (state.KeepRunning()) {
+      DoNotOptimize(generator.NextBounded(1000));
+    }
+  });
+  registry.Add("Random/ThreadRandom", [](State &state) {
+    while (state.KeepRunning()) {
+      DoNotOptimize(ThreadRandom().Next());
+    }
+  });
+  registry.Add("Random/RandomStream/float", [](State &state) {
+    RandomStream<float> stream(1);
+    while (state.KeepRunning()) {
+      DoNotOptimize(stream.NextFloat());
+    }
+  });
+  registry.Add("Random/RandomStream/SimdFloat8", [](State &state) {
+    RandomStream<SimdFloat8> stream(1);
+    state.SetItemsPerIteration(8);
+    while (state.KeepRunning()) {
+      DoNotOptimize(stream.NextFloat());
+    }
+  });
+
+  //==========================================================================
+  // Sequences
+  //==========================================================================
+  // Spread indices, so every digit position varies
+  AddPerCall(registry, "Sequences/Halton2", [](const Fixture &, size_t i) {
+    return Halton2(static_cast<uint32_t>(i) * 7919u);
+  });
+  AddPerCall(registry, "Sequences/Halton/Dimension15",
+             [](const Fixture &, size_t i) {
+               return Halton(static_cast<uint32_t>(i) * 7919u, 15);
+             });
+  AddPerCall(registry, "Sequences/Sobol2", [](const Fixture &, size_t i) {
+    return Sobol2(static_cast<uint32_t>(i) * 7919u);
+  });
+  AddPerCall(registry, "Sequences/VanDerCorput",
+             [](const Fixture &, size_t i) {
+               return VanDerCorput(static_cast<uint32_t>(i) * 7919u);
+             });
+  registry.Add("Sequences/BlueNoiseTile/Build32", [](State &state) {
+    while (state.KeepRunning()) {
+      BlueNoiseTile tile(32);
+      DoNotOptimize(tile.GetValues()[0]);
+    }
+  });
+}
+
+} // namespace Bench
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,67 @@
+#include "Fixture.h"
+
+namespace Engine {
+namespace Bench {
+
+using namespace Engine::Math;
+
+void RegisterQuaternionBenchmarks(Registry &registry) {
+  //==========================================================================
+  // Construction and conversion
+  //==========================================================================
+  BENCHMARK_PER_CALL(registry, "Quaternion/FromAxisAngle",
+                     Quaternion::FromAxisAngle(f.normals[i], f.angles[i]));
+  BENCHMARK_PER_CALL(registry, "Quaternion/FromEulerAngles",
+                     Quaternion::FromEulerAngles(f.vec3A[i] * 0.01f));
+  BENCHMARK_PER_CALL(registry, "Quaternion/FromMatrix",
+                     Quaternion::FromMatrix(f.matrixA[i]));
+  BENCHMARK_PER_CALL(registry, "Quaternion/ToMatrix", f.quatA[i].ToMatrix());
+  BENCHMARK_PER_CALL(registry, "Quaternion/ToEulerAngles",
+                     f.quatA[i].ToEulerAngles());
+  BENCHMARK_PER_CALL(registry, "Quaternion/ToAxisAngle", [&]() {
+    Vec3 axis;
+    float angle = 0.0f;
+    f.quatA[i].ToAxisAngle(axis, angle);
+    return Vec4(axis, angle);
+  }());
+
+  //==========================================================================
+  // Arithmetic
+  //==========================================================================
+  BENCHMARK_PER_CALL(registry, "Quaternion/Add", f.quatA[i] + f.quatB[i]);
+  BENCHMARK_PER_CALL(registry, "Quaternion/Subtract",
+                     f.quatA[i] - f.quatB[i]);
+  BENCHMARK_PER_CALL(registry, "Quaternion/MultiplyScalar",
+                     f.quatA[i] * f.scalars[i]);
+  BENCHMARK_PER_CALL(registry, "Quaternion/Multiply", f.quatA[i] * f.quatB[i]);
+  BENCHMARK_PER_CALL(registry, "Quaternion/Negate", -f.quatA[i]);
+  BENCHMARK_PER_CALL(registry, "Quaternion/Dot", f.quatA[i].Dot(f.quatB[i]));
+  BENCHMARK_PER_CALL(registry, "Quaternion/Length", f.quatA[i].Length());
+  BENCHMARK_PER_CALL(registry, "Quaternion/Normalized",
+                     (f.quatA[i] * 2.0f).Normalized());
+  BENCHMARK_PER_CALL(registry, "Quaternion/Normalize", [&]() {
+    Quaternion q = f.quatA[i] * 2.0f;
+    q.Normalize();
+    return q;
+  }());
+  BENCHMARK_PER_CALL(registry, "Quaternion/Conjugate",
+                     f.quatA[i].Conjugate());
+  BENCHMARK_PER_CALL(registry, "Quaternion/Inverse", f.quatA[i].Inverse());
+  BENCHMARK_PER_CALL(registry, "Quaternion/RotateVector",
+                     f.quatA[i].RotateVector(f.vec3A[i]));
+  BENCHMARK_PER_CALL(registry, "Quaternion/Forward", f.quatA[i].Forward());
+
+  //==========================================================================
+  // Interpolation
+  //==========================================================================
+  BENCHMARK_PER_CALL(registry, "Quaternion/Lerp",
+                     Quaternion::Lerp(f.quatA[i], f.quatB[i], f.scalars[i]));
+  BENCHMARK_PER_CALL(registry, "Quaternion/Slerp",
+                     Quaternion::Slerp(f.quatA[i], f.quatB[i], f.scalars[i]));
+  BENCHMARK_PER_CALL(registry, "Quaternion/SlerpFast",
+                     Quaternion::SlerpFast(f.quatA[i], f.quatB[i],
+                                           f.scalars[i]));
+}
+
+} // namespace Bench
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include "Fixture.h"
+#include "Math/Random.h"
+#include "Math/SceneGraph.h"
+#include <memory>
+
+// World transform and bounds updates over 100K-node hierarchies, one node
+// per item. Deep/ is 1000 chains of 100 nodes and Wide/ a root with 316
+// children of 316 children each. Naive recomputes every node by recursion
+// over pointer-linked children with Mat4 products; SceneGraph/All flags
+// the roots so the flat arrays recompute every node too, and
+// SceneGraph/Dirty1 flags one node in a hundred, at random, along with
+// whatever lies below it.
+
+namespace Engine {
+namespace Bench {
+
+using namespace Engine::Math;
+
+namespace {
+
+struct NaiveNode {
+  Transform local;
+  AABB bounds;
+  Mat4 world;
+  AABB worldBounds;
+  std::vector<std::unique_ptr<NaiveNode>> children;
+};
+
+void UpdateNaive(NaiveNode &node, const Mat4 &parent) {
+  node.world = parent * node.local.ToMatrix();
+  node.worldBounds = node.bounds.Transformed(node.world);
+  for (auto &child : node.children) {
+    UpdateNaive(*child, node.world);
+  }
+}
+
+// Both forms of one hierarchy, built once and updated by every call
+struct SceneHierarchy {
+  std::vector<std::unique_ptr<NaiveNode>> roots;
+  SceneGraph graph;
+  std::vector<SceneGraph::NodeId> nodes;
+  std::vector<SceneGraph::NodeId> moving;
+  size_t rootCount = 0;
+};
+
+// 'branching[d]' children for each node at depth d, in breadth-first order
+std::shared_ptr<SceneHierarchy>
+MakeHierarchy(const std::vector<size_t> &branching) {
+  auto hierarchy = std::make_shared<SceneHierarchy>();
+  SceneHierarchy &h = *hierarchy;
+  Pcg32 random(50);
+  std::vector<NaiveNode *> level;
+  std::vector<SceneGraph::NodeId> levelIds;
+  for (size_t depth = 0; depth < branching.size(); ++depth) {
+    std::vector<NaiveNode *> next;
+    std::vector<SceneGraph::NodeId> nextIds;
+    const size_t parents = depth == 0 ? 1 : level.size();
+    for (size_t p = 0; p < parents; ++p) {
+      for (size_t i = 0; i < branching[depth]; ++i) {
+        auto node = std::make_unique<NaiveNode>();
+        const Vec3 axis(random.NextFloat(-1.0f, 1.0f),
+                        random.NextFloat(-1.0f, 1.0f), 1.0f);
+        node->local = Transform(
+            Vec3(random.NextFloat(-2.0f, 2.0f), random.NextFloat(-2.0f, 2.0f),
+                 random.NextFloat(-2.0f, 2.0f)),
+            Quaternion::FromAxisAngle(axis.Normalized(),
+                                      random.NextFloat(0.0f, TWO_PI)));
+        const Vec3 half(random.NextFloat(0.1f, 1.0f));
+        node->bounds = AABB(-half, half);
+        const SceneGraph::NodeId id = h.graph.Create(
+            depth == 0 ? SceneGraph::kNone : levelIds[p], node->local,
+            node->bounds);
+        next.push_back(node.get());
+        nextIds.push_back(id);
+        h.nodes.push_back(id);
+        auto &siblings = depth == 0 ? h.roots : level[p]->children;
+        siblings.push_back(std::move(node));
+      }
+    }
+    level.swap(next);
+    levelIds.swap(nextIds);
+  }
+  h.rootCount = branching[0];
+  for (size_t i = 0; i < h.nodes.size() / 100; ++i) {
+    h.moving.push_back(h.nodes[random.NextBounded(
+        static_cast<uint32_t>(h.nodes.size()))]);
+  }
+  h.graph.Update();
+  return hierarchy;
+}
+
+void AddHierarchy(Registry &registry, const std::string &name,
+                  const std::vector<size_t> &branching) {
+  // Built on first use, so filtered-out rows cost nothing
+  auto shared = std::make_shared<std::shared_ptr<SceneHierarchy>>();
+  auto get = [shared, branching]() -> SceneHierarchy & {
+    if (!*shared) {
+      *shared = MakeHierarchy(branching);
+    }
+    return **shared;
+  };
+
+  registry.Add("Scene/" + name + "/Naive", [get](State &state) {
+    SceneHierarchy &h = get();
+    state.SetItemsPerIteration(h.nodes.size());
+    while (state.KeepRunning()) {
+      for (auto &root : h.roots) {
+        UpdateNaive(*root, Mat4::Identity());
+      }
+      DoNotOptimize(h.roots.back()->worldBounds);
+    }
+  });
+  registry.Add("Scene/" + name + "/SceneGraph/All", [get](State &state) {
+    SceneHierarchy &h = get();
+    state.SetItemsPerIteration(h.nodes.size());
+    while (state.KeepRunning()) {
+      for (size_t i = 0; i < h.rootCount; ++i) {
+        h.graph.SetLocal(h.nodes[i], h.graph.GetLocal(h.nodes[i]));
+      }
+      h.graph.Update();
+      DoNotOptimize(h.graph.GetWorldBounds().data());
+    }
+  });
+  registry.Add("Scene/" + name + "/SceneGraph/Dirty1", [get](State &state) {
+    SceneHierarchy &h = get();
+    state.SetItemsPerIteration(h.nodes.size());
+    while (state.KeepRunning()) {
+      for (SceneGraph::NodeId node : h.moving) {
+        h.graph.SetLocal(node, h.graph.GetLocal(node));
+      }
+      h.graph.Update();
+      DoNotOptimize(h.graph.GetWorldBounds().data());
+    }
+  });
+}
+
+} // namespace
+
+void RegisterSceneBenchmarks(Registry &registry) {
+  std::vector<size_t> deep(100, 1);
+  deep[0] = 1000;
+  AddHierarchy(registry, "Deep", deep);
+  AddHierarchy(registry, "Wide", {1, 316, 316});
+}
+
+} // namespace Bench
+} // namespace Engine
\ No newline at end of file
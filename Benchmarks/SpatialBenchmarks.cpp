@@ -0,0 +1,266 @@
+#include "Fixture.h"
+#include "Math/Bvh.h"
+#include "Math/LooseOctree.h"
+#include "Math/Random.h"
+#include "Math/SpatialHash.h"
+#include <cmath>
+#include <memory>
+
+// Per-frame costs of keeping a 1M-object scene queryable while some of it
+// moves: each frame moves 1, 10 or 100 percent of the objects, brings the
+// structure up to date and culls one frustum. Moving objects drift along
+// their own velocity and turn back every 32 frames, so the scene stays
+// bounded however long a benchmark runs. Every row times one frame per
+// item, the motion included. The structures persist across repetitions,
+// as they would across frames, so a refitted Bvh8 keeps its first
+// topology while the loose octree reinserts whatever left its cell.
+//
+// The Particles/ rows rebuild structures from scratch over 1M small cubes
+// orbiting in a thick disc, as a particle system would every frame.
+// Builds and pair searches count objects per second, so a million over
+// the Items/s column is the cost per million objects; Radius times one
+// query per item.
+
+namespace Engine {
+namespace Bench {
+
+using namespace Engine::Math;
+
+namespace {
+
+const size_t kObjectCount = 1000000;
+const float kRange = 1000.0f;
+// Frames a moving object drifts before turning back
+const uint32_t kDriftFrames = 32;
+
+struct DynamicScene {
+  std::vector<AABB> boxes;
+  std::vector<Vec3> velocities;
+  // A random permutation of the objects; the first N percent move
+  std::vector<uint32_t> order;
+  std::vector<Frustum> frustums;
+};
+
+Vec3 RandomPoint(Pcg32 &random, float range) {
+  return Vec3(random.NextFloat(-range, range), random.NextFloat(-range, range),
+              random.NextFloat(-range, range));
+}
+
+// The Bvh/ scene: half the boxes in sixteen tight clusters, the rest spread
+// uniformly, with speeds of up to one unit per frame
+const DynamicScene &GetDynamicScene() {
+  static const DynamicScene scene = []() {
+    DynamicScene s;
+    Pcg32 random(48);
+    std::vector<Vec3> clusters(16);
+    for (Vec3 &center : clusters) {
+      center = RandomPoint(random, kRange);
+    }
+    s.boxes.resize(kObjectCount);
+    s.velocities.resize(kObjectCount);
+    s.order.resize(kObjectCount);
+    for (size_t i = 0; i < kObjectCount; ++i) {
+      Vec3 center = i % 2 == 0 ? clusters[i % clusters.size()] +
+                                     RandomPoint(random, kRange * 0.05f)
+                               : RandomPoint(random, kRange);
+      Vec3 half(random.NextFloat(0.01f, 0.5f), random.NextFloat(0.01f, 0.5f),
+                random.NextFloat(0.01f, 0.5f));
+      s.boxes[i] = AABB(center - half, center + half);
+      s.velocities[i] = RandomPoint(random, 1.0f);
+      s.order[i] = static_cast<uint32_t>(i);
+    }
+    for (size_t i = kObjectCount - 1; i > 0; --i) {
+      std::swap(s.order[i], s.order[random.NextBounded(
+                                static_cast<uint32_t>(i + 1))]);
+    }
+    for (size_t i = 0; i < Fixture::kSize; ++i) {
+      Vec3 eye = RandomPoint(random, kRange);
+      Mat4 view = Mat4::LookAt(eye, RandomPoint(random, kRange), Vec3::Up());
+      Mat4 projection =
+          Mat4::Perspective(ToRadians(60.0f), 1.5f, 0.1f, kRange * 1.5f);
+      s.frustums.push_back(Frustum::FromMatrix(projection * view));
+    }
+    return s;
+  }();
+  return scene;
+}
+
+// Moves the first 'percent' percent of the scene's objects to where they
+// are at 'frame'
+void MoveObjects(const DynamicScene &scene, int percent, uint32_t frame,
+                 std::vector<AABB> &boxes) {
+  const uint32_t phase = frame % (2 * kDriftFrames);
+  const float t = static_cast<float>(
+      phase < kDriftFrames ? phase : 2 * kDriftFrames - phase);
+  const size_t count = kObjectCount * percent / 100;
+  for (size_t i = 0; i < count; ++i) {
+    const uint32_t object = scene.order[i];
+    const Vec3 offset = scene.velocities[object] * t;
+    boxes[object] = AABB(scene.boxes[object].min + offset,
+                         scene.boxes[object].max + offset);
+  }
+}
+
+struct OctreeFrame {
+  LooseOctree octree;
+
+  void Build(const std::vector<AABB> &boxes) { octree.Build(boxes); }
+  size_t Run(const std::vector<AABB> &boxes, const Frustum &frustum,
+             std::vector<uint32_t> &visible) {
+    octree.Update(boxes);
+    return octree.Cull(frustum, visible);
+  }
+};
+
+struct RefitFrame {
+  Bvh8 bvh;
+
+  void Build(const std::vector<AABB> &boxes) { bvh.Build(boxes); }
+  size_t Run(const std::vector<AABB> &boxes, const Frustum &frustum,
+             std::vector<uint32_t> &visible) {
+    bvh.Refit(boxes);
+    return bvh.Cull(frustum, visible);
+  }
+};
+
+struct RebuildFrame {
+  Bvh8 bvh;
+
+  void Build(const std::vector<AABB> &boxes) { bvh.Build(boxes); }
+  size_t Run(const std::vector<AABB> &boxes, const Frustum &frustum,
+             std::vector<uint32_t> &visible) {
+    BvhBuildSettings settings;
+    settings.Builder = BvhBuilder::Morton;
+    bvh.Build(boxes, settings);
+    return bvh.Cull(frustum, visible);
+  }
+};
+
+// Cubes of half size 0.25 to 0.5 on orbits of radius 20 to 200
+struct ParticleScene {
+  std::vector<AABB> boxes;
+  std::vector<Sphere> spheres;
+  SpatialHash hash;
+};
+
+const ParticleScene &GetParticleScene() {
+  static const ParticleScene scene = []() {
+    ParticleScene s;
+    Pcg32 random(49);
+    s.boxes.resize(kObjectCount);
+    for (AABB &box : s.boxes) {
+      const float radius = random.NextFloat(20.0f, 200.0f);
+      const float angle = random.NextFloat(0.0f, TWO_PI);
+      const float height = random.NextFloat(-0.2f, 0.2f) * radius;
+      const Vec3 center(radius * std::cos(angle), height,
+                        radius * std::sin(angle));
+      const Vec3 half(random.NextFloat(0.25f, 0.5f));
+      box = AABB(center - half, center + half);
+    }
+    for (size_t i = 0; i < Fixture::kSize; ++i) {
+      const AABB &box = s.boxes[random.NextBounded(kObjectCount)];
+      s.spheres.push_back(Sphere((box.min + box.max) * 0.5f, 2.0f));
+    }
+    s.hash.Build(s.boxes);
+    return s;
+  }();
+  return scene;
+}
+
+// A structure and the scene as it stands, carried from one call to the next
+template <typename Frame> struct Simulation {
+  Frame frame;
+  std::vector<AABB> boxes;
+  std::vector<uint32_t> visible;
+  uint32_t index = 0;
+};
+
+template <typename Frame>
+void AddFrame(Registry &registry, const std::string &name, int percent) {
+  auto simulation = std::make_shared<Simulation<Frame>>();
+  registry.Add(name, [simulation, percent](State &state) {
+    const DynamicScene &scene = GetDynamicScene();
+    Simulation<Frame> &s = *simulation;
+    if (s.boxes.empty()) {
+      s.boxes = scene.boxes;
+      s.visible.resize(kObjectCount);
+      s.frame.Build(s.boxes);
+    }
+    while (state.KeepRunning()) {
+      ++s.index;
+      MoveObjects(scene, percent, s.index, s.boxes);
+      const Frustum &frustum = scene.frustums[s.index & (Fixture::kSize - 1)];
+      DoNotOptimize(s.frame.Run(s.boxes, frustum, s.visible));
+    }
+  });
+}
+
+} // namespace
+
+void RegisterSpatialBenchmarks(Registry &registry) {
+  registry.Add("Spatial/Build/LooseOctree", [](State &state) {
+    const DynamicScene &scene = GetDynamicScene();
+    LooseOctree octree;
+    state.SetItemsPerIteration(kObjectCount);
+    while (state.KeepRunning()) {
+      octree.Build(scene.boxes);
+      DoNotOptimize(octree.GetNodeCount());
+    }
+  });
+
+  //==========================================================================
+  // Particles: per-frame rebuilds and queries
+  //==========================================================================
+  registry.Add("Spatial/Particles/Build/SpatialHash", [](State &state) {
+    const ParticleScene &scene = GetParticleScene();
+    SpatialHash hash;
+    state.SetItemsPerIteration(kObjectCount);
+    while (state.KeepRunning()) {
+      hash.Build(scene.boxes);
+      DoNotOptimize(hash.GetBucketCount());
+    }
+  });
+  registry.Add("Spatial/Particles/Build/Bvh8Morton", [](State &state) {
+    const ParticleScene &scene = GetParticleScene();
+    BvhBuildSettings settings;
+    settings.Builder = BvhBuilder::Morton;
+    Bvh8 bvh;
+    state.SetItemsPerIteration(kObjectCount);
+    while (state.KeepRunning()) {
+      bvh.Build(scene.boxes, settings);
+      DoNotOptimize(bvh.GetNodes().data());
+    }
+  });
+  registry.Add("Spatial/Particles/Pairs/SpatialHash", [](State &state) {
+    const ParticleScene &scene = GetParticleScene();
+    std::vector<SpatialPair> pairs;
+    state.SetItemsPerIteration(kObjectCount);
+    while (state.KeepRunning()) {
+      scene.hash.FindPairs(pairs);
+      DoNotOptimize(pairs.data());
+    }
+  });
+  registry.Add("Spatial/Particles/Radius/SpatialHash", [](State &state) {
+    const ParticleScene &scene = GetParticleScene();
+    std::vector<uint32_t> found(kObjectCount);
+    size_t i = 0;
+    while (state.KeepRunning()) {
+      DoNotOptimize(scene.hash.Overlap(scene.spheres[i], found));
+      i = (i + 1) & (Fixture::kSize - 1);
+    }
+  });
+
+  //==========================================================================
+  // Move, update and cull, per frame
+  //==========================================================================
+  for (int percent : {1, 10, 100}) {
+    const std::string prefix =
+        "Spatial/Frame/Moving" + std::to_string(percent) + "/";
+    AddFrame<OctreeFrame>(registry, prefix + "LooseOctree", percent);
+    AddFrame<RefitFrame>(registry, prefix + "Bvh8Refit", percent);
+    AddFrame<RebuildFrame>(registry, prefix + "Bvh8Morton", percent);
+  }
+}
+
+} // namespace Bench
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include "Fixture.h"
+
+namespace Engine {
+namespace Bench {
+
+using namespace Engine::Math;
+
+void RegisterVectorBenchmarks(Registry &registry) {
+  //==========================================================================
+  // Vec2
+  //==========================================================================
+  BENCHMARK_PER_CALL(registry, "Vec2/Add", f.vec2A[i] + f.vec2B[i]);
+  BENCHMARK_PER_CALL(registry, "Vec2/Subtract", f.vec2A[i] - f.vec2B[i]);
+  BENCHMARK_PER_CALL(registry, "Vec2/MultiplyScalar",
+                     f.vec2A[i] * f.scalars[i]);
+  BENCHMARK_PER_CALL(registry, "Vec2/DivideScalar",
+                     f.vec2A[i] / (f.scalars[i] + 1.0f));
+  BENCHMARK_PER_CALL(registry, "Vec2/Negate", -f.vec2A[i]);
+  BENCHMARK_PER_CALL(registry, "Vec2/AddAssign", [&]() {
+    Vec2 v = f.vec2A[i];
+    v += f.vec2B[i];
+    return v;
+  }());
+  BENCHMARK_PER_CALL(registry, "Vec2/Dot", f.vec2A[i].Dot(f.vec2B[i]));
+  BENCHMARK_PER_CALL(registry, "Vec2/Length", f.vec2A[i].Length());
+  BENCHMARK_PER_CALL(registry, "Vec2/LengthSquared",
+                     f.vec2A[i].LengthSquared());
+  BENCHMARK_PER_CALL(registry, "Vec2/Normalized", f.vec2A[i].Normalized());
+  BENCHMARK_PER_CALL(registry, "Vec2/Normalize", [&]() {
+    Vec2 v = f.vec2A[i];
+    v.Normalize();
+    return v;
+  }());
+  BENCHMARK_PER_CALL(registry, "Vec2/Perpendicular",
+                     f.vec2A[i].Perpendicular());
+  BENCHMARK_PER_CALL(registry, "Vec2/Angle", f.vec2A[i].Angle());
+
+  //==========================================================================
+  // Vec3
+  //==========================================================================
+  BENCHMARK_PER_CALL(registry, "Vec3/Add", f.vec3A[i] + f.vec3B[i]);
+  BENCHMARK_PER_CALL(registry, "Vec3/Subtract", f.vec3A[i] - f.vec3B[i]);
+  BENCHMARK_PER_CALL(registry, "Vec3/MultiplyScalar",
+                     f.vec3A[i] * f.scalars[i]);
+  BENCHMARK_PER_CALL(registry, "Vec3/Multiply", f.vec3A[i] * f.vec3B[i]);
+  BENCHMARK_PER_CALL(registry, "Vec3/DivideScalar",
+                     f.vec3A[i] / (f.scalars[i] + 1.0f));
+  BENCHMARK_PER_CALL(registry, "Vec3/Divide", f.vec3A[i] / f.vec3B[i]);
+  BENCHMARK_PER_CALL(registry, "Vec3/Negate", -f.vec3A[i]);
+  BENCHMARK_PER_CALL(registry, "Vec3/AddAssign", [&]() {
+    Vec3 v = f.vec3A[i];
+    v += f.vec3B[i];
+    return v;
+  }());
+  BENCHMARK_PER_CALL(registry, "Vec3/Dot", f.vec3A[i].Dot(f.vec3B[i]));
+  BENCHMARK_PER_CALL(registry, "Vec3/Cross", f.vec3A[i].Cross(f.vec3B[i]));
+  BENCHMARK_PER_CALL(registry, "Vec3/Length", f.vec3A[i].Length());
+  BENCHMARK_PER_CALL(registry, "Vec3/LengthSquared",
+                     f.vec3A[i].LengthSquared());
+  BENCHMARK_PER_CALL(registry, "Vec3/Normalized", f.vec3A[i].Normalized());
+  BENCHMARK_PER_CALL(registry, "Vec3/Normalize", [&]() {
+    Vec3 v = f.vec3A[i];
+    v.Normalize();
+    return v;
+  }());
+  BENCHMARK_PER_CALL(registry, "Vec3/Lerp",
+                     f.vec3A[i].Lerp(f.vec3B[i], f.scalars[i]));
+  BENCHMARK_PER_CALL(registry, "Vec3/Reflect",
+                     f.vec3A[i].Reflect(f.normals[i]));
+
+  //==========================================================================
+  // Vec4
+  //==========================================================================
+  BENCHMARK_PER_CALL(registry, "Vec4/Add", f.vec4A[i] + f.vec4B[i]);
+  BENCHMARK_PER_CALL(registry, "Vec4/Subtract", f.vec4A[i] - f.vec4B[i]);
+  BENCHMARK_PER_CALL(registry, "Vec4/MultiplyScalar",
+                     f.vec4A[i] * f.scalars[i]);
+  BENCHMARK_PER_CALL(registry, "Vec4/DivideScalar",
+                     f.vec4A[i] / (f.scalars[i] + 1.0f));
+  BENCHMARK_PER_CALL(registry, "Vec4/Negate", -f.vec4A[i]);
+  BENCHMARK_PER_CALL(registry, "Vec4/AddAssign", [&]() {
+    Vec4 v = f.vec4A[i];
+    v += f.vec4B[i];
+    return v;
+  }());
+  BENCHMARK_PER_CALL(registry, "Vec4/Dot", f.vec4A[i].Dot(f.vec4B[i]));
+  BENCHMARK_PER_CALL(registry, "Vec4/Length", f.vec4A[i].Length());
+  BENCHMARK_PER_CALL(registry, "Vec4/LengthSquared",
+                     f.vec4A[i].LengthSquared());
+  BENCHMARK_PER_CALL(registry, "Vec4/Normalized", f.vec4A[i].Normalized());
+  BENCHMARK_PER_CALL(registry, "Vec4/Normalize", [&]() {
+    Vec4 v = f.vec4A[i];
+    v.Normalize();
+    return v;
+  }());
+  BENCHMARK_PER_CALL(registry, "Vec4/XYZ", f.vec4A[i].XYZ());
+}
+
+} // namespace Bench
+} // namespace Engine
\ No newline at end of file
@@ -1,16 +1,36 @@
 #include "Engine.h"
 #include "../Math/Math.h"
+#include "../Renderer/FrameGraph.h"
 #include "../Renderer/Renderer.h"
+#include "../Renderer/TextureStreamer.h"
+#include "../Renderer/UploadQueue.h"
 #include "Camera.h"
+#include "JobSystem.h"
 #include "Logger.h"
 
 #include <GLFW/glfw3.h>
+#include <algorithm>
+#include <vector>
 
 namespace Engine {
 
 bool Engine::s_Running = false;
 float Engine::s_LastFrameTime = 0.0f;
 float Engine::s_DeltaTime = 0.0f;
+double Engine::s_FrameStartTime = 0.0;
+
+namespace {
+
+// Work time of the frame begun at 'frameStart', for dynamic resolution. It
+// is taken before the swap, which may wait for vsync and would keep the
+// scale from ever rising again, and is the longer of the CPU time so far
+// and the latest GPU frame time: the frame rate is bound by the slower one.
+float FrameWorkTimeMs(double frameStart) {
+  float cpuMs = static_cast<float>((glfwGetTime() - frameStart) * 1000.0);
+  return std::max(cpuMs, Renderer::GetGpuFrameTime());
+}
+
+} // namespace
 
 bool Engine::Initialize() {
   Logger::Info("Engine", "Initializing 3D Engine...");
@@ -34,12 +54,22 @@ bool Engine::Initialize() {
   // Set event callback
   Platform::Window::SetEventCallback([](Platform::Event &e) { OnEvent(e); });
 
+  // Geometry uploads go through a background thread when one is available
+  UploadQueue::Initialize();
+
+  // Workers for decoding and other CPU-heavy jobs
+  JobSystem::Initialize();
+  TextureStreamer::Initialize();
+
   // Initialize renderer
   if (!Renderer::Initialize()) {
     Logger::Error("Engine", "Failed to initialize Renderer!");
     return false;
   }
 
+  // Drop render resolution under load instead of missing frames
+  Renderer::EnableDynamicResolution();
+
   s_Running = true;
   Logger::Info("Engine", "Engine initialized successfully!");
   return true;
@@ -48,6 +78,9 @@ bool Engine::Initialize() {
 void Engine::Shutdown() {
   Logger::Info("Engine", "Shutting down engine...");
 
+  TextureStreamer::Shutdown();
+  UploadQueue::Shutdown();
+  JobSystem::Shutdown();
   Renderer::Shutdown();
   Platform::Window::Shutdown();
   Logger::Shutdown();
@@ -68,7 +101,17 @@ void Engine::Update() {
     RequestExit();
   }
 
+  // Demos render between Update() calls, so the frame opened at the end of
+  // the previous call is presented here.
+  Renderer::EndFrame();
+  float frameWorkMs =
+      s_FrameStartTime > 0.0 ? FrameWorkTimeMs(s_FrameStartTime) : 0.0f;
   Platform::Window::SwapBuffers();
+
+  TextureStreamer::Update();
+  Renderer::UpdateDynamicResolution(frameWorkMs);
+  Renderer::BeginFrame();
+  s_FrameStartTime = glfwGetTime();
 }
 
 float Engine::GetDeltaTime() { return s_DeltaTime; }
@@ -80,8 +123,10 @@ Platform::Window *Engine::GetWindow() {
 void Engine::Run() {
   Logger::Info("Engine", "Starting main loop...");
 
+  float frameWorkMs = 0.0f;
   while (s_Running) {
-    float time = static_cast<float>(glfwGetTime());
+    double frameStart = glfwGetTime();
+    float time = static_cast<float>(frameStart);
     float deltaTime = time - s_LastFrameTime;
     s_LastFrameTime = time;
 
@@ -93,8 +138,17 @@ void Engine::Run() {
     }
 
     Update(deltaTime);
+
+    // Consumes the screen-size reports from the previous frame
+    TextureStreamer::Update();
+
+    // Work time of the previous frame; deltaTime also holds its vsync wait
+    Renderer::UpdateDynamicResolution(frameWorkMs);
+    Renderer::BeginFrame();
     Render();
+    Renderer::EndFrame();
 
+    frameWorkMs = FrameWorkTimeMs(frameStart);
     Platform::Window::SwapBuffers();
   }
 
@@ -123,8 +177,6 @@ void Engine::Update(float deltaTime) {
 }
 
 void Engine::Render() {
-  Renderer::Clear(0.1f, 0.1f, 0.2f, 1.0f);
-
   // Phase 2: Render a simple rotating cube
   static float time = 0.0f;
   time += 0.016f; // Approximate 60 FPS
@@ -150,13 +202,71 @@ void Engine::Render() {
       Quaternion::FromAxisAngle(Vec3::Right(), Math::ToRadians(rotationX));
   cubeTransform.rotation = yRot * xRot;
 
-  // Render solid cube
-  Renderer::DrawCube(camera, cubeTransform, Vec3(0.8f, 0.6f, 0.4f));
-
-  // Render wireframe cube slightly larger
   Transform wireTransform = cubeTransform;
   wireTransform.scale = Vec3(1.1f, 1.1f, 1.1f);
-  Renderer::DrawWireCube(camera, wireTransform, Vec3(1.0f, 1.0f, 1.0f));
+
+  // Queue the solid cube and a ring of translucent cubes orbiting it; the
+  // passes below draw them sorted
+  Renderer::SubmitCube(camera, cubeTransform, Vec3(0.8f, 0.6f, 0.4f));
+
+  const int orbitCount = 6;
+  static std::vector<Transform> orbitTransforms(orbitCount);
+  static std::vector<Vec3> orbitColors(orbitCount);
+  for (int i = 0; i < orbitCount; ++i) {
+    float angle = time * 0.5f + Math::TWO_PI * i / orbitCount;
+    Transform &orbitTransform = orbitTransforms[i];
+    orbitTransform.position =
+        Vec3(std::cos(angle) * 2.0f, 0.0f, std::sin(angle) * 2.0f);
+    orbitTransform.rotation = cubeTransform.rotation;
+    orbitTransform.scale = Vec3(0.5f, 0.5f, 0.5f);
+
+    orbitColors[i] = Vec3(0.5f + 0.5f * std::cos(angle), 0.4f,
+                          0.5f + 0.5f * std::sin(angle));
+  }
+  Renderer::SubmitCubes(camera, orbitTransforms, orbitColors, 0.45f);
+
+  // The graph is rebuilt every frame; its physical resource pool persists
+  static FrameGraph frameGraph;
+  frameGraph.Reset();
+
+  // Scene color is the renderer's current target (bound by BeginFrame)
+  FrameGraphTextureDesc sceneDesc;
+  sceneDesc.Width = static_cast<uint32_t>(Renderer::GetRenderWidth());
+  sceneDesc.Height = static_cast<uint32_t>(Renderer::GetRenderHeight());
+  FrameGraphResource sceneColor =
+      frameGraph.ImportTexture("SceneColor", sceneDesc);
+
+  // Render opaque geometry front-to-back
+  frameGraph.AddPass(
+      "Opaque", [&](FrameGraphBuilder &builder) { builder.Write(sceneColor); },
+      [&](FrameGraphRegistry &) {
+        Renderer::Clear(0.1f, 0.1f, 0.2f, 1.0f);
+        Renderer::DrawOpaquePass();
+      });
+
+  // Render wireframe cube slightly larger on top
+  frameGraph.AddPass(
+      "Wireframe",
+      [&](FrameGraphBuilder &builder) {
+        builder.Read(sceneColor);
+        builder.Write(sceneColor);
+      },
+      [&](FrameGraphRegistry &) {
+        Renderer::DrawWireCube(camera, wireTransform, Vec3(1.0f, 1.0f, 1.0f));
+      });
+
+  // Blend translucent geometry back-to-front over everything else
+  frameGraph.AddPass(
+      "Transparent",
+      [&](FrameGraphBuilder &builder) {
+        builder.Read(sceneColor);
+        builder.Write(sceneColor);
+      },
+      [&](FrameGraphRegistry &) { Renderer::DrawTransparentPass(); });
+
+  if (frameGraph.Compile()) {
+    frameGraph.Execute();
+  }
 }
 
 bool Engine::OnWindowClose(Platform::Event &event) {
@@ -169,7 +279,19 @@ bool Engine::OnWindowResize(Platform::WindowResizeEvent &event) {
   Logger::Info("Engine", "Window resized to " + std::to_string(event.Width) +
                              "x" + std::to_string(event.Height));
 
+  // Minimized windows report 0x0; keep the last valid scene target
+  if (event.Width == 0 || event.Height == 0) {
+    return false;
+  }
+
+  // The renderer keeps the window size as its presentation viewport and
+  // derives the scaled scene resolution from it.
   Renderer::SetViewport(0, 0, event.Width, event.Height);
+  Logger::Info("Engine", "Rendering at " +
+                             std::to_string(Renderer::GetRenderWidth()) + "x" +
+                             std::to_string(Renderer::GetRenderHeight()) +
+                             " (scale " +
+                             std::to_string(Renderer::GetRenderScale()) + ")");
   return true;
 }
 
@@ -25,6 +25,7 @@ private:
   static bool s_Running;
   static float s_LastFrameTime;
   static float s_DeltaTime;
+  static double s_FrameStartTime;
 
   static void Update(float deltaTime);
   static void Render();
@@ -0,0 +1,164 @@
+#include "JobSystem.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine {
+
+bool JobSystem::s_Running = false;
+uint32_t JobSystem::s_WorkerCount = 0;
+
+namespace {
+
+struct QueuedJob {
+  JobSystem::JobFn Function;
+  std::shared_ptr<std::atomic<uint32_t>> Counter;
+};
+
+std::mutex s_JobMutex;
+std::condition_variable s_JobSignal;
+std::deque<QueuedJob> s_Jobs;
+std::vector<std::thread> s_Workers;
+bool s_StopRequested = false;
+
+void Execute(QueuedJob &job) {
+  job.Function();
+  job.Counter->fetch_sub(1, std::memory_order_release);
+}
+
+} // namespace
+
+void JobSystem::Initialize(uint32_t workerCount) {
+  if (s_Running) {
+    return;
+  }
+
+  if (workerCount == 0) {
+    uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+  }
+
+  s_StopRequested = false;
+  s_WorkerCount = workerCount;
+  s_Running = true;
+  for (uint32_t i = 0; i < workerCount; ++i) {
+    s_Workers.emplace_back(WorkerLoop);
+  }
+
+  Logger::Info("JobSystem",
+               "Started " + std::to_string(workerCount) + " worker threads");
+}
+
+void JobSystem::Shutdown() {
+  if (!s_Running) {
+    return;
+  }
+
+  // Workers drain the queue before exiting
+  {
+    std::lock_guard<std::mutex> lock(s_JobMutex);
+    s_StopRequested = true;
+  }
+  s_JobSignal.notify_all();
+  for (auto &worker : s_Workers) {
+    worker.join();
+  }
+  s_Workers.clear();
+
+  s_Running = false;
+  s_WorkerCount = 0;
+  Logger::Info("JobSystem", "Worker threads stopped");
+}
+
+JobHandle JobSystem::Submit(JobFn job) {
+  auto counter = std::make_shared<std::atomic<uint32_t>>(1);
+
+  if (!s_Running) {
+    QueuedJob immediate{std::move(job), counter};
+    Execute(immediate);
+    return JobHandle(counter);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(s_JobMutex);
+    s_Jobs.push_back({std::move(job), counter});
+  }
+  s_JobSignal.notify_one();
+  return JobHandle(counter);
+}
+
+void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize,
+                            const RangeFn &function) {
+  if (count == 0) {
+    return;
+  }
+  grainSize = std::max(grainSize, 1u);
+
+  uint32_t chunkCount = (count + grainSize - 1) / grainSize;
+  if (!s_Running || chunkCount == 1) {
+    function(0, count);
+    return;
+  }
+
+  auto counter = std::make_shared<std::atomic<uint32_t>>(chunkCount);
+  {
+    std::lock_guard<std::mutex> lock(s_JobMutex);
+    for (uint32_t chunk = 0; chunk < chunkCount; ++chunk) {
+      uint32_t begin = chunk * grainSize;
+      uint32_t end = std::min(begin + grainSize, count);
+      s_Jobs.push_back({[&function, begin, end]() { function(begin, end); },
+                        counter});
+    }
+  }
+  s_JobSignal.notify_all();
+
+  Wait(JobHandle(counter));
+}
+
+void JobSystem::Wait(const JobHandle &handle) {
+  while (!handle.IsDone()) {
+    if (!RunPendingJob()) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+bool JobSystem::RunPendingJob() {
+  QueuedJob job;
+  {
+    std::lock_guard<std::mutex> lock(s_JobMutex);
+    if (s_Jobs.empty()) {
+      return false;
+    }
+    job = std::move(s_Jobs.front());
+    s_Jobs.pop_front();
+  }
+
+  Execute(job);
+  return true;
+}
+
+void JobSystem::WorkerLoop() {
+  while (true) {
+    QueuedJob job;
+    {
+      std::unique_lock<std::mutex> lock(s_JobMutex);
+      s_JobSignal.wait(lock,
+                       [] { return s_StopRequested || !s_Jobs.empty(); });
+      if (s_Jobs.empty()) {
+        return;
+      }
+      job = std::move(s_Jobs.front());
+      s_Jobs.pop_front();
+    }
+
+    Execute(job);
+  }
+}
+
+} // namespace Engine
\ No newline at end of file
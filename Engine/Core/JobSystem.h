@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace Engine {
+
+//============================================================================
+// JobHandle - Tracks completion of one or more submitted jobs
+//============================================================================
+class JobHandle {
+public:
+  JobHandle() = default;
+
+  bool IsValid() const { return m_Counter != nullptr; }
+  bool IsDone() const {
+    return !m_Counter || m_Counter->load(std::memory_order_acquire) == 0;
+  }
+
+private:
+  friend class JobSystem;
+  explicit JobHandle(std::shared_ptr<std::atomic<uint32_t>> counter)
+      : m_Counter(std::move(counter)) {}
+
+  std::shared_ptr<std::atomic<uint32_t>> m_Counter;
+};
+
+//============================================================================
+// JobSystem - Fixed pool of worker threads for CPU work
+//============================================================================
+// Jobs must not touch GL; GPU work goes through UploadQueue. Without
+// Initialize() every job runs inline on the submitting thread, so code
+// using the job system also works in tools and tests.
+class JobSystem {
+public:
+  using JobFn = std::function<void()>;
+  using RangeFn = std::function<void(uint32_t begin, uint32_t end)>;
+
+  // workerCount 0 picks hardware_concurrency - 1 (at least one)
+  static void Initialize(uint32_t workerCount = 0);
+  static void Shutdown();
+
+  static bool IsRunning() { return s_Running; }
+  static uint32_t GetWorkerCount() { return s_WorkerCount; }
+
+  static JobHandle Submit(JobFn job);
+
+  // Splits [0, count) into chunks of at most grainSize and blocks until all
+  // chunks ran. The calling thread executes chunks as well.
+  static void ParallelFor(uint32_t count, uint32_t grainSize,
+                          const RangeFn &function);
+
+  // Runs queued jobs on the calling thread until the handle completes
+  static void Wait(const JobHandle &handle);
+
+private:
+  static bool RunPendingJob();
+  static void WorkerLoop();
+
+private:
+  static bool s_Running;
+  static uint32_t s_WorkerCount;
+};
+
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "RadixSort.h"
+
+#include <utility>
+
+namespace Engine {
+
+namespace {
+
+constexpr uint32_t RadixBits = 11;
+constexpr uint32_t RadixSize = 1u << RadixBits;
+constexpr uint32_t RadixMask = RadixSize - 1;
+constexpr uint32_t PassCount = 3; // 3 x 11 bits covers the 32-bit key
+
+} // namespace
+
+// 'key(i)' is the unsigned key of element i, already flipped for descending
+// order
+template <typename KeyFn>
+const std::vector<uint32_t> &RadixSort::SortBy(uint32_t count, KeyFn key) {
+  m_Keys.resize(count);
+  m_Indices.resize(count);
+  m_ScratchKeys.resize(count);
+  m_ScratchIndices.resize(count);
+
+  // Remap keys and build all three histograms in a single read
+  uint32_t histograms[PassCount][RadixSize] = {};
+  for (uint32_t i = 0; i < count; ++i) {
+    uint32_t value = key(i);
+    m_Keys[i] = value;
+    m_Indices[i] = i;
+    histograms[0][value & RadixMask]++;
+    histograms[1][(value >> RadixBits) & RadixMask]++;
+    histograms[2][value >> (RadixBits * 2)]++;
+  }
+
+  for (uint32_t pass = 0; pass < PassCount; ++pass) {
+    uint32_t shift = pass * RadixBits;
+    uint32_t *histogram = histograms[pass];
+
+    // All keys share this digit (typical for the exponent bits of depths
+    // in a similar range): the pass would not move anything
+    if (count == 0 || histogram[(m_Keys[0] >> shift) & RadixMask] == count) {
+      continue;
+    }
+
+    // Exclusive prefix sum turns counts into output offsets
+    uint32_t offset = 0;
+    for (uint32_t bucket = 0; bucket < RadixSize; ++bucket) {
+      uint32_t bucketCount = histogram[bucket];
+      histogram[bucket] = offset;
+      offset += bucketCount;
+    }
+
+    for (uint32_t i = 0; i < count; ++i) {
+      uint32_t key = m_Keys[i];
+      uint32_t destination = histogram[(key >> shift) & RadixMask]++;
+      m_ScratchKeys[destination] = key;
+      m_ScratchIndices[destination] = m_Indices[i];
+    }
+
+    std::swap(m_Keys, m_ScratchKeys);
+    std::swap(m_Indices, m_ScratchIndices);
+  }
+
+  return m_Indices;
+}
+
+// Descending order sorts the complemented keys ascending, which keeps the
+// sort stable in both directions
+const std::vector<uint32_t> &
+RadixSort::Sort(const float *keys, uint32_t count, SortOrder order) {
+  uint32_t flip = order == SortOrder::Descending ? 0xFFFFFFFFu : 0u;
+  return SortBy(count, [=](uint32_t i) { return FloatToKey(keys[i]) ^ flip; });
+}
+
+const std::vector<uint32_t> &
+RadixSort::SortUnsigned(const uint32_t *keys, uint32_t count,
+                        SortOrder order) {
+  uint32_t flip = order == SortOrder::Descending ? 0xFFFFFFFFu : 0u;
+  return SortBy(count, [=](uint32_t i) { return keys[i] ^ flip; });
+}
+
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Engine {
+
+enum class SortOrder { Ascending, Descending };
+
+//============================================================================
+// RadixSort - Stable LSD radix sort of 32-bit keys into an index order
+//============================================================================
+// Three passes of 11 bits over unsigned keys (floats are remapped to
+// unsigned integers first), so the cost is linear in the element count.
+// Instances keep their scratch buffers, so sorting every frame does not
+// allocate once they have grown.
+class RadixSort {
+public:
+  // Sorts [0, count) by 'keys' and returns the resulting order: element i
+  // of the result is the index of the i-th key. Equal keys keep their
+  // relative order. The returned reference is valid until the next Sort().
+  const std::vector<uint32_t> &Sort(const float *keys, uint32_t count,
+                                    SortOrder order = SortOrder::Ascending);
+  // The same for keys that are already unsigned integers
+  const std::vector<uint32_t> &
+  SortUnsigned(const uint32_t *keys, uint32_t count,
+               SortOrder order = SortOrder::Ascending);
+
+  const std::vector<uint32_t> &GetIndices() const { return m_Indices; }
+
+  // Maps a float to an unsigned key with the same ordering: negative
+  // values have all bits flipped, positive values only the sign bit
+  static uint32_t FloatToKey(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint32_t mask = static_cast<uint32_t>(-static_cast<int32_t>(bits >> 31)) |
+                    0x80000000u;
+    return bits ^ mask;
+  }
+
+private:
+  template <typename KeyFn>
+  const std::vector<uint32_t> &SortBy(uint32_t count, KeyFn key);
+
+private:
+  std::vector<uint32_t> m_Keys;
+  std::vector<uint32_t> m_Indices;
+  std::vector<uint32_t> m_ScratchKeys;
+  std::vector<uint32_t> m_ScratchIndices;
+};
+
+} // namespace Engine
\ No newline at end of file
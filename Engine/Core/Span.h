@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace Engine {
+
+//============================================================================
+// Span - Non-owning view over a contiguous array
+//============================================================================
+// A subset of C++20 std::span (dynamic extent only) so batch APIs can take
+// vectors, arrays and pointer ranges alike. Member names follow std::span so
+// it can be swapped out once the engine moves to C++20.
+template <typename T> class Span {
+public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = size_t;
+  using pointer = T *;
+  using reference = T &;
+  using iterator = T *;
+
+  constexpr Span() = default;
+  constexpr Span(T *data, size_t size) : m_Data(data), m_Size(size) {}
+  constexpr Span(T *first, T *last)
+      : m_Data(first), m_Size(static_cast<size_t>(last - first)) {}
+
+  template <size_t N>
+  constexpr Span(T (&array)[N]) : m_Data(array), m_Size(N) {}
+
+  // Any contiguous container with data() and size(), e.g. std::vector
+  template <typename Container,
+            typename Element = std::remove_pointer_t<
+                decltype(std::data(std::declval<Container &>()))>,
+            typename = std::enable_if_t<
+                std::is_convertible_v<Element (*)[], T (*)[]>>>
+  constexpr Span(Container &container)
+      : m_Data(std::data(container)), m_Size(std::size(container)) {}
+
+  // Span<T> to Span<const T>
+  template <typename U, typename = std::enable_if_t<
+                            std::is_convertible_v<U (*)[], T (*)[]>>>
+  constexpr Span(const Span<U> &other)
+      : m_Data(other.data()), m_Size(other.size()) {}
+
+  constexpr T *data() const { return m_Data; }
+  constexpr size_t size() const { return m_Size; }
+  constexpr size_t size_bytes() const { return m_Size * sizeof(T); }
+  constexpr bool empty() const { return m_Size == 0; }
+
+  constexpr T &operator[](size_t index) const { return m_Data[index]; }
+  constexpr T &front() const { return m_Data[0]; }
+  constexpr T &back() const { return m_Data[m_Size - 1]; }
+
+  constexpr T *begin() const { return m_Data; }
+  constexpr T *end() const { return m_Data + m_Size; }
+
+  constexpr Span first(size_t count) const { return Span(m_Data, count); }
+  constexpr Span last(size_t count) const {
+    return Span(m_Data + m_Size - count, count);
+  }
+  constexpr Span subspan(size_t offset) const {
+    return Span(m_Data + offset, m_Size - offset);
+  }
+  constexpr Span subspan(size_t offset, size_t count) const {
+    return Span(m_Data + offset, count);
+  }
+
+private:
+  T *m_Data = nullptr;
+  size_t m_Size = 0;
+};
+
+} // namespace Engine
\ No newline at end of file
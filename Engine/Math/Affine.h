@@ -0,0 +1,226 @@
+#pragma once
+
+#include "Matrix.h"
+#include "Quaternion.h"
+#include "Vector.h"
+
+namespace Engine {
+namespace Math {
+
+//============================================================================
+// Affine3x4 - Rows 0..2 of an affine Mat4
+//============================================================================
+// Model and bone transforms always end in (0, 0, 0, 1), so only the top
+// three rows are stored: 48 bytes instead of 64, and composing two of them
+// takes 9 multiplies per row instead of 16. Same row-major, column-vector
+// convention as Mat4, so the rows upload directly as three vec4 attributes.
+struct alignas(16) Affine3x4 {
+  union {
+    float data[12];
+    float m[3][4];
+    Vec4 rows[3];
+    __m128 simd_rows[3];
+  };
+
+  // Constructors. All of them initialize 'm', the member the constant
+  // evaluated paths read and write.
+  constexpr Affine3x4()
+      : m{{1.0f, 0.0f, 0.0f, 0.0f},
+          {0.0f, 1.0f, 0.0f, 0.0f},
+          {0.0f, 0.0f, 1.0f, 0.0f}} {}
+
+  constexpr Affine3x4(const Vec4 &row0, const Vec4 &row1, const Vec4 &row2)
+      : m{{row0.x, row0.y, row0.z, row0.w},
+          {row1.x, row1.y, row1.z, row1.w},
+          {row2.x, row2.y, row2.z, row2.w}} {}
+
+  // Drops the last row, which must be (0, 0, 0, 1)
+  constexpr explicit Affine3x4(const Mat4 &matrix)
+      : m{{matrix.m[0][0], matrix.m[0][1], matrix.m[0][2], matrix.m[0][3]},
+          {matrix.m[1][0], matrix.m[1][1], matrix.m[1][2], matrix.m[1][3]},
+          {matrix.m[2][0], matrix.m[2][1], matrix.m[2][2], matrix.m[2][3]}} {}
+
+  static constexpr Affine3x4 Identity() { return Affine3x4(); }
+
+  static constexpr Affine3x4 Translation(const Vec3 &translation) {
+    Affine3x4 result;
+    result.m[0][3] = translation.x;
+    result.m[1][3] = translation.y;
+    result.m[2][3] = translation.z;
+    return result;
+  }
+
+  // Translate * rotate * scale written out directly: the rotation matrix
+  // with its columns scaled and the translation in the last column, no
+  // multiplies between matrices. Same values as the Mat4 product.
+  static constexpr Affine3x4 TRS(const Vec3 &translation,
+                                 const Quaternion &rotation,
+                                 const Vec3 &scale) {
+    float x = rotation.x, y = rotation.y, z = rotation.z, w = rotation.w;
+    float xx = x * x, yy = y * y, zz = z * z;
+    float xy = x * y, xz = x * z, yz = y * z;
+    float wx = w * x, wy = w * y, wz = w * z;
+
+    Affine3x4 result;
+    result.m[0][0] = (1.0f - 2.0f * (yy + zz)) * scale.x;
+    result.m[0][1] = (2.0f * (xy - wz)) * scale.y;
+    result.m[0][2] = (2.0f * (xz + wy)) * scale.z;
+    result.m[0][3] = translation.x;
+
+    result.m[1][0] = (2.0f * (xy + wz)) * scale.x;
+    result.m[1][1] = (1.0f - 2.0f * (xx + zz)) * scale.y;
+    result.m[1][2] = (2.0f * (yz - wx)) * scale.z;
+    result.m[1][3] = translation.y;
+
+    result.m[2][0] = (2.0f * (xz - wy)) * scale.x;
+    result.m[2][1] = (2.0f * (yz + wx)) * scale.y;
+    result.m[2][2] = (1.0f - 2.0f * (xx + yy)) * scale.z;
+    result.m[2][3] = translation.z;
+    return result;
+  }
+
+  constexpr Mat4 ToMat4() const {
+    return Mat4(m[0][0], m[0][1], m[0][2], m[0][3], m[1][0], m[1][1], m[1][2],
+                m[1][3], m[2][0], m[2][1], m[2][2], m[2][3], 0.0f, 0.0f, 0.0f,
+                1.0f);
+  }
+
+  constexpr Vec3 GetTranslation() const {
+    return Vec3(m[0][3], m[1][3], m[2][3]);
+  }
+
+  // Column 'axis' of the 3x3 block, i.e. where the local axis ends up
+  constexpr Vec3 GetAxis(int axis) const {
+    return Vec3(m[0][axis], m[1][axis], m[2][axis]);
+  }
+
+  // Composition: (A * B) applies B first, as for Mat4
+  constexpr Affine3x4 operator*(const Affine3x4 &other) const {
+    // Constant evaluated path sums in the order of the SIMD path
+    if (IsConstantEvaluated()) {
+      Affine3x4 result;
+      for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 4; ++j) {
+          float translation = j == 3 ? m[i][3] : 0.0f;
+          result.m[i][j] =
+              (m[i][0] * other.m[0][j] + m[i][1] * other.m[1][j]) +
+              (m[i][2] * other.m[2][j] + translation);
+        }
+      }
+      return result;
+    }
+    Affine3x4 result;
+    for (int i = 0; i < 3; ++i) {
+      result.simd_rows[i] = ComposeRow(simd_rows[i], other);
+    }
+    return result;
+  }
+
+  constexpr Vec3 TransformPoint(const Vec3 &point) const {
+    return Vec3(m[0][0] * point.x + m[0][1] * point.y + m[0][2] * point.z +
+                    m[0][3],
+                m[1][0] * point.x + m[1][1] * point.y + m[1][2] * point.z +
+                    m[1][3],
+                m[2][0] * point.x + m[2][1] * point.y + m[2][2] * point.z +
+                    m[2][3]);
+  }
+
+  constexpr Vec3 TransformVector(const Vec3 &vector) const {
+    return Vec3(m[0][0] * vector.x + m[0][1] * vector.y + m[0][2] * vector.z,
+                m[1][0] * vector.x + m[1][1] * vector.y + m[1][2] * vector.z,
+                m[2][0] * vector.x + m[2][1] * vector.y + m[2][2] * vector.z);
+  }
+
+  constexpr float Determinant() const {
+    return Row(0).Dot(Row(1).Cross(Row(2)));
+  }
+
+  // Inverse of any invertible affine transform, shear included. The rows
+  // of the inverse 3x3 block are the cross products of this block's rows
+  // over the determinant. Returns identity if the matrix is singular.
+  constexpr Affine3x4 Inverted() const {
+    Vec3 c0 = Row(1).Cross(Row(2));
+    Vec3 c1 = Row(2).Cross(Row(0));
+    Vec3 c2 = Row(0).Cross(Row(1));
+    float det = Row(0).Dot(c0);
+    if (IsNearZero(det)) {
+      return Identity();
+    }
+
+    float invDet = 1.0f / det;
+    return FromInverseColumns(c0 * invDet, c1 * invDet, c2 * invDet);
+  }
+
+  // Inverse of a rotation plus translation: the transposed rotation and the
+  // translation rotated back
+  constexpr Affine3x4 InvertedRigid() const {
+    return FromInverseColumns(Row(0), Row(1), Row(2));
+  }
+
+  // Inverse transpose of the 3x3 block, which keeps normals perpendicular
+  // to surfaces under non-uniform scale and shear. Translation is zero.
+  // Returns identity if the matrix is singular.
+  constexpr Affine3x4 NormalMatrix() const {
+    Vec3 c0 = Row(1).Cross(Row(2));
+    Vec3 c1 = Row(2).Cross(Row(0));
+    Vec3 c2 = Row(0).Cross(Row(1));
+    float det = Row(0).Dot(c0);
+    if (IsNearZero(det)) {
+      return Identity();
+    }
+
+    float invDet = 1.0f / det;
+    return Affine3x4(Vec4(c0 * invDet, 0.0f), Vec4(c1 * invDet, 0.0f),
+                     Vec4(c2 * invDet, 0.0f));
+  }
+
+  // Normal transformed by NormalMatrix() and renormalized
+  constexpr Vec3 TransformNormal(const Vec3 &normal) const {
+    return NormalMatrix().TransformVector(normal).Normalized();
+  }
+
+private:
+  constexpr Vec3 Row(int row) const {
+    return Vec3(m[row][0], m[row][1], m[row][2]);
+  }
+
+  // 'c0'..'c2' are the columns of the inverse 3x3 block; the translation is
+  // -inverse * t with t read from this matrix
+  constexpr Affine3x4 FromInverseColumns(const Vec3 &c0, const Vec3 &c1,
+                                         const Vec3 &c2) const {
+    Vec3 t = GetTranslation();
+    Vec3 r0(c0.x, c1.x, c2.x), r1(c0.y, c1.y, c2.y), r2(c0.z, c1.z, c2.z);
+    return Affine3x4(Vec4(r0, -r0.Dot(t)), Vec4(r1, -r1.Dot(t)),
+                     Vec4(r2, -r2.Dot(t)));
+  }
+
+  // row * other, with other's implicit (0, 0, 0, 1) last row adding row.w
+  // to the translation
+  static __m128 ComposeRow(__m128 row, const Affine3x4 &other) {
+    using Detail::Swizzle;
+    __m128 w = _mm_and_ps(row, _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1)));
+    return _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(Swizzle<0, 0, 0, 0>(row), other.simd_rows[0]),
+                   _mm_mul_ps(Swizzle<1, 1, 1, 1>(row), other.simd_rows[1])),
+        _mm_add_ps(_mm_mul_ps(Swizzle<2, 2, 2, 2>(row), other.simd_rows[2]),
+                   w));
+  }
+
+  friend constexpr Mat4 operator*(const Mat4 &a, const Affine3x4 &b);
+};
+
+// Mat4 times an affine transform, e.g. view-projection * model: three
+// broadcast multiplies per row instead of four
+constexpr Mat4 operator*(const Mat4 &a, const Affine3x4 &b) {
+  if (IsConstantEvaluated()) {
+    return a * b.ToMat4();
+  }
+  Mat4 result;
+  for (int i = 0; i < 4; ++i) {
+    result.simd_rows[i] = Affine3x4::ComposeRow(a.simd_rows[i], b);
+  }
+  return result;
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
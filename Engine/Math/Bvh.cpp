@@ -0,0 +1,674 @@
+#include "Bvh.h"
+#include "../Core/JobSystem.h"
+#include "../Core/RadixSort.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <memory>
+
+namespace Engine {
+namespace Math {
+
+namespace {
+
+constexpr float kInfinity = std::numeric_limits<float>::infinity();
+constexpr uint32_t kMaxBins = 64;
+// Below this depth SAH splits give way to median splits, which bound the
+// remaining depth by log2 of the object count (see kBvhMaxDepth)
+constexpr int kMaxSahDepth = 40;
+// Wide-tree depth of the subtrees Refit() runs as separate jobs
+constexpr int kRefitJobDepth = 2;
+// Objects per job in the passes over every object
+constexpr uint32_t kObjectGrain = 16384;
+
+// Min and max corners in SIMD registers; the fourth lane is padding
+struct Box {
+  SimdFloat4 min;
+  SimdFloat4 max;
+
+  static Box Empty() { return {SimdFloat4(kInfinity), SimdFloat4(-kInfinity)}; }
+  static Box Of(const AABB &box) {
+    return {SimdFloat4::Load(box.min.data), SimdFloat4::Load(box.max.data)};
+  }
+
+  void Grow(SimdFloat4 point) {
+    min = Min(min, point);
+    max = Max(max, point);
+  }
+  void Grow(const Box &box) {
+    min = Min(min, box.min);
+    max = Max(max, box.max);
+  }
+
+  float Extent(int axis) const { return max[axis] - min[axis]; }
+
+  // Half the surface area, zero for empty boxes
+  float HalfArea() const {
+    alignas(16) float extent[4];
+    (max - min).Store(extent);
+    float x = extent[0], y = extent[1], z = extent[2];
+    return x < 0.0f ? 0.0f : x * y + y * z + z * x;
+  }
+};
+
+//============================================================================
+// Binary build
+//============================================================================
+// 'left' is the first of two adjacent children; leaves have none. Children
+// are always allocated after their parent.
+struct BinaryNode {
+  Box box;
+  uint32_t begin;
+  uint32_t count;
+  uint32_t left;
+};
+
+struct Bin {
+  Box box;
+  uint32_t count;
+
+  void Add(const Bin &other) {
+    box.Grow(other.box);
+    count += other.count;
+  }
+};
+
+// Only the first BinCount bins of each axis are used, and only those are
+// cleared, since most splits are of small ranges
+struct BinSet {
+  Bin bins[3][kMaxBins];
+
+  void Reset(uint32_t binCount) {
+    for (int axis = 0; axis < 3; ++axis) {
+      for (uint32_t b = 0; b < binCount; ++b) {
+        bins[axis][b] = {Box::Empty(), 0};
+      }
+    }
+  }
+
+  void Add(const BinSet &other, uint32_t binCount) {
+    for (int axis = 0; axis < 3; ++axis) {
+      for (uint32_t b = 0; b < binCount; ++b) {
+        bins[axis][b].Add(other.bins[axis][b]);
+      }
+    }
+  }
+};
+
+// Spreads the low 10 bits of 'value' to every third bit
+uint32_t SpreadBits(uint32_t value) {
+  value = (value | (value << 16)) & 0x030000FFu;
+  value = (value | (value << 8)) & 0x0300F00Fu;
+  value = (value | (value << 4)) & 0x030C30C3u;
+  value = (value | (value << 2)) & 0x09249249u;
+  return value;
+}
+
+class BinaryBuilder {
+public:
+  BinaryBuilder(Span<const AABB> boxes, const BvhBuildSettings &settings)
+      : m_Boxes(boxes), m_Settings(settings),
+        m_Count(static_cast<uint32_t>(boxes.size())) {
+    m_Settings.MaxLeafSize = std::clamp(m_Settings.MaxLeafSize, 1u, 255u);
+    m_Settings.BinCount = std::clamp(m_Settings.BinCount, 2u, kMaxBins);
+    m_Settings.SubtreeJobSize =
+        std::max(m_Settings.SubtreeJobSize, m_Settings.MaxLeafSize);
+  }
+
+  // Fills Nodes (root 0) and Order, the object indices in leaf order
+  void Build() {
+    Nodes.reset(new BinaryNode[2 * static_cast<size_t>(m_Count)]);
+    Order.resize(m_Count);
+    m_Centroids.resize(m_Count);
+    Box centroids = ComputeCentroids();
+    if (m_Settings.Builder == BvhBuilder::Morton) {
+      SortMorton(centroids);
+    }
+
+    BuildTop(0, 0, m_Count, 0, centroids);
+    JobSystem::ParallelFor(
+        static_cast<uint32_t>(m_Jobs.size()), 1,
+        [&](uint32_t first, uint32_t last) {
+          for (uint32_t i = first; i < last; ++i) {
+            const Job &job = m_Jobs[i];
+            BuildSubtree(job.node, job.begin, job.end, job.depth,
+                         job.centroids);
+          }
+        });
+
+    // The top nodes were split before their subtrees had boxes
+    for (auto node = m_TopNodes.rbegin(); node != m_TopNodes.rend(); ++node) {
+      BinaryNode &parent = Nodes[*node];
+      parent.box = Nodes[parent.left].box;
+      parent.box.Grow(Nodes[parent.left + 1].box);
+    }
+  }
+
+  std::unique_ptr<BinaryNode[]> Nodes;
+  std::vector<uint32_t> Order;
+
+private:
+  struct Job {
+    uint32_t node, begin, end;
+    int depth;
+    Box centroids;
+  };
+
+  Box ComputeCentroids() {
+    uint32_t chunkCount = (m_Count + kObjectGrain - 1) / kObjectGrain;
+    std::vector<Box> partial(chunkCount, Box::Empty());
+    JobSystem::ParallelFor(m_Count, kObjectGrain, [&](uint32_t begin,
+                                                      uint32_t end) {
+      Box &bounds = partial[begin / kObjectGrain];
+      for (uint32_t i = begin; i < end; ++i) {
+        Box box = Box::Of(m_Boxes[i]);
+        m_Centroids[i] = box.min + box.max;
+        bounds.Grow(m_Centroids[i]);
+        Order[i] = i;
+      }
+    });
+    Box centroids = Box::Empty();
+    for (const Box &bounds : partial) {
+      centroids.Grow(bounds);
+    }
+    return centroids;
+  }
+
+  // 10 bits per axis within the centroid bounds, sorted into leaf order
+  void SortMorton(const Box &centroids) {
+    const SimdFloat4 scale = Scale(centroids, 1023.0f);
+    std::vector<uint32_t> codes(m_Count);
+    JobSystem::ParallelFor(
+        m_Count, kObjectGrain, [&](uint32_t begin, uint32_t end) {
+          for (uint32_t i = begin; i < end; ++i) {
+            SimdInt4 cell = ToInt((m_Centroids[i] - centroids.min) * scale);
+            codes[i] = SpreadBits(cell[0]) << 2 | SpreadBits(cell[1]) << 1 |
+                       SpreadBits(cell[2]);
+          }
+        });
+
+    RadixSort sort;
+    Order = sort.SortUnsigned(codes.data(), m_Count);
+    m_Codes.resize(m_Count);
+    for (uint32_t i = 0; i < m_Count; ++i) {
+      m_Codes[i] = codes[Order[i]];
+    }
+  }
+
+  uint32_t AllocatePair() {
+    return m_NodeCount.fetch_add(2, std::memory_order_relaxed);
+  }
+
+  // Splits above the job size run one at a time with parallel binning;
+  // the ranges below them become jobs
+  void BuildTop(uint32_t node, uint32_t begin, uint32_t end, int depth,
+                const Box &centroids) {
+    if (end - begin <= m_Settings.SubtreeJobSize) {
+      m_Jobs.push_back({node, begin, end, depth, centroids});
+      return;
+    }
+    Box leftCentroids, rightCentroids;
+    uint32_t middle =
+        Split(begin, end, depth, centroids, leftCentroids, rightCentroids);
+    uint32_t left = AllocatePair();
+    Nodes[node] = {Box::Empty(), begin, end - begin, left};
+    m_TopNodes.push_back(node);
+    BuildTop(left, begin, middle, depth + 1, leftCentroids);
+    BuildTop(left + 1, middle, end, depth + 1, rightCentroids);
+  }
+
+  Box BuildSubtree(uint32_t node, uint32_t begin, uint32_t end, int depth,
+                   const Box &centroids) {
+    BinaryNode &current = Nodes[node];
+    current.begin = begin;
+    current.count = end - begin;
+    current.left = 0;
+    if (end - begin <= m_Settings.MaxLeafSize) {
+      current.box = Box::Empty();
+      for (uint32_t i = begin; i < end; ++i) {
+        current.box.Grow(Box::Of(m_Boxes[Order[i]]));
+      }
+      return current.box;
+    }
+
+    Box leftCentroids, rightCentroids;
+    uint32_t middle =
+        Split(begin, end, depth, centroids, leftCentroids, rightCentroids);
+    uint32_t left = AllocatePair();
+    current.left = left;
+    Box box =
+        BuildSubtree(left, begin, middle, depth + 1, leftCentroids);
+    box.Grow(BuildSubtree(left + 1, middle, end, depth + 1, rightCentroids));
+    current.box = box;
+    return box;
+  }
+
+  // Reorders [begin, end) into two non-empty halves and returns where the
+  // second starts
+  uint32_t Split(uint32_t begin, uint32_t end, int depth,
+                 const Box &centroids, Box &leftCentroids,
+                 Box &rightCentroids) {
+    if (m_Settings.Builder == BvhBuilder::Morton) {
+      return SplitMorton(begin, end);
+    }
+    if (depth < kMaxSahDepth) {
+      uint32_t middle;
+      if (SplitSah(begin, end, centroids, leftCentroids, rightCentroids,
+                   middle)) {
+        return middle;
+      }
+    }
+    return SplitMedian(begin, end, centroids, leftCentroids, rightCentroids);
+  }
+
+  // At the highest bit where the range's codes differ; equal codes split
+  // in the middle
+  uint32_t SplitMorton(uint32_t begin, uint32_t end) const {
+    uint32_t first = m_Codes[begin], last = m_Codes[end - 1];
+    if (first == last) {
+      return begin + (end - begin) / 2;
+    }
+    uint32_t bit = 0x80000000u;
+    while (!((first ^ last) & bit)) {
+      bit >>= 1;
+    }
+    const uint32_t *codes = m_Codes.data();
+    return static_cast<uint32_t>(
+        std::partition_point(codes + begin, codes + end,
+                             [bit](uint32_t code) { return !(code & bit); }) -
+        codes);
+  }
+
+  // Per axis 'range' over the centroid extent, zero for flat axes
+  static SimdFloat4 Scale(const Box &centroids, float range) {
+    alignas(16) float scale[4] = {};
+    for (int axis = 0; axis < 3; ++axis) {
+      float extent = centroids.Extent(axis);
+      scale[axis] = extent > 0.0f ? range / extent : 0.0f;
+    }
+    return SimdFloat4::Load(scale);
+  }
+
+  // The object's bin on all three axes at once
+  SimdInt4 BinIndices(uint32_t object, const Box &centroids,
+                      SimdFloat4 scale) const {
+    SimdFloat4 offset = (m_Centroids[object] - centroids.min) * scale;
+    return ToInt(Min(offset, SimdFloat4(m_Settings.BinCount - 1.0f)));
+  }
+
+  void FillBins(uint32_t begin, uint32_t end, const Box &centroids,
+                SimdFloat4 scale, BinSet &set) const {
+    for (uint32_t i = begin; i < end; ++i) {
+      uint32_t object = Order[i];
+      Box box = Box::Of(m_Boxes[object]);
+      SimdInt4 bins = BinIndices(object, centroids, scale);
+      for (int axis = 0; axis < 3; ++axis) {
+        Bin &bin = set.bins[axis][bins[axis]];
+        bin.box.Grow(box);
+        ++bin.count;
+      }
+    }
+  }
+
+  // Lowest area x count cost over the bin boundaries of every axis; false
+  // when all centroids coincide
+  bool SplitSah(uint32_t begin, uint32_t end, const Box &centroids,
+                Box &leftCentroids, Box &rightCentroids, uint32_t &middle) {
+    const uint32_t binCount = m_Settings.BinCount;
+    const SimdFloat4 scale = Scale(centroids, static_cast<float>(binCount));
+
+    BinSet set;
+    set.Reset(binCount);
+    uint32_t count = end - begin;
+    if (count > m_Settings.SubtreeJobSize) {
+      uint32_t chunkCount = (count + kObjectGrain - 1) / kObjectGrain;
+      std::vector<BinSet> partial(chunkCount);
+      JobSystem::ParallelFor(
+          count, kObjectGrain, [&](uint32_t first, uint32_t last) {
+            BinSet &chunk = partial[first / kObjectGrain];
+            chunk.Reset(binCount);
+            FillBins(begin + first, begin + last, centroids, scale, chunk);
+          });
+      for (const BinSet &chunk : partial) {
+        set.Add(chunk, binCount);
+      }
+    } else {
+      FillBins(begin, end, centroids, scale, set);
+    }
+
+    float bestCost = kInfinity;
+    int bestAxis = -1;
+    uint32_t bestBin = 0;
+    float rightCost[kMaxBins];
+    for (int axis = 0; axis < 3; ++axis) {
+      if (!(centroids.Extent(axis) > 0.0f)) {
+        continue;
+      }
+      const Bin *bins = set.bins[axis];
+      Box right = Box::Empty();
+      uint32_t rightCount = 0;
+      for (uint32_t b = binCount - 1; b > 0; --b) {
+        right.Grow(bins[b].box);
+        rightCount += bins[b].count;
+        rightCost[b] = right.HalfArea() * rightCount;
+      }
+      Box left = Box::Empty();
+      uint32_t leftCount = 0;
+      for (uint32_t b = 0; b + 1 < binCount; ++b) {
+        left.Grow(bins[b].box);
+        leftCount += bins[b].count;
+        if (leftCount == 0 || leftCount == count) {
+          continue;
+        }
+        float cost = left.HalfArea() * leftCount + rightCost[b + 1];
+        if (cost < bestCost) {
+          bestCost = cost;
+          bestAxis = axis;
+          bestBin = b;
+        }
+      }
+    }
+    if (bestAxis < 0) {
+      return false;
+    }
+
+    uint32_t *order = Order.data();
+    middle = static_cast<uint32_t>(
+        std::partition(order + begin, order + end,
+                       [&](uint32_t object) {
+                         SimdInt4 bins = BinIndices(object, centroids, scale);
+                         return static_cast<uint32_t>(bins[bestAxis]) <=
+                                bestBin;
+                       }) -
+        order);
+    ChildCentroids(begin, middle, end, leftCentroids, rightCentroids);
+    return true;
+  }
+
+  // Halves the range along the widest centroid axis
+  uint32_t SplitMedian(uint32_t begin, uint32_t end, const Box &centroids,
+                       Box &leftCentroids, Box &rightCentroids) {
+    int axis = 0;
+    for (int a = 1; a < 3; ++a) {
+      if (centroids.Extent(a) > centroids.Extent(axis)) {
+        axis = a;
+      }
+    }
+    uint32_t middle = begin + (end - begin) / 2;
+    uint32_t *order = Order.data();
+    std::nth_element(order + begin, order + middle, order + end,
+                     [&](uint32_t a, uint32_t b) {
+                       return m_Centroids[a][axis] < m_Centroids[b][axis];
+                     });
+    ChildCentroids(begin, middle, end, leftCentroids, rightCentroids);
+    return middle;
+  }
+
+  void ChildCentroids(uint32_t begin, uint32_t middle, uint32_t end,
+                      Box &leftCentroids, Box &rightCentroids) const {
+    leftCentroids = rightCentroids = Box::Empty();
+    for (uint32_t i = begin; i < middle; ++i) {
+      leftCentroids.Grow(m_Centroids[Order[i]]);
+    }
+    for (uint32_t i = middle; i < end; ++i) {
+      rightCentroids.Grow(m_Centroids[Order[i]]);
+    }
+  }
+
+  Span<const AABB> m_Boxes;
+  BvhBuildSettings m_Settings;
+  uint32_t m_Count;
+  // Twice each box's center, which orders and bins the same
+  std::vector<SimdFloat4> m_Centroids;
+  // Morton codes in leaf order
+  std::vector<uint32_t> m_Codes;
+  std::atomic<uint32_t> m_NodeCount{1};
+  std::vector<Job> m_Jobs;
+  std::vector<uint32_t> m_TopNodes;
+};
+
+// All lanes of a node; empty lanes are inverted boxes, which leave the
+// union unchanged
+template <int Width> Box Union(const BvhNode<Width> &node) {
+  Box box = Box::Empty();
+  for (int lane = 0; lane < Width; ++lane) {
+    box.Grow(Box{SimdFloat4(node.Bounds[0][lane], node.Bounds[1][lane],
+                            node.Bounds[2][lane], 0.0f),
+                 SimdFloat4(node.Bounds[3][lane], node.Bounds[4][lane],
+                            node.Bounds[5][lane], 0.0f)});
+  }
+  return box;
+}
+
+//============================================================================
+// Collapse to wide nodes
+//============================================================================
+template <int Width> void SetLane(BvhNode<Width> &node, int lane,
+                                  const Box &box) {
+  alignas(16) float min[4], max[4];
+  box.min.Store(min);
+  box.max.Store(max);
+  for (int axis = 0; axis < 3; ++axis) {
+    node.Bounds[axis][lane] = min[axis];
+    node.Bounds[axis + 3][lane] = max[axis];
+  }
+}
+
+// Each wide node takes the children of a binary node and keeps opening
+// the inner child with the largest area until it has Width of them.
+// Opening replaces a child by its two children in place, so every node's
+// objects stay one contiguous leaf-order range.
+template <int Width> struct Collapse {
+  using Node = BvhNode<Width>;
+
+  const BinaryNode *binary;
+  std::vector<Node> &nodes;
+  std::vector<std::pair<uint32_t, uint32_t>> &refitRanges;
+  std::vector<uint32_t> &topNodes;
+
+  uint32_t Emit(uint32_t source, int depth) {
+    const BinaryNode &parent = binary[source];
+    uint32_t lanes[Width];
+    int count = 0;
+    if (parent.left == 0) {
+      lanes[count++] = source;
+    } else {
+      lanes[count++] = parent.left;
+      lanes[count++] = parent.left + 1;
+    }
+    while (count < Width) {
+      int widest = -1;
+      float widestArea = -1.0f;
+      for (int lane = 0; lane < count; ++lane) {
+        const BinaryNode &child = binary[lanes[lane]];
+        if (child.left != 0 && child.box.HalfArea() > widestArea) {
+          widest = lane;
+          widestArea = child.box.HalfArea();
+        }
+      }
+      if (widest < 0) {
+        break;
+      }
+      uint32_t opened = binary[lanes[widest]].left;
+      std::copy_backward(lanes + widest + 1, lanes + count,
+                         lanes + count + 1);
+      lanes[widest] = opened;
+      lanes[widest + 1] = opened + 1;
+      ++count;
+    }
+
+    Node node;
+    for (int lane = 0; lane < Width; ++lane) {
+      if (lane >= count) {
+        SetLane(node, lane, Box::Empty());
+        node.Children[lane] = Node::kEmpty;
+        node.Counts[lane] = 0;
+        continue;
+      }
+      const BinaryNode &child = binary[lanes[lane]];
+      SetLane(node, lane, child.box);
+      bool leaf = child.left == 0;
+      node.Children[lane] = leaf ? Node::kLeaf | child.begin : 0;
+      node.Counts[lane] = leaf ? static_cast<uint8_t>(child.count) : 0;
+    }
+    node.ObjectBegin = parent.begin;
+    node.ObjectCount = parent.count;
+
+    uint32_t index = static_cast<uint32_t>(nodes.size());
+    nodes.push_back(node);
+    if (depth < kRefitJobDepth) {
+      topNodes.push_back(index);
+    }
+    for (int lane = 0; lane < count; ++lane) {
+      if (binary[lanes[lane]].left != 0) {
+        uint32_t child = Emit(lanes[lane], depth + 1);
+        nodes[index].Children[lane] = child;
+      }
+    }
+    if (depth == kRefitJobDepth) {
+      refitRanges.push_back({index, static_cast<uint32_t>(nodes.size())});
+    }
+    return index;
+  }
+};
+
+} // namespace
+
+//============================================================================
+// Bvh
+//============================================================================
+template <int Width>
+void Bvh<Width>::Build(Span<const AABB> boxes,
+                       const BvhBuildSettings &settings) {
+  Clear();
+  if (boxes.empty()) {
+    return;
+  }
+  assert(boxes.size() < Node::kLeaf);
+
+  BinaryBuilder builder(boxes, settings);
+  builder.Build();
+  m_Objects = std::move(builder.Order);
+
+  m_Bounds.resize(m_Objects.size());
+  JobSystem::ParallelFor(static_cast<uint32_t>(m_Objects.size()),
+                         kObjectGrain, [&](uint32_t begin, uint32_t end) {
+                           for (uint32_t i = begin; i < end; ++i) {
+                             m_Bounds[i] = boxes[m_Objects[i]];
+                           }
+                         });
+
+  m_Nodes.reserve(m_Objects.size() / 2 + 1);
+  Collapse<Width>{builder.Nodes.get(), m_Nodes, m_RefitRanges, m_TopNodes}
+      .Emit(0, 0);
+}
+
+template <int Width> void Bvh<Width>::Refit(Span<const AABB> boxes) {
+  assert(boxes.size() == m_Objects.size());
+  JobSystem::ParallelFor(static_cast<uint32_t>(m_Objects.size()),
+                         kObjectGrain, [&](uint32_t begin, uint32_t end) {
+                           for (uint32_t i = begin; i < end; ++i) {
+                             m_Bounds[i] = boxes[m_Objects[i]];
+                           }
+                         });
+
+  // Children come after their parents, so reverse order is bottom up
+  JobSystem::ParallelFor(
+      static_cast<uint32_t>(m_RefitRanges.size()), 1,
+      [&](uint32_t first, uint32_t last) {
+        for (uint32_t range = first; range < last; ++range) {
+          auto [begin, end] = m_RefitRanges[range];
+          for (uint32_t node = end; node-- > begin;) {
+            RefitNode(node);
+          }
+        }
+      });
+  for (auto node = m_TopNodes.rbegin(); node != m_TopNodes.rend(); ++node) {
+    RefitNode(*node);
+  }
+}
+
+template <int Width> void Bvh<Width>::RefitNode(uint32_t index) {
+  Node &node = m_Nodes[index];
+  for (int lane = 0; lane < Width; ++lane) {
+    uint32_t child = node.Children[lane];
+    if (child == Node::kEmpty) {
+      continue;
+    }
+    Box box = Box::Empty();
+    if (child & Node::kLeaf) {
+      uint32_t begin = child & ~Node::kLeaf;
+      for (uint32_t i = begin; i < begin + node.Counts[lane]; ++i) {
+        box.Grow(Box::Of(m_Bounds[i]));
+      }
+    } else {
+      box = Union(m_Nodes[child]);
+    }
+    SetLane(node, lane, box);
+  }
+}
+
+template <int Width> void Bvh<Width>::Clear() {
+  m_Nodes.clear();
+  m_Objects.clear();
+  m_Bounds.clear();
+  m_RefitRanges.clear();
+  m_TopNodes.clear();
+}
+
+template <int Width>
+size_t Bvh<Width>::Cull(const Frustum &frustum,
+                        Span<uint32_t> visibleIndices) const {
+  return MathKernels::Get().CullBvh(frustum.planes, GetView(),
+                                    visibleIndices.data(),
+                                    visibleIndices.size());
+}
+
+template <int Width>
+bool Bvh<Width>::Raycast(const Ray &ray, RayHit &hit, RayQuery query) const {
+  float limit = hit.T;
+  MathKernels::Get().RaycastBvh(GetView(), &ray, &hit, 1,
+                                query == RayQuery::Any);
+  return hit.T < limit;
+}
+
+template <int Width>
+void Bvh<Width>::Raycast(Span<const Ray> rays, Span<RayHit> hits,
+                         RayQuery query, uint32_t grainSize) const {
+  auto kernel = MathKernels::Get().RaycastBvh;
+  const BvhView view = GetView();
+  bool anyHit = query == RayQuery::Any;
+  JobSystem::ParallelFor(
+      static_cast<uint32_t>(std::min(rays.size(), hits.size())), grainSize,
+      [&](uint32_t begin, uint32_t end) {
+        kernel(view, rays.data() + begin, hits.data() + begin, end - begin,
+               anyHit);
+      });
+}
+
+template <int Width> AABB Bvh<Width>::GetBounds() const {
+  if (m_Nodes.empty()) {
+    return AABB();
+  }
+  Box box = Union(m_Nodes[0]);
+  return AABB(Vec3(box.min[0], box.min[1], box.min[2]),
+              Vec3(box.max[0], box.max[1], box.max[2]));
+}
+
+template <int Width> BvhView Bvh<Width>::GetView() const {
+  BvhView view;
+  view.Width = Width;
+  view.Nodes = m_Nodes.data();
+  view.NodeCount = m_Nodes.size();
+  view.Objects = m_Objects.data();
+  view.Bounds = m_Bounds.data();
+  view.ObjectCount = m_Objects.size();
+  return view;
+}
+
+template class Bvh<4>;
+template class Bvh<8>;
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,527 @@
+#pragma once
+
+// Bounding volume hierarchy over axis-aligned boxes, so frustum culling and
+// ray queries visit O(log N) nodes instead of every object.
+//
+// Build() makes a binary tree, either by binned SAH (best queries; static
+// geometry) or by sorting Morton codes (LBVH: several times faster to
+// build; scenes rebuilt every few frames), then collapses it to Width-wide
+// nodes stored depth first. A node keeps its children's boxes as one array
+// per component, so a single ray or frustum test covers all children in
+// SIMD registers on the MathKernels set for this CPU.
+//
+// Refit() moves the boxes without changing the topology: queries stay
+// exact, but get slower as objects drift from where they were at build
+// time, so rebuild once refits have moved things far.
+
+#include "../Core/Span.h"
+#include "FastMath.h"
+#include "Math.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace Engine {
+namespace Math {
+
+enum class BvhBuilder { BinnedSah, Morton };
+
+// Closest hit, or any hit nearer than the RayHit's T (shadow and
+// visibility rays)
+enum class RayQuery { Closest, Any };
+
+struct BvhBuildSettings {
+  BvhBuilder Builder = BvhBuilder::BinnedSah;
+  // Ranges this small become leaves; at most 255
+  uint32_t MaxLeafSize = 4;
+  // Split candidates per axis for the SAH builder, 2 to 64
+  uint32_t BinCount = 16;
+  // With the job system running, ranges up to this many objects are built
+  // as one job each; larger ones are split with parallel binning passes
+  uint32_t SubtreeJobSize = 16384;
+};
+
+// Binary depth the builders never exceed; sizes the traversal stacks
+constexpr int kBvhMaxDepth = 80;
+
+//============================================================================
+// BvhNode - Width children, boxes stored one component array at a time
+//============================================================================
+// Children[i] is a node index, kLeaf | the first object of a leaf in leaf
+// order (with Counts[i] objects), or kEmpty. Empty lanes have inverted
+// boxes (min +inf, max -inf), which every test rejects without a branch.
+template <int Width> struct alignas(32) BvhNode {
+  static constexpr uint32_t kLeaf = 0x80000000u;
+  static constexpr uint32_t kEmpty = 0xFFFFFFFFu;
+
+  // Min x, y, z then max x, y, z of each child
+  float Bounds[6][Width];
+  uint32_t Children[Width];
+  uint8_t Counts[Width];
+  // Leaf-order range of every object below this node
+  uint32_t ObjectBegin;
+  uint32_t ObjectCount;
+};
+
+static_assert(sizeof(BvhNode<4>) == 128, "BvhNode<4> spans two cache lines");
+static_assert(sizeof(BvhNode<8>) == 256, "BvhNode<8> spans four cache lines");
+
+// A Bvh's arrays for the kernel table, which takes either width
+struct BvhView {
+  int Width = 4;
+  const void *Nodes = nullptr;
+  size_t NodeCount = 0;
+  // Object index and box of each object in leaf order
+  const uint32_t *Objects = nullptr;
+  const AABB *Bounds = nullptr;
+  size_t ObjectCount = 0;
+};
+
+//============================================================================
+// Bvh - Hierarchy of Width-wide nodes (Bvh4, Bvh8)
+//============================================================================
+// Object i is the i-th box passed to Build(). Queries are const and may
+// run concurrently; Build() and Refit() may not overlap them.
+template <int Width> class Bvh {
+public:
+  static_assert(Width == 4 || Width == 8, "Bvh supports widths 4 and 8");
+  using Node = BvhNode<Width>;
+
+  void Build(Span<const AABB> boxes, const BvhBuildSettings &settings = {});
+
+  // New boxes for the same objects, in the same order as for Build()
+  void Refit(Span<const AABB> boxes);
+
+  void Clear();
+
+  // Writes the indices of the objects intersecting the frustum, in no
+  // particular order, and returns how many there are; stops once
+  // 'visibleIndices' is full. Subtrees entirely inside the frustum are
+  // copied without testing their objects.
+  size_t Cull(const Frustum &frustum, Span<uint32_t> visibleIndices) const;
+
+  // Boxes hit as Ray::IntersectAABB() would, with the semantics of RayHit:
+  // only hits nearer than hit.T count. Returns whether one was found.
+  bool Raycast(const Ray &ray, RayHit &hit,
+               RayQuery query = RayQuery::Closest) const;
+
+  // With the job system running, chunks of 'grainSize' rays run in
+  // parallel
+  void Raycast(Span<const Ray> rays, Span<RayHit> hits,
+               RayQuery query = RayQuery::Closest,
+               uint32_t grainSize = 1024) const;
+
+  // Exact primitives inside the boxes: intersect(object, t, u, v) returns
+  // whether the object is hit and where; the boxes only prune the search
+  template <typename Intersect>
+  bool Raycast(const Ray &ray, RayHit &hit, Intersect intersect,
+               RayQuery query = RayQuery::Closest) const;
+
+  bool IsEmpty() const { return m_Nodes.empty(); }
+  size_t GetObjectCount() const { return m_Objects.size(); }
+  Span<const Node> GetNodes() const { return m_Nodes; }
+  // Object indices in leaf order
+  Span<const uint32_t> GetObjects() const { return m_Objects; }
+  AABB GetBounds() const;
+
+  BvhView GetView() const;
+
+private:
+  void RefitNode(uint32_t index);
+
+private:
+  std::vector<Node> m_Nodes;
+  std::vector<uint32_t> m_Objects;
+  // Object boxes in leaf order
+  std::vector<AABB> m_Bounds;
+  // Refit() runs the subtrees below the top two levels as separate jobs
+  // (node ranges, since subtrees are contiguous), then the top nodes
+  std::vector<std::pair<uint32_t, uint32_t>> m_RefitRanges;
+  std::vector<uint32_t> m_TopNodes;
+};
+
+using Bvh4 = Bvh<4>;
+using Bvh8 = Bvh<8>;
+
+extern template class Bvh<4>;
+extern template class Bvh<8>;
+
+//============================================================================
+// BvhQuery - Traversal, shared by the kernels of every level
+//============================================================================
+// F is float, SimdFloat4 or SimdFloat8; the lanes of a node are tested
+// F::Width at a time.
+inline namespace ENGINE_SIMD_NAMESPACE {
+namespace BvhQuery {
+
+using FastMath::MulAdd;
+
+// Scalar forms, as Math::Min() and Math::Max(); the kernels of every level
+// include this, so nothing here may call inline code of the baseline
+inline float Min(float a, float b) { return a < b ? a : b; }
+inline float Max(float a, float b) { return a > b ? a : b; }
+
+template <typename F> struct Lanes {
+  static constexpr int Count = F::Width;
+  static F Load(const float *aligned) { return F::Load(aligned); }
+  static void Store(float *aligned, F value) { value.Store(aligned); }
+  static uint32_t Bits(F mask) { return static_cast<uint32_t>(MoveMask(mask)); }
+};
+
+template <> struct Lanes<float> {
+  static constexpr int Count = 1;
+  static float Load(const float *value) { return *value; }
+  static void Store(float *out, float value) { *out = value; }
+  static uint32_t Bits(bool mask) { return mask ? 1u : 0u; }
+};
+
+// The natural lane type for a node width on SIMD levels
+template <int Width>
+using NodeLanes = std::conditional_t<Width == 4, SimdFloat4, SimdFloat8>;
+
+// Index of the lowest set bit of a non-zero lane mask
+inline int LowestLane(uint32_t bits) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long lane;
+  _BitScanForward(&lane, bits);
+  return static_cast<int>(lane);
+#else
+  return __builtin_ctz(bits);
+#endif
+}
+
+// Lanes holding leaves (and empty lanes, which never test as hit)
+template <int Width> uint32_t LeafLanes(const BvhNode<Width> &node) {
+  uint32_t bits = 0;
+  for (int lane = 0; lane < Width; ++lane) {
+    bits |= (node.Children[lane] >> 31) << lane;
+  }
+  return bits;
+}
+
+//----------------------------------------------------------------------------
+// Frustum
+//----------------------------------------------------------------------------
+// Planes broadcast with, per plane and axis, the bound row of the corner
+// farthest along the normal (p) and the one farthest against it (n). A box
+// touches the plane when p is on the inner side, and is inside it when n
+// is. The same sums decide single objects, so a node is never rejected
+// while one of its objects would pass.
+template <typename F> struct FrustumLanes {
+  F nx[6], ny[6], nz[6], d[6];
+  int p[6][3], n[6][3];
+  const Vec4 *planes;
+
+  explicit FrustumLanes(const Vec4 *planes) : planes(planes) {
+    for (int i = 0; i < 6; ++i) {
+      nx[i] = F(planes[i].x);
+      ny[i] = F(planes[i].y);
+      nz[i] = F(planes[i].z);
+      d[i] = F(planes[i].w);
+      const float normal[3] = {planes[i].x, planes[i].y, planes[i].z};
+      for (int axis = 0; axis < 3; ++axis) {
+        bool positive = normal[axis] >= 0.0f;
+        p[i][axis] = positive ? axis + 3 : axis;
+        n[i][axis] = positive ? axis : axis + 3;
+      }
+    }
+  }
+
+  // Bits of the lanes touching all planes and of those inside all of them
+  template <int Width>
+  void Test(const float (&bounds)[6][Width], uint32_t &touching,
+            uint32_t &inside) const {
+    touching = inside = 0;
+    for (int g = 0; g < Width; g += Lanes<F>::Count) {
+      auto touchAll = Distance(0, p[0], bounds, g) >= F(0.0f);
+      auto insideAll = Distance(0, n[0], bounds, g) >= F(0.0f);
+      for (int i = 1; i < 6; ++i) {
+        touchAll = touchAll & (Distance(i, p[i], bounds, g) >= F(0.0f));
+        insideAll = insideAll & (Distance(i, n[i], bounds, g) >= F(0.0f));
+      }
+      touching |= Lanes<F>::Bits(touchAll) << g;
+      inside |= Lanes<F>::Bits(insideAll) << g;
+    }
+    inside &= touching;
+  }
+
+  bool Touches(const AABB &box) const {
+    const float bounds[6] = {box.min.x, box.min.y, box.min.z,
+                             box.max.x, box.max.y, box.max.z};
+    for (int i = 0; i < 6; ++i) {
+      float far = FastMath::MulAdd(
+          planes[i].x, bounds[p[i][0]],
+          FastMath::MulAdd(planes[i].y, bounds[p[i][1]],
+                           FastMath::MulAdd(planes[i].z, bounds[p[i][2]],
+                                            planes[i].w)));
+      if (!(far >= 0.0f)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  // Signed distance of plane i to the corner with the given bound rows
+  template <int Width>
+  F Distance(int i, const int (&rows)[3], const float (&bounds)[6][Width],
+             int g) const {
+    return MulAdd(nx[i], Lanes<F>::Load(&bounds[rows[0]][g]),
+                  MulAdd(ny[i], Lanes<F>::Load(&bounds[rows[1]][g]),
+                         MulAdd(nz[i], Lanes<F>::Load(&bounds[rows[2]][g]),
+                                d[i])));
+  }
+};
+
+// Appends leaf-order objects to 'visible' until 'capacity' is reached
+struct CullOutput {
+  const uint32_t *objects;
+  uint32_t *visible;
+  size_t capacity;
+  size_t count = 0;
+
+  void Range(uint32_t begin, uint32_t objectCount) {
+    const size_t room = capacity - count;
+    const size_t n = objectCount < room ? objectCount : room;
+    for (size_t i = 0; i < n; ++i) {
+      visible[count + i] = objects[begin + i];
+    }
+    count += n;
+  }
+  void One(uint32_t index) {
+    if (count < capacity) {
+      visible[count++] = objects[index];
+    }
+  }
+};
+
+template <typename F, int Width>
+size_t Cull(const Vec4 *planes, const BvhView &bvh, uint32_t *visible,
+            size_t capacity) {
+  using Node = BvhNode<Width>;
+  if (bvh.NodeCount == 0) {
+    return 0;
+  }
+  const Node *nodes = static_cast<const Node *>(bvh.Nodes);
+  const FrustumLanes<F> frustum(planes);
+  CullOutput out{bvh.Objects, visible, capacity};
+
+  uint32_t stack[kBvhMaxDepth * Width];
+  int top = 0;
+  stack[top++] = 0;
+  while (top > 0 && out.count < capacity) {
+    const Node &node = nodes[stack[--top]];
+    uint32_t touching, inside;
+    frustum.Test(node.Bounds, touching, inside);
+    for (; touching != 0; touching &= touching - 1) {
+      int lane = LowestLane(touching);
+      uint32_t child = node.Children[lane];
+      bool contained = (inside >> lane) & 1u;
+      if (child & Node::kLeaf) {
+        uint32_t begin = child & ~Node::kLeaf;
+        uint32_t count = node.Counts[lane];
+        if (contained) {
+          out.Range(begin, count);
+          continue;
+        }
+        for (uint32_t i = begin; i < begin + count; ++i) {
+          if (frustum.Touches(bvh.Bounds[i])) {
+            out.One(i);
+          }
+        }
+      } else if (contained) {
+        out.Range(nodes[child].ObjectBegin, nodes[child].ObjectCount);
+      } else {
+        stack[top++] = child;
+      }
+    }
+  }
+  return out.count;
+}
+
+//----------------------------------------------------------------------------
+// Rays
+//----------------------------------------------------------------------------
+// Slab test of one ray against every lane of a node. Per axis the entry
+// plane is the min bound for positive directions and the max bound for
+// negative ones, which also turns the inverted empty lanes into misses.
+// Lanes whose entry lies beyond tMax are culled along with the misses.
+template <typename F> struct RayLanes {
+  F ox, oy, oz, ix, iy, iz;
+  int nearRow[3], farRow[3];
+
+  RayLanes(const Ray &ray, const float (&invDir)[3])
+      : ox(ray.origin.x), oy(ray.origin.y), oz(ray.origin.z), ix(invDir[0]),
+        iy(invDir[1]), iz(invDir[2]) {
+    for (int axis = 0; axis < 3; ++axis) {
+      bool negative = invDir[axis] < 0.0f;
+      nearRow[axis] = negative ? axis + 3 : axis;
+      farRow[axis] = negative ? axis : axis + 3;
+    }
+  }
+
+  template <int Width>
+  uint32_t Test(const float (&bounds)[6][Width], float tMax,
+                float (&entry)[Width]) const {
+    uint32_t hits = 0;
+    for (int g = 0; g < Width; g += Lanes<F>::Count) {
+      F nearX = (Lanes<F>::Load(&bounds[nearRow[0]][g]) - ox) * ix;
+      F nearY = (Lanes<F>::Load(&bounds[nearRow[1]][g]) - oy) * iy;
+      F nearZ = (Lanes<F>::Load(&bounds[nearRow[2]][g]) - oz) * iz;
+      F farX = (Lanes<F>::Load(&bounds[farRow[0]][g]) - ox) * ix;
+      F farY = (Lanes<F>::Load(&bounds[farRow[1]][g]) - oy) * iy;
+      F farZ = (Lanes<F>::Load(&bounds[farRow[2]][g]) - oz) * iz;
+      F tNear = Max(Max(nearX, nearY), Max(nearZ, F(0.0f)));
+      F tFar = Min(Min(farX, farY), Min(farZ, F(tMax)));
+      Lanes<F>::Store(&entry[g], tNear);
+      hits |= Lanes<F>::Bits(tNear <= tFar) << g;
+    }
+    return hits;
+  }
+};
+
+// Ray::InverseDirection()
+inline void InverseDirection(const Ray &ray, float (&invDir)[3]) {
+  invDir[0] = 1.0f / ray.direction.x;
+  invDir[1] = 1.0f / ray.direction.y;
+  invDir[2] = 1.0f / ray.direction.z;
+}
+
+// Ray::IntersectAABB() against one object box
+inline bool IntersectBox(const Ray &ray, const float (&invDir)[3],
+                         const AABB &box, float &t) {
+  const float origin[3] = {ray.origin.x, ray.origin.y, ray.origin.z};
+  const float low[3] = {box.min.x, box.min.y, box.min.z};
+  const float high[3] = {box.max.x, box.max.y, box.max.z};
+  float tmin[3], tmax[3];
+  for (int axis = 0; axis < 3; ++axis) {
+    const float t1 = (low[axis] - origin[axis]) * invDir[axis];
+    const float t2 = (high[axis] - origin[axis]) * invDir[axis];
+    tmin[axis] = Min(t1, t2);
+    tmax[axis] = Max(t1, t2);
+  }
+  const float tNear = Max(Max(tmin[0], tmin[1]), tmin[2]);
+  const float tFar = Min(Min(tmax[0], tmax[1]), tmax[2]);
+  if (tNear > tFar || tFar < 0.0f) {
+    return false;
+  }
+  t = tNear > 0.0f ? tNear : tFar;
+  return true;
+}
+
+// 'intersect(i, t, u, v)' tests the object at leaf-order index i. Leaves
+// are tested as soon as their box is hit; the ray then moves on to the
+// nearest inner child and stacks the others, and stacked subtrees whose
+// entry lies beyond the closest hit so far are dropped. An any-hit query
+// stops at its first hit.
+template <typename F, int Width, typename Intersect>
+bool Raycast(const BvhView &bvh, const Ray &ray, RayHit &hit, bool anyHit,
+             Intersect intersect) {
+  using Node = BvhNode<Width>;
+  if (bvh.NodeCount == 0) {
+    return false;
+  }
+  const Node *nodes = static_cast<const Node *>(bvh.Nodes);
+  float invDir[3];
+  InverseDirection(ray, invDir);
+  const RayLanes<F> lanes(ray, invDir);
+
+  struct Entry {
+    uint32_t node;
+    float t;
+  };
+  Entry stack[kBvhMaxDepth * Width];
+  int top = 0;
+  uint32_t current = 0;
+  bool found = false;
+
+  for (;;) {
+    const Node &node = nodes[current];
+    alignas(32) float tNear[Width];
+    uint32_t hits = lanes.Test(node.Bounds, hit.T, tNear);
+    uint32_t leaves = LeafLanes(node);
+
+    for (uint32_t bits = hits & leaves; bits != 0; bits &= bits - 1) {
+      int lane = LowestLane(bits);
+      if (tNear[lane] > hit.T) {
+        continue;
+      }
+      uint32_t begin = node.Children[lane] & ~Node::kLeaf;
+      for (uint32_t i = begin; i < begin + node.Counts[lane]; ++i) {
+        float t = 0.0f, u = 0.0f, v = 0.0f;
+        if (intersect(i, t, u, v) && t < hit.T) {
+          hit.T = t;
+          hit.Index = bvh.Objects[i];
+          hit.U = u;
+          hit.V = v;
+          found = true;
+          if (anyHit) {
+            return true;
+          }
+        }
+      }
+    }
+
+    // Inner children near to far; usually only one or two are hit
+    int order[Width], count = 0;
+    for (uint32_t bits = hits & ~leaves; bits != 0; bits &= bits - 1) {
+      int lane = LowestLane(bits), slot = count++;
+      for (; slot > 0 && tNear[order[slot - 1]] > tNear[lane]; --slot) {
+        order[slot] = order[slot - 1];
+      }
+      order[slot] = lane;
+    }
+    while (count > 1) {
+      int lane = order[--count];
+      stack[top++] = {node.Children[lane], tNear[lane]};
+    }
+    if (count == 1 && tNear[order[0]] <= hit.T) {
+      current = node.Children[order[0]];
+      continue;
+    }
+
+    do {
+      if (top == 0) {
+        return found;
+      }
+    } while (stack[--top].t > hit.T);
+    current = stack[top].node;
+  }
+}
+
+// Against the object boxes, as Ray::IntersectAABB()
+template <typename F, int Width>
+bool Raycast(const BvhView &bvh, const Ray &ray, RayHit &hit, bool anyHit) {
+  float invDir[3];
+  InverseDirection(ray, invDir);
+  return Raycast<F, Width>(bvh, ray, hit, anyHit,
+                           [&](uint32_t i, float &t, float &, float &) {
+                             return IntersectBox(ray, invDir, bvh.Bounds[i],
+                                                 t);
+                           });
+}
+
+} // namespace BvhQuery
+} // namespace ENGINE_SIMD_NAMESPACE
+
+template <int Width>
+template <typename Intersect>
+bool Bvh<Width>::Raycast(const Ray &ray, RayHit &hit, Intersect intersect,
+                         RayQuery query) const {
+  const uint32_t *objects = m_Objects.data();
+  return BvhQuery::Raycast<BvhQuery::NodeLanes<Width>, Width>(
+      GetView(), ray, hit, query == RayQuery::Any,
+      [&](uint32_t i, float &t, float &u, float &v) {
+        return intersect(objects[i], t, u, v);
+      });
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
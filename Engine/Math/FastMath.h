@@ -0,0 +1,220 @@
+#pragma once
+
+// Polynomial sin/cos, atan2 and acos plus refined rsqrt, in three accuracy
+// tiers. Every function is a template over float, SimdFloat4 and
+// SimdFloat8, so per-object code and SoA packets share one implementation.
+//
+// Max error against double-precision libm (Tests/FastMathTests.cpp):
+//
+//            Fast                Medium              Precise
+//   SinCos   1.7e-5 abs          1.1e-7 abs          2 ulp
+//   Atan2    1.7e-4 abs          3.6e-6 abs          3 ulp
+//   Acos     7.1e-5 abs          1.3e-6 abs          3 ulp
+//   RSqrt    3.3e-4 rel          2.6e-7 rel          2 ulp
+//
+// SinCos reduces by multiples of pi/2; the Precise bound holds for |angle|
+// up to 100 and grows to 3 ulp at 1e4 radians. Acos clamps its input to
+// [-1, 1]; RSqrt expects positive inputs. Scalar calls run at about libm
+// speed, so the gain comes from the 4- and 8-wide forms.
+
+#include "MathTypes.h"
+#include "Simd.h"
+
+namespace Engine {
+namespace Math {
+
+enum class Accuracy { Fast, Medium, Precise };
+
+inline namespace ENGINE_SIMD_NAMESPACE {
+namespace FastMath {
+
+// Scalar counterparts of the Simd.h helpers, so every function below also
+// takes plain floats. The SIMD overloads are found through the argument
+// types.
+inline float MulAdd(float a, float b, float c) { return a * b + c; }
+inline float NegMulAdd(float a, float b, float c) { return c - a * b; }
+inline float Select(bool mask, float a, float b) { return mask ? a : b; }
+inline float RSqrtEstimate(float a) {
+  return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(a)));
+}
+using Math::Abs;
+using Math::Max;
+using Math::Min;
+using Math::Sqrt;
+
+namespace Detail {
+
+// Minimax coefficients, lowest order first
+constexpr float kSin5[] = {-1.66633904e-1f, 8.16328172e-3f};
+constexpr float kSin7[] = {-1.66666552e-1f, 8.33216030e-3f, -1.95152839e-4f};
+constexpr float kCos4[] = {-4.99776304e-1f, 4.04889360e-2f};
+constexpr float kCos6[] = {-4.99998957e-1f, 4.16562930e-2f, -1.35978230e-3f};
+constexpr float kCos8[] = {-5.00000000e-1f, 4.16666232e-2f, -1.38867635e-3f,
+                           2.43904651e-5f};
+
+// atan(a) / a in terms of a^2 on [0, 1]
+constexpr float kAtan7[] = {9.99788165e-1f, -3.25810879e-1f, 1.55583620e-1f,
+                            -4.43294011e-2f};
+constexpr float kAtan11[] = {9.99995649e-1f,  -3.32994729e-1f,
+                             1.95636675e-1f,  -1.21240787e-1f,
+                             5.74790314e-2f,  -1.34810954e-2f};
+constexpr float kAtan17[] = {1.00000000e+0f,  -3.33330750e-1f,
+                             1.99926332e-1f,  -1.42037466e-1f,
+                             1.06413208e-1f,  -7.50509202e-2f,
+                             4.27006818e-2f,  -1.60741415e-2f,
+                             2.85124104e-3f};
+
+// acos(x) / sqrt(1 - x) on [0, 1]
+constexpr float kAcos3[] = {1.57072544e+0f, -2.12052539e-1f, 7.40933195e-2f,
+                            -1.86164714e-2f};
+constexpr float kAcos5[] = {1.57079518e+0f, -2.14509428e-1f, 8.78525972e-2f,
+                            -4.48921137e-2f, 1.92733482e-2f, -4.30705305e-3f};
+constexpr float kAcos8[] = {1.57079637e+0f,  -2.14601263e-1f,
+                            8.90323520e-2f,  -5.06110005e-2f,
+                            3.26386802e-2f,  -2.08700392e-2f,
+                            1.11950412e-2f,  -4.07631276e-3f,
+                            7.09789922e-4f};
+
+// pi/2 split so that q * kPiOver2Hi is exact for the supported range
+constexpr float kPiOver2Hi = 1.5703125f;
+constexpr float kPiOver2Mid = 4.83751297e-4f;
+constexpr float kPiOver2Lo = 7.54978995e-8f;
+constexpr float kPiOver2Rest = 4.83826795e-4f; // kPiOver2Mid + kPiOver2Lo
+
+template <typename F, size_t N> F Polynomial(F x, const float (&c)[N]) {
+  F result(c[N - 1]);
+  for (size_t i = N - 1; i-- > 0;) {
+    result = MulAdd(result, x, F(c[i]));
+  }
+  return result;
+}
+
+// Nearest integer for |x| < 2^22 through the float adder, so it needs
+// neither SSE4.1 nor libm
+template <typename F> F Round(F x) {
+  const F magic(12582912.0f); // 1.5 * 2^23
+  return (x + magic) - magic;
+}
+
+template <typename F> F Floor(F x) {
+  F rounded = Round(x);
+  return rounded - Select(rounded > x, F(1.0f), F(0.0f));
+}
+
+} // namespace Detail
+
+//============================================================================
+// Trigonometry
+//============================================================================
+template <Accuracy A = Accuracy::Medium, typename F>
+void SinCos(F angle, F &sine, F &cosine) {
+  // angle = q * pi/2 + r with r in [-pi/4, pi/4]
+  F q = Detail::Round(angle * F(2.0f / PI));
+  F r;
+  if constexpr (A == Accuracy::Fast) {
+    r = NegMulAdd(q, F(HALF_PI), angle);
+  } else if constexpr (A == Accuracy::Medium) {
+    r = NegMulAdd(q, F(Detail::kPiOver2Hi), angle);
+    r = NegMulAdd(q, F(Detail::kPiOver2Rest), r);
+  } else {
+    r = NegMulAdd(q, F(Detail::kPiOver2Hi), angle);
+    r = NegMulAdd(q, F(Detail::kPiOver2Mid), r);
+    r = NegMulAdd(q, F(Detail::kPiOver2Lo), r);
+  }
+
+  F r2 = r * r;
+  F sinR, cosR;
+  if constexpr (A == Accuracy::Fast) {
+    sinR = MulAdd(r * r2, Detail::Polynomial(r2, Detail::kSin5), r);
+    cosR = MulAdd(r2, Detail::Polynomial(r2, Detail::kCos4), F(1.0f));
+  } else if constexpr (A == Accuracy::Medium) {
+    sinR = MulAdd(r * r2, Detail::Polynomial(r2, Detail::kSin7), r);
+    cosR = MulAdd(r2, Detail::Polynomial(r2, Detail::kCos6), F(1.0f));
+  } else {
+    sinR = MulAdd(r * r2, Detail::Polynomial(r2, Detail::kSin7), r);
+    cosR = MulAdd(r2, Detail::Polynomial(r2, Detail::kCos8), F(1.0f));
+  }
+
+  // Quadrant 0..3: odd quadrants swap sin and cos, and the signs follow
+  // sin(+ + - -) and cos(+ - - +)
+  F quadrant = NegMulAdd(Detail::Floor(q * F(0.25f)), F(4.0f), q);
+  auto odd = Abs(quadrant - F(2.0f)) == F(1.0f);
+  auto negateSin = quadrant >= F(2.0f);
+  auto negateCos = Abs(quadrant - F(1.5f)) < F(1.0f);
+  F s = Select(odd, cosR, sinR);
+  F c = Select(odd, sinR, cosR);
+  sine = Select(negateSin, -s, s);
+  cosine = Select(negateCos, -c, c);
+}
+
+template <Accuracy A = Accuracy::Medium, typename F> F Sin(F angle) {
+  F sine, cosine;
+  SinCos<A>(angle, sine, cosine);
+  return sine;
+}
+
+template <Accuracy A = Accuracy::Medium, typename F> F Cos(F angle) {
+  F sine, cosine;
+  SinCos<A>(angle, sine, cosine);
+  return cosine;
+}
+
+// Quadrant-correct like std::atan2; atan2(0, 0) is 0
+template <Accuracy A = Accuracy::Medium, typename F> F Atan2(F y, F x) {
+  F ax = Abs(x), ay = Abs(y);
+  F high = Max(ax, ay);
+  F a = Min(ax, ay) / Select(high == F(0.0f), F(1.0f), high);
+  F a2 = a * a;
+
+  F result;
+  if constexpr (A == Accuracy::Fast) {
+    result = a * Detail::Polynomial(a2, Detail::kAtan7);
+  } else if constexpr (A == Accuracy::Medium) {
+    result = a * Detail::Polynomial(a2, Detail::kAtan11);
+  } else {
+    result = a * Detail::Polynomial(a2, Detail::kAtan17);
+  }
+
+  result = Select(ay > ax, F(HALF_PI) - result, result);
+  result = Select(x < F(0.0f), F(PI) - result, result);
+  return Select(y < F(0.0f), -result, result);
+}
+
+template <Accuracy A = Accuracy::Medium, typename F> F Acos(F x) {
+  F ax = Min(Abs(x), F(1.0f));
+  F root = Sqrt(F(1.0f) - ax);
+
+  F result;
+  if constexpr (A == Accuracy::Fast) {
+    result = root * Detail::Polynomial(ax, Detail::kAcos3);
+  } else if constexpr (A == Accuracy::Medium) {
+    result = root * Detail::Polynomial(ax, Detail::kAcos5);
+  } else {
+    result = root * Detail::Polynomial(ax, Detail::kAcos8);
+  }
+  return Select(x < F(0.0f), F(PI) - result, result);
+}
+
+//============================================================================
+// Reciprocal square root
+//============================================================================
+// Fast is the hardware estimate, Medium adds one Newton-Raphson step and
+// Precise divides by the correctly rounded square root
+template <Accuracy A = Accuracy::Medium, typename F> F RSqrt(F x) {
+  if constexpr (A == Accuracy::Precise) {
+    return F(1.0f) / Sqrt(x);
+  } else {
+    F estimate = RSqrtEstimate(x);
+    if constexpr (A == Accuracy::Fast) {
+      return estimate;
+    } else {
+      F halfX = x * F(0.5f);
+      return estimate * NegMulAdd(halfX * estimate, estimate, F(1.5f));
+    }
+  }
+}
+
+} // namespace FastMath
+} // namespace ENGINE_SIMD_NAMESPACE
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,28 @@
+# Fails when a SIMD kernel object defines a weak symbol outside its ISA
+# namespace. Such inline code is shared by name with the baseline objects,
+# and the linker may keep the copy built with the kernel's instruction set.
+#
+#   cmake -DNM=<nm> -DLIBRARY=<libEngine.a> -P CheckKernelSymbols.cmake
+execute_process(
+    COMMAND ${NM} -A -C --defined-only ${LIBRARY}
+    OUTPUT_VARIABLE symbols
+    RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${NM} failed on ${LIBRARY}")
+endif()
+
+string(REPLACE "\n" ";" symbols "${symbols}")
+set(leaks)
+foreach(line IN LISTS symbols)
+    if(line MATCHES "Kernels(SSE2|SSE41|AVX2|AVX512)\\.cpp\\.o(bj)?:" AND
+       line MATCHES " [WVu] " AND
+       NOT line MATCHES "::(Sse2|Sse41|Avx|AvxFma|Avx512)::")
+        string(APPEND leaks "\n  ${line}")
+    endif()
+endforeach()
+
+if(leaks)
+    message(FATAL_ERROR "Inline code outside the ISA namespaces in the "
+        "SIMD kernels; call only code from ENGINE_SIMD_NAMESPACE or the "
+        "kernel's anonymous namespace:${leaks}")
+endif()
\ No newline at end of file
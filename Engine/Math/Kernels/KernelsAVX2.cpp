@@ -0,0 +1,18 @@
+// Built with -mavx2 -mfma (/arch:AVX2 on MSVC), see Engine/CMakeLists.txt
+
+#include "SimdKernels.inl"
+
+#if !defined(__AVX2__) || !defined(ENGINE_SIMD_FMA)
+#error "KernelsAVX2.cpp must be compiled with AVX2 and FMA enabled"
+#endif
+
+namespace Engine {
+namespace Math {
+
+const MathKernelTable *GetAVX2Kernels() {
+  static const MathKernelTable table = MakeSimdKernelTable(SimdLevel::AVX2);
+  return &table;
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,19 @@
+// Built with -mavx512f -mavx512vl -mavx2 -mfma (/arch:AVX512 on MSVC), see
+// Engine/CMakeLists.txt
+
+#include "SimdKernels.inl"
+
+#if !defined(__AVX512F__) || !defined(__AVX512VL__)
+#error "KernelsAVX512.cpp must be compiled with AVX-512F and AVX-512VL enabled"
+#endif
+
+namespace Engine {
+namespace Math {
+
+const MathKernelTable *GetAVX512Kernels() {
+  static const MathKernelTable table = MakeSimdKernelTable(SimdLevel::AVX512);
+  return &table;
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
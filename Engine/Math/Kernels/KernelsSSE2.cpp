@@ -0,0 +1,18 @@
+// Built with the baseline x86-64 flags (-msse2 on 32-bit targets)
+
+#include "SimdKernels.inl"
+
+#if !defined(__SSE2__) && !defined(_M_X64)
+#error "KernelsSSE2.cpp must be compiled with SSE2 enabled"
+#endif
+
+namespace Engine {
+namespace Math {
+
+const MathKernelTable *GetSSE2Kernels() {
+  static const MathKernelTable table = MakeSimdKernelTable(SimdLevel::SSE2);
+  return &table;
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,18 @@
+// Built with -msse4.1 (ENGINE_SIMD_SSE41 on MSVC), see Engine/CMakeLists.txt
+
+#include "SimdKernels.inl"
+
+#if !defined(ENGINE_SIMD_SSE41)
+#error "KernelsSSE41.cpp must be compiled with SSE4.1 enabled"
+#endif
+
+namespace Engine {
+namespace Math {
+
+const MathKernelTable *GetSSE41Kernels() {
+  static const MathKernelTable table = MakeSimdKernelTable(SimdLevel::SSE41);
+  return &table;
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,383 @@
+// Portable reference kernels. Built with the default flags and no
+// intrinsics, so they are available on every target and serve as the
+// ground truth the SIMD levels are tested against.
+
+#include "../Bvh.h"
+#include "../Math.h"
+#include "../Noise.h"
+
+namespace Engine {
+namespace Math {
+
+namespace {
+
+// Rows 0..2 of a 3x4 affine transform
+struct Affine {
+  float m[3][4];
+};
+
+inline void Store(Vec3 &out, float x, float y, float z) {
+  out.x = x;
+  out.y = y;
+  out.z = z;
+  out.w = 0.0f;
+}
+
+template <bool Translate>
+inline void Apply(const float (*m)[4], const Vec3 &in, Vec3 &out,
+                  const float *row3 = nullptr) {
+  float x = in.x, y = in.y, z = in.z;
+  float w = Translate ? 1.0f : 0.0f;
+  float rx = m[0][0] * x + m[0][1] * y + m[0][2] * z + m[0][3] * w;
+  float ry = m[1][0] * x + m[1][1] * y + m[1][2] * z + m[1][3] * w;
+  float rz = m[2][0] * x + m[2][1] * y + m[2][2] * z + m[2][3] * w;
+  if (row3) {
+    float rw = row3[0] * x + row3[1] * y + row3[2] * z + row3[3];
+    rx /= rw;
+    ry /= rw;
+    rz /= rw;
+  }
+  Store(out, rx, ry, rz);
+}
+
+void TransformPoints(const Mat4 &matrix, const Vec3 *points, Vec3 *out,
+                     size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    Apply<true>(matrix.m, points[i], out[i]);
+  }
+}
+
+void TransformVectors(const Mat4 &matrix, const Vec3 *vectors, Vec3 *out,
+                      size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    Apply<false>(matrix.m, vectors[i], out[i]);
+  }
+}
+
+void TransformPointsProjective(const Mat4 &matrix, const Vec3 *points,
+                               Vec3 *out, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    Apply<true>(matrix.m, points[i], out[i], matrix.m[3]);
+  }
+}
+
+template <bool Translate>
+void TransformSoA(const Mat4 &matrix, const Vec3 *in, float *outX,
+                  float *outY, float *outZ, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    Vec3 result;
+    Apply<Translate>(matrix.m, in[i], result);
+    outX[i] = result.x;
+    outY[i] = result.y;
+    outZ[i] = result.z;
+  }
+}
+
+void MultiplyMatrices(const Mat4 *a, const Mat4 &b, Mat4 *out,
+                      size_t count) {
+  const Mat4 right = b; // 'out' may overlap 'b'
+  for (size_t i = 0; i < count; ++i) {
+    Mat4 result;
+    for (int r = 0; r < 4; ++r) {
+      for (int c = 0; c < 4; ++c) {
+        result.m[r][c] =
+            (a[i].m[r][0] * right.m[0][c] + a[i].m[r][1] * right.m[1][c]) +
+            (a[i].m[r][2] * right.m[2][c] + a[i].m[r][3] * right.m[3][c]);
+      }
+    }
+    out[i] = result;
+  }
+}
+
+void CullSpheres(const Vec4 *planes, const Vec4 *spheres, uint8_t *visible,
+                 size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    const Vec4 &s = spheres[i];
+    bool inside = true;
+    for (int p = 0; p < 6; ++p) {
+      float distance = planes[p].x * s.x + planes[p].y * s.y +
+                       planes[p].z * s.z + planes[p].w;
+      inside &= distance >= -s.w;
+    }
+    visible[i] = inside ? 1 : 0;
+  }
+}
+
+// A box reaches |n.x| ex + |n.y| ey + |n.z| ez toward each plane from its
+// center, a sphere its radius
+template <bool Boxes, typename Bounds>
+size_t CullSoA(const Vec4 *planes, const Bounds &bounds, size_t begin,
+               size_t end, uint32_t *visible) {
+  uint32_t *out = visible;
+  for (size_t i = begin; i < end; ++i) {
+    float x = bounds.CenterX[i], y = bounds.CenterY[i], z = bounds.CenterZ[i];
+    bool inside = true;
+    for (int p = 0; p < 6; ++p) {
+      float distance =
+          planes[p].x * x + planes[p].y * y + planes[p].z * z + planes[p].w;
+      float reach;
+      if constexpr (Boxes) {
+        reach = Abs(planes[p].x) * bounds.ExtentX[i] +
+                Abs(planes[p].y) * bounds.ExtentY[i] +
+                Abs(planes[p].z) * bounds.ExtentZ[i];
+      } else {
+        reach = bounds.Radius[i];
+      }
+      inside &= distance >= -reach;
+    }
+    if (inside) {
+      *out++ = static_cast<uint32_t>(i);
+    }
+  }
+  return static_cast<size_t>(out - visible);
+}
+
+template <bool Translate>
+void Skin(const Mat4 *bones, const SkinInfluences *influences,
+          const Vec3 *in, Vec3 *out, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    const SkinInfluences &influence = influences[i];
+    Affine blended = {};
+    for (int k = 0; k < 4; ++k) {
+      const float(*bone)[4] = bones[influence.Bones[k]].m;
+      float weight = influence.Weights[k];
+      for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 4; ++c) {
+          blended.m[r][c] += weight * bone[r][c];
+        }
+      }
+    }
+    Apply<Translate>(blended.m, in[i], out[i]);
+  }
+}
+
+void MultiplyQuaternions(const Quaternion *a, const Quaternion *b,
+                         Quaternion *out, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = a[i] * b[i];
+  }
+}
+
+void RotateVectors(const Quaternion *rotations, const Vec3 *vectors,
+                   Vec3 *out, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    Vec3 rotated = rotations[i].RotateVector(vectors[i]);
+    Store(out[i], rotated.x, rotated.y, rotated.z);
+  }
+}
+
+void LerpQuaternions(const Quaternion *a, const Quaternion *b, float t,
+                     Quaternion *out, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = Quaternion::Lerp(a[i], b[i], t);
+  }
+}
+
+void SlerpQuaternions(const Quaternion *a, const Quaternion *b, float t,
+                      Quaternion *out, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = Quaternion::SlerpFast(a[i], b[i], t);
+  }
+}
+
+void QuaternionsToMatrices(const Quaternion *rotations, Mat4 *out,
+                           size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = rotations[i].ToMatrix();
+  }
+}
+
+inline Transform LoadTransform(const TransformComponentsSoA &transforms,
+                               size_t i) {
+  return Transform(Vec3(transforms.PositionX[i], transforms.PositionY[i],
+                        transforms.PositionZ[i]),
+                   Quaternion(transforms.RotationX[i], transforms.RotationY[i],
+                              transforms.RotationZ[i], transforms.RotationW[i]),
+                   Vec3(transforms.ScaleX[i], transforms.ScaleY[i],
+                        transforms.ScaleZ[i]));
+}
+
+void TransformsToAffine(const Transform *transforms, Affine3x4 *out,
+                        size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = transforms[i].ToAffine();
+  }
+}
+
+void TransformsToMVP(const Mat4 &viewProjection, const Transform *transforms,
+                     Mat4 *out, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = viewProjection * transforms[i].ToAffine();
+  }
+}
+
+void TransformStreamsToAffine(const TransformComponentsSoA &transforms,
+                              Affine3x4 *out, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = LoadTransform(transforms, i).ToAffine();
+  }
+}
+
+void TransformStreamsToMVP(const Mat4 &viewProjection,
+                           const TransformComponentsSoA &transforms, Mat4 *out,
+                           size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = viewProjection * LoadTransform(transforms, i).ToAffine();
+  }
+}
+
+void PackFloat3(const Vec3 *vectors, Float3 *out, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = Float3(vectors[i].x, vectors[i].y, vectors[i].z);
+  }
+}
+
+void UnpackFloat3(const Float3 *packed, Vec3 *out, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = Vec3(packed[i].x, packed[i].y, packed[i].z);
+  }
+}
+
+void PackHalf3(const Vec3 *vectors, Half3 *out, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = Half3(vectors[i]);
+  }
+}
+
+void UnpackHalf3(const Half3 *packed, Vec3 *out, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = packed[i].Load();
+  }
+}
+
+void Noise2(const NoiseSettings &settings, const float *x, const float *y,
+            float *out, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = Noise::Evaluate(settings, x[i], y[i]);
+  }
+}
+
+void Noise3(const NoiseSettings &settings, const float *x, const float *y,
+            const float *z, float *out, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = Noise::Evaluate(settings, x[i], y[i], z[i]);
+  }
+}
+
+void Noise4(const NoiseSettings &settings, const float *x, const float *y,
+            const float *z, const float *w, float *out, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = Noise::Evaluate(settings, x[i], y[i], z[i], w[i]);
+  }
+}
+
+// Node lanes one at a time
+size_t CullBvh(const Vec4 *planes, const BvhView &bvh, uint32_t *visible,
+               size_t capacity) {
+  return bvh.Width == 8
+             ? BvhQuery::Cull<float, 8>(planes, bvh, visible, capacity)
+             : BvhQuery::Cull<float, 4>(planes, bvh, visible, capacity);
+}
+
+void RaycastBvh(const BvhView &bvh, const Ray *rays, RayHit *hits,
+                size_t rayCount, bool anyHit) {
+  for (size_t i = 0; i < rayCount; ++i) {
+    if (bvh.Width == 8) {
+      BvhQuery::Raycast<float, 8>(bvh, rays[i], hits[i], anyHit);
+    } else {
+      BvhQuery::Raycast<float, 4>(bvh, rays[i], hits[i], anyHit);
+    }
+  }
+}
+
+// Keeps each ray's nearest hit closer than its current T
+template <typename Intersect>
+void Raycast(RayHit *hits, size_t rayCount, size_t primitiveCount,
+             Intersect intersect) {
+  for (size_t r = 0; r < rayCount; ++r) {
+    RayHit &hit = hits[r];
+    for (size_t i = 0; i < primitiveCount; ++i) {
+      float t = 0.0f, u = 0.0f, v = 0.0f;
+      if (intersect(r, i, t, u, v) && t < hit.T) {
+        hit = {t, static_cast<uint32_t>(i), u, v};
+      }
+    }
+  }
+}
+
+void RaycastBoxes(const Ray *rays, RayHit *hits, size_t rayCount,
+                  const AABB *boxes, size_t boxCount) {
+  for (size_t r = 0; r < rayCount; ++r) {
+    Vec3 inverse = rays[r].InverseDirection();
+    Raycast(hits + r, 1, boxCount,
+            [&](size_t, size_t i, float &t, float &, float &) {
+              return rays[r].IntersectAABB(boxes[i], inverse, t);
+            });
+  }
+}
+
+void RaycastSpheres(const Ray *rays, RayHit *hits, size_t rayCount,
+                    const Sphere *spheres, size_t sphereCount) {
+  Raycast(hits, rayCount, sphereCount,
+          [&](size_t r, size_t i, float &t, float &, float &) {
+            return rays[r].IntersectSphere(spheres[i], t);
+          });
+}
+
+void RaycastTriangles(const Ray *rays, RayHit *hits, size_t rayCount,
+                      const Vec3 *vertices, const uint32_t *indices,
+                      size_t triangleCount) {
+  Raycast(hits, rayCount, triangleCount,
+          [&](size_t r, size_t i, float &t, float &u, float &v) {
+            const uint32_t *triangle = indices + 3 * i;
+            return rays[r].IntersectTriangle(vertices[triangle[0]],
+                                             vertices[triangle[1]],
+                                             vertices[triangle[2]], t, u, v);
+          });
+}
+
+} // namespace
+
+const MathKernelTable *GetScalarKernels() {
+  static const MathKernelTable table = [] {
+    MathKernelTable t;
+    t.Level = SimdLevel::Scalar;
+    t.TransformPoints = TransformPoints;
+    t.TransformVectors = TransformVectors;
+    t.TransformPointsProjective = TransformPointsProjective;
+    t.TransformPointsSoA = TransformSoA<true>;
+    t.TransformVectorsSoA = TransformSoA<false>;
+    t.MultiplyMatrices = MultiplyMatrices;
+    t.CullSpheres = CullSpheres;
+    t.CullSpheresSoA = CullSoA<false, SphereBoundsSoA>;
+    t.CullBoxesSoA = CullSoA<true, BoxBoundsSoA>;
+    t.RaycastBoxes = RaycastBoxes;
+    t.RaycastSpheres = RaycastSpheres;
+    t.RaycastTriangles = RaycastTriangles;
+    t.SkinPoints = Skin<true>;
+    t.SkinVectors = Skin<false>;
+    t.MultiplyQuaternions = MultiplyQuaternions;
+    t.RotateVectors = RotateVectors;
+    t.LerpQuaternions = LerpQuaternions;
+    t.SlerpQuaternions = SlerpQuaternions;
+    t.QuaternionsToMatrices = QuaternionsToMatrices;
+    t.TransformsToAffine = TransformsToAffine;
+    t.TransformsToMVP = TransformsToMVP;
+    t.TransformStreamsToAffine = TransformStreamsToAffine;
+    t.TransformStreamsToMVP = TransformStreamsToMVP;
+    t.PackFloat3 = PackFloat3;
+    t.UnpackFloat3 = UnpackFloat3;
+    t.PackHalf3 = PackHalf3;
+    t.UnpackHalf3 = UnpackHalf3;
+    t.Noise2 = Noise2;
+    t.Noise3 = Noise3;
+    t.Noise4 = Noise4;
+    t.CullBvh = CullBvh;
+    t.RaycastBvh = RaycastBvh;
+    return t;
+  }();
+  return &table;
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,1307 @@
+// SIMD kernel bodies shared by the per-ISA translation units. Each unit is
+// compiled with its own flags and includes this file once; SimdFloat4/8 and
+// the __AVX__/__AVX512F__ paths below pick up those flags. Everything here
+// has internal linkage and only touches the math types as raw floats, so no
+// inline function compiled for a wider ISA can leak into the baseline build.
+// Code called from here must live in this file or in ENGINE_SIMD_NAMESPACE;
+// CheckKernelSymbols.cmake fails the build on anything else.
+
+#include "../Bvh.h"
+#include "../MathKernels.h"
+#include "../Noise.h"
+#include "../RayPacket.h"
+#include "../VectorPacket.h"
+
+#include <cstring>
+#include <type_traits>
+
+namespace Engine {
+namespace Math {
+
+namespace {
+
+enum class TransformKind { Point, Vector, Projective };
+
+inline __m128 XyzMask() {
+  return _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+}
+
+// Matrix columns, so M * (x, y, z, w) = c0*x + c1*y + c2*z + c3*w
+struct Columns {
+  SimdFloat4 c[4];
+
+  explicit Columns(const Mat4 &matrix) {
+    Detail::LoadRows4(matrix.data, 4, c);
+  }
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// Transforms with AoS output ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// Broadcast each coordinate across a register and accumulate the columns
+template <TransformKind Kind>
+inline __m128 TransformOne(const Columns &columns, const float *point) {
+  __m128 p = _mm_load_ps(point);
+  SimdFloat4 x = _mm_shuffle_ps(p, p, _MM_SHUFFLE(0, 0, 0, 0));
+  SimdFloat4 y = _mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1));
+  SimdFloat4 z = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 2, 2));
+
+  SimdFloat4 r = Kind == TransformKind::Vector
+                     ? columns.c[0] * x
+                     : MulAdd(columns.c[0], x, columns.c[3]);
+  r = MulAdd(columns.c[1], y, r);
+  r = MulAdd(columns.c[2], z, r);
+
+  if constexpr (Kind == TransformKind::Projective) {
+    r = r / SimdFloat4(_mm_shuffle_ps(r.v, r.v, _MM_SHUFFLE(3, 3, 3, 3)));
+  }
+  return _mm_and_ps(r.v, XyzMask());
+}
+
+// Points to process one at a time until 'in' reaches 'alignment' bytes
+inline size_t PeelCount(const Vec3 *in, size_t alignment, size_t count) {
+  size_t misalignment = reinterpret_cast<uintptr_t>(in) & (alignment - 1);
+  size_t peel = ((alignment - misalignment) & (alignment - 1)) / sizeof(Vec3);
+  return peel < count ? peel : count;
+}
+
+template <TransformKind Kind>
+void TransformAoS(const Mat4 &matrix, const Vec3 *in, Vec3 *out,
+                  size_t count) {
+  Columns columns(matrix);
+  size_t i = 0;
+
+#if defined(__AVX512F__)
+  // Four points per register, aligned loads after peeling to 64 bytes and
+  // a masked tail
+  for (size_t peel = PeelCount(in, 64, count); i < peel; ++i) {
+    _mm_store_ps(&out[i].x, TransformOne<Kind>(columns, &in[i].x));
+  }
+
+  const float(*m)[4] = matrix.m;
+  __m512 c0 = _mm512_setr4_ps(m[0][0], m[1][0], m[2][0], m[3][0]);
+  __m512 c1 = _mm512_setr4_ps(m[0][1], m[1][1], m[2][1], m[3][1]);
+  __m512 c2 = _mm512_setr4_ps(m[0][2], m[1][2], m[2][2], m[3][2]);
+  __m512 c3 = _mm512_setr4_ps(m[0][3], m[1][3], m[2][3], m[3][3]);
+  // The masked form with a full mask avoids the undefined source operand
+  // of _mm512_permute_ps, which GCC 12 reports as uninitialized
+  auto splat = [](__m512 p, auto lane) {
+    constexpr int l = decltype(lane)::value;
+    return _mm512_mask_permute_ps(p, 0xFFFF, p, _MM_SHUFFLE(l, l, l, l));
+  };
+  auto transform = [&](__m512 p) {
+    __m512 x = splat(p, std::integral_constant<int, 0>());
+    __m512 y = splat(p, std::integral_constant<int, 1>());
+    __m512 z = splat(p, std::integral_constant<int, 2>());
+    __m512 r = Kind == TransformKind::Vector ? _mm512_mul_ps(c0, x)
+                                             : _mm512_fmadd_ps(c0, x, c3);
+    r = _mm512_fmadd_ps(c1, y, r);
+    r = _mm512_fmadd_ps(c2, z, r);
+    if constexpr (Kind == TransformKind::Projective) {
+      r = _mm512_div_ps(r, splat(r, std::integral_constant<int, 3>()));
+    }
+    return _mm512_maskz_mov_ps(0x7777, r);
+  };
+
+  for (; i + 4 <= count; i += 4) {
+    _mm512_storeu_ps(&out[i].x, transform(_mm512_load_ps(&in[i].x)));
+  }
+  if (i < count) {
+    __mmask16 lanes = static_cast<__mmask16>((1u << ((count - i) * 4)) - 1);
+    __m512 p = _mm512_maskz_load_ps(lanes, &in[i].x);
+    _mm512_mask_storeu_ps(&out[i].x, lanes, transform(p));
+    i = count;
+  }
+#elif defined(__AVX__)
+  // Two points per register. Vec3 arrays are only 16-byte aligned, so peel
+  // one point to make the wide loads aligned and never split a cache line;
+  // the single-point loop below takes the remainder.
+  for (size_t peel = PeelCount(in, 32, count); i < peel; ++i) {
+    _mm_store_ps(&out[i].x, TransformOne<Kind>(columns, &in[i].x));
+  }
+
+  __m256 c0 = _mm256_set_m128(columns.c[0].v, columns.c[0].v);
+  __m256 c1 = _mm256_set_m128(columns.c[1].v, columns.c[1].v);
+  __m256 c2 = _mm256_set_m128(columns.c[2].v, columns.c[2].v);
+  __m256 c3 = _mm256_set_m128(columns.c[3].v, columns.c[3].v);
+  __m256 mask = _mm256_set_m128(XyzMask(), XyzMask());
+
+  for (; i + 2 <= count; i += 2) {
+    __m256 p = _mm256_load_ps(&in[i].x);
+    SimdFloat8 x = _mm256_permute_ps(p, _MM_SHUFFLE(0, 0, 0, 0));
+    SimdFloat8 y = _mm256_permute_ps(p, _MM_SHUFFLE(1, 1, 1, 1));
+    SimdFloat8 z = _mm256_permute_ps(p, _MM_SHUFFLE(2, 2, 2, 2));
+
+    SimdFloat8 r = Kind == TransformKind::Vector ? SimdFloat8(c0) * x
+                                                 : MulAdd(c0, x, c3);
+    r = MulAdd(c1, y, r);
+    r = MulAdd(c2, z, r);
+
+    if constexpr (Kind == TransformKind::Projective) {
+      r = r / SimdFloat8(_mm256_permute_ps(r.v, _MM_SHUFFLE(3, 3, 3, 3)));
+    }
+    _mm256_storeu_ps(&out[i].x, _mm256_and_ps(r.v, mask));
+  }
+#endif
+
+  for (; i < count; ++i) {
+    _mm_store_ps(&out[i].x, TransformOne<Kind>(columns, &in[i].x));
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// AoS to SoA loads //////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// Loads up to F::Width elements of four floats each into component
+// registers; missing elements read as zero
+template <typename F, int N>
+inline void LoadElements(const float *elements, size_t count, F (&out)[N]) {
+  if (count >= static_cast<size_t>(F::Width)) {
+    Detail::LoadRows(elements, 4, out);
+    return;
+  }
+  alignas(32) float padded[F::Width * 4] = {};
+  std::memcpy(padded, elements, count * 4 * sizeof(float));
+  Detail::LoadRows(padded, 4, out);
+}
+
+#if defined(__AVX512F__)
+// Sixteen elements of four floats as four component registers. 'lanes'
+// selects which elements exist; the rest read as zero.
+inline void LoadElements16(const float *elements, __mmask16 lanes,
+                           __m512 (&out)[4]) {
+  // Element k of each 64-byte block occupies floats 4k..4k+3
+  __m512 block[4];
+  for (int b = 0; lanes == 0xFFFF && b < 4; ++b) {
+    block[b] = _mm512_loadu_ps(elements + b * 16);
+  }
+  for (int b = 0; lanes != 0xFFFF && b < 4; ++b) {
+    unsigned present = (lanes >> (b * 4)) & 0xFu;
+    __mmask16 mask = 0;
+    for (int e = 0; e < 4; ++e) {
+      mask |= ((present >> e) & 1u) ? (0xFu << (e * 4)) : 0u;
+    }
+    block[b] = _mm512_maskz_loadu_ps(mask, elements + b * 16);
+  }
+
+  // Gather x and y of elements 0-7 / 8-15, then z and w, then combine
+  const __m512i xyIndex = _mm512_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28, 1, 5,
+                                          9, 13, 17, 21, 25, 29);
+  const __m512i zwIndex = _mm512_setr_epi32(2, 6, 10, 14, 18, 22, 26, 30, 3, 7,
+                                          11, 15, 19, 23, 27, 31);
+  __m512 xy0 = _mm512_permutex2var_ps(block[0], xyIndex, block[1]);
+  __m512 zw0 = _mm512_permutex2var_ps(block[0], zwIndex, block[1]);
+  __m512 xy1 = _mm512_permutex2var_ps(block[2], xyIndex, block[3]);
+  __m512 zw1 = _mm512_permutex2var_ps(block[2], zwIndex, block[3]);
+
+  const __m512i low = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 16, 17, 18,
+                                        19, 20, 21, 22, 23);
+  const __m512i high = _mm512_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15, 24, 25,
+                                         26, 27, 28, 29, 30, 31);
+  out[0] = _mm512_permutex2var_ps(xy0, low, xy1);
+  out[1] = _mm512_permutex2var_ps(xy0, high, xy1);
+  out[2] = _mm512_permutex2var_ps(zw0, low, zw1);
+  out[3] = _mm512_permutex2var_ps(zw0, high, zw1);
+}
+
+inline __mmask16 TailMask(size_t remaining) {
+  return remaining >= 16 ? static_cast<__mmask16>(0xFFFF)
+                         : static_cast<__mmask16>((1u << remaining) - 1);
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// Transforms with SoA output ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+template <bool Translate>
+void TransformSoA(const Mat4 &matrix, const Vec3 *in, float *outX,
+                  float *outY, float *outZ, size_t count) {
+  const float(*m)[4] = matrix.m;
+  const float t0 = Translate ? m[0][3] : 0.0f;
+  const float t1 = Translate ? m[1][3] : 0.0f;
+  const float t2 = Translate ? m[2][3] : 0.0f;
+  size_t i = 0;
+
+#if defined(__AVX512F__)
+  auto set = [](float value) { return _mm512_set1_ps(value); };
+  __m512 m00 = set(m[0][0]), m01 = set(m[0][1]), m02 = set(m[0][2]);
+  __m512 m10 = set(m[1][0]), m11 = set(m[1][1]), m12 = set(m[1][2]);
+  __m512 m20 = set(m[2][0]), m21 = set(m[2][1]), m22 = set(m[2][2]);
+  __m512 x0 = set(t0), y0 = set(t1), z0 = set(t2);
+
+  for (; i < count; i += 16) {
+    __mmask16 lanes = TailMask(count - i);
+    __m512 p[4];
+    LoadElements16(&in[i].x, lanes, p);
+    __m512 x = _mm512_fmadd_ps(
+        m00, p[0], _mm512_fmadd_ps(m01, p[1], _mm512_fmadd_ps(m02, p[2], x0)));
+    __m512 y = _mm512_fmadd_ps(
+        m10, p[0], _mm512_fmadd_ps(m11, p[1], _mm512_fmadd_ps(m12, p[2], y0)));
+    __m512 z = _mm512_fmadd_ps(
+        m20, p[0], _mm512_fmadd_ps(m21, p[1], _mm512_fmadd_ps(m22, p[2], z0)));
+    _mm512_mask_storeu_ps(outX + i, lanes, x);
+    _mm512_mask_storeu_ps(outY + i, lanes, y);
+    _mm512_mask_storeu_ps(outZ + i, lanes, z);
+  }
+#else
+  // Eight points per packet with every matrix element broadcast
+  using F = SimdFloat8;
+  const F m00(m[0][0]), m01(m[0][1]), m02(m[0][2]);
+  const F m10(m[1][0]), m11(m[1][1]), m12(m[1][2]);
+  const F m20(m[2][0]), m21(m[2][1]), m22(m[2][2]);
+  const F x0(t0), y0(t1), z0(t2);
+
+  for (; i < count; i += F::Width) {
+    size_t remaining = count - i;
+    F p[3];
+    LoadElements(&in[i].x, remaining, p);
+    F x = MulAdd(m00, p[0], MulAdd(m01, p[1], MulAdd(m02, p[2], x0)));
+    F y = MulAdd(m10, p[0], MulAdd(m11, p[1], MulAdd(m12, p[2], y0)));
+    F z = MulAdd(m20, p[0], MulAdd(m21, p[1], MulAdd(m22, p[2], z0)));
+
+    // The output streams carry no alignment guarantee
+    if (remaining >= static_cast<size_t>(F::Width)) {
+      x.StoreU(outX + i);
+      y.StoreU(outY + i);
+      z.StoreU(outZ + i);
+    } else {
+      alignas(32) float lanes[3][F::Width];
+      x.Store(lanes[0]);
+      y.Store(lanes[1]);
+      z.Store(lanes[2]);
+      std::memcpy(outX + i, lanes[0], remaining * sizeof(float));
+      std::memcpy(outY + i, lanes[1], remaining * sizeof(float));
+      std::memcpy(outZ + i, lanes[2], remaining * sizeof(float));
+    }
+  }
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Matrix products ///////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// Each row of a[i] * b is the rows of b weighted by that row's elements,
+// as in Mat4::operator*. With AVX-512 a register holds the whole matrix
+// and with AVX two rows, so b's rows are repeated in every 128-bit lane
+// and the weights are broadcast within each lane. 'b' is read up front,
+// so any output may alias it.
+void MultiplyMatrices(const Mat4 *a, const Mat4 &b, Mat4 *out, size_t count) {
+#if defined(__AVX512F__)
+  // Masked forms with a full mask, as in TransformAoS, avoid the undefined
+  // source operands that GCC 12 reports as uninitialized
+  const __mmask16 all = 0xFFFF;
+  __m512 whole = _mm512_loadu_ps(b.data);
+  __m512 rows[4] = {_mm512_mask_shuffle_f32x4(whole, all, whole, whole, 0x00),
+                    _mm512_mask_shuffle_f32x4(whole, all, whole, whole, 0x55),
+                    _mm512_mask_shuffle_f32x4(whole, all, whole, whole, 0xAA),
+                    _mm512_mask_shuffle_f32x4(whole, all, whole, whole, 0xFF)};
+  for (size_t i = 0; i < count; ++i) {
+    __m512 left = _mm512_loadu_ps(a[i].data);
+    __m512 x = _mm512_mask_permute_ps(left, all, left, 0x00);
+    __m512 y = _mm512_mask_permute_ps(left, all, left, 0x55);
+    __m512 z = _mm512_mask_permute_ps(left, all, left, 0xAA);
+    __m512 w = _mm512_mask_permute_ps(left, all, left, 0xFF);
+    __m512 result = _mm512_mul_ps(x, rows[0]);
+    result = _mm512_fmadd_ps(y, rows[1], result);
+    result = _mm512_fmadd_ps(z, rows[2], result);
+    result = _mm512_fmadd_ps(w, rows[3], result);
+    _mm512_storeu_ps(out[i].data, result);
+  }
+#elif defined(__AVX__)
+  using F = SimdFloat8;
+  F rows[4];
+  for (int j = 0; j < 4; ++j) {
+    rows[j] = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b.m[j]));
+  }
+  for (size_t i = 0; i < count; ++i) {
+    for (int half = 0; half < 2; ++half) {
+      __m256 left = _mm256_loadu_ps(a[i].data + 8 * half);
+      F result = F(_mm256_permute_ps(left, 0x00)) * rows[0];
+      result = MulAdd(_mm256_permute_ps(left, 0x55), rows[1], result);
+      result = MulAdd(_mm256_permute_ps(left, 0xAA), rows[2], result);
+      result = MulAdd(_mm256_permute_ps(left, 0xFF), rows[3], result);
+      result.StoreU(out[i].data + 8 * half);
+    }
+  }
+#else
+  // Same sums in the same order as Mat4::operator*, so bit for bit equal
+  __m128 rows[4];
+  for (int j = 0; j < 4; ++j) {
+    rows[j] = _mm_loadu_ps(b.m[j]);
+  }
+  for (size_t i = 0; i < count; ++i) {
+    for (int r = 0; r < 4; ++r) {
+      __m128 left = _mm_loadu_ps(a[i].m[r]);
+      __m128 xy = _mm_add_ps(
+          _mm_mul_ps(_mm_shuffle_ps(left, left, 0x00), rows[0]),
+          _mm_mul_ps(_mm_shuffle_ps(left, left, 0x55), rows[1]));
+      __m128 zw = _mm_add_ps(
+          _mm_mul_ps(_mm_shuffle_ps(left, left, 0xAA), rows[2]),
+          _mm_mul_ps(_mm_shuffle_ps(left, left, 0xFF), rows[3]));
+      _mm_storeu_ps(out[i].m[r], _mm_add_ps(xy, zw));
+    }
+  }
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Sphere culling ////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// Four mask bits to four 0/1 bytes, lane 0 first
+inline uint32_t ExpandMask4(int bits) {
+  uint32_t bytes = 0;
+  for (int lane = 0; lane < 4; ++lane) {
+    bytes |= static_cast<uint32_t>((bits >> lane) & 1) << (lane * 8);
+  }
+  return bytes;
+}
+
+void CullSpheres(const Vec4 *planes, const Vec4 *spheres, uint8_t *visible,
+                 size_t count) {
+  size_t i = 0;
+
+#if defined(__AVX512F__)
+  __m512 px[6], py[6], pz[6], pw[6];
+  for (int p = 0; p < 6; ++p) {
+    px[p] = _mm512_set1_ps(planes[p].x);
+    py[p] = _mm512_set1_ps(planes[p].y);
+    pz[p] = _mm512_set1_ps(planes[p].z);
+    pw[p] = _mm512_set1_ps(planes[p].w);
+  }
+
+  for (; i < count; i += 16) {
+    size_t remaining = count - i;
+    __m512 s[4];
+    LoadElements16(&spheres[i].x, TailMask(remaining), s);
+    __m512 negRadius = _mm512_sub_ps(_mm512_setzero_ps(), s[3]);
+    __mmask16 inside = 0xFFFF;
+    for (int p = 0; p < 6; ++p) {
+      __m512 distance = _mm512_fmadd_ps(
+          px[p], s[0],
+          _mm512_fmadd_ps(py[p], s[1], _mm512_fmadd_ps(pz[p], s[2], pw[p])));
+      inside &= _mm512_cmp_ps_mask(distance, negRadius, _CMP_GE_OQ);
+    }
+
+    __m128i bytes = _mm512_maskz_cvtepi32_epi8(inside, _mm512_set1_epi32(1));
+    if (remaining >= 16) {
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(visible + i), bytes);
+    } else {
+      alignas(16) uint8_t lanes[16];
+      _mm_store_si128(reinterpret_cast<__m128i *>(lanes), bytes);
+      std::memcpy(visible + i, lanes, remaining);
+    }
+  }
+#else
+  using F = SimdFloat8;
+  F px[6], py[6], pz[6], pw[6];
+  for (int p = 0; p < 6; ++p) {
+    px[p] = F(planes[p].x);
+    py[p] = F(planes[p].y);
+    pz[p] = F(planes[p].z);
+    pw[p] = F(planes[p].w);
+  }
+
+  for (; i < count; i += F::Width) {
+    size_t remaining = count - i;
+    F s[4];
+    LoadElements(&spheres[i].x, remaining, s);
+    F negRadius = -s[3];
+    F inside;
+    for (int p = 0; p < 6; ++p) {
+      F distance =
+          MulAdd(px[p], s[0], MulAdd(py[p], s[1], MulAdd(pz[p], s[2], pw[p])));
+      F touching = distance >= negRadius;
+      inside = p == 0 ? touching : inside & touching;
+    }
+
+    int bits = MoveMask(inside);
+    uint32_t lanes[2] = {ExpandMask4(bits), ExpandMask4(bits >> 4)};
+    size_t written = remaining < static_cast<size_t>(F::Width)
+                         ? remaining
+                         : static_cast<size_t>(F::Width);
+    std::memcpy(visible + i, lanes, written);
+  }
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Structure-of-arrays culling ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// SWAR popcount of a lane mask
+inline uint32_t CountLanes(uint32_t bits) {
+  bits = bits - ((bits >> 1) & 0x55555555u);
+  bits = (bits & 0x33333333u) + ((bits >> 2) & 0x33333333u);
+  return (((bits + (bits >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+}
+
+#if defined(__AVX2__) && !defined(__AVX512F__)
+// For each 8-bit lane mask, the set lanes in ascending order, one per byte
+struct CompactTable {
+  uint64_t order[256];
+
+  constexpr CompactTable() : order() {
+    for (uint32_t bits = 0; bits < 256; ++bits) {
+      int slot = 0;
+      for (uint32_t lane = 0; lane < 8; ++lane) {
+        if (bits & (1u << lane)) {
+          order[bits] |= static_cast<uint64_t>(lane) << (8 * slot++);
+        }
+      }
+    }
+  }
+};
+
+constexpr CompactTable kCompactTable;
+#endif
+
+// Appends first + lane for every set bit among the first 'laneCount' of
+// the 8-lane mask. Full blocks may write 8 slots ahead of 'out', which
+// stays in bounds because 'out' never runs ahead of the input.
+inline uint32_t *AppendLanes(uint32_t *out, uint32_t first, uint32_t bits,
+                             uint32_t laneCount) {
+#if defined(__AVX512F__)
+  (void)laneCount;
+  __m256i lanes = _mm256_add_epi32(_mm256_set1_epi32(first),
+                                   _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+  _mm256_mask_compressstoreu_epi32(out, static_cast<__mmask8>(bits), lanes);
+  return out + CountLanes(bits);
+#else
+#if defined(__AVX2__)
+  if (laneCount == 8) {
+    __m256i order = _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+        reinterpret_cast<const __m128i *>(&kCompactTable.order[bits])));
+    __m256i lanes = _mm256_add_epi32(_mm256_set1_epi32(first), order);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), lanes);
+    return out + CountLanes(bits);
+  }
+#endif
+  // Branchless: every lane is written, only visible ones advance 'out'
+  for (uint32_t lane = 0; lane < laneCount; ++lane) {
+    *out = first + lane;
+    out += (bits >> lane) & 1;
+  }
+  return out;
+#endif
+}
+
+// 'remaining' floats of a stream; lanes past the end read zero
+inline SimdFloat8 LoadStream(const float *stream, size_t remaining) {
+  if (remaining >= static_cast<size_t>(SimdFloat8::Width)) {
+    return SimdFloat8::LoadU(stream);
+  }
+  alignas(32) float lanes[SimdFloat8::Width] = {};
+  std::memcpy(lanes, stream, remaining * sizeof(float));
+  return SimdFloat8::Load(lanes);
+}
+
+// Eight elements per iteration against the six planes broadcast into
+// registers. A box reaches |n.x| ex + |n.y| ey + |n.z| ez toward each plane
+// from its center, a sphere its radius.
+template <bool Boxes, typename Bounds>
+size_t CullSoA(const Vec4 *planes, const Bounds &bounds, size_t begin,
+               size_t end, uint32_t *visible) {
+  using F = SimdFloat8;
+  F nx[6], ny[6], nz[6], d[6], ax[6], ay[6], az[6];
+  for (int p = 0; p < 6; ++p) {
+    nx[p] = F(planes[p].x);
+    ny[p] = F(planes[p].y);
+    nz[p] = F(planes[p].z);
+    d[p] = F(planes[p].w);
+    ax[p] = Abs(nx[p]);
+    ay[p] = Abs(ny[p]);
+    az[p] = Abs(nz[p]);
+  }
+
+  // Center x, y, z, then extent x, y, z or the radius
+  const float *streams[Boxes ? 6 : 4];
+  bounds.GetStreams(streams);
+
+  uint32_t *out = visible;
+  for (size_t i = begin; i < end; i += F::Width) {
+    size_t remaining = end - i;
+    F x = LoadStream(streams[0] + i, remaining);
+    F y = LoadStream(streams[1] + i, remaining);
+    F z = LoadStream(streams[2] + i, remaining);
+    F ex, ey, ez, radius;
+    if constexpr (Boxes) {
+      ex = LoadStream(streams[3] + i, remaining);
+      ey = LoadStream(streams[4] + i, remaining);
+      ez = LoadStream(streams[5] + i, remaining);
+    } else {
+      radius = LoadStream(streams[3] + i, remaining);
+    }
+
+    F inside;
+    for (int p = 0; p < 6; ++p) {
+      F distance = MulAdd(nx[p], x, MulAdd(ny[p], y, MulAdd(nz[p], z, d[p])));
+      F reach;
+      if constexpr (Boxes) {
+        reach = MulAdd(ax[p], ex, MulAdd(ay[p], ey, az[p] * ez));
+      } else {
+        reach = radius;
+      }
+      F touching = distance >= -reach;
+      inside = p == 0 ? touching : inside & touching;
+    }
+
+    uint32_t laneCount = remaining < static_cast<size_t>(F::Width)
+                             ? static_cast<uint32_t>(remaining)
+                             : static_cast<uint32_t>(F::Width);
+    uint32_t bits = static_cast<uint32_t>(MoveMask(inside)) &
+                    ((1u << laneCount) - 1);
+    out = AppendLanes(out, static_cast<uint32_t>(i), bits, laneCount);
+  }
+  return static_cast<size_t>(out - visible);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Skinning //////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// Rows 0..2 of the weighted sum of the vertex's bone matrices
+inline void BlendRows(const Mat4 *bones, const SkinInfluences &influence,
+                      __m128 (&rows)[3]) {
+  for (int r = 0; r < 3; ++r) {
+    rows[r] = _mm_setzero_ps();
+  }
+  for (int k = 0; k < 4; ++k) {
+    SimdFloat4 weight(influence.Weights[k]);
+    const float(*bone)[4] = bones[influence.Bones[k]].m;
+    for (int r = 0; r < 3; ++r) {
+      rows[r] = MulAdd(weight, SimdFloat4(_mm_load_ps(bone[r])),
+                       SimdFloat4(rows[r]))
+                    .v;
+    }
+  }
+}
+
+// (x, y, z, 1) for points, (x, y, z, 0) for vectors
+template <bool Translate> inline __m128 Homogeneous(const float *xyz) {
+  __m128 v = _mm_and_ps(_mm_load_ps(xyz), XyzMask());
+  return Translate ? _mm_or_ps(v, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f)) : v;
+}
+
+template <bool Translate>
+void Skin(const Mat4 *bones, const SkinInfluences *influences,
+          const Vec3 *in, Vec3 *out, size_t count) {
+  size_t i = 0;
+
+#if defined(__AVX__)
+  // Two vertices per register, one in each 128-bit half
+  for (; i + 2 <= count; i += 2) {
+    __m128 a[3], b[3];
+    BlendRows(bones, influences[i], a);
+    BlendRows(bones, influences[i + 1], b);
+    __m256 p = _mm256_set_m128(Homogeneous<Translate>(&in[i + 1].x),
+                               Homogeneous<Translate>(&in[i].x));
+
+    // Row dot products; the zero fourth row leaves the padding lane zero
+    __m256 r0 = _mm256_mul_ps(_mm256_set_m128(b[0], a[0]), p);
+    __m256 r1 = _mm256_mul_ps(_mm256_set_m128(b[1], a[1]), p);
+    __m256 r2 = _mm256_mul_ps(_mm256_set_m128(b[2], a[2]), p);
+    __m256 sums = _mm256_hadd_ps(_mm256_hadd_ps(r0, r1),
+                                 _mm256_hadd_ps(r2, _mm256_setzero_ps()));
+    _mm256_storeu_ps(&out[i].x, sums);
+  }
+#endif
+
+  for (; i < count; ++i) {
+    __m128 rows[3];
+    BlendRows(bones, influences[i], rows);
+    __m128 p = Homogeneous<Translate>(&in[i].x);
+    __m128 r0 = _mm_mul_ps(rows[0], p);
+    __m128 r1 = _mm_mul_ps(rows[1], p);
+    __m128 r2 = _mm_mul_ps(rows[2], p);
+    __m128 r3 = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    _mm_store_ps(&out[i].x,
+                 _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3)));
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Quaternions ///////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// Quaternions and padded Vec3s are both four floats per element, so every
+// kernel below transposes F::Width elements into SoA packets, computes, and
+// transposes back. The tail goes through zero-padded copies.
+using QuatF = QuatPacket<SimdFloat8>;
+using Vec3F = Vec3Packet<SimdFloat8>;
+constexpr size_t kQuatWidth = SimdFloat8::Width;
+
+inline QuatF LoadQuats(const Quaternion *q, size_t count) {
+  SimdFloat8 lanes[4];
+  LoadElements(&q->x, count, lanes);
+  return QuatF(lanes[0], lanes[1], lanes[2], lanes[3]);
+}
+
+inline Vec3F LoadVectors(const Vec3 *v, size_t count) {
+  SimdFloat8 lanes[3];
+  LoadElements(&v->x, count, lanes);
+  return Vec3F(lanes[0], lanes[1], lanes[2]);
+}
+
+// Stores min(count, F::Width) elements of four floats
+template <int N>
+inline void StoreElements(float *elements, size_t count,
+                          const SimdFloat8 (&in)[N]) {
+  if (count >= kQuatWidth) {
+    Detail::StoreRows(elements, 4, in);
+    return;
+  }
+  alignas(32) float padded[kQuatWidth * 4];
+  Detail::StoreRows(padded, 4, in);
+  std::memcpy(elements, padded, count * 4 * sizeof(float));
+}
+
+inline void StoreQuats(Quaternion *q, size_t count, const QuatF &packet) {
+  const SimdFloat8 lanes[4] = {packet.x, packet.y, packet.z, packet.w};
+  StoreElements(&q->x, count, lanes);
+}
+
+void MultiplyQuaternions(const Quaternion *a, const Quaternion *b,
+                         Quaternion *out, size_t count) {
+  for (size_t i = 0; i < count; i += kQuatWidth) {
+    size_t remaining = count - i;
+    StoreQuats(out + i, remaining,
+               LoadQuats(a + i, remaining) * LoadQuats(b + i, remaining));
+  }
+}
+
+void RotateVectors(const Quaternion *rotations, const Vec3 *vectors,
+                   Vec3 *out, size_t count) {
+  for (size_t i = 0; i < count; i += kQuatWidth) {
+    size_t remaining = count - i;
+    Vec3F rotated = RotateVector(LoadQuats(rotations + i, remaining),
+                                 LoadVectors(vectors + i, remaining));
+    // The zero fill keeps the padding lane clear
+    const SimdFloat8 lanes[3] = {rotated.x, rotated.y, rotated.z};
+    StoreElements(&out[i].x, remaining, lanes);
+  }
+}
+
+template <bool Spherical>
+void InterpolateQuaternions(const Quaternion *a, const Quaternion *b,
+                            float t, Quaternion *out, size_t count) {
+  const SimdFloat8 weight(t);
+  for (size_t i = 0; i < count; i += kQuatWidth) {
+    size_t remaining = count - i;
+    QuatF qa = LoadQuats(a + i, remaining);
+    QuatF qb = LoadQuats(b + i, remaining);
+    StoreQuats(out + i, remaining,
+               Spherical ? SlerpFast(qa, qb, weight) : Lerp(qa, qb, weight));
+  }
+}
+
+// Same expansion as Quaternion::ToMatrix, one matrix row per transpose
+void QuaternionsToMatrices(const Quaternion *rotations, Mat4 *out,
+                           size_t count) {
+  using F = SimdFloat8;
+  const F zero = F::Zero(), one(1.0f), two(2.0f);
+  for (size_t i = 0; i < count; i += kQuatWidth) {
+    size_t remaining = count - i;
+    QuatF q = LoadQuats(rotations + i, remaining);
+    F x2 = q.x * two, y2 = q.y * two, z2 = q.z * two;
+    F xx = q.x * x2, yy = q.y * y2, zz = q.z * z2;
+    F xy = q.x * y2, xz = q.x * z2, yz = q.y * z2;
+    F wx = q.w * x2, wy = q.w * y2, wz = q.w * z2;
+
+    const F rows[4][4] = {{one - (yy + zz), xy - wz, xz + wy, zero},
+                          {xy + wz, one - (xx + zz), yz - wx, zero},
+                          {xz - wy, yz + wx, one - (xx + yy), zero},
+                          {zero, zero, zero, one}};
+
+    // Row r of consecutive matrices is 16 floats apart
+    alignas(32) float padded[kQuatWidth * 16];
+    float *target = remaining >= kQuatWidth ? out[i].data : padded;
+    for (int r = 0; r < 4; ++r) {
+      Detail::StoreRows(target + r * 4, 16, rows[r]);
+    }
+    if (target == padded) {
+      std::memcpy(out[i].data, padded, remaining * sizeof(Mat4));
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Transform composition /////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// Translate * rotate * scale of F::Width transforms written out directly as
+// in Affine3x4::TRS: m[r][c] holds element (r, c) of every lane
+struct AffineF {
+  SimdFloat8 m[3][4];
+
+  AffineF(const Vec3F &position, const QuatF &rotation, const Vec3F &scale) {
+    using F = SimdFloat8;
+    const F one(1.0f), two(2.0f);
+    const QuatF &q = rotation;
+    F x2 = q.x * two, y2 = q.y * two, z2 = q.z * two;
+    F xx = q.x * x2, yy = q.y * y2, zz = q.z * z2;
+    F xy = q.x * y2, xz = q.x * z2, yz = q.y * z2;
+    F wx = q.w * x2, wy = q.w * y2, wz = q.w * z2;
+
+    m[0][0] = (one - (yy + zz)) * scale.x;
+    m[0][1] = (xy - wz) * scale.y;
+    m[0][2] = (xz + wy) * scale.z;
+    m[0][3] = position.x;
+    m[1][0] = (xy + wz) * scale.x;
+    m[1][1] = (one - (xx + zz)) * scale.y;
+    m[1][2] = (yz - wx) * scale.z;
+    m[1][3] = position.y;
+    m[2][0] = (xz - wy) * scale.x;
+    m[2][1] = (yz + wx) * scale.y;
+    m[2][2] = (one - (xx + yy)) * scale.z;
+    m[2][3] = position.z;
+  }
+};
+
+#if defined(__AVX__)
+// Transposes eight registers of eight lanes: afterwards rows[k] holds lane k
+// of every input register
+inline void Transpose8x8(__m256 (&rows)[8]) {
+  __m256 t[8], s[8];
+  for (int i = 0; i < 8; i += 2) {
+    t[i] = _mm256_unpacklo_ps(rows[i], rows[i + 1]);
+    t[i + 1] = _mm256_unpackhi_ps(rows[i], rows[i + 1]);
+  }
+  for (int i = 0; i < 8; i += 4) {
+    s[i] = _mm256_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(1, 0, 1, 0));
+    s[i + 1] = _mm256_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(3, 2, 3, 2));
+    s[i + 2] = _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(1, 0, 1, 0));
+    s[i + 3] = _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(3, 2, 3, 2));
+  }
+  for (int i = 0; i < 4; ++i) {
+    rows[i] = _mm256_permute2f128_ps(s[i], s[i + 4], 0x20);
+    rows[i + 4] = _mm256_permute2f128_ps(s[i], s[i + 4], 0x31);
+  }
+}
+#endif
+
+// Transform is a padded position, a rotation and a padded scale
+inline AffineF LoadTransforms(const Transform *transforms, size_t begin,
+                              size_t count) {
+  static_assert(sizeof(Transform) == 12 * sizeof(float),
+                "Transform is three padded four-float members");
+  const float *source = &transforms[begin].position.x;
+  alignas(32) float padded[kQuatWidth * 12];
+  if (count < kQuatWidth) {
+    std::memset(padded, 0, sizeof(padded));
+    std::memcpy(padded, source, count * sizeof(Transform));
+    source = padded;
+  }
+  SimdFloat8 scale[3];
+  Detail::LoadRows(source + 8, 12, scale);
+#if defined(__AVX__)
+  // Position and rotation are the first eight floats of each transform
+  __m256 lanes[8];
+  for (int i = 0; i < 8; ++i) {
+    lanes[i] = _mm256_loadu_ps(source + i * 12);
+  }
+  Transpose8x8(lanes);
+  return AffineF(Vec3F(lanes[0], lanes[1], lanes[2]),
+                 QuatF(lanes[4], lanes[5], lanes[6], lanes[7]),
+                 Vec3F(scale[0], scale[1], scale[2]));
+#else
+  SimdFloat8 position[3], rotation[4];
+  Detail::LoadRows(source, 12, position);
+  Detail::LoadRows(source + 4, 12, rotation);
+  return AffineF(Vec3F(position[0], position[1], position[2]),
+                 QuatF(rotation[0], rotation[1], rotation[2], rotation[3]),
+                 Vec3F(scale[0], scale[1], scale[2]));
+#endif
+}
+
+// TransformComponentsSoA as raw pointers: position x, y, z, rotation x, y,
+// z, w and scale x, y, z
+struct TransformStreams {
+  const float *streams[10];
+
+  explicit TransformStreams(const TransformComponentsSoA &transforms) {
+    transforms.GetStreams(streams);
+  }
+};
+
+inline AffineF LoadTransforms(const TransformStreams &transforms,
+                              size_t begin, size_t count) {
+  SimdFloat8 lanes[10];
+  for (int i = 0; i < 10; ++i) {
+    lanes[i] = LoadStream(transforms.streams[i] + begin, count);
+  }
+  return AffineF(Vec3F(lanes[0], lanes[1], lanes[2]),
+                 QuatF(lanes[3], lanes[4], lanes[5], lanes[6]),
+                 Vec3F(lanes[7], lanes[8], lanes[9]));
+}
+
+// Stores min(count, F::Width) matrices of 'Rows' rows of four floats
+template <int Rows>
+inline void StoreMatrices(float *matrices, size_t count,
+                          const SimdFloat8 (&rows)[Rows][4]) {
+  // Row r of consecutive matrices is Rows * 4 floats apart
+  alignas(32) float padded[kQuatWidth * Rows * 4];
+  float *target = count >= kQuatWidth ? matrices : padded;
+#if defined(__AVX__)
+  // Two rows at a time make eight floats per matrix, one 8x8 transpose
+  int r = 0;
+  for (; r + 1 < Rows; r += 2) {
+    __m256 lanes[8];
+    for (int c = 0; c < 4; ++c) {
+      lanes[c] = rows[r][c].v;
+      lanes[c + 4] = rows[r + 1][c].v;
+    }
+    Transpose8x8(lanes);
+    for (int i = 0; i < 8; ++i) {
+      _mm256_storeu_ps(target + i * Rows * 4 + r * 4, lanes[i]);
+    }
+  }
+  if (r < Rows) {
+    Detail::StoreRows(target + r * 4, Rows * 4, rows[r]);
+  }
+#else
+  for (int r = 0; r < Rows; ++r) {
+    Detail::StoreRows(target + r * 4, Rows * 4, rows[r]);
+  }
+#endif
+  if (target == padded) {
+    std::memcpy(matrices, padded, count * Rows * 4 * sizeof(float));
+  }
+}
+
+// Broadcast view-projection elements, applied as viewProjection * affine
+// with the affine's implicit (0, 0, 0, 1) last row
+struct ViewProjectionF {
+  SimdFloat8 m[4][4];
+
+  explicit ViewProjectionF(const Mat4 &matrix) {
+    for (int r = 0; r < 4; ++r) {
+      for (int c = 0; c < 4; ++c) {
+        m[r][c] = SimdFloat8(matrix.m[r][c]);
+      }
+    }
+  }
+
+  void Apply(const AffineF &model, SimdFloat8 (&out)[4][4]) const {
+    for (int r = 0; r < 4; ++r) {
+      for (int c = 0; c < 4; ++c) {
+        SimdFloat8 sum = m[r][0] * model.m[0][c];
+        sum = MulAdd(m[r][1], model.m[1][c], sum);
+        sum = MulAdd(m[r][2], model.m[2][c], sum);
+        out[r][c] = c == 3 ? sum + m[r][3] : sum;
+      }
+    }
+  }
+};
+
+// 'Source' is the table's parameter type: a Transform array or a
+// TransformComponentsSoA reference, read through TransformStreams
+inline const Transform *ReadAs(const Transform *transforms) {
+  return transforms;
+}
+
+inline TransformStreams ReadAs(const TransformComponentsSoA &transforms) {
+  return TransformStreams(transforms);
+}
+
+template <typename Source>
+void ComposeAffine(Source source, Affine3x4 *out, size_t count) {
+  const auto transforms = ReadAs(source);
+  for (size_t i = 0; i < count; i += kQuatWidth) {
+    size_t remaining = count - i;
+    StoreMatrices(out[i].data, remaining,
+                  LoadTransforms(transforms, i, remaining).m);
+  }
+}
+
+template <typename Source>
+void ComposeMVP(const Mat4 &viewProjection, Source source, Mat4 *out,
+                size_t count) {
+  const ViewProjectionF broadcast(viewProjection);
+  const auto transforms = ReadAs(source);
+  for (size_t i = 0; i < count; i += kQuatWidth) {
+    size_t remaining = count - i;
+    SimdFloat8 rows[4][4];
+    broadcast.Apply(LoadTransforms(transforms, i, remaining), rows);
+    StoreMatrices(out[i].data, remaining, rows);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Ray packets ///////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// Eight rays per packet against one broadcast primitive at a time. RayHit
+// is four floats (T, Index bits, U, V), so the running closest hits load
+// and store like the quaternions above.
+using RayF = RayPacket<SimdFloat8>;
+constexpr size_t kRayWidth = RayF::Width;
+
+inline SimdFloat8 IndexLanes(size_t index) {
+  uint32_t value = static_cast<uint32_t>(index);
+  float bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return SimdFloat8(bits);
+}
+
+template <typename Intersect>
+void RaycastPackets(const Ray *rays, RayHit *hits, size_t rayCount,
+                    size_t primitiveCount, Intersect intersect) {
+  using F = SimdFloat8;
+  for (size_t r = 0; r < rayCount; r += kRayWidth) {
+    size_t remaining = rayCount - r;
+    int lanes = static_cast<int>(remaining < kRayWidth ? remaining : kRayWidth);
+    RayF packet = RayF::Load(rays + r, lanes);
+    F best[4];
+    LoadElements(&hits[r].T, remaining, best);
+
+    for (size_t i = 0; i < primitiveCount; ++i) {
+      F t, u, v;
+      F hit = intersect(packet, i, t, u, v);
+      F closer = hit & (t < best[0]);
+      if (None(closer)) {
+        continue;
+      }
+      best[0] = Select(closer, t, best[0]);
+      best[1] = Select(closer, IndexLanes(i), best[1]);
+      best[2] = Select(closer, u, best[2]);
+      best[3] = Select(closer, v, best[3]);
+    }
+    StoreElements(&hits[r].T, remaining, best);
+  }
+}
+
+void RaycastBoxes(const Ray *rays, RayHit *hits, size_t rayCount,
+                  const AABB *boxes, size_t boxCount) {
+  using F = SimdFloat8;
+  RaycastPackets(rays, hits, rayCount, boxCount,
+                 [&](const RayF &packet, size_t i, F &t, F &u, F &v) {
+                   u = v = F::Zero();
+                   return packet.IntersectAABB(boxes[i], t);
+                 });
+}
+
+void RaycastSpheres(const Ray *rays, RayHit *hits, size_t rayCount,
+                    const Sphere *spheres, size_t sphereCount) {
+  using F = SimdFloat8;
+  RaycastPackets(rays, hits, rayCount, sphereCount,
+                 [&](const RayF &packet, size_t i, F &t, F &u, F &v) {
+                   u = v = F::Zero();
+                   return packet.IntersectSphere(spheres[i], t);
+                 });
+}
+
+void RaycastTriangles(const Ray *rays, RayHit *hits, size_t rayCount,
+                      const Vec3 *vertices, const uint32_t *indices,
+                      size_t triangleCount) {
+  using F = SimdFloat8;
+  RaycastPackets(rays, hits, rayCount, triangleCount,
+                 [&](const RayF &packet, size_t i, F &t, F &u, F &v) {
+                   const uint32_t *triangle = indices + 3 * i;
+                   return packet.IntersectTriangle(
+                       vertices[triangle[0]], vertices[triangle[1]],
+                       vertices[triangle[2]], t, u, v);
+                 });
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Packed storage ////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// Every run of four elements is the same 48 bytes either way: four padded
+// Vec3 registers or three registers of packed floats
+//   (ax ay az bx) (by bz cx cy) (cz dx dy dz)
+inline void PackFour(const Vec3 *vectors, __m128 (&packed)[3]) {
+  __m128 a = _mm_load_ps(&vectors[0].x);
+  __m128 b = _mm_load_ps(&vectors[1].x);
+  __m128 c = _mm_load_ps(&vectors[2].x);
+  __m128 d = _mm_load_ps(&vectors[3].x);
+  __m128 azbx = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 2, 2));
+  __m128 czdx = _mm_shuffle_ps(c, d, _MM_SHUFFLE(0, 0, 2, 2));
+  packed[0] = _mm_shuffle_ps(a, azbx, _MM_SHUFFLE(2, 0, 1, 0));
+  packed[1] = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 2, 1));
+  packed[2] = _mm_shuffle_ps(czdx, d, _MM_SHUFFLE(2, 1, 2, 0));
+}
+
+inline void UnpackFour(const __m128 (&packed)[3], Vec3 *out) {
+  const __m128 mask = XyzMask();
+  __m128 bxbybz =
+      _mm_shuffle_ps(packed[0], packed[1], _MM_SHUFFLE(1, 0, 3, 3));
+  __m128 b = _mm_shuffle_ps(bxbybz, bxbybz, _MM_SHUFFLE(3, 3, 2, 0));
+  __m128 c = _mm_shuffle_ps(packed[1], packed[2], _MM_SHUFFLE(0, 0, 3, 2));
+  __m128 d = _mm_shuffle_ps(packed[2], packed[2], _MM_SHUFFLE(3, 3, 2, 1));
+  _mm_store_ps(&out[0].x, _mm_and_ps(packed[0], mask));
+  _mm_store_ps(&out[1].x, _mm_and_ps(b, mask));
+  _mm_store_ps(&out[2].x, _mm_and_ps(c, mask));
+  _mm_store_ps(&out[3].x, _mm_and_ps(d, mask));
+}
+
+void PackFloat3(const Vec3 *vectors, Float3 *out, size_t count) {
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m128 packed[3];
+    PackFour(vectors + i, packed);
+    float *dst = &out[i].x;
+    _mm_storeu_ps(dst, packed[0]);
+    _mm_storeu_ps(dst + 4, packed[1]);
+    _mm_storeu_ps(dst + 8, packed[2]);
+  }
+  for (; i < count; ++i) {
+    out[i].x = vectors[i].x;
+    out[i].y = vectors[i].y;
+    out[i].z = vectors[i].z;
+  }
+}
+
+void UnpackFloat3(const Float3 *packed, Vec3 *out, size_t count) {
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const float *src = &packed[i].x;
+    __m128 loaded[3] = {_mm_loadu_ps(src), _mm_loadu_ps(src + 4),
+                        _mm_loadu_ps(src + 8)};
+    UnpackFour(loaded, out + i);
+  }
+  for (; i < count; ++i) {
+    _mm_store_ps(&out[i].x,
+                 _mm_setr_ps(packed[i].x, packed[i].y, packed[i].z, 0.0f));
+  }
+}
+
+// Detail::FloatToHalf on four lanes, branch free. Each result is a 16-bit
+// half sign extended to 32 bits, ready for _mm_packs_epi32.
+inline __m128i FloatToHalf4(__m128 value) {
+  const __m128i halfOverflow = _mm_set1_epi32((127 + 16) << 23);
+  const __m128i halfMinNormal = _mm_set1_epi32((127 - 14) << 23);
+  const __m128i denormalMagic =
+      _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+  const __m128i normalBias = _mm_set1_epi32(0xFFF - ((127 - 15) << 23));
+
+  __m128 sign = _mm_and_ps(value, _mm_set1_ps(-0.0f));
+  __m128 absolute = _mm_xor_ps(value, sign);
+  __m128i bits = _mm_castps_si128(absolute);
+
+  // Infinity, or the quiet NaN 0x7E00
+  __m128i isNaN = _mm_castps_si128(_mm_cmpunord_ps(absolute, absolute));
+  __m128i special = _mm_or_si128(_mm_set1_epi32(0x7C00),
+                                 _mm_and_si128(isNaN, _mm_set1_epi32(0x200)));
+
+  __m128i denormal = _mm_sub_epi32(
+      _mm_castps_si128(
+          _mm_add_ps(absolute, _mm_castsi128_ps(denormalMagic))),
+      denormalMagic);
+
+  // Adding the odd bit on top of 0xFFF rounds ties to even
+  __m128i mantissaOdd = _mm_srai_epi32(_mm_slli_epi32(bits, 31 - 13), 31);
+  __m128i normal = _mm_srli_epi32(
+      _mm_sub_epi32(_mm_add_epi32(bits, normalBias), mantissaOdd), 13);
+
+  __m128i isDenormal = _mm_cmpgt_epi32(halfMinNormal, bits);
+  __m128i isRegular = _mm_cmpgt_epi32(halfOverflow, bits);
+  __m128i finite = _mm_or_si128(_mm_and_si128(isDenormal, denormal),
+                                _mm_andnot_si128(isDenormal, normal));
+  __m128i half = _mm_or_si128(_mm_and_si128(isRegular, finite),
+                              _mm_andnot_si128(isRegular, special));
+  return _mm_or_si128(half, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+}
+
+// Detail::HalfToFloat on four lanes holding zero extended halves. Scaling
+// by 2^112 rebiases the exponent and renormalizes denormals in one
+// multiply, which needs denormal inputs left alone (no DAZ); infinity and
+// NaN get their exponent forced to all ones.
+inline __m128 HalfToFloat4(__m128i half) {
+  const __m128 rebias = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+
+  __m128i magnitude = _mm_and_si128(half, _mm_set1_epi32(0x7FFF));
+  __m128i sign = _mm_slli_epi32(_mm_xor_si128(half, magnitude), 16);
+  __m128 scaled =
+      _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(magnitude, 13)), rebias);
+  __m128i isInfNaN = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x7BFF));
+  __m128i infNaN = _mm_and_si128(isInfNaN, _mm_set1_epi32(255 << 23));
+  return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, infNaN)));
+}
+
+// One element for the tails, through the same lanes as the full runs
+inline void FloatToHalf3(const Vec3 &vector, Half3 &out) {
+  alignas(16) int32_t lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i *>(lanes),
+                  FloatToHalf4(_mm_load_ps(&vector.x)));
+  out.x = static_cast<uint16_t>(lanes[0]);
+  out.y = static_cast<uint16_t>(lanes[1]);
+  out.z = static_cast<uint16_t>(lanes[2]);
+}
+
+// Four elements are twelve halves: three conversions of the packed floats
+// and 24 bytes stored as 16 + 8
+void PackHalf3(const Vec3 *vectors, Half3 *out, size_t count) {
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m128 packed[3];
+    PackFour(vectors + i, packed);
+    __m128i low = _mm_packs_epi32(FloatToHalf4(packed[0]),
+                                  FloatToHalf4(packed[1]));
+    __m128i high = FloatToHalf4(packed[2]);
+    __m128i *dst = reinterpret_cast<__m128i *>(&out[i]);
+    _mm_storeu_si128(dst, low);
+    _mm_storel_epi64(dst + 1, _mm_packs_epi32(high, high));
+  }
+  for (; i < count; ++i) {
+    FloatToHalf3(vectors[i], out[i]);
+  }
+}
+
+void UnpackHalf3(const Half3 *packed, Vec3 *out, size_t count) {
+  const __m128i zero = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m128i *src = reinterpret_cast<const __m128i *>(&packed[i]);
+    __m128i low = _mm_loadu_si128(src);
+    __m128i high = _mm_loadl_epi64(src + 1);
+    __m128 floats[3] = {HalfToFloat4(_mm_unpacklo_epi16(low, zero)),
+                        HalfToFloat4(_mm_unpackhi_epi16(low, zero)),
+                        HalfToFloat4(_mm_unpacklo_epi16(high, zero))};
+    UnpackFour(floats, out + i);
+  }
+  for (; i < count; ++i) {
+    _mm_store_ps(&out[i].x, HalfToFloat4(_mm_setr_epi32(
+                                packed[i].x, packed[i].y, packed[i].z, 0)));
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Noise /////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// Eight samples per evaluation: one register with AVX, two halves on the
+// SSE levels. The tail goes through a zero-padded copy.
+template <int N>
+void NoiseKernel(const NoiseSettings &settings, const float *const (&in)[N],
+                 float *out, size_t count) {
+  auto evaluate = [&settings](const SimdFloat8(&c)[N]) {
+    if constexpr (N == 2) {
+      return Noise::Evaluate(settings, c[0], c[1]);
+    } else if constexpr (N == 3) {
+      return Noise::Evaluate(settings, c[0], c[1], c[2]);
+    } else {
+      return Noise::Evaluate(settings, c[0], c[1], c[2], c[3]);
+    }
+  };
+
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    SimdFloat8 c[N];
+    for (int d = 0; d < N; ++d) {
+      c[d] = SimdFloat8::LoadU(in[d] + i);
+    }
+    evaluate(c).StoreU(out + i);
+  }
+  if (i < count) {
+    size_t tail = count - i;
+    float padded[N][8] = {};
+    SimdFloat8 c[N];
+    for (int d = 0; d < N; ++d) {
+      std::memcpy(padded[d], in[d] + i, tail * sizeof(float));
+      c[d] = SimdFloat8::LoadU(padded[d]);
+    }
+    float result[8];
+    evaluate(c).StoreU(result);
+    std::memcpy(out + i, result, tail * sizeof(float));
+  }
+}
+
+void Noise2(const NoiseSettings &settings, const float *x, const float *y,
+            float *out, size_t count) {
+  const float *const in[2] = {x, y};
+  NoiseKernel<2>(settings, in, out, count);
+}
+
+void Noise3(const NoiseSettings &settings, const float *x, const float *y,
+            const float *z, float *out, size_t count) {
+  const float *const in[3] = {x, y, z};
+  NoiseKernel<3>(settings, in, out, count);
+}
+
+void Noise4(const NoiseSettings &settings, const float *x, const float *y,
+            const float *z, const float *w, float *out, size_t count) {
+  const float *const in[4] = {x, y, z, w};
+  NoiseKernel<4>(settings, in, out, count);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Bvh ///////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+// One register per node test: four lanes of a Bvh4 node, eight of a Bvh8
+// node (two halves on the SSE levels)
+size_t CullBvh(const Vec4 *planes, const BvhView &bvh, uint32_t *visible,
+               size_t capacity) {
+  return bvh.Width == 8
+             ? BvhQuery::Cull<SimdFloat8, 8>(planes, bvh, visible, capacity)
+             : BvhQuery::Cull<SimdFloat4, 4>(planes, bvh, visible, capacity);
+}
+
+template <int Width>
+void RaycastBvh(const BvhView &bvh, const Ray *rays, RayHit *hits,
+                size_t rayCount, bool anyHit) {
+  for (size_t i = 0; i < rayCount; ++i) {
+    BvhQuery::Raycast<BvhQuery::NodeLanes<Width>, Width>(bvh, rays[i],
+                                                         hits[i], anyHit);
+  }
+}
+
+void RaycastBvh(const BvhView &bvh, const Ray *rays, RayHit *hits,
+                size_t rayCount, bool anyHit) {
+  if (bvh.Width == 8) {
+    RaycastBvh<8>(bvh, rays, hits, rayCount, anyHit);
+  } else {
+    RaycastBvh<4>(bvh, rays, hits, rayCount, anyHit);
+  }
+}
+
+MathKernelTable MakeSimdKernelTable(SimdLevel level) {
+  MathKernelTable table;
+  table.Level = level;
+  table.TransformPoints = TransformAoS<TransformKind::Point>;
+  table.TransformVectors = TransformAoS<TransformKind::Vector>;
+  table.TransformPointsProjective = TransformAoS<TransformKind::Projective>;
+  table.TransformPointsSoA = TransformSoA<true>;
+  table.TransformVectorsSoA = TransformSoA<false>;
+  table.MultiplyMatrices = MultiplyMatrices;
+  table.CullSpheres = CullSpheres;
+  table.CullSpheresSoA = CullSoA<false, SphereBoundsSoA>;
+  table.CullBoxesSoA = CullSoA<true, BoxBoundsSoA>;
+  table.RaycastBoxes = RaycastBoxes;
+  table.RaycastSpheres = RaycastSpheres;
+  table.RaycastTriangles = RaycastTriangles;
+  table.SkinPoints = Skin<true>;
+  table.SkinVectors = Skin<false>;
+  table.MultiplyQuaternions = MultiplyQuaternions;
+  table.RotateVectors = RotateVectors;
+  table.LerpQuaternions = InterpolateQuaternions<false>;
+  table.SlerpQuaternions = InterpolateQuaternions<true>;
+  table.QuaternionsToMatrices = QuaternionsToMatrices;
+  table.TransformsToAffine = ComposeAffine<const Transform *>;
+  table.TransformsToMVP = ComposeMVP<const Transform *>;
+  table.TransformStreamsToAffine =
+      ComposeAffine<const TransformComponentsSoA &>;
+  table.TransformStreamsToMVP = ComposeMVP<const TransformComponentsSoA &>;
+  table.PackFloat3 = PackFloat3;
+  table.UnpackFloat3 = UnpackFloat3;
+  table.PackHalf3 = PackHalf3;
+  table.UnpackHalf3 = UnpackHalf3;
+  table.Noise2 = Noise2;
+  table.Noise3 = Noise3;
+  table.Noise4 = Noise4;
+  table.CullBvh = CullBvh;
+  table.RaycastBvh = RaycastBvh;
+  return table;
+}
+
+} // namespace
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
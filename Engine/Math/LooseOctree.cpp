@@ -0,0 +1,644 @@
+#include "LooseOctree.h"
+#include "../Core/JobSystem.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <utility>
+
+namespace Engine {
+namespace Math {
+
+namespace {
+
+constexpr float kInfinity = std::numeric_limits<float>::infinity();
+// Handles keep the pool in the top bits and the node index below
+constexpr uint32_t kPoolShift = 28;
+constexpr uint32_t kIndexMask = (1u << kPoolShift) - 1;
+constexpr uint32_t kRoot = 0;
+// Objects per job in the passes over objects, and nodes per job in those
+// over nodes
+constexpr uint32_t kObjectGrain = 16384;
+constexpr uint32_t kNodeGrain = 256;
+// Objects ahead of the current one whose boxes Update() prefetches
+constexpr size_t kPrefetchDistance = 8;
+// Deepest traversal stack: up to eight children pushed per level
+constexpr int kStackSize = 8 * (kLooseOctreeMaxDepth + 1);
+
+uint32_t PoolOf(uint32_t handle) { return handle >> kPoolShift; }
+
+bool Encloses(const AABB &outer, const AABB &inner) {
+  return inner.min.x >= outer.min.x && inner.min.y >= outer.min.y &&
+         inner.min.z >= outer.min.z && inner.max.x <= outer.max.x &&
+         inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+}
+
+// Bit 0, 1 and 2 are set for the upper half in x, y and z
+int OctantOf(const Vec3 &center, const AABB &box) {
+  Vec3 twice = box.min + box.max;
+  return (twice.x >= 2.0f * center.x ? 1 : 0) |
+         (twice.y >= 2.0f * center.y ? 2 : 0) |
+         (twice.z >= 2.0f * center.z ? 4 : 0);
+}
+
+Vec3 ChildCenter(const LooseOctreeNode &node, int octant) {
+  float quarter = node.HalfSize * 0.5f;
+  return node.Center + Vec3(octant & 1 ? quarter : -quarter,
+                            octant & 2 ? quarter : -quarter,
+                            octant & 4 ? quarter : -quarter);
+}
+
+AABB LooseCell(const Vec3 &center, float halfSize, float looseness) {
+  Vec3 extent(halfSize * looseness);
+  return AABB(center - extent, center + extent);
+}
+
+enum class Side { Outside, Crossing, Inside };
+
+using BvhQuery::FrustumLanes;
+
+// FrustumLanes::Touches(), the test Bvh::Cull() applies to objects, that
+// also tells whether the box is entirely inside
+Side Classify(const FrustumLanes<float> &frustum, const AABB &box) {
+  const float bounds[6] = {box.min.x, box.min.y, box.min.z,
+                           box.max.x, box.max.y, box.max.z};
+  Side side = Side::Inside;
+  for (int i = 0; i < 6; ++i) {
+    const Vec4 &plane = frustum.planes[i];
+    auto distance = [&](const int(&rows)[3]) {
+      return FastMath::MulAdd(
+          plane.x, bounds[rows[0]],
+          FastMath::MulAdd(plane.y, bounds[rows[1]],
+                           FastMath::MulAdd(plane.z, bounds[rows[2]],
+                                            plane.w)));
+    };
+    if (!(distance(frustum.p[i]) >= 0.0f)) {
+      return Side::Outside;
+    }
+    if (!(distance(frustum.n[i]) >= 0.0f)) {
+      side = Side::Crossing;
+    }
+  }
+  return side;
+}
+
+// Where the ray enters the box, 0 if it starts inside
+bool EnterBox(const Ray &ray, const Vec3 &invDir, const AABB &box,
+              float &tNear) {
+  Vec3 t1 = (box.min - ray.origin) * invDir;
+  Vec3 t2 = (box.max - ray.origin) * invDir;
+  float nearT = Max(Max(Min(t1.x, t2.x), Min(t1.y, t2.y)), Min(t1.z, t2.z));
+  float farT = Min(Min(Max(t1.x, t2.x), Max(t1.y, t2.y)), Max(t1.z, t2.z));
+  if (nearT > farT || farT < 0.0f) {
+    return false;
+  }
+  tNear = Max(nearT, 0.0f);
+  return true;
+}
+
+// Collects object indices into a span, dropping those past its end
+struct Output {
+  Span<uint32_t> indices;
+  size_t count = 0;
+
+  bool IsFull() const { return count == indices.size(); }
+  void Add(uint32_t object) {
+    if (count < indices.size()) {
+      indices[count++] = object;
+    }
+  }
+};
+
+// Objects of the tree passing 'testObject', with 'testNode' deciding for
+// each node whether to skip its subtree (Outside), test its objects
+// (Crossing) or take the whole subtree untested (Inside)
+template <typename GetNode, typename TestNode, typename TestObject>
+size_t Collect(GetNode getNode, TestNode testNode, TestObject testObject,
+               Span<uint32_t> indices) {
+  Output out{indices};
+  struct Entry {
+    uint32_t node;
+    bool inside;
+  };
+  Entry stack[kStackSize];
+  int top = 0;
+  stack[top++] = {kRoot, false};
+  while (top > 0 && !out.IsFull()) {
+    Entry entry = stack[--top];
+    const LooseOctreeNode &node = getNode(entry.node);
+    bool inside = entry.inside;
+    if (!inside) {
+      Side side = testNode(node);
+      if (side == Side::Outside) {
+        continue;
+      }
+      inside = side == Side::Inside;
+    }
+    for (size_t i = 0; i < node.Objects.size(); ++i) {
+      if (inside || testObject(node.Bounds[i])) {
+        out.Add(node.Objects[i]);
+      }
+    }
+    for (uint32_t child : node.Children) {
+      if (child != LooseOctreeNode::kNone) {
+        stack[top++] = {child, inside};
+      }
+    }
+  }
+  return out.count;
+}
+
+} // namespace
+
+//============================================================================
+// Nodes
+//============================================================================
+const LooseOctreeNode &LooseOctree::GetNode(uint32_t handle) const {
+  return m_Pools[PoolOf(handle)].Nodes[handle & kIndexMask];
+}
+
+LooseOctreeNode &LooseOctree::NodeAt(uint32_t handle) {
+  return m_Pools[PoolOf(handle)].Nodes[handle & kIndexMask];
+}
+
+size_t LooseOctree::GetNodeCount() const {
+  size_t count = 0;
+  for (const Pool &pool : m_Pools) {
+    count += pool.Nodes.size() - pool.Free.size();
+  }
+  return count;
+}
+
+// The root's children start pools 1 to 8; every other node shares its
+// parent's pool, so a job per root octant never touches another's pool
+uint32_t LooseOctree::AllocateNode(uint32_t parent, int octant) {
+  uint32_t poolIndex = parent == kRoot ? octant + 1u : PoolOf(parent);
+  Pool &pool = m_Pools[poolIndex];
+  uint32_t index;
+  if (!pool.Free.empty()) {
+    index = pool.Free.back();
+    pool.Free.pop_back();
+  } else {
+    index = static_cast<uint32_t>(pool.Nodes.size());
+    assert(index <= kIndexMask);
+    pool.Nodes.emplace_back();
+  }
+
+  const Node &parentNode = NodeAt(parent);
+  Node &node = pool.Nodes[index];
+  node.Center = ChildCenter(parentNode, octant);
+  node.HalfSize = parentNode.HalfSize * 0.5f;
+  node.LooseBounds =
+      LooseCell(node.Center, node.HalfSize, m_Settings.Looseness);
+  node.Parent = parent;
+  std::fill(std::begin(node.Children), std::end(node.Children), Node::kNone);
+  node.Depth = static_cast<uint8_t>(parentNode.Depth + 1);
+  node.Split = false;
+  // Recycled nodes keep the capacity of their arrays
+  node.Objects.clear();
+  node.Bounds.clear();
+  return poolIndex << kPoolShift | index;
+}
+
+// Free nodes are recognised by their missing parent
+void LooseOctree::FreeNode(uint32_t handle) {
+  NodeAt(handle).Parent = Node::kNone;
+  m_Pools[PoolOf(handle)].Free.push_back(handle & kIndexMask);
+}
+
+uint32_t LooseOctree::ChildOf(uint32_t handle, int octant) {
+  uint32_t child = NodeAt(handle).Children[octant];
+  if (child == Node::kNone) {
+    // Allocation may move the nodes of this pool
+    child = AllocateNode(handle, octant);
+    NodeAt(handle).Children[octant] = child;
+  }
+  return child;
+}
+
+//============================================================================
+// Insertion and removal
+//============================================================================
+// Descends while the cell has split and the child's loose bounds hold the
+// box, then stores the object, splitting the cell if it overflows
+void LooseOctree::Insert(uint32_t object, const AABB &box, uint32_t handle) {
+  for (;;) {
+    const Node &node = NodeAt(handle);
+    if (!node.Split || node.Depth >= m_Settings.MaxDepth) {
+      break;
+    }
+    int octant = OctantOf(node.Center, box);
+    AABB loose = LooseCell(ChildCenter(node, octant), node.HalfSize * 0.5f,
+                           m_Settings.Looseness);
+    if (!Encloses(loose, box)) {
+      break;
+    }
+    handle = ChildOf(handle, octant);
+  }
+
+  Store(object, box, handle);
+  const Node &node = NodeAt(handle);
+  if (!node.Split && node.Depth < m_Settings.MaxDepth &&
+      node.Objects.size() > m_Settings.SplitThreshold) {
+    SplitNode(handle);
+  }
+}
+
+void LooseOctree::Store(uint32_t object, const AABB &box, uint32_t handle) {
+  Node &node = NodeAt(handle);
+  m_Records[object] = {handle, static_cast<uint32_t>(node.Objects.size())};
+  node.Objects.push_back(object);
+  node.Bounds.push_back(box);
+}
+
+// Moves the last object of the node into the freed slot
+void LooseOctree::Detach(uint32_t object) {
+  Record record = m_Records[object];
+  Node &node = NodeAt(record.Node);
+  uint32_t last = node.Objects.back();
+  node.Objects[record.Slot] = last;
+  node.Bounds[record.Slot] = node.Bounds.back();
+  m_Records[last].Slot = record.Slot;
+  node.Objects.pop_back();
+  node.Bounds.pop_back();
+}
+
+// Frees the node and its ancestors while they are empty and childless
+void LooseOctree::Prune(uint32_t handle) {
+  while (handle != kRoot) {
+    Node &node = NodeAt(handle);
+    if (node.Parent == Node::kNone || !node.Objects.empty() ||
+        std::any_of(std::begin(node.Children), std::end(node.Children),
+                    [](uint32_t child) { return child != Node::kNone; })) {
+      break;
+    }
+    uint32_t parent = node.Parent;
+    for (uint32_t &child : NodeAt(parent).Children) {
+      if (child == handle) {
+        child = Node::kNone;
+      }
+    }
+    FreeNode(handle);
+    handle = parent;
+  }
+}
+
+// The nearest ancestor whose loose bounds hold the box. It is in the
+// node's pool, or the root for objects that left their root octant.
+uint32_t LooseOctree::ClimbFrom(uint32_t handle, const AABB &box) const {
+  while (handle != kRoot) {
+    const Node &node = GetNode(handle);
+    if (Encloses(node.LooseBounds, box)) {
+      break;
+    }
+    handle = node.Parent;
+  }
+  return handle;
+}
+
+// From now on objects that fit a child go there, including the ones
+// already stored here
+void LooseOctree::SplitNode(uint32_t handle) {
+  Node &node = NodeAt(handle);
+  node.Split = true;
+  std::vector<uint32_t> objects;
+  std::vector<AABB> boxes;
+  objects.swap(node.Objects);
+  boxes.swap(node.Bounds);
+  for (size_t i = 0; i < objects.size(); ++i) {
+    Insert(objects[i], boxes[i], handle);
+  }
+}
+
+// Objects starting at the root (every one when 'starts' is empty) are
+// stored there until it splits, then grouped by root octant; the insertion
+// then runs one job per octant, each in its own pool
+void LooseOctree::InsertBatch(Span<const uint32_t> objects,
+                              Span<const AABB> boxes,
+                              Span<const uint32_t> starts) {
+  // Positions in 'objects', from the octant's top node or from 'starts'
+  std::vector<uint32_t> fromTop[8], fromStart[8];
+  for (size_t i = 0; i < objects.size(); ++i) {
+    uint32_t position = static_cast<uint32_t>(i);
+    if (!starts.empty() && starts[i] != kRoot) {
+      fromStart[PoolOf(starts[i]) - 1].push_back(position);
+      continue;
+    }
+    // Pool 0 holds only the root, so this reference stays valid
+    const Node &root = NodeAt(kRoot);
+    if (!root.Split) {
+      Insert(objects[i], boxes[i], kRoot);
+      continue;
+    }
+    int octant = OctantOf(root.Center, boxes[i]);
+    AABB loose = LooseCell(ChildCenter(root, octant), root.HalfSize * 0.5f,
+                           m_Settings.Looseness);
+    if (Encloses(loose, boxes[i])) {
+      fromTop[octant].push_back(position);
+    } else {
+      Store(objects[i], boxes[i], kRoot);
+    }
+  }
+
+  JobSystem::ParallelFor(8, 1, [&](uint32_t begin, uint32_t end) {
+    for (uint32_t octant = begin; octant < end; ++octant) {
+      if (!fromTop[octant].empty()) {
+        uint32_t child = ChildOf(kRoot, static_cast<int>(octant));
+        for (uint32_t i : fromTop[octant]) {
+          Insert(objects[i], boxes[i], child);
+        }
+      }
+      for (uint32_t i : fromStart[octant]) {
+        Insert(objects[i], boxes[i], starts[i]);
+      }
+    }
+  });
+}
+
+//============================================================================
+// Build and update
+//============================================================================
+void LooseOctree::Build(Span<const AABB> boxes,
+                        const LooseOctreeSettings &settings) {
+  Clear();
+  assert(settings.Looseness > 1.0f);
+  assert(settings.MaxDepth >= 0 && settings.MaxDepth <= kLooseOctreeMaxDepth);
+  m_Settings = settings;
+  if (boxes.empty()) {
+    return;
+  }
+
+  Vec3 low(kInfinity), high(-kInfinity);
+  for (const AABB &box : boxes) {
+    Vec3 center = box.Center();
+    low = Vec3(Min(low.x, center.x), Min(low.y, center.y),
+               Min(low.z, center.z));
+    high = Vec3(Max(high.x, center.x), Max(high.y, center.y),
+                Max(high.z, center.z));
+  }
+  Vec3 size = high - low;
+  float halfSize = Max(Max(size.x, size.y), size.z) * 0.5f;
+  // A little larger, so rounding never puts the outermost centers outside
+  halfSize = halfSize > 0.0f ? halfSize * 1.001f : 1.0f;
+
+  Node root;
+  root.Center = (low + high) * 0.5f;
+  root.HalfSize = halfSize;
+  root.LooseBounds = AABB(Vec3(-kInfinity), Vec3(kInfinity));
+  std::fill(std::begin(root.Children), std::end(root.Children), Node::kNone);
+  m_Pools[0].Nodes.push_back(std::move(root));
+
+  m_Records.resize(boxes.size());
+  std::vector<uint32_t> objects(boxes.size());
+  std::iota(objects.begin(), objects.end(), 0u);
+  InsertBatch(objects, boxes, {});
+}
+
+// Node by node, so each node's arrays are walked in order and only the
+// new boxes are gathered. Objects still inside their node's loose bounds
+// just have their box replaced.
+void LooseOctree::Update(Span<const AABB> boxes) {
+  assert(boxes.size() == m_Records.size());
+  std::vector<std::pair<uint32_t, uint32_t>> ranges;
+  for (uint32_t pool = 0; pool < 9; ++pool) {
+    uint32_t count = static_cast<uint32_t>(m_Pools[pool].Nodes.size());
+    for (uint32_t begin = 0; begin < count; begin += kNodeGrain) {
+      ranges.emplace_back(pool << kPoolShift | begin,
+                          pool << kPoolShift |
+                              std::min(begin + kNodeGrain, count));
+    }
+  }
+
+  std::vector<std::vector<uint32_t>> moved(ranges.size());
+  JobSystem::ParallelFor(
+      static_cast<uint32_t>(ranges.size()), 1,
+      [&](uint32_t first, uint32_t last) {
+        for (uint32_t range = first; range < last; ++range) {
+          auto [begin, end] = ranges[range];
+          for (uint32_t handle = begin; handle < end; ++handle) {
+            // Free nodes have no objects
+            Node &node = NodeAt(handle);
+            const size_t count = node.Objects.size();
+            for (size_t slot = 0; slot < count; ++slot) {
+              // The boxes are in object order, so every read is a gather
+              if (slot + kPrefetchDistance < count) {
+                const AABB &ahead =
+                    boxes[node.Objects[slot + kPrefetchDistance]];
+                _mm_prefetch(reinterpret_cast<const char *>(&ahead),
+                             _MM_HINT_T0);
+              }
+              const AABB &box = boxes[node.Objects[slot]];
+              if (Encloses(node.LooseBounds, box)) {
+                node.Bounds[slot] = box;
+              } else {
+                moved[range].push_back(node.Objects[slot]);
+              }
+            }
+          }
+        }
+      });
+
+  m_Moved.clear();
+  for (const std::vector<uint32_t> &chunk : moved) {
+    m_Moved.insert(m_Moved.end(), chunk.begin(), chunk.end());
+  }
+  std::vector<AABB> movedBoxes(m_Moved.size());
+  for (size_t i = 0; i < m_Moved.size(); ++i) {
+    movedBoxes[i] = boxes[m_Moved[i]];
+  }
+  Reinsert(movedBoxes);
+}
+
+void LooseOctree::Update(Span<const uint32_t> objects,
+                         Span<const AABB> boxes) {
+  assert(objects.size() == boxes.size());
+  const uint32_t count = static_cast<uint32_t>(objects.size());
+  const uint32_t chunkCount = (count + kObjectGrain - 1) / kObjectGrain;
+  // Positions in 'objects'
+  std::vector<std::vector<uint32_t>> moved(chunkCount);
+  JobSystem::ParallelFor(count, kObjectGrain, [&](uint32_t begin,
+                                                  uint32_t end) {
+    std::vector<uint32_t> &chunk = moved[begin / kObjectGrain];
+    for (uint32_t i = begin; i < end; ++i) {
+      Record record = m_Records[objects[i]];
+      Node &node = NodeAt(record.Node);
+      if (Encloses(node.LooseBounds, boxes[i])) {
+        node.Bounds[record.Slot] = boxes[i];
+      } else {
+        chunk.push_back(i);
+      }
+    }
+  });
+
+  m_Moved.clear();
+  std::vector<AABB> movedBoxes;
+  for (const std::vector<uint32_t> &chunk : moved) {
+    for (uint32_t i : chunk) {
+      m_Moved.push_back(objects[i]);
+      movedBoxes.push_back(boxes[i]);
+    }
+  }
+  Reinsert(movedBoxes);
+}
+
+// Moves the objects in m_Moved, with 'boxes[i]' for m_Moved[i]. One job
+// per pool detaches its objects and finds where each should start its
+// descent; after the insertion, cells left empty are freed, again by pool.
+// Freeing comes last so that no start node disappears in between.
+void LooseOctree::Reinsert(Span<const AABB> boxes) {
+  if (m_Moved.empty()) {
+    return;
+  }
+  const size_t count = m_Moved.size();
+  std::vector<uint32_t> sources(count), starts(count);
+  std::vector<uint32_t> byPool[9];
+  for (size_t i = 0; i < count; ++i) {
+    sources[i] = m_Records[m_Moved[i]].Node;
+    byPool[PoolOf(sources[i])].push_back(static_cast<uint32_t>(i));
+  }
+  JobSystem::ParallelFor(9, 1, [&](uint32_t begin, uint32_t end) {
+    for (uint32_t pool = begin; pool < end; ++pool) {
+      for (uint32_t i : byPool[pool]) {
+        starts[i] = ClimbFrom(sources[i], boxes[i]);
+        Detach(m_Moved[i]);
+      }
+    }
+  });
+
+  InsertBatch(m_Moved, boxes, starts);
+
+  JobSystem::ParallelFor(9, 1, [&](uint32_t begin, uint32_t end) {
+    for (uint32_t pool = begin; pool < end; ++pool) {
+      for (uint32_t i : byPool[pool]) {
+        Prune(sources[i]);
+      }
+    }
+  });
+}
+
+void LooseOctree::Clear() {
+  for (Pool &pool : m_Pools) {
+    pool.Nodes.clear();
+    pool.Free.clear();
+  }
+  m_Records.clear();
+  m_Moved.clear();
+}
+
+//============================================================================
+// Queries
+//============================================================================
+size_t LooseOctree::Cull(const Frustum &frustum,
+                         Span<uint32_t> indices) const {
+  if (IsEmpty()) {
+    return 0;
+  }
+  const FrustumLanes<float> lanes(frustum.planes);
+  return Collect(
+      [this](uint32_t handle) -> const Node & { return GetNode(handle); },
+      [&](const Node &node) {
+        // The root's bounds are infinite
+        return node.Depth == 0 ? Side::Crossing
+                               : Classify(lanes, node.LooseBounds);
+      },
+      [&](const AABB &box) { return lanes.Touches(box); }, indices);
+}
+
+size_t LooseOctree::Overlap(const Sphere &sphere,
+                            Span<uint32_t> indices) const {
+  if (IsEmpty()) {
+    return 0;
+  }
+  return Collect(
+      [this](uint32_t handle) -> const Node & { return GetNode(handle); },
+      [&](const Node &node) {
+        return sphere.Intersects(node.LooseBounds) ? Side::Crossing
+                                                   : Side::Outside;
+      },
+      [&](const AABB &box) { return sphere.Intersects(box); }, indices);
+}
+
+size_t LooseOctree::Overlap(const AABB &box, Span<uint32_t> indices) const {
+  if (IsEmpty()) {
+    return 0;
+  }
+  return Collect(
+      [this](uint32_t handle) -> const Node & { return GetNode(handle); },
+      [&](const Node &node) {
+        if (!box.Intersects(node.LooseBounds)) {
+          return Side::Outside;
+        }
+        return Encloses(box, node.LooseBounds) ? Side::Inside
+                                               : Side::Crossing;
+      },
+      [&](const AABB &object) { return box.Intersects(object); }, indices);
+}
+
+// Depth first, nearest child first, skipping nodes that start beyond the
+// closest hit so far
+bool LooseOctree::Raycast(const Ray &ray, RayHit &hit,
+                          RayQuery query) const {
+  if (IsEmpty()) {
+    return false;
+  }
+  const Vec3 invDir = ray.InverseDirection();
+  const float limit = hit.T;
+  struct Entry {
+    uint32_t node;
+    float t;
+  };
+  Entry stack[kStackSize];
+  int top = 0;
+  stack[top++] = {kRoot, 0.0f};
+  while (top > 0) {
+    Entry entry = stack[--top];
+    if (entry.t > hit.T) {
+      continue;
+    }
+    const Node &node = GetNode(entry.node);
+    for (size_t i = 0; i < node.Objects.size(); ++i) {
+      float t;
+      if (ray.IntersectAABB(node.Bounds[i], invDir, t) && t < hit.T) {
+        hit.T = t;
+        hit.Index = node.Objects[i];
+        hit.U = hit.V = 0.0f;
+        if (query == RayQuery::Any) {
+          return true;
+        }
+      }
+    }
+
+    // Farthest pushed first, so the nearest is popped next
+    Entry children[8];
+    int count = 0;
+    for (uint32_t child : node.Children) {
+      float t;
+      if (child != Node::kNone &&
+          EnterBox(ray, invDir, GetNode(child).LooseBounds, t) && t <= hit.T) {
+        int slot = count++;
+        for (; slot > 0 && children[slot - 1].t < t; --slot) {
+          children[slot] = children[slot - 1];
+        }
+        children[slot] = {child, t};
+      }
+    }
+    for (int i = 0; i < count; ++i) {
+      stack[top++] = children[i];
+    }
+  }
+  return hit.T < limit;
+}
+
+void LooseOctree::Raycast(Span<const Ray> rays, Span<RayHit> hits,
+                          RayQuery query, uint32_t grainSize) const {
+  JobSystem::ParallelFor(
+      static_cast<uint32_t>(std::min(rays.size(), hits.size())), grainSize,
+      [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+          Raycast(rays[i], hits[i], query);
+        }
+      });
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
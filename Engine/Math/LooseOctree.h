@@ -0,0 +1,147 @@
+#pragma once
+
+// Loose octree over axis-aligned boxes, for scenes where most objects move
+// every frame. A Bvh refit keeps its topology, so its boxes swell as objects
+// drift apart; here each object sits in the cell holding its center, and a
+// cell's bounds are Looseness times its size, so an object only changes
+// cells once its box leaves those loose bounds. Update() costs a
+// containment test per object plus a reinsertion per object that left.
+//
+// Nodes live in pooled arrays, one per octant of the root, and are recycled
+// through free lists, so reinsertions rarely allocate. Each octant is
+// updated as a separate job when the job system is running.
+
+#include "../Core/Span.h"
+#include "Bvh.h"
+#include "Math.h"
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+namespace Math {
+
+// Deepest level a LooseOctree splits to; sizes the traversal stacks
+constexpr int kLooseOctreeMaxDepth = 16;
+
+struct LooseOctreeSettings {
+  // Node bounds over cell size, above 1. Objects whose half extent is up
+  // to (Looseness - 1) times the cell's half size fit a cell; larger
+  // values move objects less often but make the nodes overlap more.
+  float Looseness = 2.0f;
+  // The root is depth 0; at most kLooseOctreeMaxDepth
+  int MaxDepth = 10;
+  // A cell holding more objects than this splits, pushing down the ones
+  // that fit its children
+  uint32_t SplitThreshold = 64;
+};
+
+//============================================================================
+// LooseOctreeNode - A cell with its objects and up to eight children
+//============================================================================
+// Children and Parent are node handles (pool and index), or kNone. Objects
+// and Bounds hold the objects stored at this cell and their boxes, so
+// queries read them contiguously.
+struct LooseOctreeNode {
+  static constexpr uint32_t kNone = 0xFFFFFFFFu;
+
+  Vec3 Center;
+  float HalfSize = 0.0f;
+  // Center -/+ HalfSize * Looseness; infinite for the root, which keeps
+  // the objects that fit nowhere else
+  AABB LooseBounds;
+  uint32_t Parent = kNone;
+  uint32_t Children[8];
+  uint8_t Depth = 0;
+  // Set once the cell has split: new objects that fit a child go there
+  bool Split = false;
+  std::vector<uint32_t> Objects;
+  std::vector<AABB> Bounds;
+};
+
+//============================================================================
+// LooseOctree - Octree with loose cells, pooled nodes and batched updates
+//============================================================================
+// Object i is the i-th box passed to Build(). Queries are const and may run
+// concurrently; Build() and Update() may not overlap them.
+class LooseOctree {
+public:
+  using Node = LooseOctreeNode;
+
+  // The root cell is the smallest cube around every box's center; objects
+  // that later leave it are kept at the root
+  void Build(Span<const AABB> boxes, const LooseOctreeSettings &settings = {});
+
+  // New boxes for the same objects, in the same order as for Build()
+  void Update(Span<const AABB> boxes);
+  // New boxes for some of the objects: 'boxes[i]' for object 'objects[i]'
+  void Update(Span<const uint32_t> objects, Span<const AABB> boxes);
+
+  void Clear();
+
+  // Writes the indices of the objects intersecting the volume, in no
+  // particular order, and returns how many there are; stops once 'indices'
+  // is full. Objects are tested against the frustum as by Bvh::Cull(), and
+  // cells entirely inside a frustum or box are copied without tests.
+  size_t Cull(const Frustum &frustum, Span<uint32_t> indices) const;
+  size_t Overlap(const Sphere &sphere, Span<uint32_t> indices) const;
+  size_t Overlap(const AABB &box, Span<uint32_t> indices) const;
+
+  // Boxes hit as Ray::IntersectAABB() would, with the semantics of RayHit
+  // and RayQuery as for Bvh::Raycast()
+  bool Raycast(const Ray &ray, RayHit &hit,
+               RayQuery query = RayQuery::Closest) const;
+  void Raycast(Span<const Ray> rays, Span<RayHit> hits,
+               RayQuery query = RayQuery::Closest,
+               uint32_t grainSize = 1024) const;
+
+  bool IsEmpty() const { return m_Records.empty(); }
+  size_t GetObjectCount() const { return m_Records.size(); }
+  size_t GetNodeCount() const;
+  // Objects that changed cells in the last Update()
+  size_t GetReinsertedCount() const { return m_Moved.size(); }
+  const LooseOctreeSettings &GetSettings() const { return m_Settings; }
+
+  // Handle of the root, and of the node holding an object
+  uint32_t GetRoot() const { return m_Records.empty() ? Node::kNone : 0; }
+  uint32_t GetNodeOf(uint32_t object) const { return m_Records[object].Node; }
+  const Node &GetNode(uint32_t handle) const;
+
+private:
+  // Where an object is stored: its node and its slot in the node's arrays
+  struct Record {
+    uint32_t Node;
+    uint32_t Slot;
+  };
+
+  // Nodes of one root octant (or just the root, for pool 0) and the
+  // indices of its free nodes
+  struct Pool {
+    std::vector<LooseOctreeNode> Nodes;
+    std::vector<uint32_t> Free;
+  };
+
+  Node &NodeAt(uint32_t handle);
+  uint32_t AllocateNode(uint32_t parent, int octant);
+  void FreeNode(uint32_t handle);
+  uint32_t ChildOf(uint32_t handle, int octant);
+
+  void Insert(uint32_t object, const AABB &box, uint32_t handle);
+  void Store(uint32_t object, const AABB &box, uint32_t handle);
+  void Detach(uint32_t object);
+  void Prune(uint32_t handle);
+  uint32_t ClimbFrom(uint32_t handle, const AABB &box) const;
+  void SplitNode(uint32_t handle);
+  void InsertBatch(Span<const uint32_t> objects, Span<const AABB> boxes,
+                   Span<const uint32_t> starts);
+  void Reinsert(Span<const AABB> boxes);
+
+private:
+  LooseOctreeSettings m_Settings;
+  Pool m_Pools[9];
+  std::vector<Record> m_Records;
+  // Objects reinserted by the last Update()
+  std::vector<uint32_t> m_Moved;
+};
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include "Math.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Logger.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace Engine {
+namespace Math {
+
+namespace {
+
+template <typename Bounds>
+using CullKernel = size_t (*)(const Vec4 *planes, const Bounds &bounds,
+                              size_t begin, size_t end, uint32_t *visible);
+
+// Each chunk writes its indices at its own offset of 'visible'; the chunks'
+// results are then packed together in order
+template <typename Bounds>
+size_t CullChunked(CullKernel<Bounds> kernel, const Vec4 *planes,
+                   const Bounds &bounds, size_t count, uint32_t *visible,
+                   uint32_t grainSize) {
+  grainSize = std::max(grainSize, 1u);
+  size_t chunkCount = (count + grainSize - 1) / grainSize;
+  if (!JobSystem::IsRunning() || chunkCount <= 1) {
+    return kernel(planes, bounds, 0, count, visible);
+  }
+
+  std::vector<size_t> visibleCounts(chunkCount);
+  JobSystem::ParallelFor(
+      static_cast<uint32_t>(chunkCount), 1,
+      [&](uint32_t firstChunk, uint32_t lastChunk) {
+        for (uint32_t chunk = firstChunk; chunk < lastChunk; ++chunk) {
+          size_t begin = static_cast<size_t>(chunk) * grainSize;
+          size_t end = std::min(begin + grainSize, count);
+          visibleCounts[chunk] =
+              kernel(planes, bounds, begin, end, visible + begin);
+        }
+      });
+
+  size_t total = visibleCounts[0];
+  for (size_t chunk = 1; chunk < chunkCount; ++chunk) {
+    std::memmove(visible + total, visible + chunk * grainSize,
+                 visibleCounts[chunk] * sizeof(uint32_t));
+    total += visibleCounts[chunk];
+  }
+  return total;
+}
+
+// Any element may be visible, so the output needs room for every one. A
+// short output is a caller bug: it is reported, and only as many elements
+// as fit are tested.
+size_t CheckedCount(size_t count, Span<uint32_t> visibleIndices) {
+  assert(visibleIndices.size() >= count &&
+         "Frustum::Cull() output is smaller than the bounds");
+  if (visibleIndices.size() < count) {
+    Logger::Error("Frustum", "Cull() output holds " +
+                                 std::to_string(visibleIndices.size()) +
+                                 " indices for " + std::to_string(count) +
+                                 " elements");
+    return visibleIndices.size();
+  }
+  return count;
+}
+
+} // namespace
+
+size_t Frustum::Cull(const SphereBoundsSoA &spheres,
+                     Span<uint32_t> visibleIndices,
+                     uint32_t grainSize) const {
+  size_t count = CheckedCount(spheres.Size(), visibleIndices);
+  return CullChunked(MathKernels::Get().CullSpheresSoA, planes, spheres, count,
+                     visibleIndices.data(), grainSize);
+}
+
+size_t Frustum::Cull(const BoxBoundsSoA &boxes, Span<uint32_t> visibleIndices,
+                     uint32_t grainSize) const {
+  size_t count = CheckedCount(boxes.Size(), visibleIndices);
+  return CullChunked(MathKernels::Get().CullBoxesSoA, planes, boxes, count,
+                     visibleIndices.data(), grainSize);
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
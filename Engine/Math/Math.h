@@ -3,8 +3,11 @@
 // Core math library for the 3D Engine
 // Includes SIMD-optimized vectors, matrices, and quaternions
 
+#include "Affine.h"
+#include "MathKernels.h"
 #include "MathTypes.h"
 #include "Matrix.h"
+#include "Packed.h"
 #include "Quaternion.h"
 #include "Vector.h"
 
@@ -20,25 +23,25 @@ namespace Math {
 struct AABB {
   Vec3 min, max;
 
-  AABB() : min(Vec3::Zero()), max(Vec3::Zero()) {}
-  AABB(const Vec3 &min, const Vec3 &max) : min(min), max(max) {}
+  constexpr AABB() : min(Vec3::Zero()), max(Vec3::Zero()) {}
+  constexpr AABB(const Vec3 &min, const Vec3 &max) : min(min), max(max) {}
 
-  Vec3 Center() const { return (min + max) * 0.5f; }
-  Vec3 Size() const { return max - min; }
-  Vec3 Extents() const { return Size() * 0.5f; }
+  constexpr Vec3 Center() const { return (min + max) * 0.5f; }
+  constexpr Vec3 Size() const { return max - min; }
+  constexpr Vec3 Extents() const { return Size() * 0.5f; }
 
-  bool Contains(const Vec3 &point) const {
+  constexpr bool Contains(const Vec3 &point) const {
     return point.x >= min.x && point.x <= max.x && point.y >= min.y &&
            point.y <= max.y && point.z >= min.z && point.z <= max.z;
   }
 
-  bool Intersects(const AABB &other) const {
+  constexpr bool Intersects(const AABB &other) const {
     return min.x <= other.max.x && max.x >= other.min.x &&
            min.y <= other.max.y && max.y >= other.min.y &&
            min.z <= other.max.z && max.z >= other.min.z;
   }
 
-  AABB Transformed(const Mat4 &transform) const {
+  constexpr AABB Transformed(const Mat4 &transform) const {
     Vec3 corners[8] = {Vec3(min.x, min.y, min.z), Vec3(max.x, min.y, min.z),
                        Vec3(min.x, max.y, min.z), Vec3(max.x, max.y, min.z),
                        Vec3(min.x, min.y, max.z), Vec3(max.x, min.y, max.z),
@@ -66,19 +69,20 @@ struct Sphere {
   Vec3 center;
   float radius;
 
-  Sphere() : center(Vec3::Zero()), radius(0.0f) {}
-  Sphere(const Vec3 &center, float radius) : center(center), radius(radius) {}
+  constexpr Sphere() : center(Vec3::Zero()), radius(0.0f) {}
+  constexpr Sphere(const Vec3 &center, float radius)
+      : center(center), radius(radius) {}
 
-  bool Contains(const Vec3 &point) const {
+  constexpr bool Contains(const Vec3 &point) const {
     return (point - center).LengthSquared() <= radius * radius;
   }
 
-  bool Intersects(const Sphere &other) const {
+  constexpr bool Intersects(const Sphere &other) const {
     float distance = (center - other.center).Length();
     return distance <= (radius + other.radius);
   }
 
-  bool Intersects(const AABB &aabb) const {
+  constexpr bool Intersects(const AABB &aabb) const {
     Vec3 closest = Vec3(Clamp(center.x, aabb.min.x, aabb.max.x),
                         Clamp(center.y, aabb.min.y, aabb.max.y),
                         Clamp(center.z, aabb.min.z, aabb.max.z));
@@ -95,36 +99,37 @@ struct Frustum {
   static Frustum FromMatrix(const Mat4 &matrix) {
     Frustum frustum;
 
-    // Extract frustum planes from projection * view matrix
+    // Extract frustum planes from projection * view matrix: with column
+    // vectors each plane is the w row plus or minus the x, y or z row
     // Left plane
     frustum.planes[0] =
-        Vec4(matrix.m[0][3] + matrix.m[0][0], matrix.m[1][3] + matrix.m[1][0],
-             matrix.m[2][3] + matrix.m[2][0], matrix.m[3][3] + matrix.m[3][0]);
+        Vec4(matrix.m[3][0] + matrix.m[0][0], matrix.m[3][1] + matrix.m[0][1],
+             matrix.m[3][2] + matrix.m[0][2], matrix.m[3][3] + matrix.m[0][3]);
 
     // Right plane
     frustum.planes[1] =
-        Vec4(matrix.m[0][3] - matrix.m[0][0], matrix.m[1][3] - matrix.m[1][0],
-             matrix.m[2][3] - matrix.m[2][0], matrix.m[3][3] - matrix.m[3][0]);
+        Vec4(matrix.m[3][0] - matrix.m[0][0], matrix.m[3][1] - matrix.m[0][1],
+             matrix.m[3][2] - matrix.m[0][2], matrix.m[3][3] - matrix.m[0][3]);
 
     // Bottom plane
     frustum.planes[2] =
-        Vec4(matrix.m[0][3] + matrix.m[0][1], matrix.m[1][3] + matrix.m[1][1],
-             matrix.m[2][3] + matrix.m[2][1], matrix.m[3][3] + matrix.m[3][1]);
+        Vec4(matrix.m[3][0] + matrix.m[1][0], matrix.m[3][1] + matrix.m[1][1],
+             matrix.m[3][2] + matrix.m[1][2], matrix.m[3][3] + matrix.m[1][3]);
 
     // Top plane
     frustum.planes[3] =
-        Vec4(matrix.m[0][3] - matrix.m[0][1], matrix.m[1][3] - matrix.m[1][1],
-             matrix.m[2][3] - matrix.m[2][1], matrix.m[3][3] - matrix.m[3][1]);
+        Vec4(matrix.m[3][0] - matrix.m[1][0], matrix.m[3][1] - matrix.m[1][1],
+             matrix.m[3][2] - matrix.m[1][2], matrix.m[3][3] - matrix.m[1][3]);
 
     // Near plane
     frustum.planes[4] =
-        Vec4(matrix.m[0][3] + matrix.m[0][2], matrix.m[1][3] + matrix.m[1][2],
-             matrix.m[2][3] + matrix.m[2][2], matrix.m[3][3] + matrix.m[3][2]);
+        Vec4(matrix.m[3][0] + matrix.m[2][0], matrix.m[3][1] + matrix.m[2][1],
+             matrix.m[3][2] + matrix.m[2][2], matrix.m[3][3] + matrix.m[2][3]);
 
     // Far plane
     frustum.planes[5] =
-        Vec4(matrix.m[0][3] - matrix.m[0][2], matrix.m[1][3] - matrix.m[1][2],
-             matrix.m[2][3] - matrix.m[2][2], matrix.m[3][3] - matrix.m[3][2]);
+        Vec4(matrix.m[3][0] - matrix.m[2][0], matrix.m[3][1] - matrix.m[2][1],
+             matrix.m[3][2] - matrix.m[2][2], matrix.m[3][3] - matrix.m[2][3]);
 
     // Normalize planes
     for (int i = 0; i < 6; ++i) {
@@ -169,6 +174,26 @@ struct Frustum {
     }
     return true;
   }
+
+  // Batch sphere test on the MathKernels set for this CPU. Spheres are
+  // (center, radius); writes 1 to 'visible' for each sphere that intersects.
+  void Intersects(Span<const Vec4> spheres, Span<uint8_t> visible) const {
+    size_t count = std::min(spheres.size(), visible.size());
+    MathKernels::Get().CullSpheres(planes, spheres.data(), visible.data(),
+                                   count);
+  }
+
+  // Batch culling of structure-of-arrays bounds on the MathKernels set for
+  // this CPU (Math.cpp). Writes the indices of the visible elements to
+  // 'visibleIndices' in ascending order and returns how many there are.
+  // 'visibleIndices' must hold at least Size() indices of the bounds;
+  // a shorter one asserts in debug builds and logs an error otherwise.
+  // With the job system running, chunks of 'grainSize' elements run in
+  // parallel.
+  size_t Cull(const SphereBoundsSoA &spheres, Span<uint32_t> visibleIndices,
+              uint32_t grainSize = 16384) const;
+  size_t Cull(const BoxBoundsSoA &boxes, Span<uint32_t> visibleIndices,
+              uint32_t grainSize = 16384) const;
 };
 
 //============================================================================
@@ -178,13 +203,13 @@ struct Ray {
   Vec3 origin;
   Vec3 direction;
 
-  Ray() : origin(Vec3::Zero()), direction(Vec3::Forward()) {}
-  Ray(const Vec3 &origin, const Vec3 &direction)
+  constexpr Ray() : origin(Vec3::Zero()), direction(Vec3::Forward()) {}
+  constexpr Ray(const Vec3 &origin, const Vec3 &direction)
       : origin(origin), direction(direction.Normalized()) {}
 
-  Vec3 At(float t) const { return origin + direction * t; }
+  constexpr Vec3 At(float t) const { return origin + direction * t; }
 
-  bool IntersectSphere(const Sphere &sphere, float &t) const {
+  constexpr bool IntersectSphere(const Sphere &sphere, float &t) const {
     Vec3 oc = origin - sphere.center;
     float a = direction.Dot(direction);
     float b = 2.0f * oc.Dot(direction);
@@ -210,10 +235,18 @@ struct Ray {
     return false;
   }
 
-  bool IntersectAABB(const AABB &aabb, float &t) const {
-    Vec3 invDir =
-        Vec3(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+  constexpr Vec3 InverseDirection() const {
+    return Vec3(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+  }
 
+  constexpr bool IntersectAABB(const AABB &aabb, float &t) const {
+    return IntersectAABB(aabb, InverseDirection(), t);
+  }
+
+  // Slab test with InverseDirection() computed once by the caller, for rays
+  // tested against many boxes
+  constexpr bool IntersectAABB(const AABB &aabb, const Vec3 &invDir,
+                               float &t) const {
     Vec3 t1 = (aabb.min - origin) * invDir;
     Vec3 t2 = (aabb.max - origin) * invDir;
 
@@ -230,8 +263,78 @@ struct Ray {
     t = tNear > 0.0f ? tNear : tFar;
     return true;
   }
+
+  // Moller-Trumbore, both windings. 'u' and 'v' are the barycentric weights
+  // of v1 and v2 at the hit.
+  constexpr bool IntersectTriangle(const Vec3 &v0, const Vec3 &v1,
+                                   const Vec3 &v2, float &t, float &u,
+                                   float &v) const {
+    Vec3 edge1 = v1 - v0;
+    Vec3 edge2 = v2 - v0;
+    Vec3 p = direction.Cross(edge2);
+    float determinant = edge1.Dot(p);
+    if (Abs(determinant) < EPSILON) {
+      return false;
+    }
+
+    float inverse = 1.0f / determinant;
+    Vec3 s = origin - v0;
+    float hitU = s.Dot(p) * inverse;
+    if (hitU < 0.0f || hitU > 1.0f) {
+      return false;
+    }
+
+    Vec3 q = s.Cross(edge1);
+    float hitV = direction.Dot(q) * inverse;
+    if (hitV < 0.0f || hitU + hitV > 1.0f) {
+      return false;
+    }
+
+    float hitT = edge2.Dot(q) * inverse;
+    if (hitT <= EPSILON) {
+      return false;
+    }
+
+    t = hitT;
+    u = hitU;
+    v = hitV;
+    return true;
+  }
+
+  constexpr bool IntersectTriangle(const Vec3 &v0, const Vec3 &v1,
+                                   const Vec3 &v2, float &t) const {
+    float u = 0.0f, v = 0.0f;
+    return IntersectTriangle(v0, v1, v2, t, u, v);
+  }
 };
 
+// Batch ray queries on the MathKernels set for this CPU, 8 rays per packet
+// (RayPacket.h) on the SIMD levels. Each hit keeps its ray's closest hit
+// nearer than the hit's current T; see RayHit.
+inline void Raycast(Span<const Ray> rays, Span<RayHit> hits,
+                    Span<const AABB> boxes) {
+  MathKernels::Get().RaycastBoxes(rays.data(), hits.data(),
+                                  std::min(rays.size(), hits.size()),
+                                  boxes.data(), boxes.size());
+}
+
+inline void Raycast(Span<const Ray> rays, Span<RayHit> hits,
+                    Span<const Sphere> spheres) {
+  MathKernels::Get().RaycastSpheres(rays.data(), hits.data(),
+                                    std::min(rays.size(), hits.size()),
+                                    spheres.data(), spheres.size());
+}
+
+// Indexed triangle list, three indices per triangle
+inline void Raycast(Span<const Ray> rays, Span<RayHit> hits,
+                    Span<const Vec3> vertices,
+                    Span<const uint32_t> indices) {
+  MathKernels::Get().RaycastTriangles(rays.data(), hits.data(),
+                                      std::min(rays.size(), hits.size()),
+                                      vertices.data(), indices.data(),
+                                      indices.size() / 3);
+}
+
 //============================================================================
 // Transform - Combines translation, rotation, and scale
 //============================================================================
@@ -240,37 +343,38 @@ struct Transform {
   Quaternion rotation;
   Vec3 scale;
 
-  Transform()
+  constexpr Transform()
       : position(Vec3::Zero()), rotation(Quaternion::Identity()),
         scale(Vec3::One()) {}
 
-  Transform(const Vec3 &position,
-            const Quaternion &rotation = Quaternion::Identity(),
-            const Vec3 &scale = Vec3::One())
+  constexpr Transform(const Vec3 &position,
+                      const Quaternion &rotation = Quaternion::Identity(),
+                      const Vec3 &scale = Vec3::One())
       : position(position), rotation(rotation), scale(scale) {}
 
-  Mat4 ToMatrix() const {
-    return Mat4::Translation(position) * rotation.ToMatrix() *
-           Mat4::Scale(scale);
+  constexpr Affine3x4 ToAffine() const {
+    return Affine3x4::TRS(position, rotation, scale);
   }
 
-  Vec3 TransformPoint(const Vec3 &point) const {
+  constexpr Mat4 ToMatrix() const { return ToAffine().ToMat4(); }
+
+  constexpr Vec3 TransformPoint(const Vec3 &point) const {
     return rotation.RotateVector(point * scale) + position;
   }
 
-  Vec3 TransformVector(const Vec3 &vector) const {
+  constexpr Vec3 TransformVector(const Vec3 &vector) const {
     return rotation.RotateVector(vector * scale);
   }
 
-  Vec3 InverseTransformPoint(const Vec3 &point) const {
+  constexpr Vec3 InverseTransformPoint(const Vec3 &point) const {
     return rotation.Inverse().RotateVector(point - position) / scale;
   }
 
-  Vec3 InverseTransformVector(const Vec3 &vector) const {
+  constexpr Vec3 InverseTransformVector(const Vec3 &vector) const {
     return rotation.Inverse().RotateVector(vector) / scale;
   }
 
-  Transform Inverse() const {
+  constexpr Transform Inverse() const {
     Quaternion invRotation = rotation.Inverse();
     Vec3 invScale = Vec3(1.0f / scale.x, 1.0f / scale.y, 1.0f / scale.z);
     Vec3 invPosition = invRotation.RotateVector(-position) * invScale;
@@ -284,6 +388,37 @@ struct Transform {
   }
 };
 
+// Batch Transform::ToAffine() and viewProjection * ToAffine() on the
+// MathKernels set for this CPU, 8 transforms at a time on the SIMD levels
+inline void ComposeTransforms(Span<const Transform> transforms,
+                              Span<Affine3x4> models) {
+  MathKernels::Get().TransformsToAffine(
+      transforms.data(), models.data(),
+      std::min(transforms.size(), models.size()));
+}
+
+inline void ComposeTransforms(const Mat4 &viewProjection,
+                              Span<const Transform> transforms,
+                              Span<Mat4> mvps) {
+  MathKernels::Get().TransformsToMVP(viewProjection, transforms.data(),
+                                     mvps.data(),
+                                     std::min(transforms.size(), mvps.size()));
+}
+
+inline void ComposeTransforms(const TransformComponentsSoA &transforms,
+                              Span<Affine3x4> models) {
+  MathKernels::Get().TransformStreamsToAffine(
+      transforms, models.data(), std::min(transforms.Size(), models.size()));
+}
+
+inline void ComposeTransforms(const Mat4 &viewProjection,
+                              const TransformComponentsSoA &transforms,
+                              Span<Mat4> mvps) {
+  MathKernels::Get().TransformStreamsToMVP(
+      viewProjection, transforms, mvps.data(),
+      std::min(transforms.Size(), mvps.size()));
+}
+
 } // namespace Math
 } // namespace Engine
 
@@ -292,6 +427,10 @@ using Vec2 = Engine::Math::Vec2;
 using Vec3 = Engine::Math::Vec3;
 using Vec4 = Engine::Math::Vec4;
 using Mat4 = Engine::Math::Mat4;
+using Affine3x4 = Engine::Math::Affine3x4;
+using Float3 = Engine::Math::Float3;
+using Half3 = Engine::Math::Half3;
+using Float4Packed = Engine::Math::Float4Packed;
 using Quaternion = Engine::Math::Quaternion;
 using Transform = Engine::Math::Transform;
 using AABB = Engine::Math::AABB;
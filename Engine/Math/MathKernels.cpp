@@ -0,0 +1,193 @@
+#include "MathKernels.h"
+#include "../Core/Logger.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define ENGINE_CPUID_X86 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#define ENGINE_CPUID_X86 1
+#endif
+
+namespace Engine {
+namespace Math {
+
+std::atomic<const MathKernelTable *> MathKernels::s_Active{nullptr};
+
+void SphereBoundsSoA::GetStreams(const float *(&streams)[4]) const {
+  const Span<const float> all[] = {CenterX, CenterY, CenterZ, Radius};
+  for (int i = 0; i < 4; ++i) {
+    streams[i] = all[i].data();
+  }
+}
+
+void BoxBoundsSoA::GetStreams(const float *(&streams)[6]) const {
+  const Span<const float> all[] = {CenterX, CenterY, CenterZ,
+                                   ExtentX, ExtentY, ExtentZ};
+  for (int i = 0; i < 6; ++i) {
+    streams[i] = all[i].data();
+  }
+}
+
+void TransformComponentsSoA::GetStreams(const float *(&streams)[10]) const {
+  const Span<const float> all[] = {PositionX, PositionY, PositionZ, RotationX,
+                                   RotationY, RotationZ, RotationW, ScaleX,
+                                   ScaleY, ScaleZ};
+  for (int i = 0; i < 10; ++i) {
+    streams[i] = all[i].data();
+  }
+}
+
+namespace {
+
+#if defined(ENGINE_CPUID_X86)
+struct CpuidResult {
+  uint32_t eax, ebx, ecx, edx;
+};
+
+CpuidResult Cpuid(uint32_t leaf, uint32_t subleaf) {
+  CpuidResult result = {};
+#if defined(_MSC_VER)
+  int registers[4];
+  __cpuidex(registers, static_cast<int>(leaf), static_cast<int>(subleaf));
+  result = {static_cast<uint32_t>(registers[0]),
+            static_cast<uint32_t>(registers[1]),
+            static_cast<uint32_t>(registers[2]),
+            static_cast<uint32_t>(registers[3])};
+#else
+  __cpuid_count(leaf, subleaf, result.eax, result.ebx, result.ecx,
+                result.edx);
+#endif
+  return result;
+}
+
+// Register state the OS saves on context switches (XCR0)
+uint64_t ReadXcr0() {
+#if defined(_MSC_VER)
+  return _xgetbv(0);
+#else
+  uint32_t low, high;
+  __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+  return (static_cast<uint64_t>(high) << 32) | low;
+#endif
+}
+
+bool HasBit(uint32_t value, int bit) { return (value >> bit) & 1u; }
+#endif
+
+SimdLevel DetectCpuLevel() {
+#if defined(ENGINE_CPUID_X86)
+  uint32_t maxLeaf = Cpuid(0, 0).eax;
+  CpuidResult features = Cpuid(1, 0);
+  if (!HasBit(features.edx, 26)) {
+    return SimdLevel::Scalar;
+  }
+  if (!HasBit(features.ecx, 19)) {
+    return SimdLevel::SSE2;
+  }
+
+  // AVX needs the OS to save YMM state; AVX-512 additionally the opmask
+  // and upper ZMM registers
+  bool osxsave = HasBit(features.ecx, 27);
+  uint64_t xcr0 = osxsave ? ReadXcr0() : 0;
+  bool avxState = (xcr0 & 0x6) == 0x6;
+  bool avx512State = (xcr0 & 0xE6) == 0xE6;
+
+  CpuidResult extended = maxLeaf >= 7 ? Cpuid(7, 0) : CpuidResult{};
+  bool avx2 = avxState && HasBit(features.ecx, 28) &&
+              HasBit(features.ecx, 12) && HasBit(extended.ebx, 5);
+  if (!avx2) {
+    return SimdLevel::SSE41;
+  }
+
+  bool avx512 = avx512State && HasBit(extended.ebx, 16) &&
+                HasBit(extended.ebx, 31);
+  return avx512 ? SimdLevel::AVX512 : SimdLevel::AVX2;
+#else
+  return SimdLevel::Scalar;
+#endif
+}
+
+const MathKernelTable *BuiltTable(SimdLevel level) {
+  switch (level) {
+  case SimdLevel::Scalar:
+    return GetScalarKernels();
+#if defined(ENGINE_MATH_KERNELS_SSE2)
+  case SimdLevel::SSE2:
+    return GetSSE2Kernels();
+#endif
+#if defined(ENGINE_MATH_KERNELS_SSE41)
+  case SimdLevel::SSE41:
+    return GetSSE41Kernels();
+#endif
+#if defined(ENGINE_MATH_KERNELS_AVX2)
+  case SimdLevel::AVX2:
+    return GetAVX2Kernels();
+#endif
+#if defined(ENGINE_MATH_KERNELS_AVX512)
+  case SimdLevel::AVX512:
+    return GetAVX512Kernels();
+#endif
+  default:
+    return nullptr;
+  }
+}
+
+} // namespace
+
+const char *GetSimdLevelName(SimdLevel level) {
+  switch (level) {
+  case SimdLevel::Scalar:
+    return "Scalar";
+  case SimdLevel::SSE2:
+    return "SSE2";
+  case SimdLevel::SSE41:
+    return "SSE4.1";
+  case SimdLevel::AVX2:
+    return "AVX2";
+  case SimdLevel::AVX512:
+    return "AVX-512";
+  }
+  return "Unknown";
+}
+
+SimdLevel MathKernels::DetectLevel() {
+  static const SimdLevel level = DetectCpuLevel();
+  return level;
+}
+
+const MathKernelTable *MathKernels::GetTable(SimdLevel level) {
+  if (level > DetectLevel()) {
+    return nullptr;
+  }
+  return BuiltTable(level);
+}
+
+bool MathKernels::Select(SimdLevel level) {
+  const MathKernelTable *table = GetTable(level);
+  if (!table) {
+    return false;
+  }
+  s_Active.store(table, std::memory_order_release);
+  return true;
+}
+
+const MathKernelTable &MathKernels::Initialize() {
+  SimdLevel cpu = DetectLevel();
+
+  const MathKernelTable *table = nullptr;
+  for (int level = static_cast<int>(cpu); !table && level >= 0; --level) {
+    table = BuiltTable(static_cast<SimdLevel>(level));
+  }
+
+  // Several threads may get here first; they all pick the same table
+  s_Active.store(table, std::memory_order_release);
+  Logger::Info("MathKernels", std::string("Using ") +
+                                  GetSimdLevelName(table->Level) +
+                                  " kernels (CPU supports " +
+                                  GetSimdLevelName(cpu) + ")");
+  return *table;
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,250 @@
+#pragma once
+
+#include "Affine.h"
+#include "Matrix.h"
+#include "Quaternion.h"
+#include "Vector.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace Engine {
+namespace Math {
+
+struct AABB;
+struct BvhView;
+struct Float3;
+struct Half3;
+struct NoiseSettings;
+struct Ray;
+struct Sphere;
+struct Transform;
+
+// Instruction set levels with their own kernel table, lowest first
+enum class SimdLevel { Scalar, SSE2, SSE41, AVX2, AVX512 };
+
+const char *GetSimdLevelName(SimdLevel level);
+
+// Up to four bones per vertex; weights sum to one
+struct SkinInfluences {
+  uint16_t Bones[4] = {0, 0, 0, 0};
+  float Weights[4] = {1.0f, 0.0f, 0.0f, 0.0f};
+};
+
+// Bounding volumes with one stream per component, for batch culling. Boxes
+// are center and half extent. Size() is the shortest stream.
+struct SphereBoundsSoA {
+  Span<const float> CenterX, CenterY, CenterZ, Radius;
+
+  size_t Size() const {
+    return std::min({CenterX.size(), CenterY.size(), CenterZ.size(),
+                     Radius.size()});
+  }
+
+  // The stream pointers in member order. Defined out of line so the
+  // per-ISA kernels never compile Span's inline members.
+  void GetStreams(const float *(&streams)[4]) const;
+};
+
+struct BoxBoundsSoA {
+  Span<const float> CenterX, CenterY, CenterZ;
+  Span<const float> ExtentX, ExtentY, ExtentZ;
+
+  size_t Size() const {
+    return std::min({CenterX.size(), CenterY.size(), CenterZ.size(),
+                     ExtentX.size(), ExtentY.size(), ExtentZ.size()});
+  }
+
+  void GetStreams(const float *(&streams)[6]) const;
+};
+
+// Transforms with one stream per component, e.g. from a scene's SoA
+// storage. Rotations are unit quaternions. Size() is the shortest stream.
+struct TransformComponentsSoA {
+  Span<const float> PositionX, PositionY, PositionZ;
+  Span<const float> RotationX, RotationY, RotationZ, RotationW;
+  Span<const float> ScaleX, ScaleY, ScaleZ;
+
+  size_t Size() const {
+    return std::min({PositionX.size(), PositionY.size(), PositionZ.size(),
+                     RotationX.size(), RotationY.size(), RotationZ.size(),
+                     RotationW.size(), ScaleX.size(), ScaleY.size(),
+                     ScaleZ.size()});
+  }
+
+  void GetStreams(const float *(&streams)[10]) const;
+};
+
+// Closest hit of a ray in a batch query. T bounds the search on input and
+// is only replaced by closer hits, so one set of hits can be run against
+// several primitive lists. Index is the primitive, or kNone for no hit; U
+// and V are barycentrics of the hit triangle's second and third vertex.
+struct RayHit {
+  static constexpr uint32_t kNone = 0xFFFFFFFFu;
+
+  float T = std::numeric_limits<float>::infinity();
+  uint32_t Index = kNone;
+  float U = 0.0f;
+  float V = 0.0f;
+
+  bool IsHit() const { return Index != kNone; }
+};
+
+//============================================================================
+// MathKernelTable - Batch kernels built for one instruction set
+//============================================================================
+// Every entry processes 'count' elements. Vec3 outputs keep their padding
+// lane zero; AoS outputs may alias the matching input.
+struct MathKernelTable {
+  SimdLevel Level = SimdLevel::Scalar;
+
+  // M * (p, 1), M * (v, 0), and M * (p, 1) divided by its w
+  void (*TransformPoints)(const Mat4 &matrix, const Vec3 *points, Vec3 *out,
+                          size_t count) = nullptr;
+  void (*TransformVectors)(const Mat4 &matrix, const Vec3 *vectors, Vec3 *out,
+                           size_t count) = nullptr;
+  void (*TransformPointsProjective)(const Mat4 &matrix, const Vec3 *points,
+                                    Vec3 *out, size_t count) = nullptr;
+
+  // Same as above with separate x, y and z output streams
+  void (*TransformPointsSoA)(const Mat4 &matrix, const Vec3 *points,
+                             float *outX, float *outY, float *outZ,
+                             size_t count) = nullptr;
+  void (*TransformVectorsSoA)(const Mat4 &matrix, const Vec3 *vectors,
+                              float *outX, float *outY, float *outZ,
+                              size_t count) = nullptr;
+
+  // out[i] = a[i] * b; FMA levels round each element once per term
+  void (*MultiplyMatrices)(const Mat4 *a, const Mat4 &b, Mat4 *out,
+                           size_t count) = nullptr;
+
+  // Spheres are (center, radius) and planes (normal, distance) with normals
+  // facing inward, as in Frustum. Writes 1 for spheres touching all six
+  // planes and 0 for the rest.
+  void (*CullSpheres)(const Vec4 *planes, const Vec4 *spheres,
+                      uint8_t *visible, size_t count) = nullptr;
+
+  // Culls elements [begin, end) of the streams against the same planes.
+  // Writes the indices of the visible ones to 'visible' in ascending order
+  // and returns how many were written; 'visible' needs room for all
+  // end - begin indices.
+  size_t (*CullSpheresSoA)(const Vec4 *planes, const SphereBoundsSoA &spheres,
+                           size_t begin, size_t end,
+                           uint32_t *visible) = nullptr;
+  size_t (*CullBoxesSoA)(const Vec4 *planes, const BoxBoundsSoA &boxes,
+                         size_t begin, size_t end, uint32_t *visible) = nullptr;
+
+  // Closest hit of each ray among the primitives, with the semantics of the
+  // matching Ray members. Triangles are three vertex indices each.
+  void (*RaycastBoxes)(const Ray *rays, RayHit *hits, size_t rayCount,
+                       const AABB *boxes, size_t boxCount) = nullptr;
+  void (*RaycastSpheres)(const Ray *rays, RayHit *hits, size_t rayCount,
+                         const Sphere *spheres, size_t sphereCount) = nullptr;
+  void (*RaycastTriangles)(const Ray *rays, RayHit *hits, size_t rayCount,
+                           const Vec3 *vertices, const uint32_t *indices,
+                           size_t triangleCount) = nullptr;
+
+  // Linear blend skinning with affine bone matrices; vectors skip the
+  // translation (e.g. normals under rigid or uniformly scaled bones)
+  void (*SkinPoints)(const Mat4 *bones, const SkinInfluences *influences,
+                     const Vec3 *points, Vec3 *out, size_t count) = nullptr;
+  void (*SkinVectors)(const Mat4 *bones, const SkinInfluences *influences,
+                      const Vec3 *vectors, Vec3 *out, size_t count) = nullptr;
+
+  // Quaternion batches with the semantics of the matching Quaternion
+  // members. Lerp is normalized; Slerp uses the SlerpFast polynomial.
+  void (*MultiplyQuaternions)(const Quaternion *a, const Quaternion *b,
+                              Quaternion *out, size_t count) = nullptr;
+  void (*RotateVectors)(const Quaternion *rotations, const Vec3 *vectors,
+                        Vec3 *out, size_t count) = nullptr;
+  void (*LerpQuaternions)(const Quaternion *a, const Quaternion *b, float t,
+                          Quaternion *out, size_t count) = nullptr;
+  void (*SlerpQuaternions)(const Quaternion *a, const Quaternion *b, float t,
+                           Quaternion *out, size_t count) = nullptr;
+  void (*QuaternionsToMatrices)(const Quaternion *rotations, Mat4 *out,
+                                size_t count) = nullptr;
+
+  // Model matrices as Transform::ToAffine(), and MVPs as viewProjection *
+  // ToAffine(), straight from translation, rotation and scale
+  void (*TransformsToAffine)(const Transform *transforms, Affine3x4 *out,
+                             size_t count) = nullptr;
+  void (*TransformsToMVP)(const Mat4 &viewProjection,
+                          const Transform *transforms, Mat4 *out,
+                          size_t count) = nullptr;
+  void (*TransformStreamsToAffine)(const TransformComponentsSoA &transforms,
+                                   Affine3x4 *out, size_t count) = nullptr;
+  void (*TransformStreamsToMVP)(const Mat4 &viewProjection,
+                                const TransformComponentsSoA &transforms,
+                                Mat4 *out, size_t count) = nullptr;
+
+  // Conversion between Vec3 and the packed storage types in Packed.h; the
+  // output must not overlap the input. Halves round to nearest even, as
+  // Half3(const Vec3 &).
+  void (*PackFloat3)(const Vec3 *vectors, Float3 *out, size_t count) = nullptr;
+  void (*UnpackFloat3)(const Float3 *packed, Vec3 *out, size_t count) = nullptr;
+  void (*PackHalf3)(const Vec3 *vectors, Half3 *out, size_t count) = nullptr;
+  void (*UnpackHalf3)(const Half3 *packed, Vec3 *out, size_t count) = nullptr;
+
+  // Noise::Evaluate(settings, ...) at each sample of the coordinate streams,
+  // see Noise.h
+  void (*Noise2)(const NoiseSettings &settings, const float *x, const float *y,
+                 float *out, size_t count) = nullptr;
+  void (*Noise3)(const NoiseSettings &settings, const float *x, const float *y,
+                 const float *z, float *out, size_t count) = nullptr;
+  void (*Noise4)(const NoiseSettings &settings, const float *x, const float *y,
+                 const float *z, const float *w, float *out,
+                 size_t count) = nullptr;
+
+  // Bvh queries for either node width, see Bvh.h. CullBvh writes up to
+  // 'capacity' visible object indices and returns how many; RaycastBvh
+  // runs closest-hit or any-hit queries against the object boxes.
+  size_t (*CullBvh)(const Vec4 *planes, const BvhView &bvh, uint32_t *visible,
+                    size_t capacity) = nullptr;
+  void (*RaycastBvh)(const BvhView &bvh, const Ray *rays, RayHit *hits,
+                     size_t rayCount, bool anyHit) = nullptr;
+};
+
+//============================================================================
+// MathKernels - Picks the kernel table for the running CPU
+//============================================================================
+// Each SIMD level lives in its own translation unit built with that level's
+// compiler flags (Engine/Math/Kernels). At first use the highest level that
+// was built and that cpuid reports (including OS support for the wider
+// registers) is selected. ENGINE_SIMD_LEVEL in CMake pins the build to a
+// single level plus the scalar fallback.
+class MathKernels {
+public:
+  static const MathKernelTable &Get() {
+    const MathKernelTable *table = s_Active.load(std::memory_order_acquire);
+    return table ? *table : Initialize();
+  }
+
+  static SimdLevel GetLevel() { return Get().Level; }
+
+  // Highest level the CPU supports, whether or not it was built
+  static SimdLevel DetectLevel();
+
+  // The table for 'level', or null if it was not built or the CPU lacks it
+  static const MathKernelTable *GetTable(SimdLevel level);
+
+  // Switches the active table, e.g. to compare levels; false if unavailable
+  static bool Select(SimdLevel level);
+
+private:
+  static const MathKernelTable &Initialize();
+
+  static std::atomic<const MathKernelTable *> s_Active;
+};
+
+// Per-level tables, defined in Engine/Math/Kernels. Only the levels the
+// build compiled exist (ENGINE_MATH_KERNELS_<LEVEL> is defined for each).
+const MathKernelTable *GetScalarKernels();
+const MathKernelTable *GetSSE2Kernels();
+const MathKernelTable *GetSSE41Kernels();
+const MathKernelTable *GetAVX2Kernels();
+const MathKernelTable *GetAVX512Kernels();
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
@@ -18,41 +18,68 @@ static constexpr float FLOAT_EPSILON = std::numeric_limits<float>::epsilon();
 static constexpr float DEG_TO_RAD = PI / 180.0f;
 static constexpr float RAD_TO_DEG = 180.0f / PI;
 
+// True while the calling constexpr function is being evaluated at compile
+// time. The value types use it to take their scalar path in constant
+// expressions and their SIMD path at runtime. C++17 has no
+// std::is_constant_evaluated, but GCC 9+, Clang 9+ and MSVC 19.25+ provide
+// the builtin it is implemented with.
+constexpr bool IsConstantEvaluated() noexcept {
+  return __builtin_is_constant_evaluated();
+}
+
 // Utility functions
-inline float ToRadians(float degrees) { return degrees * DEG_TO_RAD; }
+constexpr float ToRadians(float degrees) { return degrees * DEG_TO_RAD; }
+
+constexpr float ToDegrees(float radians) { return radians * RAD_TO_DEG; }
 
-inline float ToDegrees(float radians) { return radians * RAD_TO_DEG; }
+template <typename T> constexpr T Min(T a, T b) { return a < b ? a : b; }
 
-inline bool IsNearZero(float value, float epsilon = EPSILON) {
-  return std::abs(value) < epsilon;
+template <typename T> constexpr T Max(T a, T b) { return a > b ? a : b; }
+
+template <typename T> constexpr T Abs(T value) {
+  return value < 0 ? -value : value;
 }
 
-inline bool IsEqual(float a, float b, float epsilon = EPSILON) {
-  return std::abs(a - b) < epsilon;
+constexpr bool IsNearZero(float value, float epsilon = EPSILON) {
+  return Abs(value) < epsilon;
 }
 
-inline float Clamp(float value, float min, float max) {
+constexpr bool IsEqual(float a, float b, float epsilon = EPSILON) {
+  return Abs(a - b) < epsilon;
+}
+
+constexpr float Clamp(float value, float min, float max) {
   return value < min ? min : (value > max ? max : value);
 }
 
-inline float Lerp(float a, float b, float t) { return a + t * (b - a); }
+constexpr float Lerp(float a, float b, float t) { return a + t * (b - a); }
 
-inline float Smoothstep(float edge0, float edge1, float x) {
+constexpr float Smoothstep(float edge0, float edge1, float x) {
   float t = Clamp((x - edge0) / (edge1 - edge0), 0.0f, 1.0f);
   return t * t * (3.0f - 2.0f * t);
 }
 
-template <typename T> inline T Min(T a, T b) { return a < b ? a : b; }
-
-template <typename T> inline T Max(T a, T b) { return a > b ? a : b; }
-
-template <typename T> inline T Abs(T value) {
-  return value < 0 ? -value : value;
+// Newton-Raphson in double at compile time, starting above the root so the
+// iterates decrease until they converge; std::sqrt at runtime
+constexpr float Sqrt(float value) {
+  if (!IsConstantEvaluated()) {
+    return std::sqrt(value);
+  }
+  if (!(value > 0.0f) || value == std::numeric_limits<float>::infinity()) {
+    return value < 0.0f ? std::numeric_limits<float>::quiet_NaN() : value;
+  }
+  double x = value;
+  double estimate = value < 1.0f ? 1.0 : x;
+  for (;;) {
+    double next = 0.5 * (estimate + x / estimate);
+    if (next >= estimate) {
+      return static_cast<float>(estimate);
+    }
+    estimate = next;
+  }
 }
 
-inline float Sqrt(float value) { return std::sqrt(value); }
-
-inline float InvSqrt(float value) { return 1.0f / std::sqrt(value); }
+constexpr float InvSqrt(float value) { return 1.0f / Sqrt(value); }
 
 inline float Sin(float angle) { return std::sin(angle); }
 
@@ -0,0 +1,47 @@
+#include "Matrix.h"
+#include "MathKernels.h"
+
+#include <algorithm>
+
+namespace Engine {
+namespace Math {
+
+void Mat4::TransformPoints(Span<const Vec3> points, Span<Vec3> out) const {
+  MathKernels::Get().TransformPoints(*this, points.data(), out.data(),
+                                     std::min(points.size(), out.size()));
+}
+
+void Mat4::TransformVectors(Span<const Vec3> vectors, Span<Vec3> out) const {
+  MathKernels::Get().TransformVectors(*this, vectors.data(), out.data(),
+                                      std::min(vectors.size(), out.size()));
+}
+
+void Mat4::TransformPointsProjective(Span<const Vec3> points,
+                                     Span<Vec3> out) const {
+  MathKernels::Get().TransformPointsProjective(
+      *this, points.data(), out.data(), std::min(points.size(), out.size()));
+}
+
+void Mat4::TransformPoints(Span<const Vec3> points, Span<float> outX,
+                           Span<float> outY, Span<float> outZ) const {
+  size_t count = std::min({points.size(), outX.size(), outY.size(),
+                           outZ.size()});
+  MathKernels::Get().TransformPointsSoA(*this, points.data(), outX.data(),
+                                        outY.data(), outZ.data(), count);
+}
+
+void Mat4::TransformVectors(Span<const Vec3> vectors, Span<float> outX,
+                            Span<float> outY, Span<float> outZ) const {
+  size_t count = std::min({vectors.size(), outX.size(), outY.size(),
+                           outZ.size()});
+  MathKernels::Get().TransformVectorsSoA(*this, vectors.data(), outX.data(),
+                                         outY.data(), outZ.data(), count);
+}
+
+void Mat4::Multiply(Span<const Mat4> a, const Mat4 &b, Span<Mat4> out) {
+  MathKernels::Get().MultiplyMatrices(a.data(), b, out.data(),
+                                      std::min(a.size(), out.size()));
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
@@ -1,11 +1,43 @@
 #pragma once
 
+#include "../Core/Span.h"
 #include "Vector.h"
-#include <immintrin.h>
+#include <emmintrin.h>
 
 namespace Engine {
 namespace Math {
 
+namespace Detail {
+
+// Lane selection in x, y, z, w order, unlike _MM_SHUFFLE
+template <int X, int Y, int Z, int W> inline __m128 Swizzle(__m128 v) {
+  return _mm_shuffle_ps(v, v, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+template <int X, int Y, int Z, int W>
+inline __m128 Shuffle(__m128 a, __m128 b) {
+  return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+// 2x2 matrices stored row-major in one register: A * B, adj(A) * B and
+// A * adj(B)
+inline __m128 Mat2Mul(__m128 a, __m128 b) {
+  return _mm_add_ps(_mm_mul_ps(a, Swizzle<0, 3, 0, 3>(b)),
+                    _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+inline __m128 Mat2AdjMul(__m128 a, __m128 b) {
+  return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b),
+                    _mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+}
+
+inline __m128 Mat2MulAdj(__m128 a, __m128 b) {
+  return _mm_sub_ps(_mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)),
+                    _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+} // namespace Detail
+
 //============================================================================
 // Mat4 - 4x4 Matrix with SIMD optimization
 //============================================================================
@@ -21,86 +53,89 @@ struct alignas(16) Mat4 {
     };
   };
 
-  // Constructors
-  Mat4() {
-    // Initialize to identity matrix directly (avoid recursion)
-    SetZero();
-    m[0][0] = m[1][1] = m[2][2] = m[3][3] = 1.0f;
-  }
-
-  Mat4(float diagonal) {
-    SetZero();
-    m[0][0] = m[1][1] = m[2][2] = m[3][3] = diagonal;
-  }
-
-  Mat4(const Vec4 &row0, const Vec4 &row1, const Vec4 &row2, const Vec4 &row3) {
-    rows[0] = row0;
-    rows[1] = row1;
-    rows[2] = row2;
-    rows[3] = row3;
-  }
-
-  Mat4(float m00, float m01, float m02, float m03, float m10, float m11,
-       float m12, float m13, float m20, float m21, float m22, float m23,
-       float m30, float m31, float m32, float m33) {
-    m[0][0] = m00;
-    m[0][1] = m01;
-    m[0][2] = m02;
-    m[0][3] = m03;
-    m[1][0] = m10;
-    m[1][1] = m11;
-    m[1][2] = m12;
-    m[1][3] = m13;
-    m[2][0] = m20;
-    m[2][1] = m21;
-    m[2][2] = m22;
-    m[2][3] = m23;
-    m[3][0] = m30;
-    m[3][1] = m31;
-    m[3][2] = m32;
-    m[3][3] = m33;
-  }
+  // Constructors. All of them initialize 'm', the member the constant
+  // evaluated paths below read and write.
+  constexpr Mat4() : Mat4(1.0f) {}
+
+  constexpr Mat4(float diagonal)
+      : m{{diagonal, 0.0f, 0.0f, 0.0f},
+          {0.0f, diagonal, 0.0f, 0.0f},
+          {0.0f, 0.0f, diagonal, 0.0f},
+          {0.0f, 0.0f, 0.0f, diagonal}} {}
+
+  constexpr Mat4(const Vec4 &row0, const Vec4 &row1, const Vec4 &row2,
+                 const Vec4 &row3)
+      : m{{row0.x, row0.y, row0.z, row0.w},
+          {row1.x, row1.y, row1.z, row1.w},
+          {row2.x, row2.y, row2.z, row2.w},
+          {row3.x, row3.y, row3.z, row3.w}} {}
+
+  constexpr Mat4(float m00, float m01, float m02, float m03, float m10,
+                 float m11, float m12, float m13, float m20, float m21,
+                 float m22, float m23, float m30, float m31, float m32,
+                 float m33)
+      : m{{m00, m01, m02, m03},
+          {m10, m11, m12, m13},
+          {m20, m21, m22, m23},
+          {m30, m31, m32, m33}} {}
 
   // Static factory methods
-  static Mat4 Identity() {
-    Mat4 result;
-    result.SetZero();
-    result.m[0][0] = result.m[1][1] = result.m[2][2] = result.m[3][3] = 1.0f;
-    return result;
-  }
+  static constexpr Mat4 Identity() { return Mat4(1.0f); }
 
-  static Mat4 Zero() {
-    Mat4 result;
-    result.SetZero();
-    return result;
-  }
+  static constexpr Mat4 Zero() { return Mat4(0.0f); }
 
   // Element access
-  float *operator[](int row) { return m[row]; }
-  const float *operator[](int row) const { return m[row]; }
+  constexpr float *operator[](int row) { return m[row]; }
+  constexpr const float *operator[](int row) const { return m[row]; }
 
-  float &operator()(int row, int col) { return m[row][col]; }
-  const float &operator()(int row, int col) const { return m[row][col]; }
+  constexpr float &operator()(int row, int col) { return m[row][col]; }
+  constexpr const float &operator()(int row, int col) const {
+    return m[row][col];
+  }
 
   // Matrix operations
-  Mat4 operator+(const Mat4 &other) const {
+  constexpr Mat4 operator+(const Mat4 &other) const {
     Mat4 result;
+    if (IsConstantEvaluated()) {
+      for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+          result.m[i][j] = m[i][j] + other.m[i][j];
+        }
+      }
+      return result;
+    }
     for (int i = 0; i < 4; ++i) {
       result.simd_rows[i] = _mm_add_ps(simd_rows[i], other.simd_rows[i]);
     }
     return result;
   }
 
-  Mat4 operator-(const Mat4 &other) const {
+  constexpr Mat4 operator-(const Mat4 &other) const {
     Mat4 result;
+    if (IsConstantEvaluated()) {
+      for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+          result.m[i][j] = m[i][j] - other.m[i][j];
+        }
+      }
+      return result;
+    }
     for (int i = 0; i < 4; ++i) {
       result.simd_rows[i] = _mm_sub_ps(simd_rows[i], other.simd_rows[i]);
     }
     return result;
   }
 
-  Mat4 operator*(float scalar) const {
+  constexpr Mat4 operator*(float scalar) const {
     Mat4 result;
+    if (IsConstantEvaluated()) {
+      for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+          result.m[i][j] = m[i][j] * scalar;
+        }
+      }
+      return result;
+    }
     __m128 s = _mm_set1_ps(scalar);
     for (int i = 0; i < 4; ++i) {
       result.simd_rows[i] = _mm_mul_ps(simd_rows[i], s);
@@ -108,77 +143,73 @@ struct alignas(16) Mat4 {
     return result;
   }
 
-  // Optimized matrix multiplication
-  Mat4 operator*(const Mat4 &other) const {
-    Mat4 result;
-
-    // Transpose other matrix for better memory access
-    __m128 col0 =
-        _mm_set_ps(other.m[3][0], other.m[2][0], other.m[1][0], other.m[0][0]);
-    __m128 col1 =
-        _mm_set_ps(other.m[3][1], other.m[2][1], other.m[1][1], other.m[0][1]);
-    __m128 col2 =
-        _mm_set_ps(other.m[3][2], other.m[2][2], other.m[1][2], other.m[0][2]);
-    __m128 col3 =
-        _mm_set_ps(other.m[3][3], other.m[2][3], other.m[1][3], other.m[0][3]);
-
-    for (int i = 0; i < 4; ++i) {
-      __m128 row = simd_rows[i];
-
-      __m128 mul0 = _mm_mul_ps(row, col0);
-      __m128 mul1 = _mm_mul_ps(row, col1);
-      __m128 mul2 = _mm_mul_ps(row, col2);
-      __m128 mul3 = _mm_mul_ps(row, col3);
-
-      // Horizontal add to get dot products
-      __m128 sum0 = _mm_hadd_ps(mul0, mul1);
-      __m128 sum1 = _mm_hadd_ps(mul2, mul3);
-      __m128 final = _mm_hadd_ps(sum0, sum1);
-
-      result.simd_rows[i] = final;
+  constexpr Mat4 operator*(const Mat4 &other) const {
+    // Constant evaluated paths sum in the order of the SIMD paths, so
+    // baked results match runtime ones bit for bit
+    if (IsConstantEvaluated()) {
+      Mat4 result;
+      for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+          result.m[i][j] = (m[i][0] * other.m[0][j] + m[i][1] * other.m[1][j]) +
+                           (m[i][2] * other.m[2][j] + m[i][3] * other.m[3][j]);
+        }
+      }
+      return result;
     }
-
-    return result;
+    return MultiplySimd(other);
   }
 
-  // Vector multiplication
-  Vec4 operator*(const Vec4 &vec) const {
-    Vec4 result;
-    for (int i = 0; i < 4; ++i) {
-      __m128 row = simd_rows[i];
-      __m128 mul = _mm_mul_ps(row, vec.simd);
-      __m128 hadd1 = _mm_hadd_ps(mul, mul);
-      __m128 hadd2 = _mm_hadd_ps(hadd1, hadd1);
-      result.data[i] = _mm_cvtss_f32(hadd2);
+  constexpr Vec4 operator*(const Vec4 &vec) const {
+    if (IsConstantEvaluated()) {
+      Vec4 result;
+      for (int i = 0; i < 4; ++i) {
+        result[i] = (m[i][0] * vec.x + m[i][2] * vec.z) +
+                    (m[i][1] * vec.y + m[i][3] * vec.w);
+      }
+      return result;
     }
-    return result;
+    return TransformSimd(vec);
   }
 
-  Vec3 TransformPoint(const Vec3 &point) const {
+  constexpr Vec3 TransformPoint(const Vec3 &point) const {
     Vec4 result = *this * Vec4(point, 1.0f);
     return result.XYZ();
   }
 
-  Vec3 TransformVector(const Vec3 &vector) const {
+  constexpr Vec3 TransformVector(const Vec3 &vector) const {
     Vec4 result = *this * Vec4(vector, 0.0f);
     return result.XYZ();
   }
 
+  // Batch transforms on the MathKernels set for this CPU (Matrix.cpp).
+  // 'out' may alias the input; only as many elements as both spans hold
+  // are written.
+  void TransformPoints(Span<const Vec3> points, Span<Vec3> out) const;
+  void TransformVectors(Span<const Vec3> vectors, Span<Vec3> out) const;
+
+  // Divides by the transformed w, e.g. world space to NDC through a
+  // view-projection matrix
+  void TransformPointsProjective(Span<const Vec3> points,
+                                 Span<Vec3> out) const;
+
+  // Structure-of-arrays output, for consumers that work per component
+  // such as bounds computation or packet culling
+  void TransformPoints(Span<const Vec3> points, Span<float> outX,
+                       Span<float> outY, Span<float> outZ) const;
+  void TransformVectors(Span<const Vec3> vectors, Span<float> outX,
+                        Span<float> outY, Span<float> outZ) const;
+
+  // out[i] = a[i] * b, e.g. a batch of view-projections or parent world
+  // matrices times one matrix. The AVX2 and AVX-512 kernels use FMA, so
+  // results can differ from operator* in the last bit. 'out' may alias 'a'.
+  static void Multiply(Span<const Mat4> a, const Mat4 &b, Span<Mat4> out);
+
   // Utility methods
-  Mat4 &SetZero() {
-    for (int i = 0; i < 4; ++i) {
-      simd_rows[i] = _mm_setzero_ps();
-    }
-    return *this;
-  }
+  constexpr Mat4 &SetZero() { return *this = Zero(); }
 
-  Mat4 &SetIdentity() {
-    SetZero();
-    m[0][0] = m[1][1] = m[2][2] = m[3][3] = 1.0f;
-    return *this;
-  }
+  constexpr Mat4 &SetIdentity() { return *this = Identity(); }
 
-  Mat4 Transposed() const {
+  constexpr Mat4 Transposed() const {
     Mat4 result;
     for (int i = 0; i < 4; ++i) {
       for (int j = 0; j < 4; ++j) {
@@ -188,7 +219,7 @@ struct alignas(16) Mat4 {
     return result;
   }
 
-  float Determinant() const {
+  constexpr float Determinant() const {
     float det = 0.0f;
     det += m[0][0] * (m[1][1] * (m[2][2] * m[3][3] - m[2][3] * m[3][2]) -
                       m[1][2] * (m[2][1] * m[3][3] - m[2][3] * m[3][1]) +
@@ -205,30 +236,90 @@ struct alignas(16) Mat4 {
     return det;
   }
 
+  // General inverse by 2x2 blocks: with M = [A B; C D] every block of the
+  // adjugate is built from 2x2 products, so the whole inverse is ~60 SSE
+  // ops. Returns identity if the matrix is singular.
   Mat4 Inverted() const {
-    Mat4 result;
-    float det = Determinant();
-
-    if (IsNearZero(det)) {
-      return Identity(); // Return identity if not invertible
+    using namespace Detail;
+    __m128 a = _mm_movelh_ps(simd_rows[0], simd_rows[1]);
+    __m128 b = _mm_movehl_ps(simd_rows[1], simd_rows[0]);
+    __m128 c = _mm_movelh_ps(simd_rows[2], simd_rows[3]);
+    __m128 d = _mm_movehl_ps(simd_rows[3], simd_rows[2]);
+
+    // (|A|, |B|, |C|, |D|)
+    __m128 detSub = _mm_sub_ps(
+        _mm_mul_ps(Shuffle<0, 2, 0, 2>(simd_rows[0], simd_rows[2]),
+                   Shuffle<1, 3, 1, 3>(simd_rows[1], simd_rows[3])),
+        _mm_mul_ps(Shuffle<1, 3, 1, 3>(simd_rows[0], simd_rows[2]),
+                   Shuffle<0, 2, 0, 2>(simd_rows[1], simd_rows[3])));
+    __m128 detA = Swizzle<0, 0, 0, 0>(detSub);
+    __m128 detB = Swizzle<1, 1, 1, 1>(detSub);
+    __m128 detC = Swizzle<2, 2, 2, 2>(detSub);
+    __m128 detD = Swizzle<3, 3, 3, 3>(detSub);
+
+    // Adjugate blocks X, Y, Z, W of [X Y; Z W] = |M| * inverse(M)
+    __m128 dc = Mat2AdjMul(d, c);
+    __m128 ab = Mat2AdjMul(a, b);
+    __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Mat2Mul(b, dc));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Mat2Mul(c, ab));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), Mat2MulAdj(d, ab));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Mat2MulAdj(a, dc));
+
+    // |M| = |A||D| + |B||C| - tr(adj(A) B adj(D) C)
+    __m128 trace = _mm_mul_ps(ab, Swizzle<0, 2, 1, 3>(dc));
+    trace = _mm_add_ps(trace, _mm_movehl_ps(trace, trace));
+    trace = _mm_add_ss(trace, Swizzle<1, 1, 1, 1>(trace));
+    __m128 det = _mm_sub_ss(
+        _mm_add_ss(_mm_mul_ss(detA, detD), _mm_mul_ss(detB, detC)), trace);
+
+    if (IsNearZero(_mm_cvtss_f32(det))) {
+      return Identity();
     }
 
-    float invDet = 1.0f / det;
+    // Signs of the 2x2 adjugates folded into the reciprocal
+    __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f),
+                               Swizzle<0, 0, 0, 0>(det));
+    x = _mm_mul_ps(x, invDet);
+    y = _mm_mul_ps(y, invDet);
+    z = _mm_mul_ps(z, invDet);
+    w = _mm_mul_ps(w, invDet);
 
-    // Calculate cofactor matrix
-    result.m[0][0] = (m[1][1] * (m[2][2] * m[3][3] - m[2][3] * m[3][2]) -
-                      m[1][2] * (m[2][1] * m[3][3] - m[2][3] * m[3][1]) +
-                      m[1][3] * (m[2][1] * m[3][2] - m[2][2] * m[3][1])) *
-                     invDet;
+    Mat4 result;
+    result.simd_rows[0] = Shuffle<3, 1, 3, 1>(x, y);
+    result.simd_rows[1] = Shuffle<2, 0, 2, 0>(x, y);
+    result.simd_rows[2] = Shuffle<3, 1, 3, 1>(z, w);
+    result.simd_rows[3] = Shuffle<2, 0, 2, 0>(z, w);
+    return result;
+  }
 
-    // ... (abbreviated for brevity, full implementation would calculate all 16
-    // elements) For now, return a simple inverse for basic transformations
+  // Inverse of a translate * rotate * scale matrix (last row 0, 0, 0, 1,
+  // no shear). The scaled axes are orthogonal, so the 3x3 inverse is the
+  // transpose with each axis divided by its squared length. Axes with zero
+  // scale stay zero.
+  Mat4 InvertedAffine() const {
+    __m128 r0 = simd_rows[0], r1 = simd_rows[1], r2 = simd_rows[2];
+    __m128 sizeSq = _mm_add_ps(_mm_mul_ps(r0, r0),
+                               _mm_add_ps(_mm_mul_ps(r1, r1),
+                                          _mm_mul_ps(r2, r2)));
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 valid = _mm_cmpge_ps(sizeSq, _mm_set1_ps(EPSILON));
+    __m128 invSizeSq =
+        _mm_and_ps(_mm_div_ps(one, _mm_or_ps(_mm_and_ps(valid, sizeSq),
+                                             _mm_andnot_ps(valid, one))),
+                   valid);
+    return InvertedAffineRows(_mm_mul_ps(r0, invSizeSq),
+                              _mm_mul_ps(r1, invSizeSq),
+                              _mm_mul_ps(r2, invSizeSq));
+  }
 
-    return result;
+  // Inverse of a rotation plus translation: transpose the rotation and
+  // rotate the negated translation back
+  Mat4 InvertedRigid() const {
+    return InvertedAffineRows(simd_rows[0], simd_rows[1], simd_rows[2]);
   }
 
   // Transformation matrix factories
-  static Mat4 Translation(const Vec3 &translation) {
+  static constexpr Mat4 Translation(const Vec3 &translation) {
     Mat4 result = Identity();
     result.m[0][3] = translation.x;
     result.m[1][3] = translation.y;
@@ -236,7 +327,7 @@ struct alignas(16) Mat4 {
     return result;
   }
 
-  static Mat4 Scale(const Vec3 &scale) {
+  static constexpr Mat4 Scale(const Vec3 &scale) {
     Mat4 result = Identity();
     result.m[0][0] = scale.x;
     result.m[1][1] = scale.y;
@@ -244,7 +335,7 @@ struct alignas(16) Mat4 {
     return result;
   }
 
-  static Mat4 Scale(float uniformScale) {
+  static constexpr Mat4 Scale(float uniformScale) {
     return Scale(Vec3(uniformScale, uniformScale, uniformScale));
   }
 
@@ -304,7 +395,8 @@ struct alignas(16) Mat4 {
   }
 
   // Camera matrices
-  static Mat4 LookAt(const Vec3 &eye, const Vec3 &target, const Vec3 &up) {
+  static constexpr Mat4 LookAt(const Vec3 &eye, const Vec3 &target,
+                               const Vec3 &up) {
     Vec3 f = (target - eye).Normalized();
     Vec3 s = f.Cross(up).Normalized();
     Vec3 u = s.Cross(f);
@@ -326,7 +418,8 @@ struct alignas(16) Mat4 {
     return result;
   }
 
-  // Projection matrices
+  // Projection matrices: right-handed eye space looking down -z, clip depth
+  // in [-1, 1] as OpenGL and glm::perspective/glm::ortho use
   static Mat4 Perspective(float fovy, float aspect, float near, float far) {
     float tanHalfFovy = Tan(fovy * 0.5f);
 
@@ -334,21 +427,21 @@ struct alignas(16) Mat4 {
     result.m[0][0] = 1.0f / (aspect * tanHalfFovy);
     result.m[1][1] = 1.0f / tanHalfFovy;
     result.m[2][2] = -(far + near) / (far - near);
-    result.m[2][3] = -1.0f;
-    result.m[3][2] = -(2.0f * far * near) / (far - near);
+    result.m[2][3] = -(2.0f * far * near) / (far - near);
+    result.m[3][2] = -1.0f;
 
     return result;
   }
 
-  static Mat4 Orthographic(float left, float right, float bottom, float top,
-                           float near, float far) {
+  static constexpr Mat4 Orthographic(float left, float right, float bottom,
+                                     float top, float near, float far) {
     Mat4 result = Identity();
     result.m[0][0] = 2.0f / (right - left);
     result.m[1][1] = 2.0f / (top - bottom);
     result.m[2][2] = -2.0f / (far - near);
-    result.m[3][0] = -(right + left) / (right - left);
-    result.m[3][1] = -(top + bottom) / (top - bottom);
-    result.m[3][2] = -(far + near) / (far - near);
+    result.m[0][3] = -(right + left) / (right - left);
+    result.m[1][3] = -(top + bottom) / (top - bottom);
+    result.m[2][3] = -(far + near) / (far - near);
 
     return result;
   }
@@ -359,6 +452,71 @@ struct alignas(16) Mat4 {
     return Translation(translation) * RotationX(rotation.x) *
            RotationY(rotation.y) * RotationZ(rotation.z) * Scale(scale);
   }
+
+private:
+  // Runtime path of operator*. Row i of A * B is the rows of B weighted by
+  // the elements of A's row i, so B is used as stored: four broadcasts per
+  // row and no gather of B's columns.
+  Mat4 MultiplySimd(const Mat4 &other) const {
+    using Detail::Swizzle;
+    Mat4 result;
+    for (int i = 0; i < 4; ++i) {
+      __m128 row = simd_rows[i];
+      __m128 xy = _mm_add_ps(
+          _mm_mul_ps(Swizzle<0, 0, 0, 0>(row), other.simd_rows[0]),
+          _mm_mul_ps(Swizzle<1, 1, 1, 1>(row), other.simd_rows[1]));
+      __m128 zw = _mm_add_ps(
+          _mm_mul_ps(Swizzle<2, 2, 2, 2>(row), other.simd_rows[2]),
+          _mm_mul_ps(Swizzle<3, 3, 3, 3>(row), other.simd_rows[3]));
+      result.simd_rows[i] = _mm_add_ps(xy, zw);
+    }
+    return result;
+  }
+
+  // Runtime path of operator*: the four row products reduced with
+  // unpacks, six shuffles where a full transpose takes eight
+  Vec4 TransformSimd(const Vec4 &vec) const {
+    __m128 mul0 = _mm_mul_ps(simd_rows[0], vec.simd);
+    __m128 mul1 = _mm_mul_ps(simd_rows[1], vec.simd);
+    __m128 mul2 = _mm_mul_ps(simd_rows[2], vec.simd);
+    __m128 mul3 = _mm_mul_ps(simd_rows[3], vec.simd);
+
+    // (x0 + z0, x1 + z1, y0 + w0, y1 + w1) and the same for rows 2 and 3
+    __m128 sum01 = _mm_add_ps(_mm_unpacklo_ps(mul0, mul1),
+                              _mm_unpackhi_ps(mul0, mul1));
+    __m128 sum23 = _mm_add_ps(_mm_unpacklo_ps(mul2, mul3),
+                              _mm_unpackhi_ps(mul2, mul3));
+
+    Vec4 result;
+    result.simd = _mm_add_ps(_mm_movelh_ps(sum01, sum23),
+                             _mm_movehl_ps(sum23, sum01));
+    return result;
+  }
+
+  // Rows r0..r2 hold the columns of the inverse 3x3 block (lane 3 is
+  // ignored); the translation is read from this matrix
+  Mat4 InvertedAffineRows(__m128 r0, __m128 r1, __m128 r2) const {
+    __m128 xyz = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+    r0 = _mm_and_ps(r0, xyz);
+    r1 = _mm_and_ps(r1, xyz);
+    r2 = _mm_and_ps(r2, xyz);
+
+    // -inverse(R) * t, accumulated column by column
+    __m128 t = _mm_mul_ps(r0, Detail::Swizzle<3, 3, 3, 3>(simd_rows[0]));
+    t = _mm_add_ps(t,
+                   _mm_mul_ps(r1, Detail::Swizzle<3, 3, 3, 3>(simd_rows[1])));
+    t = _mm_add_ps(t,
+                   _mm_mul_ps(r2, Detail::Swizzle<3, 3, 3, 3>(simd_rows[2])));
+    __m128 r3 = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), t);
+
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    Mat4 result;
+    result.simd_rows[0] = r0;
+    result.simd_rows[1] = r1;
+    result.simd_rows[2] = r2;
+    result.simd_rows[3] = r3;
+    return result;
+  }
 };
 
 // Stream operator for debugging
@@ -0,0 +1,423 @@
+#pragma once
+
+// Value and simplex noise in two, three and four dimensions, with fBm and
+// ridged fractal sums. Every function is a template over float, SimdFloat4
+// and SimdFloat8 like FastMath.h, so per-sample code and SoA packets share
+// one implementation; the Noise2/3/4 kernels run it eight samples per call
+// on the MathKernels set for this CPU.
+//
+// Lattice values and gradients come from an integer hash of the cell and
+// the seed rather than a permutation table, so there is nothing to gather
+// and no period short of the 32-bit cell index. Coordinates must stay
+// within +-2^31, and the fraction loses precision well before that.
+//
+// Ranges: Value, Simplex and FBm in [-1, 1]; Ridged in [0, 1].
+
+#include "FastMath.h"
+#include "MathKernels.h"
+
+namespace Engine {
+namespace Math {
+
+enum class NoiseType { Value, Simplex };
+enum class FractalType { None, FBm, Ridged };
+
+// Coordinates are multiplied by Frequency. Fractal types sum Octaves
+// layers, each with Lacunarity times the frequency and Gain times the
+// amplitude of the one before and hashed with the next seed.
+struct NoiseSettings {
+  NoiseType Type = NoiseType::Simplex;
+  FractalType Fractal = FractalType::None;
+  uint32_t Seed = 0;
+  int Octaves = 4;
+  float Frequency = 1.0f;
+  float Lacunarity = 2.0f;
+  float Gain = 0.5f;
+};
+
+//============================================================================
+// Batch evaluation
+//============================================================================
+// Each fills min(inputs, output) samples of Noise::Evaluate(settings, ...)
+inline void EvaluateNoise(const NoiseSettings &settings, Span<const float> x,
+                          Span<const float> y, Span<float> out) {
+  MathKernels::Get().Noise2(settings, x.data(), y.data(), out.data(),
+                            std::min({x.size(), y.size(), out.size()}));
+}
+
+inline void EvaluateNoise(const NoiseSettings &settings, Span<const float> x,
+                          Span<const float> y, Span<const float> z,
+                          Span<float> out) {
+  MathKernels::Get().Noise3(
+      settings, x.data(), y.data(), z.data(), out.data(),
+      std::min({x.size(), y.size(), z.size(), out.size()}));
+}
+
+inline void EvaluateNoise(const NoiseSettings &settings, Span<const float> x,
+                          Span<const float> y, Span<const float> z,
+                          Span<const float> w, Span<float> out) {
+  MathKernels::Get().Noise4(
+      settings, x.data(), y.data(), z.data(), w.data(), out.data(),
+      std::min({x.size(), y.size(), z.size(), w.size(), out.size()}));
+}
+
+inline namespace ENGINE_SIMD_NAMESPACE {
+namespace Noise {
+
+using FastMath::MulAdd;
+using FastMath::Select;
+using Math::Abs;
+using Math::Max;
+using Math::Min;
+
+namespace Detail {
+
+// Odd multipliers spreading each lattice axis over the hash input
+constexpr uint32_t kPrimeX = 0x8DA6B343u;
+constexpr uint32_t kPrimeY = 0xD8163841u;
+constexpr uint32_t kPrimeZ = 0xCB1AB31Fu;
+constexpr uint32_t kPrimeW = 0x9E3779B1u;
+
+// Simplex kernel radius squared, and the scales that map each sum into
+// [-1, 1]: one over the largest magnitude a random search with local
+// refinement found for these gradient sets, rounded down
+constexpr float kRadius2 = 0.5f;
+constexpr float kScale2 = 45.23f;
+constexpr float kScale3 = 76.88f;
+constexpr float kScale4 = 62.77f;
+
+// Lowbias32 finalizer (Wellons): every input bit reaches every output bit
+template <typename I> I Hash(I h) {
+  h ^= h >> 16;
+  h *= I(0x7FEB352Du);
+  h ^= h >> 15;
+  h *= I(0x846CA68Bu);
+  h ^= h >> 16;
+  return h;
+}
+
+// Lane mask where (h & mask) == value
+inline bool BitsEqual(uint32_t h, uint32_t mask, uint32_t value) {
+  return (h & mask) == value;
+}
+template <typename I> auto BitsEqual(I h, uint32_t mask, uint32_t value) {
+  return AsFloat((h & I(mask)) == I(value));
+}
+
+template <typename F> F Floor(F x) {
+  F truncated = ToFloat(ToInt(x));
+  return truncated - Select(truncated > x, F(1.0f), F(0.0f));
+}
+
+template <typename F> F Lerp(F a, F b, F t) { return MulAdd(b - a, t, a); }
+
+// 6t^5 - 15t^4 + 10t^3: zero first and second derivatives at the lattice
+template <typename F> F Fade(F t) {
+  return t * t * t * MulAdd(t, MulAdd(t, F(6.0f), F(-15.0f)), F(10.0f));
+}
+
+// Top 24 bits of the hash as a value in [-1, 1)
+template <typename F, typename I> F LatticeValue(I h) {
+  return MulAdd(ToFloat(h >> 8), F(2.0f / 16777216.0f), F(-1.0f));
+}
+
+// 'v' negated where bit 'bit' of the hash is set. Flipping the sign bit
+// directly keeps scalar code free of branches on random hash bits.
+template <typename F, typename I> F FlipSign(F v, I h, int bit) {
+  return AsFloat(AsInt(v) ^ ((h << (31 - bit)) & I(0x80000000u)));
+}
+
+// Dot products with hashed gradients (Gustavson): the 8 directions
+// (+-1, +-2) and (+-2, +-1), the 12 cube edges, and the 32 tesseract edges
+template <typename F, typename I> F Gradient(I h, F x, F y) {
+  auto low = BitsEqual(h, 4, 0);
+  F u = Select(low, x, y);
+  F v = Select(low, y, x);
+  return MulAdd(FlipSign(v, h, 1), F(2.0f), FlipSign(u, h, 0));
+}
+
+template <typename F, typename I> F Gradient(I h, F x, F y, F z) {
+  F u = Select(BitsEqual(h, 8, 0), x, y);
+  F v = Select(BitsEqual(h, 12, 0), y, Select(BitsEqual(h, 13, 12), x, z));
+  return FlipSign(u, h, 0) + FlipSign(v, h, 1);
+}
+
+template <typename F, typename I> F Gradient(I h, F x, F y, F z, F w) {
+  F a = Select(BitsEqual(h, 24, 24), y, x);
+  F b = Select(BitsEqual(h, 16, 0), y, z);
+  F c = Select(BitsEqual(h, 24, 0), z, w);
+  return FlipSign(a, h, 0) + FlipSign(b, h, 1) + FlipSign(c, h, 2);
+}
+
+// One simplex corner: (r^2 - d^2)^4 falloff times the gradient ramp
+template <typename F, typename I, typename... Offsets>
+F Corner(I h, F x, Offsets... rest) {
+  F t = F(kRadius2) - x * x;
+  ((t = t - rest * rest), ...);
+  t = Max(t, F(0.0f));
+  t = t * t;
+  return t * t * Gradient(h, x, rest...);
+}
+
+// Rank of 'a' among the coordinates, as 1 for each one it is not below.
+// Ties go to the earlier axis, so the ranks are always a permutation.
+template <typename F> F Above(F a, F b) {
+  return Select(a >= b, F(1.0f), F(0.0f));
+}
+
+} // namespace Detail
+
+//============================================================================
+// Value noise
+//============================================================================
+// Hashed values at the lattice points, blended with the quintic fade
+template <typename F> F Value(F x, F y, uint32_t seed = 0) {
+  using I = IntLanes<F>;
+  using namespace Detail;
+  F x0 = Floor(x), y0 = Floor(y);
+  F u = Fade(x - x0), v = Fade(y - y0);
+  I hx0 = ToInt(x0) * I(kPrimeX), hx1 = hx0 + I(kPrimeX);
+  I hy0 = ToInt(y0) * I(kPrimeY), hy1 = hy0 + I(kPrimeY);
+  hy0 ^= I(seed);
+  hy1 ^= I(seed);
+
+  F a = Lerp(LatticeValue<F>(Hash(hx0 ^ hy0)),
+             LatticeValue<F>(Hash(hx1 ^ hy0)), u);
+  F b = Lerp(LatticeValue<F>(Hash(hx0 ^ hy1)),
+             LatticeValue<F>(Hash(hx1 ^ hy1)), u);
+  return Lerp(a, b, v);
+}
+
+template <typename F> F Value(F x, F y, F z, uint32_t seed = 0) {
+  using I = IntLanes<F>;
+  using namespace Detail;
+  F x0 = Floor(x), y0 = Floor(y), z0 = Floor(z);
+  F u = Fade(x - x0), v = Fade(y - y0), w = Fade(z - z0);
+  I hx0 = ToInt(x0) * I(kPrimeX), hx1 = hx0 + I(kPrimeX);
+  I hy0 = ToInt(y0) * I(kPrimeY), hy1 = hy0 + I(kPrimeY);
+  I hz0 = ToInt(z0) * I(kPrimeZ), hz1 = hz0 + I(kPrimeZ);
+  hz0 ^= I(seed);
+  hz1 ^= I(seed);
+
+  auto square = [&](I hz) {
+    F a = Lerp(LatticeValue<F>(Hash(hx0 ^ hy0 ^ hz)),
+               LatticeValue<F>(Hash(hx1 ^ hy0 ^ hz)), u);
+    F b = Lerp(LatticeValue<F>(Hash(hx0 ^ hy1 ^ hz)),
+               LatticeValue<F>(Hash(hx1 ^ hy1 ^ hz)), u);
+    return Lerp(a, b, v);
+  };
+  return Lerp(square(hz0), square(hz1), w);
+}
+
+template <typename F> F Value(F x, F y, F z, F w, uint32_t seed = 0) {
+  using I = IntLanes<F>;
+  using namespace Detail;
+  F x0 = Floor(x), y0 = Floor(y), z0 = Floor(z), w0 = Floor(w);
+  F u = Fade(x - x0), v = Fade(y - y0), s = Fade(z - z0), t = Fade(w - w0);
+  I hx0 = ToInt(x0) * I(kPrimeX), hx1 = hx0 + I(kPrimeX);
+  I hy0 = ToInt(y0) * I(kPrimeY), hy1 = hy0 + I(kPrimeY);
+  I hz0 = ToInt(z0) * I(kPrimeZ), hz1 = hz0 + I(kPrimeZ);
+  I hw0 = ToInt(w0) * I(kPrimeW), hw1 = hw0 + I(kPrimeW);
+  hw0 ^= I(seed);
+  hw1 ^= I(seed);
+
+  auto square = [&](I hzw) {
+    F a = Lerp(LatticeValue<F>(Hash(hx0 ^ hy0 ^ hzw)),
+               LatticeValue<F>(Hash(hx1 ^ hy0 ^ hzw)), u);
+    F b = Lerp(LatticeValue<F>(Hash(hx0 ^ hy1 ^ hzw)),
+               LatticeValue<F>(Hash(hx1 ^ hy1 ^ hzw)), u);
+    return Lerp(a, b, v);
+  };
+  auto cube = [&](I hw) {
+    return Lerp(square(hz0 ^ hw), square(hz1 ^ hw), s);
+  };
+  return Lerp(cube(hw0), cube(hw1), t);
+}
+
+//============================================================================
+// Simplex noise
+//============================================================================
+// Gustavson's formulation: the skewed lattice splits space into simplices,
+// and each sample sums falloff-weighted gradient ramps from the corners of
+// its simplex only (3, 4 and 5 corners), so the cost grows linearly with
+// the dimension rather than as 2^n.
+template <typename F> F Simplex(F x, F y, uint32_t seed = 0) {
+  using I = IntLanes<F>;
+  using namespace Detail;
+  const float kSkew = 0.366025403784f;   // (sqrt(3) - 1) / 2
+  const float kUnskew = 0.211324865405f; // (3 - sqrt(3)) / 6
+
+  F skew = (x + y) * F(kSkew);
+  F i = Floor(x + skew), j = Floor(y + skew);
+  F unskew = (i + j) * F(kUnskew);
+  F x0 = x - i + unskew, y0 = y - j + unskew;
+
+  // Lower triangle steps along x first, upper along y
+  F i1 = Above(x0, y0), j1 = F(1.0f) - i1;
+
+  I s(seed);
+  I hx = ToInt(i) * I(kPrimeX), hy = ToInt(j) * I(kPrimeY);
+  I h0 = Hash(s ^ hx ^ hy);
+  I h1 = Hash(s ^ (hx + ToInt(i1) * I(kPrimeX)) ^
+              (hy + ToInt(j1) * I(kPrimeY)));
+  I h2 = Hash(s ^ (hx + I(kPrimeX)) ^ (hy + I(kPrimeY)));
+
+  F n = Corner(h0, x0, y0);
+  n += Corner(h1, x0 - i1 + F(kUnskew), y0 - j1 + F(kUnskew));
+  n += Corner(h2, x0 + F(2.0f * kUnskew - 1.0f),
+              y0 + F(2.0f * kUnskew - 1.0f));
+  return n * F(kScale2);
+}
+
+template <typename F> F Simplex(F x, F y, F z, uint32_t seed = 0) {
+  using I = IntLanes<F>;
+  using namespace Detail;
+  const float kSkew = 1.0f / 3.0f;
+  const float kUnskew = 1.0f / 6.0f;
+
+  F skew = (x + y + z) * F(kSkew);
+  F i = Floor(x + skew), j = Floor(y + skew), k = Floor(z + skew);
+  F unskew = (i + j + k) * F(kUnskew);
+  F x0 = x - i + unskew, y0 = y - j + unskew, z0 = z - k + unskew;
+
+  // Ranks 0..2; the second corner steps along the largest coordinate, the
+  // third along the two largest
+  F xy = Above(x0, y0), xz = Above(x0, z0), yz = Above(y0, z0);
+  F rankX = xy + xz;
+  F rankY = F(1.0f) - xy + yz;
+  F rankZ = F(2.0f) - xz - yz;
+  F i1 = Max(rankX - F(1.0f), F(0.0f)), i2 = Min(rankX, F(1.0f));
+  F j1 = Max(rankY - F(1.0f), F(0.0f)), j2 = Min(rankY, F(1.0f));
+  F k1 = Max(rankZ - F(1.0f), F(0.0f)), k2 = Min(rankZ, F(1.0f));
+
+  I s(seed);
+  I hx = ToInt(i) * I(kPrimeX), hy = ToInt(j) * I(kPrimeY);
+  I hz = ToInt(k) * I(kPrimeZ);
+  auto corner = [&](F di, F dj, F dk, float offset) {
+    I h = Hash(s ^ (hx + ToInt(di) * I(kPrimeX)) ^
+               (hy + ToInt(dj) * I(kPrimeY)) ^ (hz + ToInt(dk) * I(kPrimeZ)));
+    return Corner(h, x0 - di + F(offset), y0 - dj + F(offset),
+                  z0 - dk + F(offset));
+  };
+
+  F n = Corner(Hash(s ^ hx ^ hy ^ hz), x0, y0, z0);
+  n += corner(i1, j1, k1, kUnskew);
+  n += corner(i2, j2, k2, 2.0f * kUnskew);
+  n += corner(F(1.0f), F(1.0f), F(1.0f), 3.0f * kUnskew);
+  return n * F(kScale3);
+}
+
+template <typename F> F Simplex(F x, F y, F z, F w, uint32_t seed = 0) {
+  using I = IntLanes<F>;
+  using namespace Detail;
+  const float kSkew = 0.309016994375f;   // (sqrt(5) - 1) / 4
+  const float kUnskew = 0.138196601125f; // (5 - sqrt(5)) / 20
+
+  F skew = (x + y + z + w) * F(kSkew);
+  F i = Floor(x + skew), j = Floor(y + skew);
+  F k = Floor(z + skew), l = Floor(w + skew);
+  F unskew = (i + j + k + l) * F(kUnskew);
+  F x0 = x - i + unskew, y0 = y - j + unskew;
+  F z0 = z - k + unskew, w0 = w - l + unskew;
+
+  // Ranks 0..3; corner n steps along the n largest coordinates
+  F xy = Above(x0, y0), xz = Above(x0, z0), xw = Above(x0, w0);
+  F yz = Above(y0, z0), yw = Above(y0, w0), zw = Above(z0, w0);
+  F rank[4] = {xy + xz + xw, F(1.0f) - xy + yz + yw,
+               F(2.0f) - xz - yz + zw, F(3.0f) - xw - yw - zw};
+
+  I s(seed);
+  I hx = ToInt(i) * I(kPrimeX), hy = ToInt(j) * I(kPrimeY);
+  I hz = ToInt(k) * I(kPrimeZ), hw = ToInt(l) * I(kPrimeW);
+  auto corner = [&](float threshold, float offset) {
+    F d[4];
+    for (int axis = 0; axis < 4; ++axis) {
+      d[axis] = Min(Max(rank[axis] - F(threshold), F(0.0f)), F(1.0f));
+    }
+    I h = Hash(s ^ (hx + ToInt(d[0]) * I(kPrimeX)) ^
+               (hy + ToInt(d[1]) * I(kPrimeY)) ^
+               (hz + ToInt(d[2]) * I(kPrimeZ)) ^
+               (hw + ToInt(d[3]) * I(kPrimeW)));
+    return Corner(h, x0 - d[0] + F(offset), y0 - d[1] + F(offset),
+                  z0 - d[2] + F(offset), w0 - d[3] + F(offset));
+  };
+
+  F n = Corner(Hash(s ^ hx ^ hy ^ hz ^ hw), x0, y0, z0, w0);
+  n += corner(2.0f, kUnskew);
+  n += corner(1.0f, 2.0f * kUnskew);
+  n += corner(0.0f, 3.0f * kUnskew);
+  n += corner(-1.0f, 4.0f * kUnskew);
+  return n * F(kScale4);
+}
+
+//============================================================================
+// Fractal sums
+//============================================================================
+namespace Detail {
+
+template <typename F, typename... Rest>
+F Base(NoiseType type, uint32_t seed, F x, Rest... rest) {
+  return type == NoiseType::Value ? Value(x, rest..., seed)
+                                  : Simplex(x, rest..., seed);
+}
+
+} // namespace Detail
+
+// Octaves summed and divided by the total amplitude
+template <typename F, typename... Rest>
+F FBm(const NoiseSettings &settings, F x, Rest... rest) {
+  F sum(0.0f);
+  float frequency = settings.Frequency, amplitude = 1.0f, total = 0.0f;
+  const int octaves = settings.Octaves > 1 ? settings.Octaves : 1;
+  for (int octave = 0; octave < octaves; ++octave) {
+    F n = Detail::Base(settings.Type, settings.Seed + octave,
+                       x * F(frequency), rest * F(frequency)...);
+    sum = MulAdd(n, F(amplitude), sum);
+    total += amplitude;
+    frequency *= settings.Lacunarity;
+    amplitude *= settings.Gain;
+  }
+  return sum * F(1.0f / total);
+}
+
+// Musgrave's ridged multifractal: octaves of (1 - |n|)^2, each weighted by
+// the octave before it so detail gathers along the ridges
+template <typename F, typename... Rest>
+F Ridged(const NoiseSettings &settings, F x, Rest... rest) {
+  F sum(0.0f), weight(1.0f);
+  float frequency = settings.Frequency, amplitude = 1.0f, total = 0.0f;
+  const int octaves = settings.Octaves > 1 ? settings.Octaves : 1;
+  for (int octave = 0; octave < octaves; ++octave) {
+    F n = F(1.0f) - Abs(Detail::Base(settings.Type, settings.Seed + octave,
+                                     x * F(frequency),
+                                     rest * F(frequency)...));
+    n = n * n * weight;
+    weight = Min(n * F(2.0f), F(1.0f));
+    sum = MulAdd(n, F(amplitude), sum);
+    total += amplitude;
+    frequency *= settings.Lacunarity;
+    amplitude *= settings.Gain;
+  }
+  return sum * F(1.0f / total);
+}
+
+// The sample 'settings' describe at (x, y), (x, y, z) or (x, y, z, w)
+template <typename F, typename... Rest>
+F Evaluate(const NoiseSettings &settings, F x, Rest... rest) {
+  switch (settings.Fractal) {
+  case FractalType::FBm:
+    return FBm(settings, x, rest...);
+  case FractalType::Ridged:
+    return Ridged(settings, x, rest...);
+  default:
+    return Detail::Base(settings.Type, settings.Seed,
+                        x * F(settings.Frequency),
+                        rest * F(settings.Frequency)...);
+  }
+}
+
+} // namespace Noise
+} // namespace ENGINE_SIMD_NAMESPACE
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
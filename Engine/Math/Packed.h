@@ -0,0 +1,213 @@
+#pragma once
+
+// Storage types without SIMD padding or alignment, for arrays that are
+// mostly kept rather than computed on: vertex streams, per-object colors
+// and scales, saved scenes. Vec3 and Vec4 stay the compute types; the
+// packed types widen into them on Load() and narrow on Store(), so data
+// only takes its padded form in registers. Pack/Unpack convert whole
+// arrays on the MathKernels set for this CPU.
+
+#include "MathKernels.h"
+#include "Vector.h"
+#include <cstdint>
+#include <cstring>
+
+namespace Engine {
+namespace Math {
+
+namespace Detail {
+
+template <typename To, typename From> inline To BitCast(const From &from) {
+  static_assert(sizeof(To) == sizeof(From), "BitCast needs equal sizes");
+  To to;
+  std::memcpy(&to, &from, sizeof(To));
+  return to;
+}
+
+// IEEE binary16 with round to nearest even. Values past the half range
+// become infinity and every NaN becomes the quiet NaN 0x7E00.
+inline uint16_t FloatToHalf(float value) {
+  const uint32_t halfOverflow = (127u + 16u) << 23;
+  const uint32_t halfMinNormal = (127u - 14u) << 23;
+  const uint32_t denormalMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+  uint32_t bits = BitCast<uint32_t>(value);
+  uint32_t sign = bits & 0x80000000u;
+  bits ^= sign;
+
+  uint32_t half;
+  if (bits >= halfOverflow) {
+    half = bits > 0x7F800000u ? 0x7E00u : 0x7C00u;
+  } else if (bits < halfMinNormal) {
+    // The float add rounds the mantissa into place
+    float denormal =
+        BitCast<float>(bits) + BitCast<float>(denormalMagic);
+    half = BitCast<uint32_t>(denormal) - denormalMagic;
+  } else {
+    uint32_t mantissaOdd = (bits >> 13) & 1u;
+    bits -= (127u - 15u) << 23;
+    bits += 0xFFFu + mantissaOdd;
+    half = bits >> 13;
+  }
+  return static_cast<uint16_t>(half | (sign >> 16));
+}
+
+inline float HalfToFloat(uint16_t half) {
+  const uint32_t shiftedExponent = 0x7C00u << 13;
+  uint32_t bits = (half & 0x7FFFu) << 13;
+  uint32_t exponent = bits & shiftedExponent;
+  bits += (127u - 15u) << 23;
+  if (exponent == shiftedExponent) {
+    bits += (128u - 16u) << 23; // Infinity or NaN
+  } else if (exponent == 0) {
+    // Denormal: renormalize through a float subtract
+    bits += 1u << 23;
+    bits = BitCast<uint32_t>(BitCast<float>(bits) -
+                             BitCast<float>(113u << 23));
+  }
+  return BitCast<float>(bits | (static_cast<uint32_t>(half & 0x8000u) << 16));
+}
+
+} // namespace Detail
+
+//============================================================================
+// Float3 - Three floats, 12 bytes instead of Vec3's 16
+//============================================================================
+struct Float3 {
+  float x, y, z;
+
+  constexpr Float3() : x(0.0f), y(0.0f), z(0.0f) {}
+  constexpr explicit Float3(float scalar) : x(scalar), y(scalar), z(scalar) {}
+  constexpr Float3(float x, float y, float z) : x(x), y(y), z(z) {}
+  constexpr explicit Float3(const Vec3 &vector)
+      : x(vector.x), y(vector.y), z(vector.z) {}
+
+  // An 8-byte and a 4-byte load; never reads past z
+  constexpr Vec3 Load() const {
+    if (IsConstantEvaluated()) {
+      return Vec3(x, y, z);
+    }
+    __m128 xy =
+        _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double *>(&x)));
+    Vec3 result;
+    _mm_store_ps(&result.x, _mm_movelh_ps(xy, _mm_load_ss(&z)));
+    return result;
+  }
+
+  constexpr void Store(const Vec3 &vector) {
+    if (IsConstantEvaluated()) {
+      x = vector.x;
+      y = vector.y;
+      z = vector.z;
+      return;
+    }
+    __m128 value = _mm_load_ps(&vector.x);
+    _mm_store_sd(reinterpret_cast<double *>(&x), _mm_castps_pd(value));
+    _mm_store_ss(&z, _mm_movehl_ps(value, value));
+  }
+};
+
+//============================================================================
+// Half3 - Three IEEE half floats, 6 bytes
+//============================================================================
+// For data that tolerates 11 significant bits: normals, colors, offsets
+// within a bounded range. Conversion rounds to nearest even.
+struct Half3 {
+  uint16_t x, y, z;
+
+  constexpr Half3() : x(0), y(0), z(0) {}
+  explicit Half3(const Vec3 &vector)
+      : x(Detail::FloatToHalf(vector.x)), y(Detail::FloatToHalf(vector.y)),
+        z(Detail::FloatToHalf(vector.z)) {}
+
+  Vec3 Load() const {
+    return Vec3(Detail::HalfToFloat(x), Detail::HalfToFloat(y),
+                Detail::HalfToFloat(z));
+  }
+
+  void Store(const Vec3 &vector) { *this = Half3(vector); }
+};
+
+//============================================================================
+// Float4Packed - Four floats without Vec4's 16-byte alignment
+//============================================================================
+// Same 16 bytes as Vec4, but it can sit at any 4-byte offset inside a
+// vertex or component struct without padding the members around it
+struct Float4Packed {
+  float x, y, z, w;
+
+  constexpr Float4Packed() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
+  constexpr Float4Packed(float x, float y, float z, float w)
+      : x(x), y(y), z(z), w(w) {}
+  constexpr explicit Float4Packed(const Vec4 &vector)
+      : x(vector.x), y(vector.y), z(vector.z), w(vector.w) {}
+
+  constexpr Vec4 Load() const {
+    if (IsConstantEvaluated()) {
+      return Vec4(x, y, z, w);
+    }
+    Vec4 result;
+    result.simd = _mm_loadu_ps(&x);
+    return result;
+  }
+
+  constexpr void Store(const Vec4 &vector) {
+    if (IsConstantEvaluated()) {
+      x = vector.x;
+      y = vector.y;
+      z = vector.z;
+      w = vector.w;
+      return;
+    }
+    _mm_storeu_ps(&x, vector.simd);
+  }
+};
+
+static_assert(sizeof(Float3) == 12 && alignof(Float3) == 4,
+              "Float3 is three unpadded floats");
+static_assert(sizeof(Half3) == 6, "Half3 is three unpadded halves");
+static_assert(sizeof(Float4Packed) == 16 && alignof(Float4Packed) == 4,
+              "Float4Packed is four unaligned floats");
+
+//============================================================================
+// Bulk conversion
+//============================================================================
+// Each converts min(input, output) elements. Unpacked Vec3s have a zero
+// padding lane.
+inline void Pack(Span<const Vec3> vectors, Span<Float3> out) {
+  MathKernels::Get().PackFloat3(vectors.data(), out.data(),
+                                std::min(vectors.size(), out.size()));
+}
+
+inline void Unpack(Span<const Float3> packed, Span<Vec3> out) {
+  MathKernels::Get().UnpackFloat3(packed.data(), out.data(),
+                                  std::min(packed.size(), out.size()));
+}
+
+inline void Pack(Span<const Vec3> vectors, Span<Half3> out) {
+  MathKernels::Get().PackHalf3(vectors.data(), out.data(),
+                               std::min(vectors.size(), out.size()));
+}
+
+inline void Unpack(Span<const Half3> packed, Span<Vec3> out) {
+  MathKernels::Get().UnpackHalf3(packed.data(), out.data(),
+                                 std::min(packed.size(), out.size()));
+}
+
+// Float4Packed is Vec4 without the alignment, so these are plain copies
+inline void Pack(Span<const Vec4> vectors, Span<Float4Packed> out) {
+  size_t count = std::min(vectors.size(), out.size());
+  for (size_t i = 0; i < count; ++i) {
+    out[i].Store(vectors[i]);
+  }
+}
+
+inline void Unpack(Span<const Float4Packed> packed, Span<Vec4> out) {
+  size_t count = std::min(packed.size(), out.size());
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = packed[i].Load();
+  }
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
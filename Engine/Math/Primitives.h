@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Vector.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine {
+namespace Math {
+namespace Primitives {
+
+// Built-in geometry, evaluated at compile time so it lives in .rodata.
+// Shapes are unit sized and centered on the origin; callers scale them.
+
+//============================================================================
+// Shared-corner cube, for flat colored and wireframe drawing
+//============================================================================
+constexpr Vec3 kCubeCorners[8] = {
+    // Front face
+    Vec3(-0.5f, -0.5f, 0.5f), Vec3(0.5f, -0.5f, 0.5f),
+    Vec3(0.5f, 0.5f, 0.5f), Vec3(-0.5f, 0.5f, 0.5f),
+
+    // Back face
+    Vec3(-0.5f, -0.5f, -0.5f), Vec3(0.5f, -0.5f, -0.5f),
+    Vec3(0.5f, 0.5f, -0.5f), Vec3(-0.5f, 0.5f, -0.5f)};
+
+constexpr uint32_t kCubeIndices[36] = {// Front face
+                                       0, 1, 2, 2, 3, 0,
+                                       // Back face
+                                       4, 5, 6, 6, 7, 4,
+                                       // Left face
+                                       7, 3, 0, 0, 4, 7,
+                                       // Right face
+                                       1, 5, 6, 6, 2, 1,
+                                       // Top face
+                                       3, 2, 6, 6, 7, 3,
+                                       // Bottom face
+                                       0, 1, 5, 5, 4, 0};
+
+//============================================================================
+// Per-face geometry, for lit and textured meshes
+//============================================================================
+struct SurfaceVertex {
+  Vec3 position;
+  Vec3 normal;
+  Vec2 texCoords;
+};
+
+template <size_t N> struct SurfaceMesh {
+  std::array<SurfaceVertex, 4 * N> vertices;
+  std::array<uint32_t, 6 * N> indices;
+};
+
+// Appends the unit quad spanned by 'u' and 'v' around 'center', counter
+// clockwise seen from the side 'u x v' points to
+template <size_t N>
+constexpr void AddQuad(SurfaceMesh<N> &mesh, size_t quad, const Vec3 &center,
+                       const Vec3 &u, const Vec3 &v) {
+  const Vec3 normal = u.Cross(v);
+  const Vec3 corners[4] = {center - (u + v) * 0.5f, center + (u - v) * 0.5f,
+                           center + (u + v) * 0.5f, center - (u - v) * 0.5f};
+  const Vec2 texCoords[4] = {Vec2(0.0f, 0.0f), Vec2(1.0f, 0.0f),
+                             Vec2(1.0f, 1.0f), Vec2(0.0f, 1.0f)};
+
+  const uint32_t base = static_cast<uint32_t>(4 * quad);
+  for (size_t i = 0; i < 4; ++i) {
+    mesh.vertices[4 * quad + i] = {corners[i], normal, texCoords[i]};
+  }
+  const uint32_t order[6] = {0, 1, 2, 2, 3, 0};
+  for (size_t i = 0; i < 6; ++i) {
+    mesh.indices[6 * quad + i] = base + order[i];
+  }
+}
+
+// Each face is offset along its normal and spanned by a tangent and the
+// normal x tangent bitangent
+constexpr SurfaceMesh<6> MakeCube() {
+  const Vec3 normals[6] = {Vec3::UnitX(), -Vec3::UnitX(), Vec3::UnitY(),
+                           -Vec3::UnitY(), Vec3::UnitZ(), -Vec3::UnitZ()};
+  const Vec3 tangents[6] = {-Vec3::UnitZ(), Vec3::UnitZ(),  Vec3::UnitX(),
+                            Vec3::UnitX(),  Vec3::UnitX(), -Vec3::UnitX()};
+
+  SurfaceMesh<6> mesh{};
+  for (size_t face = 0; face < 6; ++face) {
+    AddQuad(mesh, face, normals[face] * 0.5f, tangents[face],
+            normals[face].Cross(tangents[face]));
+  }
+  return mesh;
+}
+
+// Plane in XZ facing +Y
+constexpr SurfaceMesh<1> MakePlane() {
+  SurfaceMesh<1> mesh{};
+  AddQuad(mesh, 0, Vec3::Zero(), Vec3::UnitX(), -Vec3::UnitZ());
+  return mesh;
+}
+
+constexpr SurfaceMesh<6> kCube = MakeCube();
+constexpr SurfaceMesh<1> kPlane = MakePlane();
+
+//============================================================================
+// Vertex buffer layouts
+//============================================================================
+// Packed position and color floats, six per vertex
+template <size_t N>
+constexpr std::array<float, 6 * N>
+InterleavePositionColor(const Vec3 (&positions)[N], const Vec3 (&colors)[N]) {
+  std::array<float, 6 * N> result{};
+  for (size_t i = 0; i < N; ++i) {
+    for (int axis = 0; axis < 3; ++axis) {
+      result[6 * i + axis] = positions[i][axis];
+      result[6 * i + 3 + axis] = colors[i][axis];
+    }
+  }
+  return result;
+}
+
+template <size_t N>
+constexpr std::array<float, 6 * N>
+InterleavePositionColor(const Vec3 (&positions)[N], const Vec3 &color) {
+  Vec3 colors[N];
+  for (size_t i = 0; i < N; ++i) {
+    colors[i] = color;
+  }
+  return InterleavePositionColor(positions, colors);
+}
+
+} // namespace Primitives
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
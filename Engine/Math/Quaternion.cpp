@@ -0,0 +1,44 @@
+#include "Quaternion.h"
+#include "MathKernels.h"
+
+#include <algorithm>
+
+namespace Engine {
+namespace Math {
+
+void Quaternion::Multiply(Span<const Quaternion> a, Span<const Quaternion> b,
+                          Span<Quaternion> out) {
+  size_t count = std::min({a.size(), b.size(), out.size()});
+  MathKernels::Get().MultiplyQuaternions(a.data(), b.data(), out.data(),
+                                         count);
+}
+
+void Quaternion::RotateVectors(Span<const Quaternion> rotations,
+                               Span<const Vec3> vectors, Span<Vec3> out) {
+  size_t count = std::min({rotations.size(), vectors.size(), out.size()});
+  MathKernels::Get().RotateVectors(rotations.data(), vectors.data(),
+                                   out.data(), count);
+}
+
+void Quaternion::Lerp(Span<const Quaternion> a, Span<const Quaternion> b,
+                      float t, Span<Quaternion> out) {
+  size_t count = std::min({a.size(), b.size(), out.size()});
+  MathKernels::Get().LerpQuaternions(a.data(), b.data(), t, out.data(),
+                                     count);
+}
+
+void Quaternion::SlerpFast(Span<const Quaternion> a, Span<const Quaternion> b,
+                           float t, Span<Quaternion> out) {
+  size_t count = std::min({a.size(), b.size(), out.size()});
+  MathKernels::Get().SlerpQuaternions(a.data(), b.data(), t, out.data(),
+                                      count);
+}
+
+void Quaternion::ToMatrices(Span<const Quaternion> rotations,
+                            Span<Mat4> out) {
+  MathKernels::Get().QuaternionsToMatrices(
+      rotations.data(), out.data(), std::min(rotations.size(), out.size()));
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
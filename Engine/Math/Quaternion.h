@@ -6,6 +6,32 @@
 namespace Engine {
 namespace Math {
 
+namespace Detail {
+
+// Polynomial fit of sin(s * theta) / sin(theta) in terms of cos(theta) - 1,
+// from Eberly, "A Fast and Accurate Algorithm for Computing SLERP". The
+// first seven terms are the series coefficients; the last is scaled to
+// absorb the truncated tail. Templated so the SIMD packets share it.
+constexpr float kSlerpMu = 1.85298109240830f;
+constexpr float kSlerpU[8] = {1.0f / 3.0f,  1.0f / 10.0f, 1.0f / 21.0f,
+                              1.0f / 36.0f, 1.0f / 55.0f, 1.0f / 78.0f,
+                              1.0f / 105.0f, kSlerpMu / 136.0f};
+constexpr float kSlerpV[8] = {1.0f / 3.0f, 2.0f / 5.0f,  3.0f / 7.0f,
+                              4.0f / 9.0f, 5.0f / 11.0f, 6.0f / 13.0f,
+                              7.0f / 15.0f, kSlerpMu * 8.0f / 17.0f};
+
+template <typename F> constexpr F SlerpWeight(F s, F cosMinusOne) {
+  F s2 = s * s;
+  F result = F(1.0f);
+  for (int i = 7; i >= 0; --i) {
+    result = F(1.0f) + (F(kSlerpU[i]) * s2 - F(kSlerpV[i])) * cosMinusOne *
+                           result;
+  }
+  return s * result;
+}
+
+} // namespace Detail
+
 //============================================================================
 // Quaternion - For smooth 3D rotations
 //============================================================================
@@ -13,12 +39,16 @@ struct Quaternion {
   float x, y, z, w;
 
   // Constructors
-  Quaternion() : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
-  Quaternion(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
-  Quaternion(const Vec3 &xyz, float w) : x(xyz.x), y(xyz.y), z(xyz.z), w(w) {}
+  constexpr Quaternion() : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
+  constexpr Quaternion(float x, float y, float z, float w)
+      : x(x), y(y), z(z), w(w) {}
+  constexpr Quaternion(const Vec3 &xyz, float w)
+      : x(xyz.x), y(xyz.y), z(xyz.z), w(w) {}
 
   // Static factory methods
-  static Quaternion Identity() { return Quaternion(0.0f, 0.0f, 0.0f, 1.0f); }
+  static constexpr Quaternion Identity() {
+    return Quaternion(0.0f, 0.0f, 0.0f, 1.0f);
+  }
 
   static Quaternion FromAxisAngle(const Vec3 &axis, float angle) {
     Vec3 normalizedAxis = axis.Normalized();
@@ -45,7 +75,7 @@ struct Quaternion {
                       cx * cy * sz - sx * sy * cz, cx * cy * cz + sx * sy * sz);
   }
 
-  static Quaternion FromMatrix(const Mat4 &matrix) {
+  static constexpr Quaternion FromMatrix(const Mat4 &matrix) {
     float trace = matrix.m[0][0] + matrix.m[1][1] + matrix.m[2][2];
     Quaternion result;
 
@@ -83,28 +113,28 @@ struct Quaternion {
   }
 
   // Operators
-  Quaternion operator+(const Quaternion &other) const {
+  constexpr Quaternion operator+(const Quaternion &other) const {
     return Quaternion(x + other.x, y + other.y, z + other.z, w + other.w);
   }
 
-  Quaternion operator-(const Quaternion &other) const {
+  constexpr Quaternion operator-(const Quaternion &other) const {
     return Quaternion(x - other.x, y - other.y, z - other.z, w - other.w);
   }
 
-  Quaternion operator*(float scalar) const {
+  constexpr Quaternion operator*(float scalar) const {
     return Quaternion(x * scalar, y * scalar, z * scalar, w * scalar);
   }
 
-  Quaternion operator*(const Quaternion &other) const {
+  constexpr Quaternion operator*(const Quaternion &other) const {
     return Quaternion(w * other.x + x * other.w + y * other.z - z * other.y,
                       w * other.y - x * other.z + y * other.w + z * other.x,
                       w * other.z + x * other.y - y * other.x + z * other.w,
                       w * other.w - x * other.x - y * other.y - z * other.z);
   }
 
-  Quaternion operator-() const { return Quaternion(-x, -y, -z, -w); }
+  constexpr Quaternion operator-() const { return Quaternion(-x, -y, -z, -w); }
 
-  Quaternion &operator+=(const Quaternion &other) {
+  constexpr Quaternion &operator+=(const Quaternion &other) {
     x += other.x;
     y += other.y;
     z += other.z;
@@ -112,7 +142,7 @@ struct Quaternion {
     return *this;
   }
 
-  Quaternion &operator-=(const Quaternion &other) {
+  constexpr Quaternion &operator-=(const Quaternion &other) {
     x -= other.x;
     y -= other.y;
     z -= other.z;
@@ -120,7 +150,7 @@ struct Quaternion {
     return *this;
   }
 
-  Quaternion &operator*=(float scalar) {
+  constexpr Quaternion &operator*=(float scalar) {
     x *= scalar;
     y *= scalar;
     z *= scalar;
@@ -128,26 +158,28 @@ struct Quaternion {
     return *this;
   }
 
-  Quaternion &operator*=(const Quaternion &other) {
+  constexpr Quaternion &operator*=(const Quaternion &other) {
     *this = *this * other;
     return *this;
   }
 
   // Quaternion operations
-  float Dot(const Quaternion &other) const {
+  constexpr float Dot(const Quaternion &other) const {
     return x * other.x + y * other.y + z * other.z + w * other.w;
   }
 
-  float Length() const { return Sqrt(x * x + y * y + z * z + w * w); }
+  constexpr float Length() const { return Sqrt(x * x + y * y + z * z + w * w); }
 
-  float LengthSquared() const { return x * x + y * y + z * z + w * w; }
+  constexpr float LengthSquared() const {
+    return x * x + y * y + z * z + w * w;
+  }
 
-  Quaternion Normalized() const {
+  constexpr Quaternion Normalized() const {
     float len = Length();
     return IsNearZero(len) ? Identity() : *this * (1.0f / len);
   }
 
-  void Normalize() {
+  constexpr void Normalize() {
     float len = Length();
     if (!IsNearZero(len)) {
       float invLen = 1.0f / len;
@@ -158,9 +190,9 @@ struct Quaternion {
     }
   }
 
-  Quaternion Conjugate() const { return Quaternion(-x, -y, -z, w); }
+  constexpr Quaternion Conjugate() const { return Quaternion(-x, -y, -z, w); }
 
-  Quaternion Inverse() const {
+  constexpr Quaternion Inverse() const {
     float lenSq = LengthSquared();
     if (IsNearZero(lenSq)) {
       return Identity();
@@ -168,11 +200,16 @@ struct Quaternion {
     return Conjugate() * (1.0f / lenSq);
   }
 
-  // Rotation operations
-  Vec3 RotateVector(const Vec3 &vector) const {
-    Quaternion qvec(vector.x, vector.y, vector.z, 0.0f);
-    Quaternion result = *this * qvec * Conjugate();
-    return Vec3(result.x, result.y, result.z);
+  // Rotation operations. Assumes a unit quaternion: v + w * t + q.xyz x t
+  // with t = 2 (q.xyz x v), two cross products instead of two full
+  // quaternion products.
+  constexpr Vec3 RotateVector(const Vec3 &vector) const {
+    float tx = 2.0f * (y * vector.z - z * vector.y);
+    float ty = 2.0f * (z * vector.x - x * vector.z);
+    float tz = 2.0f * (x * vector.y - y * vector.x);
+    return Vec3(vector.x + w * tx + (y * tz - z * ty),
+                vector.y + w * ty + (z * tx - x * tz),
+                vector.z + w * tz + (x * ty - y * tx));
   }
 
   // Conversions
@@ -200,7 +237,7 @@ struct Quaternion {
     return euler;
   }
 
-  Mat4 ToMatrix() const {
+  constexpr Mat4 ToMatrix() const {
     float xx = x * x;
     float yy = y * y;
     float zz = z * z;
@@ -245,7 +282,8 @@ struct Quaternion {
   }
 
   // Interpolation
-  static Quaternion Lerp(const Quaternion &a, const Quaternion &b, float t) {
+  static constexpr Quaternion Lerp(const Quaternion &a, const Quaternion &b,
+                                   float t) {
     float dot = a.Dot(b);
 
     // Choose the shorter rotation path
@@ -279,16 +317,40 @@ struct Quaternion {
     return (a * wa + b_corrected * wb).Normalized();
   }
 
+  // Slerp through the polynomial weights in Detail::SlerpWeight instead of
+  // Acos and three Sin calls; within 1e-5 of Slerp for unit inputs
+  static constexpr Quaternion SlerpFast(const Quaternion &a,
+                                        const Quaternion &b, float t) {
+    float dot = a.Dot(b);
+    float cosMinusOne = Abs(dot) - 1.0f;
+    float wa = Detail::SlerpWeight(1.0f - t, cosMinusOne);
+    float wb = Detail::SlerpWeight(t, cosMinusOne);
+    return (a * wa + b * (dot < 0.0f ? -wb : wb)).Normalized();
+  }
+
+  // Batch operations on the MathKernels set for this CPU (Quaternion.cpp).
+  // Each processes min(sizes) elements; 'out' may alias an input. Rotation
+  // and matrix conversion assume unit quaternions.
+  static void Multiply(Span<const Quaternion> a, Span<const Quaternion> b,
+                       Span<Quaternion> out);
+  static void RotateVectors(Span<const Quaternion> rotations,
+                            Span<const Vec3> vectors, Span<Vec3> out);
+  static void Lerp(Span<const Quaternion> a, Span<const Quaternion> b,
+                   float t, Span<Quaternion> out);
+  static void SlerpFast(Span<const Quaternion> a, Span<const Quaternion> b,
+                        float t, Span<Quaternion> out);
+  static void ToMatrices(Span<const Quaternion> rotations, Span<Mat4> out);
+
   // Utility functions
-  Vec3 Forward() const { return RotateVector(Vec3::Forward()); }
+  constexpr Vec3 Forward() const { return RotateVector(Vec3::Forward()); }
 
-  Vec3 Right() const { return RotateVector(Vec3::Right()); }
+  constexpr Vec3 Right() const { return RotateVector(Vec3::Right()); }
 
-  Vec3 Up() const { return RotateVector(Vec3::Up()); }
+  constexpr Vec3 Up() const { return RotateVector(Vec3::Up()); }
 };
 
 // Global operators
-inline Quaternion operator*(float scalar, const Quaternion &quat) {
+constexpr Quaternion operator*(float scalar, const Quaternion &quat) {
   return quat * scalar;
 }
 
@@ -0,0 +1,32 @@
+#include "Random.h"
+
+#include <atomic>
+
+namespace Engine {
+namespace Math {
+
+namespace {
+
+std::atomic<uint64_t> s_Seed{0x853C49E6748FEA9Bull};
+std::atomic<uint64_t> s_NextThreadStream{0};
+
+} // namespace
+
+void SetRandomSeed(uint64_t seed) {
+  s_Seed.store(seed, std::memory_order_relaxed);
+  s_NextThreadStream.store(0, std::memory_order_relaxed);
+}
+
+uint64_t GetRandomSeed() { return s_Seed.load(std::memory_order_relaxed); }
+
+uint64_t Detail::NextThreadStream() {
+  return s_NextThreadStream.fetch_add(1, std::memory_order_relaxed);
+}
+
+Pcg32 &ThreadRandom() {
+  thread_local Pcg32 generator(GetRandomSeed(), Detail::NextThreadStream());
+  return generator;
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
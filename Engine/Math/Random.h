@@ -0,0 +1,207 @@
+#pragma once
+
+// Random number generators for procedural content: Pcg32 for scalar draws
+// with independent streams, RandomStream for one xoshiro128+ generator per
+// SIMD lane, and per-thread generators. None of them is suitable for
+// anything security related.
+//
+// Determinism: a generator built from (seed, stream) always produces the
+// same sequence. Jobs that must give the same result however they are
+// scheduled take their stream from the job or chunk index; ThreadRandom()
+// is for jitter and effects where that does not matter.
+
+#include "Simd.h"
+#include <cstdint>
+#include <limits>
+
+namespace Engine {
+namespace Math {
+
+//============================================================================
+// SplitMix64 - Expands a seed into well-mixed 64-bit words
+//============================================================================
+// Used to seed the other generators, so nearby seeds (0, 1, 2...) still
+// give unrelated states.
+class SplitMix64 {
+public:
+  explicit SplitMix64(uint64_t seed) : m_State(seed) {}
+
+  uint64_t Next() {
+    uint64_t z = (m_State += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+  }
+
+private:
+  uint64_t m_State;
+};
+
+//============================================================================
+// Pcg32 - PCG-XSH-RR, 64-bit state and 32-bit output
+//============================================================================
+// The stream selects one of 2^63 sequences, so generators sharing a seed
+// but not a stream are independent. Satisfies UniformRandomBitGenerator
+// and therefore also drives the <random> distributions.
+class Pcg32 {
+public:
+  using result_type = uint32_t;
+
+  explicit Pcg32(uint64_t seed = 0, uint64_t stream = 0) {
+    Seed(seed, stream);
+  }
+
+  void Seed(uint64_t seed, uint64_t stream = 0) {
+    m_State = 0;
+    m_Increment = (stream << 1) | 1;
+    Next();
+    m_State += seed;
+    Next();
+  }
+
+  uint32_t Next() {
+    uint64_t state = m_State;
+    m_State = state * kMultiplier + m_Increment;
+    uint32_t xorShifted = static_cast<uint32_t>(((state >> 18) ^ state) >> 27);
+    uint32_t rotation = static_cast<uint32_t>(state >> 59);
+    return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+  }
+
+  // Uniform in [0, bound) without modulo bias (Lemire's multiply and
+  // reject); bound must be non-zero
+  uint32_t NextBounded(uint32_t bound) {
+    uint64_t product = static_cast<uint64_t>(Next()) * bound;
+    uint32_t low = static_cast<uint32_t>(product);
+    if (low < bound) {
+      uint32_t threshold = (0u - bound) % bound;
+      while (low < threshold) {
+        product = static_cast<uint64_t>(Next()) * bound;
+        low = static_cast<uint32_t>(product);
+      }
+    }
+    return static_cast<uint32_t>(product >> 32);
+  }
+
+  // Uniform in [0, 1) with 24 bits, and in [min, max)
+  float NextFloat() {
+    return static_cast<float>(Next() >> 8) * (1.0f / 16777216.0f);
+  }
+  float NextFloat(float min, float max) {
+    return min + (max - min) * NextFloat();
+  }
+
+  // Skips 'steps' outputs in O(log steps), e.g. to give each job a disjoint
+  // slice of one sequence
+  void Advance(uint64_t steps) {
+    uint64_t multiplier = kMultiplier, increment = m_Increment;
+    uint64_t totalMultiplier = 1, totalIncrement = 0;
+    for (; steps > 0; steps >>= 1) {
+      if (steps & 1) {
+        totalMultiplier *= multiplier;
+        totalIncrement = totalIncrement * multiplier + increment;
+      }
+      increment = (multiplier + 1) * increment;
+      multiplier *= multiplier;
+    }
+    m_State = totalMultiplier * m_State + totalIncrement;
+  }
+
+  result_type operator()() { return Next(); }
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+private:
+  static constexpr uint64_t kMultiplier = 6364136223846793005ull;
+
+  uint64_t m_State;
+  uint64_t m_Increment;
+};
+
+//============================================================================
+// Per-thread generators
+//============================================================================
+// Each thread's generator is seeded on first use with the global seed and
+// the order in which threads first asked for one. SetRandomSeed() applies
+// to threads that have not drawn yet and restarts that order.
+void SetRandomSeed(uint64_t seed);
+uint64_t GetRandomSeed();
+Pcg32 &ThreadRandom();
+
+namespace Detail {
+// Stream index for the next thread that seeds a per-thread generator
+uint64_t NextThreadStream();
+} // namespace Detail
+
+inline namespace ENGINE_SIMD_NAMESPACE {
+
+//============================================================================
+// RandomStream - One xoshiro128+ generator per lane
+//============================================================================
+// F is float, SimdFloat4 or SimdFloat8. Lane l of RandomStream<F>(seed,
+// stream) produces the same sequence as RandomStream<float>(seed, stream *
+// Width + l), so batch and per-element code can share results. The low bits
+// of xoshiro128+ are weak, which is why NextFloat() keeps the top 24.
+template <typename F> class RandomStream {
+public:
+  using Int = IntLanes<F>;
+
+  static constexpr int Width = static_cast<int>(sizeof(F) / sizeof(float));
+
+  explicit RandomStream(uint64_t seed = 0, uint64_t stream = 0) {
+    uint32_t state[4][Width];
+    for (int lane = 0; lane < Width; ++lane) {
+      uint64_t index = stream * Width + static_cast<uint64_t>(lane);
+      SplitMix64 mix(seed ^ SplitMix64(index).Next());
+      uint64_t a = mix.Next(), b = mix.Next();
+      state[0][lane] = static_cast<uint32_t>(a);
+      state[1][lane] = static_cast<uint32_t>(a >> 32);
+      state[2][lane] = static_cast<uint32_t>(b);
+      state[3][lane] = static_cast<uint32_t>(b >> 32) | (a == 0 && b == 0);
+    }
+    for (int word = 0; word < 4; ++word) {
+      m_State[word] = Load(state[word]);
+    }
+  }
+
+  // 32 random bits per lane
+  Int Next() {
+    Int result = m_State[0] + m_State[3];
+    Int shifted = m_State[1] << 9;
+    m_State[2] ^= m_State[0];
+    m_State[3] ^= m_State[1];
+    m_State[1] ^= m_State[2];
+    m_State[0] ^= m_State[3];
+    m_State[2] ^= shifted;
+    m_State[3] = (m_State[3] << 11) | (m_State[3] >> 21);
+    return result;
+  }
+
+  // Uniform in [0, 1) with 24 bits, and in [min, max)
+  F NextFloat() { return ToFloat(Next() >> 8) * F(1.0f / 16777216.0f); }
+  F NextFloat(F min, F max) { return min + (max - min) * NextFloat(); }
+
+private:
+  static Int Load(const uint32_t *lanes) {
+    if constexpr (Width == 1) {
+      return lanes[0];
+    } else {
+      return Int::LoadU(lanes);
+    }
+  }
+
+  Int m_State[4];
+};
+
+// Per-thread RandomStream, seeded like ThreadRandom()
+template <typename F> RandomStream<F> &ThreadRandomStream() {
+  thread_local RandomStream<F> stream(GetRandomSeed(),
+                                      Detail::NextThreadStream());
+  return stream;
+}
+
+} // namespace ENGINE_SIMD_NAMESPACE
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,143 @@
+#pragma once
+
+// Packets of Width rays in SoA form for picking, line of sight and light
+// baking. Each packet computes its inverse directions and their signs once,
+// so the slab test against a box is subtracts, multiplies and selects only.
+// Tests return a lane mask of hits and write the hit distance to 't'; lanes
+// that miss hold unspecified values.
+
+#include "Math.h"
+#include "VectorPacket.h"
+#include <cstring>
+
+namespace Engine {
+namespace Math {
+
+//============================================================================
+// RayPacket - Width rays in SoA form
+//============================================================================
+template <typename F> struct RayPacket {
+  Vec3Packet<F> origin;
+  Vec3Packet<F> direction;
+  Vec3Packet<F> inverseDirection;
+  // All-ones lanes where the ray runs toward -axis, so it enters each slab
+  // through the box's max plane
+  Vec3Packet<F> negative;
+
+  static constexpr int Width = F::Width;
+
+  RayPacket() = default;
+  // Directions are used as given; t is measured in their length, as for Ray
+  RayPacket(const Vec3Packet<F> &origin, const Vec3Packet<F> &direction)
+      : origin(origin), direction(direction),
+        inverseDirection(F(1.0f) / direction.x, F(1.0f) / direction.y,
+                         F(1.0f) / direction.z),
+        negative(inverseDirection.x < F::Zero(),
+                 inverseDirection.y < F::Zero(),
+                 inverseDirection.z < F::Zero()) {}
+
+  // Width consecutive rays
+  static RayPacket Load(const Ray *rays) {
+    static_assert(sizeof(Ray) == 8 * sizeof(float),
+                  "Ray is a padded origin and direction");
+    const float *source = &rays[0].origin.x;
+    F origins[3], directions[3];
+    Detail::LoadRows(source, 8, origins);
+    Detail::LoadRows(source + 4, 8, directions);
+    return RayPacket(Vec3Packet<F>(origins[0], origins[1], origins[2]),
+                     Vec3Packet<F>(directions[0], directions[1],
+                                   directions[2]));
+  }
+
+  // The first 'count' rays; the remaining lanes are NaN and never hit
+  static RayPacket Load(const Ray *rays, int count) {
+    if (count >= Width) {
+      return Load(rays);
+    }
+    alignas(32) float padded[Width * 8];
+    std::memset(padded, 0xFF, sizeof(padded));
+    std::memcpy(padded, &rays[0].origin.x, count * sizeof(Ray));
+    return Load(reinterpret_cast<const Ray *>(padded));
+  }
+
+  Vec3Packet<F> At(F t) const {
+    return Vec3Packet<F>(MulAdd(direction.x, t, origin.x),
+                         MulAdd(direction.y, t, origin.y),
+                         MulAdd(direction.z, t, origin.z));
+  }
+
+  // Slab test, same result as Ray::IntersectAABB: 't' is the entry
+  // distance, or the exit distance for rays starting inside the box
+  F IntersectAABB(const AABB &box, F &t) const {
+    F nearX = (Select(negative.x, F(box.max.x), F(box.min.x)) - origin.x) *
+              inverseDirection.x;
+    F nearY = (Select(negative.y, F(box.max.y), F(box.min.y)) - origin.y) *
+              inverseDirection.y;
+    F nearZ = (Select(negative.z, F(box.max.z), F(box.min.z)) - origin.z) *
+              inverseDirection.z;
+    F farX = (Select(negative.x, F(box.min.x), F(box.max.x)) - origin.x) *
+             inverseDirection.x;
+    F farY = (Select(negative.y, F(box.min.y), F(box.max.y)) - origin.y) *
+             inverseDirection.y;
+    F farZ = (Select(negative.z, F(box.min.z), F(box.max.z)) - origin.z) *
+             inverseDirection.z;
+
+    F tNear = Max(Max(nearX, nearY), nearZ);
+    F tFar = Min(Min(farX, farY), farZ);
+    t = Select(tNear > F::Zero(), tNear, tFar);
+    return (tNear <= tFar) & (tFar >= F::Zero());
+  }
+
+  // Nearest intersection in front of the origin, as Ray::IntersectSphere
+  F IntersectSphere(const Sphere &sphere, F &t) const {
+    Vec3Packet<F> oc = origin - Vec3Packet<F>(sphere.center);
+    F a = Dot(direction, direction);
+    F b = F(2.0f) * Dot(oc, direction);
+    F c = Dot(oc, oc) - F(sphere.radius * sphere.radius);
+    F discriminant = NegMulAdd(F(4.0f) * a, c, b * b);
+
+    F root = Sqrt(Max(discriminant, F::Zero()));
+    F inverse = F(1.0f) / (a + a);
+    F t1 = (-b - root) * inverse;
+    F t2 = (root - b) * inverse;
+    t = Select(t1 > F::Zero(), t1, t2);
+    return (discriminant >= F::Zero()) & (t > F::Zero());
+  }
+
+  // Moller-Trumbore against one triangle for all lanes, both windings, as
+  // Ray::IntersectTriangle. 'u' and 'v' weight v1 and v2.
+  F IntersectTriangle(const Vec3 &v0, const Vec3 &v1, const Vec3 &v2, F &t,
+                      F &u, F &v) const {
+    Vec3Packet<F> base(v0);
+    return IntersectTriangle(base, Vec3Packet<F>(v1) - base,
+                             Vec3Packet<F>(v2) - base, t, u, v);
+  }
+
+  // Same with the triangle given as broadcast v0 and its two edges
+  F IntersectTriangle(const Vec3Packet<F> &v0, const Vec3Packet<F> &edge1,
+                      const Vec3Packet<F> &edge2, F &t, F &u, F &v) const {
+    Vec3Packet<F> p = Cross(direction, edge2);
+    F determinant = Dot(edge1, p);
+    F inverse = F(1.0f) / determinant;
+
+    Vec3Packet<F> s = origin - v0;
+    u = Dot(s, p) * inverse;
+    Vec3Packet<F> q = Cross(s, edge1);
+    v = Dot(direction, q) * inverse;
+    t = Dot(edge2, q) * inverse;
+
+    const F zero = F::Zero(), one(1.0f);
+    return (Abs(determinant) >= F(EPSILON)) & (u >= zero) & (u <= one) &
+           (v >= zero) & (u + v <= one) & (t > F(EPSILON));
+  }
+};
+
+using RayX4 = RayPacket<SimdFloat4>;
+using RayX8 = RayPacket<SimdFloat8>;
+
+} // namespace Math
+} // namespace Engine
+
+// Convenience typedefs matching Math.h
+using RayX4 = Engine::Math::RayX4;
+using RayX8 = Engine::Math::RayX8;
\ No newline at end of file
@@ -0,0 +1,298 @@
+#include "SceneGraph.h"
+#include "../Core/JobSystem.h"
+#include "Bvh.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace Engine {
+namespace Math {
+
+namespace {
+
+constexpr uint32_t kNone = SceneGraph::kNone;
+// Depth not yet known while sorting; kNone marks removed nodes
+constexpr uint32_t kUnknown = kNone - 1;
+
+// Bounds of the transformed box from its center and half extent, as tight
+// as transforming all eight corners
+AABB TransformBounds(const Affine3x4 &transform, const AABB &box) {
+  const Vec3 center = transform.TransformPoint((box.min + box.max) * 0.5f);
+  const Vec3 half = (box.max - box.min) * 0.5f;
+  Vec3 extent;
+  for (int row = 0; row < 3; ++row) {
+    extent[row] = std::abs(transform.m[row][0]) * half.x +
+                  std::abs(transform.m[row][1]) * half.y +
+                  std::abs(transform.m[row][2]) * half.z;
+  }
+  return AABB(center - extent, center + extent);
+}
+
+// 'values[i]' becomes the old 'values[order[i]]'
+template <typename T>
+void Permute(std::vector<T> &values, const std::vector<uint32_t> &order) {
+  std::vector<T> permuted(order.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    permuted[i] = values[order[i]];
+  }
+  values.swap(permuted);
+}
+
+} // namespace
+
+//============================================================================
+// Nodes
+//============================================================================
+uint32_t SceneGraph::IndexOf(NodeId node) const {
+  assert(IsValid(node));
+  return m_Indices[node];
+}
+
+bool SceneGraph::IsValid(NodeId node) const {
+  return node < m_Indices.size() && m_Indices[node] != kNone;
+}
+
+SceneGraph::NodeId SceneGraph::Create(NodeId parent, const Transform &local,
+                                      const AABB &bounds) {
+  NodeId id;
+  if (!m_FreeIds.empty()) {
+    id = m_FreeIds.back();
+    m_FreeIds.pop_back();
+  } else {
+    id = static_cast<NodeId>(m_Indices.size());
+    m_Indices.push_back(kNone);
+  }
+  m_Indices[id] = static_cast<uint32_t>(m_Ids.size());
+  m_Ids.push_back(id);
+  m_Parents.push_back(parent == kNone ? kNone : IndexOf(parent));
+  m_Locals.push_back(local);
+  m_LocalBounds.push_back(bounds);
+  m_Worlds.push_back(Affine3x4());
+  m_WorldBounds.push_back(AABB());
+  m_Dirty.push_back(1);
+  m_Removed.push_back(0);
+  m_Sorted = false;
+  return id;
+}
+
+void SceneGraph::Destroy(NodeId node) {
+  m_Removed[IndexOf(node)] = 1;
+  m_Sorted = false;
+}
+
+void SceneGraph::SetParent(NodeId node, NodeId parent) {
+  const uint32_t index = IndexOf(node);
+  const uint32_t parentIndex = parent == kNone ? kNone : IndexOf(parent);
+  assert([&]() {
+    for (uint32_t i = parentIndex; i != kNone; i = m_Parents[i]) {
+      if (i == index) {
+        return false;
+      }
+    }
+    return true;
+  }() && "SceneGraph::SetParent() would make a cycle");
+  m_Parents[index] = parentIndex;
+  m_Dirty[index] = 1;
+  m_Sorted = false;
+}
+
+void SceneGraph::Clear() {
+  m_Ids.clear();
+  m_Parents.clear();
+  m_Locals.clear();
+  m_LocalBounds.clear();
+  m_Worlds.clear();
+  m_WorldBounds.clear();
+  m_Dirty.clear();
+  m_Removed.clear();
+  m_Indices.clear();
+  m_FreeIds.clear();
+  m_LevelStart.assign(1, 0);
+  m_Sorted = true;
+  m_UpdatedCount = 0;
+}
+
+void SceneGraph::SetLocal(NodeId node, const Transform &local) {
+  const uint32_t index = IndexOf(node);
+  m_Locals[index] = local;
+  m_Dirty[index] = 1;
+}
+
+void SceneGraph::SetLocalBounds(NodeId node, const AABB &bounds) {
+  const uint32_t index = IndexOf(node);
+  m_LocalBounds[index] = bounds;
+  m_Dirty[index] = 1;
+}
+
+SceneGraph::NodeId SceneGraph::GetParent(NodeId node) const {
+  const uint32_t parent = m_Parents[IndexOf(node)];
+  return parent == kNone ? kNone : m_Ids[parent];
+}
+
+const Transform &SceneGraph::GetLocal(NodeId node) const {
+  return m_Locals[IndexOf(node)];
+}
+
+const AABB &SceneGraph::GetLocalBounds(NodeId node) const {
+  return m_LocalBounds[IndexOf(node)];
+}
+
+const Affine3x4 &SceneGraph::GetWorldTransform(NodeId node) const {
+  return m_Worlds[IndexOf(node)];
+}
+
+const AABB &SceneGraph::GetWorldBounds(NodeId node) const {
+  return m_WorldBounds[IndexOf(node)];
+}
+
+//============================================================================
+// Update
+//============================================================================
+// Counting sort by depth. Before sorting a parent may come after its
+// children, so each node walks up to the nearest ancestor of known depth
+// and fills in the depths on the way back down; nodes at or below a
+// removed one get kNone and are dropped.
+void SceneGraph::Sort() {
+  const uint32_t count = static_cast<uint32_t>(m_Ids.size());
+  std::vector<uint32_t> depths(count, kUnknown);
+  std::vector<uint32_t> path;
+  uint32_t levelCount = 0;
+  for (uint32_t i = 0; i < count; ++i) {
+    uint32_t node = i;
+    while (depths[node] == kUnknown && !m_Removed[node] &&
+           m_Parents[node] != kNone) {
+      path.push_back(node);
+      node = m_Parents[node];
+    }
+    if (depths[node] == kUnknown) {
+      depths[node] = m_Removed[node] ? kNone : 0;
+    }
+    uint32_t depth = depths[node];
+    while (!path.empty()) {
+      depth = depth == kNone ? kNone : depth + 1;
+      depths[path.back()] = depth;
+      path.pop_back();
+    }
+    if (depths[i] != kNone) {
+      levelCount = std::max(levelCount, depths[i] + 1);
+    }
+  }
+
+  m_LevelStart.assign(levelCount + 1, 0);
+  for (uint32_t i = 0; i < count; ++i) {
+    if (depths[i] != kNone) {
+      ++m_LevelStart[depths[i] + 1];
+    }
+  }
+  for (uint32_t level = 0; level < levelCount; ++level) {
+    m_LevelStart[level + 1] += m_LevelStart[level];
+  }
+
+  // order[new] = old, and the new index of each old one
+  std::vector<uint32_t> order(m_LevelStart[levelCount]);
+  std::vector<uint32_t> indices(count, kNone);
+  std::vector<uint32_t> cursor(m_LevelStart.begin(), m_LevelStart.end() - 1);
+  for (uint32_t i = 0; i < count; ++i) {
+    if (depths[i] == kNone) {
+      m_Indices[m_Ids[i]] = kNone;
+      m_FreeIds.push_back(m_Ids[i]);
+    } else {
+      indices[i] = cursor[depths[i]]++;
+      order[indices[i]] = i;
+    }
+  }
+
+  std::vector<uint32_t> parents(order.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    const uint32_t parent = m_Parents[order[i]];
+    parents[i] = parent == kNone ? kNone : indices[parent];
+  }
+  m_Parents.swap(parents);
+  Permute(m_Ids, order);
+  Permute(m_Locals, order);
+  Permute(m_LocalBounds, order);
+  Permute(m_Worlds, order);
+  Permute(m_WorldBounds, order);
+  Permute(m_Dirty, order);
+  m_Removed.assign(order.size(), 0);
+  for (size_t i = 0; i < order.size(); ++i) {
+    m_Indices[m_Ids[i]] = static_cast<uint32_t>(i);
+  }
+  m_Sorted = true;
+}
+
+// Flags the nodes whose parent was recomputed, then recomputes each run of
+// flagged nodes: their locals become affine transforms in one batch, which
+// the parents' world transforms then multiply
+void SceneGraph::UpdateRange(uint32_t begin, uint32_t end) {
+  for (uint32_t i = begin; i < end; ++i) {
+    const uint32_t parent = m_Parents[i];
+    if (parent != kNone) {
+      m_Dirty[i] |= m_Dirty[parent];
+    }
+  }
+  for (uint32_t i = begin; i < end;) {
+    if (!m_Dirty[i]) {
+      ++i;
+      continue;
+    }
+    uint32_t last = i + 1;
+    while (last < end && m_Dirty[last]) {
+      ++last;
+    }
+    ComposeTransforms(Span<const Transform>(&m_Locals[i], last - i),
+                      Span<Affine3x4>(&m_Worlds[i], last - i));
+    for (; i < last; ++i) {
+      const uint32_t parent = m_Parents[i];
+      if (parent != kNone) {
+        m_Worlds[i] = m_Worlds[parent] * m_Worlds[i];
+      }
+      m_WorldBounds[i] = TransformBounds(m_Worlds[i], m_LocalBounds[i]);
+    }
+  }
+}
+
+// Levels of up to 'grainSize' nodes run inline, so deep chains do not pay
+// for a job per level
+void SceneGraph::Update(uint32_t grainSize) {
+  if (!m_Sorted) {
+    Sort();
+  }
+  for (size_t level = 0; level < GetLevelCount(); ++level) {
+    const uint32_t begin = m_LevelStart[level];
+    const uint32_t end = m_LevelStart[level + 1];
+    if (end - begin <= grainSize) {
+      UpdateRange(begin, end);
+    } else {
+      JobSystem::ParallelFor(end - begin, grainSize,
+                             [&](uint32_t first, uint32_t last) {
+                               UpdateRange(begin + first, begin + last);
+                             });
+    }
+  }
+
+  size_t updated = 0;
+  for (uint8_t &dirty : m_Dirty) {
+    updated += dirty;
+    dirty = 0;
+  }
+  m_UpdatedCount = updated;
+}
+
+//============================================================================
+// Queries
+//============================================================================
+size_t SceneGraph::Cull(const Frustum &frustum, Span<NodeId> nodes) const {
+  const BvhQuery::FrustumLanes<float> lanes(frustum.planes);
+  size_t count = 0;
+  for (size_t i = 0; i < m_WorldBounds.size() && count < nodes.size(); ++i) {
+    if (lanes.Touches(m_WorldBounds[i])) {
+      nodes[count++] = m_Ids[i];
+    }
+  }
+  return count;
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+// Transform hierarchy stored as flat arrays sorted by depth, so that every
+// parent comes before its children and each depth level is a contiguous
+// range. Setting a local transform or bounds only flags the node; Update()
+// walks the levels in order, a node is recomputed when it or its parent
+// was, and each level is split into job chunks. World transforms and world
+// bounds stay cached for culling and rendering until the next change.
+//
+// Structural changes (new nodes, reparenting, removal) only flag the order
+// as stale; the next Update() re-sorts everything by depth in one pass.
+
+#include "../Core/Span.h"
+#include "Math.h"
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+namespace Math {
+
+//============================================================================
+// SceneGraph - Parent/child transforms with cached world transforms
+//============================================================================
+// Nodes are named by ids that stay valid until the node is destroyed. The
+// arrays behind GetNodes(), GetWorldTransforms() and GetWorldBounds() are
+// in depth order and may be reordered by Update().
+class SceneGraph {
+public:
+  using NodeId = uint32_t;
+  static constexpr NodeId kNone = 0xFFFFFFFFu;
+
+  // 'bounds' are in the node's own space; a node without geometry keeps
+  // the empty box at its origin
+  NodeId Create(NodeId parent = kNone, const Transform &local = Transform(),
+                const AABB &bounds = AABB());
+  // The node and everything below it leave at the next Update(), which
+  // frees their ids for reuse
+  void Destroy(NodeId node);
+  // kNone makes the node a root; the parent may not be below the node
+  void SetParent(NodeId node, NodeId parent);
+  void Clear();
+
+  void SetLocal(NodeId node, const Transform &local);
+  void SetLocalBounds(NodeId node, const AABB &bounds);
+
+  // Recomputes the world transforms and bounds of the flagged nodes and
+  // everything below them, one depth level after another
+  void Update(uint32_t grainSize = 1024);
+
+  bool IsValid(NodeId node) const;
+  NodeId GetParent(NodeId node) const;
+  const Transform &GetLocal(NodeId node) const;
+  const AABB &GetLocalBounds(NodeId node) const;
+  // As of the last Update()
+  const Affine3x4 &GetWorldTransform(NodeId node) const;
+  const AABB &GetWorldBounds(NodeId node) const;
+
+  // Every node, in depth order, with its world transform and bounds
+  Span<const NodeId> GetNodes() const { return m_Ids; }
+  Span<const Affine3x4> GetWorldTransforms() const { return m_Worlds; }
+  Span<const AABB> GetWorldBounds() const { return m_WorldBounds; }
+
+  size_t GetNodeCount() const { return m_Ids.size(); }
+  // Depth levels as of the last Update(); roots are level 0
+  size_t GetLevelCount() const { return m_LevelStart.size() - 1; }
+  // Nodes recomputed by the last Update()
+  size_t GetUpdatedCount() const { return m_UpdatedCount; }
+
+  // Writes the ids of the nodes whose world bounds touch the frustum, as
+  // Bvh::Cull() tests boxes, and returns how many there are; stops once
+  // 'nodes' is full
+  size_t Cull(const Frustum &frustum, Span<NodeId> nodes) const;
+
+private:
+  uint32_t IndexOf(NodeId node) const;
+  void Sort();
+  void UpdateRange(uint32_t begin, uint32_t end);
+
+private:
+  // Per node, in depth order once sorted. Parents are indices into these
+  // arrays, or kNone for roots.
+  std::vector<NodeId> m_Ids;
+  std::vector<uint32_t> m_Parents;
+  std::vector<Transform> m_Locals;
+  std::vector<AABB> m_LocalBounds;
+  std::vector<Affine3x4> m_Worlds;
+  std::vector<AABB> m_WorldBounds;
+  // Set by the setters and by Update() for nodes below flagged ones;
+  // cleared once Update() is done
+  std::vector<uint8_t> m_Dirty;
+  // Set by Destroy() until the next Update() drops the node
+  std::vector<uint8_t> m_Removed;
+
+  // Index of each id, or kNone for free ids
+  std::vector<uint32_t> m_Indices;
+  std::vector<NodeId> m_FreeIds;
+  // First index of each level, plus the node count at the end
+  std::vector<uint32_t> m_LevelStart = {0};
+  bool m_Sorted = true;
+  size_t m_UpdatedCount = 0;
+};
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,245 @@
+#include "Sequences.h"
+#include "Random.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace Engine {
+namespace Math {
+
+namespace {
+
+// Largest float below 1, so rounding never produces 1 itself
+const float kOneMinusEpsilon = 0x1.fffffep-1f;
+
+// Digits reversed into an integer and divided once at the end. 'scale'
+// stays below 2^64 since it is at most base times the index.
+inline float ReverseDigits(uint32_t index, uint32_t base) {
+  uint64_t reversed = 0, scale = 1;
+  for (; index > 0; index /= base) {
+    reversed = reversed * base + index % base;
+    scale *= base;
+  }
+  float result = static_cast<float>(static_cast<double>(reversed) / scale);
+  return std::min(result, kOneMinusEpsilon);
+}
+
+// With a constant base the divisions become multiplies
+template <uint32_t Base> float RadicalInverseIn(uint32_t index) {
+  return ReverseDigits(index, Base);
+}
+
+// Base 2 needs no divisions at all
+float ReverseBase2(uint32_t index) { return VanDerCorput(index); }
+
+using RadicalInverseFunction = float (*)(uint32_t);
+const RadicalInverseFunction kHalton[kHaltonDimensions] = {
+    ReverseBase2,         RadicalInverseIn<3>,  RadicalInverseIn<5>,
+    RadicalInverseIn<7>,  RadicalInverseIn<11>, RadicalInverseIn<13>,
+    RadicalInverseIn<17>, RadicalInverseIn<19>, RadicalInverseIn<23>,
+    RadicalInverseIn<29>, RadicalInverseIn<31>, RadicalInverseIn<37>,
+    RadicalInverseIn<41>, RadicalInverseIn<43>, RadicalInverseIn<47>,
+    RadicalInverseIn<53>};
+
+float ToUnitFloat(uint32_t bits) {
+  return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+}
+
+// Joe-Kuo primitive polynomials (degree, coefficients) and initial
+// direction numbers for dimensions 1..9
+struct SobolPolynomial {
+  int degree;
+  uint32_t coefficients;
+  uint32_t initial[5];
+};
+
+const SobolPolynomial kSobolPolynomials[kSobolDimensions - 1] = {
+    {1, 0, {1}},
+    {2, 1, {1, 3}},
+    {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},
+    {4, 1, {1, 1, 3, 3}},
+    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+    {5, 4, {1, 1, 5, 5, 5}},
+    {5, 7, {1, 1, 7, 11, 19}},
+};
+
+struct SobolDirections {
+  uint32_t v[kSobolDimensions][32];
+
+  SobolDirections() {
+    for (int bit = 0; bit < 32; ++bit) {
+      v[0][bit] = 1u << (31 - bit);
+    }
+    for (int dimension = 1; dimension < kSobolDimensions; ++dimension) {
+      const SobolPolynomial &p = kSobolPolynomials[dimension - 1];
+      uint32_t *d = v[dimension];
+      for (int bit = 0; bit < 32; ++bit) {
+        if (bit < p.degree) {
+          d[bit] = p.initial[bit] << (31 - bit);
+          continue;
+        }
+        d[bit] = d[bit - p.degree] ^ (d[bit - p.degree] >> p.degree);
+        for (int k = 1; k < p.degree; ++k) {
+          if ((p.coefficients >> (p.degree - 1 - k)) & 1u) {
+            d[bit] ^= d[bit - k];
+          }
+        }
+      }
+    }
+  }
+};
+
+const SobolDirections &GetSobolDirections() {
+  static const SobolDirections directions;
+  return directions;
+}
+
+} // namespace
+
+//============================================================================
+// Halton and van der Corput
+//============================================================================
+float RadicalInverse(uint32_t index, uint32_t base) {
+  assert(base >= 2);
+  return ReverseDigits(index, base);
+}
+
+float Halton(uint32_t index, int dimension) {
+  assert(dimension >= 0 && dimension < kHaltonDimensions);
+  return kHalton[dimension](index);
+}
+
+uint32_t ReverseBits(uint32_t value) {
+  value = (value << 16) | (value >> 16);
+  value = ((value & 0x00FF00FFu) << 8) | ((value & 0xFF00FF00u) >> 8);
+  value = ((value & 0x0F0F0F0Fu) << 4) | ((value & 0xF0F0F0F0u) >> 4);
+  value = ((value & 0x33333333u) << 2) | ((value & 0xCCCCCCCCu) >> 2);
+  value = ((value & 0x55555555u) << 1) | ((value & 0xAAAAAAAAu) >> 1);
+  return value;
+}
+
+float VanDerCorput(uint32_t index, uint32_t scramble) {
+  return ToUnitFloat(ReverseBits(index) ^ scramble);
+}
+
+//============================================================================
+// Sobol
+//============================================================================
+float Sobol(uint32_t index, int dimension, uint32_t scramble) {
+  assert(dimension >= 0 && dimension < kSobolDimensions);
+  const uint32_t *v = GetSobolDirections().v[dimension];
+  uint32_t result = scramble;
+  // Masked rather than branching on each bit, which mispredicts half the
+  // time on arbitrary indices
+  for (int bit = 0; index != 0; index >>= 1, ++bit) {
+    result ^= v[bit] & (0u - (index & 1u));
+  }
+  return ToUnitFloat(result);
+}
+
+//============================================================================
+// BlueNoiseTile
+//============================================================================
+// Ulichney's void-and-cluster. Each set texel adds a wrapped Gaussian to an
+// energy field; the tightest cluster is the set texel with the most energy
+// and the largest void the empty texel with the least. Starting from a
+// relaxed sparse pattern, clusters are removed to rank the initial texels
+// downwards and voids filled to rank the rest upwards.
+BlueNoiseTile::BlueNoiseTile(int size, uint32_t seed) : m_Size(size) {
+  assert(size > 0);
+  const int count = size * size;
+  const float sigma = 1.5f;
+
+  std::vector<float> kernel(count);
+  for (int y = 0; y < size; ++y) {
+    for (int x = 0; x < size; ++x) {
+      float dx = static_cast<float>(std::min(x, size - x));
+      float dy = static_cast<float>(std::min(y, size - y));
+      kernel[y * size + x] =
+          std::exp(-(dx * dx + dy * dy) / (2.0f * sigma * sigma));
+    }
+  }
+
+  auto splat = [&](std::vector<float> &energy, int texel, float sign) {
+    int tx = texel % size, ty = texel / size;
+    for (int y = 0; y < size; ++y) {
+      const float *row = &kernel[((y - ty + size) % size) * size];
+      float *out = &energy[y * size];
+      for (int x = 0; x < size; ++x) {
+        out[x] += sign * row[(x - tx + size) % size];
+      }
+    }
+  };
+  // Extreme energy among texels whose pattern bit equals 'set'
+  auto find = [&](const std::vector<float> &energy,
+                  const std::vector<uint8_t> &pattern, bool set) {
+    int best = -1;
+    for (int i = 0; i < count; ++i) {
+      if (pattern[i] != set) {
+        continue;
+      }
+      if (best < 0 || (set ? energy[i] > energy[best]
+                           : energy[i] < energy[best])) {
+        best = i;
+      }
+    }
+    return best;
+  };
+
+  // Initial pattern: about a tenth of the texels, then swap the tightest
+  // cluster into the largest void until that stops moving anything
+  std::vector<uint8_t> pattern(count, 0);
+  std::vector<float> energy(count, 0.0f);
+  const int initialCount = std::max(1, count / 10);
+  Pcg32 random(seed, 0x5EED);
+  for (int placed = 0; placed < initialCount;) {
+    int texel = static_cast<int>(random.NextBounded(count));
+    if (!pattern[texel]) {
+      pattern[texel] = 1;
+      splat(energy, texel, 1.0f);
+      ++placed;
+    }
+  }
+  for (int iteration = 0; iteration < count; ++iteration) {
+    int cluster = find(energy, pattern, true);
+    pattern[cluster] = 0;
+    splat(energy, cluster, -1.0f);
+    int gap = find(energy, pattern, false);
+    pattern[gap] = 1;
+    splat(energy, gap, 1.0f);
+    if (gap == cluster) {
+      break;
+    }
+  }
+
+  std::vector<int> rank(count);
+
+  // Phase 1: rank the initial texels by removing clusters
+  std::vector<uint8_t> removing = pattern;
+  std::vector<float> removingEnergy = energy;
+  for (int r = initialCount - 1; r >= 0; --r) {
+    int cluster = find(removingEnergy, removing, true);
+    removing[cluster] = 0;
+    splat(removingEnergy, cluster, -1.0f);
+    rank[cluster] = r;
+  }
+
+  // Phases 2 and 3: rank the rest by filling voids
+  for (int r = initialCount; r < count; ++r) {
+    int gap = find(energy, pattern, false);
+    pattern[gap] = 1;
+    splat(energy, gap, 1.0f);
+    rank[gap] = r;
+  }
+
+  m_Values.resize(count);
+  for (int i = 0; i < count; ++i) {
+    m_Values[i] = static_cast<float>(rank[i]) / static_cast<float>(count);
+  }
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
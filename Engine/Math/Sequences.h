@@ -0,0 +1,88 @@
+#pragma once
+
+// Low-discrepancy sequences and blue-noise tiles for sampling: points that
+// cover the domain more evenly than independent random draws, so estimates
+// (AO rays, shadow taps, jittered placement) converge faster and noise
+// turns into fine grain rather than clumps.
+//
+// Every function maps an index to a point and keeps no state, so jobs can
+// take disjoint index ranges and still draw from one sequence.
+
+#include "../Core/Span.h"
+#include "Vector.h"
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+namespace Math {
+
+//============================================================================
+// Halton and van der Corput
+//============================================================================
+// Digits of 'index' in 'base' mirrored about the radix point, in [0, 1)
+float RadicalInverse(uint32_t index, uint32_t base);
+
+// Dimension d is the radical inverse in the d-th prime (2, 3, 5...). The
+// higher dimensions correlate badly over short runs, so keep to the first
+// few or scramble them.
+constexpr int kHaltonDimensions = 16;
+float Halton(uint32_t index, int dimension);
+inline Vec2 Halton2(uint32_t index) {
+  return Vec2(Halton(index, 0), Halton(index, 1));
+}
+
+// Base 2 radical inverse by bit reversal. A non-zero scramble XORs the
+// reversed bits, which keeps the stratification while decorrelating
+// pixels or frames that share the index.
+uint32_t ReverseBits(uint32_t value);
+float VanDerCorput(uint32_t index, uint32_t scramble = 0);
+
+//============================================================================
+// Sobol
+//============================================================================
+// Dimension 0 is van der Corput and the rest use the Joe-Kuo direction
+// numbers. Any 2^m consecutive points starting at a multiple of 2^m fall
+// one per interval of width 2^-m in each dimension, and dimensions 0 and 1
+// together form a (0, m, 2)-net. Scrambling works as for VanDerCorput.
+constexpr int kSobolDimensions = 10;
+float Sobol(uint32_t index, int dimension, uint32_t scramble = 0);
+inline Vec2 Sobol2(uint32_t index, uint32_t scramble = 0) {
+  return Vec2(Sobol(index, 0, scramble), Sobol(index, 1, scramble));
+}
+
+//============================================================================
+// BlueNoiseTile - Tileable blue-noise threshold map
+//============================================================================
+// A size x size array holding each value k / size^2 exactly once, arranged
+// by void-and-cluster so that the texels below any threshold are spread
+// evenly, with no low-frequency structure, across the tile and its
+// wrapped neighbors. Generation is O(size^4); build tiles once at load
+// time (64 x 64 takes a few tens of milliseconds) and keep them.
+class BlueNoiseTile {
+public:
+  explicit BlueNoiseTile(int size = 64, uint32_t seed = 0);
+
+  // The value at (x, y), wrapping in both axes
+  float Sample(uint32_t x, uint32_t y) const {
+    uint32_t size = static_cast<uint32_t>(m_Size);
+    return m_Values[(y % size) * size + x % size];
+  }
+
+  // The value shifted by the golden ratio per frame, so each texel walks a
+  // low-discrepancy sequence over time while every frame stays blue
+  float Sample(uint32_t x, uint32_t y, uint32_t frame) const {
+    uint32_t fixed = static_cast<uint32_t>(Sample(x, y) * 4294967296.0);
+    fixed += frame * 0x9E3779B9u;
+    return static_cast<float>(fixed >> 8) * (1.0f / 16777216.0f);
+  }
+
+  int GetSize() const { return m_Size; }
+  Span<const float> GetValues() const { return m_Values; }
+
+private:
+  int m_Size;
+  std::vector<float> m_Values;
+};
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,571 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <immintrin.h>
+
+// MSVC only defines __AVX__/__AVX2__; /arch:AVX implies SSE4.1 and
+// /arch:AVX2 implies FMA. SSE4.1-only builds on MSVC define
+// ENGINE_SIMD_SSE41 themselves.
+#if !defined(ENGINE_SIMD_SSE41) && (defined(__SSE4_1__) || defined(__AVX__))
+#define ENGINE_SIMD_SSE41 1
+#endif
+#if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define ENGINE_SIMD_FMA 1
+#endif
+
+// The wrappers below compile to different instructions depending on the ISA
+// flags of the including translation unit. Each flag set gets its own inline
+// namespace, so the per-ISA kernel files (see MathKernels.h) never share an
+// inline function body with the baseline build at link time.
+#if defined(__AVX512F__)
+#define ENGINE_SIMD_NAMESPACE Avx512
+#elif defined(__AVX__) && defined(ENGINE_SIMD_FMA)
+#define ENGINE_SIMD_NAMESPACE AvxFma
+#elif defined(__AVX__)
+#define ENGINE_SIMD_NAMESPACE Avx
+#elif defined(ENGINE_SIMD_SSE41)
+#define ENGINE_SIMD_NAMESPACE Sse41
+#else
+#define ENGINE_SIMD_NAMESPACE Sse2
+#endif
+
+namespace Engine {
+namespace Math {
+inline namespace ENGINE_SIMD_NAMESPACE {
+
+//============================================================================
+// SimdFloat4 - Four float lanes in one SSE register
+//============================================================================
+// Comparisons return lane masks (all bits set where true) in the same type,
+// which feed Select() and the bitwise operators.
+struct SimdFloat4 {
+  __m128 v;
+
+  static constexpr int Width = 4;
+
+  SimdFloat4() = default;
+  SimdFloat4(__m128 value) : v(value) {}
+  SimdFloat4(float scalar) : v(_mm_set1_ps(scalar)) {}
+  SimdFloat4(float a, float b, float c, float d) : v(_mm_setr_ps(a, b, c, d)) {}
+
+  static SimdFloat4 Zero() { return _mm_setzero_ps(); }
+  static SimdFloat4 Load(const float *aligned) { return _mm_load_ps(aligned); }
+  static SimdFloat4 LoadU(const float *data) { return _mm_loadu_ps(data); }
+
+  void Store(float *aligned) const { _mm_store_ps(aligned, v); }
+  void StoreU(float *data) const { _mm_storeu_ps(data, v); }
+
+  float operator[](int lane) const {
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, v);
+    return lanes[lane];
+  }
+
+  SimdFloat4 operator+(SimdFloat4 o) const { return _mm_add_ps(v, o.v); }
+  SimdFloat4 operator-(SimdFloat4 o) const { return _mm_sub_ps(v, o.v); }
+  SimdFloat4 operator*(SimdFloat4 o) const { return _mm_mul_ps(v, o.v); }
+  SimdFloat4 operator/(SimdFloat4 o) const { return _mm_div_ps(v, o.v); }
+  SimdFloat4 operator-() const {
+    return _mm_xor_ps(v, _mm_set1_ps(-0.0f));
+  }
+
+  SimdFloat4 &operator+=(SimdFloat4 o) { return *this = *this + o; }
+  SimdFloat4 &operator-=(SimdFloat4 o) { return *this = *this - o; }
+  SimdFloat4 &operator*=(SimdFloat4 o) { return *this = *this * o; }
+  SimdFloat4 &operator/=(SimdFloat4 o) { return *this = *this / o; }
+
+  SimdFloat4 operator&(SimdFloat4 o) const { return _mm_and_ps(v, o.v); }
+  SimdFloat4 operator|(SimdFloat4 o) const { return _mm_or_ps(v, o.v); }
+  SimdFloat4 operator^(SimdFloat4 o) const { return _mm_xor_ps(v, o.v); }
+
+  SimdFloat4 operator<(SimdFloat4 o) const { return _mm_cmplt_ps(v, o.v); }
+  SimdFloat4 operator<=(SimdFloat4 o) const { return _mm_cmple_ps(v, o.v); }
+  SimdFloat4 operator>(SimdFloat4 o) const { return _mm_cmpgt_ps(v, o.v); }
+  SimdFloat4 operator>=(SimdFloat4 o) const { return _mm_cmpge_ps(v, o.v); }
+  SimdFloat4 operator==(SimdFloat4 o) const { return _mm_cmpeq_ps(v, o.v); }
+  SimdFloat4 operator!=(SimdFloat4 o) const { return _mm_cmpneq_ps(v, o.v); }
+};
+
+// a * b + c, fused where the target has FMA
+inline SimdFloat4 MulAdd(SimdFloat4 a, SimdFloat4 b, SimdFloat4 c) {
+#if defined(ENGINE_SIMD_FMA)
+  return _mm_fmadd_ps(a.v, b.v, c.v);
+#else
+  return _mm_add_ps(_mm_mul_ps(a.v, b.v), c.v);
+#endif
+}
+
+// c - a * b
+inline SimdFloat4 NegMulAdd(SimdFloat4 a, SimdFloat4 b, SimdFloat4 c) {
+#if defined(ENGINE_SIMD_FMA)
+  return _mm_fnmadd_ps(a.v, b.v, c.v);
+#else
+  return _mm_sub_ps(c.v, _mm_mul_ps(a.v, b.v));
+#endif
+}
+
+inline SimdFloat4 Min(SimdFloat4 a, SimdFloat4 b) {
+  return _mm_min_ps(a.v, b.v);
+}
+inline SimdFloat4 Max(SimdFloat4 a, SimdFloat4 b) {
+  return _mm_max_ps(a.v, b.v);
+}
+inline SimdFloat4 Abs(SimdFloat4 a) {
+  return _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v);
+}
+inline SimdFloat4 Sqrt(SimdFloat4 a) { return _mm_sqrt_ps(a.v); }
+
+// 1/sqrt(a): hardware estimate refined by one Newton-Raphson step, good to
+// about 22 bits
+inline SimdFloat4 RSqrt(SimdFloat4 a) {
+  __m128 estimate = _mm_rsqrt_ps(a.v);
+  __m128 halfA = _mm_mul_ps(a.v, _mm_set1_ps(0.5f));
+  __m128 square = _mm_mul_ps(estimate, estimate);
+  __m128 correction =
+      _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfA, square));
+  return _mm_mul_ps(estimate, correction);
+}
+
+// The raw hardware estimate, ~12 bits
+inline SimdFloat4 RSqrtEstimate(SimdFloat4 a) { return _mm_rsqrt_ps(a.v); }
+
+// Lanes of 'a' where the mask is set, lanes of 'b' elsewhere
+inline SimdFloat4 Select(SimdFloat4 mask, SimdFloat4 a, SimdFloat4 b) {
+#if defined(ENGINE_SIMD_SSE41)
+  return _mm_blendv_ps(b.v, a.v, mask.v);
+#else
+  return _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v));
+#endif
+}
+
+// ~a & b
+inline SimdFloat4 AndNot(SimdFloat4 a, SimdFloat4 b) {
+  return _mm_andnot_ps(a.v, b.v);
+}
+
+// One bit per lane, lane 0 in bit 0
+inline int MoveMask(SimdFloat4 mask) { return _mm_movemask_ps(mask.v); }
+inline bool Any(SimdFloat4 mask) { return MoveMask(mask) != 0; }
+inline bool All(SimdFloat4 mask) { return MoveMask(mask) == 0xF; }
+inline bool None(SimdFloat4 mask) { return MoveMask(mask) == 0; }
+
+//============================================================================
+// SimdFloat8 - Eight float lanes; one AVX register or two SSE registers
+//============================================================================
+// Without AVX enabled at compile time the type is emulated with two SSE
+// halves, so packet code written against it builds on every x86-64 target.
+struct SimdFloat8 {
+#if defined(__AVX__)
+  __m256 v;
+#else
+  SimdFloat4 lo, hi;
+#endif
+
+  static constexpr int Width = 8;
+
+  SimdFloat8() = default;
+#if defined(__AVX__)
+  SimdFloat8(__m256 value) : v(value) {}
+  SimdFloat8(float scalar) : v(_mm256_set1_ps(scalar)) {}
+  SimdFloat8(SimdFloat4 low, SimdFloat4 high)
+      : v(_mm256_insertf128_ps(_mm256_castps128_ps256(low.v), high.v, 1)) {}
+
+  SimdFloat4 Low() const { return _mm256_castps256_ps128(v); }
+  SimdFloat4 High() const { return _mm256_extractf128_ps(v, 1); }
+
+  static SimdFloat8 Zero() { return _mm256_setzero_ps(); }
+  static SimdFloat8 Load(const float *aligned) {
+    return _mm256_load_ps(aligned);
+  }
+  static SimdFloat8 LoadU(const float *data) { return _mm256_loadu_ps(data); }
+
+  void Store(float *aligned) const { _mm256_store_ps(aligned, v); }
+  void StoreU(float *data) const { _mm256_storeu_ps(data, v); }
+#else
+  SimdFloat8(float scalar) : lo(scalar), hi(scalar) {}
+  SimdFloat8(SimdFloat4 low, SimdFloat4 high) : lo(low), hi(high) {}
+
+  SimdFloat4 Low() const { return lo; }
+  SimdFloat4 High() const { return hi; }
+
+  static SimdFloat8 Zero() {
+    return SimdFloat8(SimdFloat4::Zero(), SimdFloat4::Zero());
+  }
+  // 'aligned' must be 32-byte aligned, matching the AVX path
+  static SimdFloat8 Load(const float *aligned) {
+    return SimdFloat8(SimdFloat4::Load(aligned), SimdFloat4::Load(aligned + 4));
+  }
+  static SimdFloat8 LoadU(const float *data) {
+    return SimdFloat8(SimdFloat4::LoadU(data), SimdFloat4::LoadU(data + 4));
+  }
+
+  void Store(float *aligned) const {
+    lo.Store(aligned);
+    hi.Store(aligned + 4);
+  }
+  void StoreU(float *data) const {
+    lo.StoreU(data);
+    hi.StoreU(data + 4);
+  }
+#endif
+
+  float operator[](int lane) const {
+    alignas(32) float lanes[8];
+    Store(lanes);
+    return lanes[lane];
+  }
+
+#if defined(__AVX__)
+  SimdFloat8 operator+(SimdFloat8 o) const { return _mm256_add_ps(v, o.v); }
+  SimdFloat8 operator-(SimdFloat8 o) const { return _mm256_sub_ps(v, o.v); }
+  SimdFloat8 operator*(SimdFloat8 o) const { return _mm256_mul_ps(v, o.v); }
+  SimdFloat8 operator/(SimdFloat8 o) const { return _mm256_div_ps(v, o.v); }
+  SimdFloat8 operator-() const {
+    return _mm256_xor_ps(v, _mm256_set1_ps(-0.0f));
+  }
+
+  SimdFloat8 operator&(SimdFloat8 o) const { return _mm256_and_ps(v, o.v); }
+  SimdFloat8 operator|(SimdFloat8 o) const { return _mm256_or_ps(v, o.v); }
+  SimdFloat8 operator^(SimdFloat8 o) const { return _mm256_xor_ps(v, o.v); }
+
+  SimdFloat8 operator<(SimdFloat8 o) const {
+    return _mm256_cmp_ps(v, o.v, _CMP_LT_OQ);
+  }
+  SimdFloat8 operator<=(SimdFloat8 o) const {
+    return _mm256_cmp_ps(v, o.v, _CMP_LE_OQ);
+  }
+  SimdFloat8 operator>(SimdFloat8 o) const {
+    return _mm256_cmp_ps(v, o.v, _CMP_GT_OQ);
+  }
+  SimdFloat8 operator>=(SimdFloat8 o) const {
+    return _mm256_cmp_ps(v, o.v, _CMP_GE_OQ);
+  }
+  SimdFloat8 operator==(SimdFloat8 o) const {
+    return _mm256_cmp_ps(v, o.v, _CMP_EQ_OQ);
+  }
+  SimdFloat8 operator!=(SimdFloat8 o) const {
+    return _mm256_cmp_ps(v, o.v, _CMP_NEQ_UQ);
+  }
+#else
+  SimdFloat8 operator+(SimdFloat8 o) const { return {lo + o.lo, hi + o.hi}; }
+  SimdFloat8 operator-(SimdFloat8 o) const { return {lo - o.lo, hi - o.hi}; }
+  SimdFloat8 operator*(SimdFloat8 o) const { return {lo * o.lo, hi * o.hi}; }
+  SimdFloat8 operator/(SimdFloat8 o) const { return {lo / o.lo, hi / o.hi}; }
+  SimdFloat8 operator-() const { return {-lo, -hi}; }
+
+  SimdFloat8 operator&(SimdFloat8 o) const { return {lo & o.lo, hi & o.hi}; }
+  SimdFloat8 operator|(SimdFloat8 o) const { return {lo | o.lo, hi | o.hi}; }
+  SimdFloat8 operator^(SimdFloat8 o) const { return {lo ^ o.lo, hi ^ o.hi}; }
+
+  SimdFloat8 operator<(SimdFloat8 o) const { return {lo < o.lo, hi < o.hi}; }
+  SimdFloat8 operator<=(SimdFloat8 o) const {
+    return {lo <= o.lo, hi <= o.hi};
+  }
+  SimdFloat8 operator>(SimdFloat8 o) const { return {lo > o.lo, hi > o.hi}; }
+  SimdFloat8 operator>=(SimdFloat8 o) const {
+    return {lo >= o.lo, hi >= o.hi};
+  }
+  SimdFloat8 operator==(SimdFloat8 o) const {
+    return {lo == o.lo, hi == o.hi};
+  }
+  SimdFloat8 operator!=(SimdFloat8 o) const {
+    return {lo != o.lo, hi != o.hi};
+  }
+#endif
+
+  SimdFloat8 &operator+=(SimdFloat8 o) { return *this = *this + o; }
+  SimdFloat8 &operator-=(SimdFloat8 o) { return *this = *this - o; }
+  SimdFloat8 &operator*=(SimdFloat8 o) { return *this = *this * o; }
+  SimdFloat8 &operator/=(SimdFloat8 o) { return *this = *this / o; }
+};
+
+#if defined(__AVX__)
+inline SimdFloat8 MulAdd(SimdFloat8 a, SimdFloat8 b, SimdFloat8 c) {
+#if defined(ENGINE_SIMD_FMA)
+  return _mm256_fmadd_ps(a.v, b.v, c.v);
+#else
+  return _mm256_add_ps(_mm256_mul_ps(a.v, b.v), c.v);
+#endif
+}
+inline SimdFloat8 NegMulAdd(SimdFloat8 a, SimdFloat8 b, SimdFloat8 c) {
+#if defined(ENGINE_SIMD_FMA)
+  return _mm256_fnmadd_ps(a.v, b.v, c.v);
+#else
+  return _mm256_sub_ps(c.v, _mm256_mul_ps(a.v, b.v));
+#endif
+}
+inline SimdFloat8 Min(SimdFloat8 a, SimdFloat8 b) {
+  return _mm256_min_ps(a.v, b.v);
+}
+inline SimdFloat8 Max(SimdFloat8 a, SimdFloat8 b) {
+  return _mm256_max_ps(a.v, b.v);
+}
+inline SimdFloat8 Abs(SimdFloat8 a) {
+  return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v);
+}
+inline SimdFloat8 Sqrt(SimdFloat8 a) { return _mm256_sqrt_ps(a.v); }
+inline SimdFloat8 RSqrt(SimdFloat8 a) {
+  __m256 estimate = _mm256_rsqrt_ps(a.v);
+  __m256 halfA = _mm256_mul_ps(a.v, _mm256_set1_ps(0.5f));
+  __m256 square = _mm256_mul_ps(estimate, estimate);
+  __m256 correction =
+      _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(halfA, square));
+  return _mm256_mul_ps(estimate, correction);
+}
+inline SimdFloat8 RSqrtEstimate(SimdFloat8 a) { return _mm256_rsqrt_ps(a.v); }
+inline SimdFloat8 Select(SimdFloat8 mask, SimdFloat8 a, SimdFloat8 b) {
+  return _mm256_blendv_ps(b.v, a.v, mask.v);
+}
+inline SimdFloat8 AndNot(SimdFloat8 a, SimdFloat8 b) {
+  return _mm256_andnot_ps(a.v, b.v);
+}
+inline int MoveMask(SimdFloat8 mask) { return _mm256_movemask_ps(mask.v); }
+#else
+inline SimdFloat8 MulAdd(SimdFloat8 a, SimdFloat8 b, SimdFloat8 c) {
+  return {MulAdd(a.lo, b.lo, c.lo), MulAdd(a.hi, b.hi, c.hi)};
+}
+inline SimdFloat8 NegMulAdd(SimdFloat8 a, SimdFloat8 b, SimdFloat8 c) {
+  return {NegMulAdd(a.lo, b.lo, c.lo), NegMulAdd(a.hi, b.hi, c.hi)};
+}
+inline SimdFloat8 Min(SimdFloat8 a, SimdFloat8 b) {
+  return {Min(a.lo, b.lo), Min(a.hi, b.hi)};
+}
+inline SimdFloat8 Max(SimdFloat8 a, SimdFloat8 b) {
+  return {Max(a.lo, b.lo), Max(a.hi, b.hi)};
+}
+inline SimdFloat8 Abs(SimdFloat8 a) { return {Abs(a.lo), Abs(a.hi)}; }
+inline SimdFloat8 Sqrt(SimdFloat8 a) { return {Sqrt(a.lo), Sqrt(a.hi)}; }
+inline SimdFloat8 RSqrt(SimdFloat8 a) { return {RSqrt(a.lo), RSqrt(a.hi)}; }
+inline SimdFloat8 RSqrtEstimate(SimdFloat8 a) {
+  return {RSqrtEstimate(a.lo), RSqrtEstimate(a.hi)};
+}
+inline SimdFloat8 Select(SimdFloat8 mask, SimdFloat8 a, SimdFloat8 b) {
+  return {Select(mask.lo, a.lo, b.lo), Select(mask.hi, a.hi, b.hi)};
+}
+inline SimdFloat8 AndNot(SimdFloat8 a, SimdFloat8 b) {
+  return {AndNot(a.lo, b.lo), AndNot(a.hi, b.hi)};
+}
+inline int MoveMask(SimdFloat8 mask) {
+  return MoveMask(mask.lo) | (MoveMask(mask.hi) << 4);
+}
+#endif
+
+inline bool Any(SimdFloat8 mask) { return MoveMask(mask) != 0; }
+inline bool All(SimdFloat8 mask) { return MoveMask(mask) == 0xFF; }
+inline bool None(SimdFloat8 mask) { return MoveMask(mask) == 0; }
+
+//============================================================================
+// SimdInt4 - Four 32-bit integer lanes in one SSE register
+//============================================================================
+// Lanes behave like uint32_t: arithmetic wraps and >> is a logical shift.
+// For hashing and bit manipulation next to SimdFloat4 (noise, random
+// number streams); comparisons return all-ones lane masks.
+struct SimdInt4 {
+  __m128i v;
+
+  static constexpr int Width = 4;
+
+  SimdInt4() = default;
+  SimdInt4(__m128i value) : v(value) {}
+  SimdInt4(uint32_t scalar) : v(_mm_set1_epi32(static_cast<int>(scalar))) {}
+
+  static SimdInt4 Zero() { return _mm_setzero_si128(); }
+  static SimdInt4 LoadU(const uint32_t *data) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+  }
+
+  void StoreU(uint32_t *data) const {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(data), v);
+  }
+
+  uint32_t operator[](int lane) const {
+    alignas(16) uint32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), v);
+    return lanes[lane];
+  }
+
+  SimdInt4 operator+(SimdInt4 o) const { return _mm_add_epi32(v, o.v); }
+  SimdInt4 operator-(SimdInt4 o) const { return _mm_sub_epi32(v, o.v); }
+  // Low 32 bits of the product; SSE2 has no 32-bit mullo, so it multiplies
+  // the even and odd lanes as 64-bit products and interleaves them
+  SimdInt4 operator*(SimdInt4 o) const {
+#if defined(ENGINE_SIMD_SSE41)
+    return _mm_mullo_epi32(v, o.v);
+#else
+    __m128i even = _mm_mul_epu32(v, o.v);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(v, 32), _mm_srli_epi64(o.v, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+  }
+
+  SimdInt4 operator&(SimdInt4 o) const { return _mm_and_si128(v, o.v); }
+  SimdInt4 operator|(SimdInt4 o) const { return _mm_or_si128(v, o.v); }
+  SimdInt4 operator^(SimdInt4 o) const { return _mm_xor_si128(v, o.v); }
+  SimdInt4 operator<<(int count) const { return _mm_slli_epi32(v, count); }
+  SimdInt4 operator>>(int count) const { return _mm_srli_epi32(v, count); }
+
+  SimdInt4 &operator+=(SimdInt4 o) { return *this = *this + o; }
+  SimdInt4 &operator-=(SimdInt4 o) { return *this = *this - o; }
+  SimdInt4 &operator*=(SimdInt4 o) { return *this = *this * o; }
+  SimdInt4 &operator&=(SimdInt4 o) { return *this = *this & o; }
+  SimdInt4 &operator|=(SimdInt4 o) { return *this = *this | o; }
+  SimdInt4 &operator^=(SimdInt4 o) { return *this = *this ^ o; }
+
+  SimdInt4 operator==(SimdInt4 o) const { return _mm_cmpeq_epi32(v, o.v); }
+};
+
+// Conversions: ToInt truncates toward zero into two's complement lanes,
+// ToFloat reads the lanes as signed, AsInt/AsFloat keep the bits
+inline SimdInt4 ToInt(SimdFloat4 a) { return _mm_cvttps_epi32(a.v); }
+inline SimdFloat4 ToFloat(SimdInt4 a) { return _mm_cvtepi32_ps(a.v); }
+inline SimdInt4 AsInt(SimdFloat4 a) { return _mm_castps_si128(a.v); }
+inline SimdFloat4 AsFloat(SimdInt4 a) { return _mm_castsi128_ps(a.v); }
+
+//============================================================================
+// SimdInt8 - Eight 32-bit integer lanes; one AVX2 register or two halves
+//============================================================================
+// AVX without AVX2 has no 256-bit integer arithmetic, so there (and below
+// AVX) the type is two SimdInt4 halves.
+struct SimdInt8 {
+#if defined(__AVX2__)
+  __m256i v;
+#else
+  SimdInt4 lo, hi;
+#endif
+
+  static constexpr int Width = 8;
+
+  SimdInt8() = default;
+#if defined(__AVX2__)
+  SimdInt8(__m256i value) : v(value) {}
+  SimdInt8(uint32_t scalar)
+      : v(_mm256_set1_epi32(static_cast<int>(scalar))) {}
+  SimdInt8(SimdInt4 low, SimdInt4 high)
+      : v(_mm256_inserti128_si256(_mm256_castsi128_si256(low.v), high.v,
+                                  1)) {}
+
+  SimdInt4 Low() const { return _mm256_castsi256_si128(v); }
+  SimdInt4 High() const { return _mm256_extracti128_si256(v, 1); }
+
+  static SimdInt8 Zero() { return _mm256_setzero_si256(); }
+  static SimdInt8 LoadU(const uint32_t *data) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+  }
+
+  void StoreU(uint32_t *data) const {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(data), v);
+  }
+
+  SimdInt8 operator+(SimdInt8 o) const { return _mm256_add_epi32(v, o.v); }
+  SimdInt8 operator-(SimdInt8 o) const { return _mm256_sub_epi32(v, o.v); }
+  SimdInt8 operator*(SimdInt8 o) const { return _mm256_mullo_epi32(v, o.v); }
+  SimdInt8 operator&(SimdInt8 o) const { return _mm256_and_si256(v, o.v); }
+  SimdInt8 operator|(SimdInt8 o) const { return _mm256_or_si256(v, o.v); }
+  SimdInt8 operator^(SimdInt8 o) const { return _mm256_xor_si256(v, o.v); }
+  SimdInt8 operator<<(int count) const { return _mm256_slli_epi32(v, count); }
+  SimdInt8 operator>>(int count) const { return _mm256_srli_epi32(v, count); }
+  SimdInt8 operator==(SimdInt8 o) const {
+    return _mm256_cmpeq_epi32(v, o.v);
+  }
+#else
+  SimdInt8(uint32_t scalar) : lo(scalar), hi(scalar) {}
+  SimdInt8(SimdInt4 low, SimdInt4 high) : lo(low), hi(high) {}
+
+  SimdInt4 Low() const { return lo; }
+  SimdInt4 High() const { return hi; }
+
+  static SimdInt8 Zero() {
+    return SimdInt8(SimdInt4::Zero(), SimdInt4::Zero());
+  }
+  static SimdInt8 LoadU(const uint32_t *data) {
+    return SimdInt8(SimdInt4::LoadU(data), SimdInt4::LoadU(data + 4));
+  }
+
+  void StoreU(uint32_t *data) const {
+    lo.StoreU(data);
+    hi.StoreU(data + 4);
+  }
+
+  SimdInt8 operator+(SimdInt8 o) const { return {lo + o.lo, hi + o.hi}; }
+  SimdInt8 operator-(SimdInt8 o) const { return {lo - o.lo, hi - o.hi}; }
+  SimdInt8 operator*(SimdInt8 o) const { return {lo * o.lo, hi * o.hi}; }
+  SimdInt8 operator&(SimdInt8 o) const { return {lo & o.lo, hi & o.hi}; }
+  SimdInt8 operator|(SimdInt8 o) const { return {lo | o.lo, hi | o.hi}; }
+  SimdInt8 operator^(SimdInt8 o) const { return {lo ^ o.lo, hi ^ o.hi}; }
+  SimdInt8 operator<<(int count) const { return {lo << count, hi << count}; }
+  SimdInt8 operator>>(int count) const { return {lo >> count, hi >> count}; }
+  SimdInt8 operator==(SimdInt8 o) const { return {lo == o.lo, hi == o.hi}; }
+#endif
+
+  uint32_t operator[](int lane) const {
+    uint32_t lanes[8];
+    StoreU(lanes);
+    return lanes[lane];
+  }
+
+  SimdInt8 &operator+=(SimdInt8 o) { return *this = *this + o; }
+  SimdInt8 &operator-=(SimdInt8 o) { return *this = *this - o; }
+  SimdInt8 &operator*=(SimdInt8 o) { return *this = *this * o; }
+  SimdInt8 &operator&=(SimdInt8 o) { return *this = *this & o; }
+  SimdInt8 &operator|=(SimdInt8 o) { return *this = *this | o; }
+  SimdInt8 &operator^=(SimdInt8 o) { return *this = *this ^ o; }
+};
+
+#if defined(__AVX2__)
+inline SimdInt8 ToInt(SimdFloat8 a) { return _mm256_cvttps_epi32(a.v); }
+inline SimdFloat8 ToFloat(SimdInt8 a) { return _mm256_cvtepi32_ps(a.v); }
+inline SimdInt8 AsInt(SimdFloat8 a) { return _mm256_castps_si256(a.v); }
+inline SimdFloat8 AsFloat(SimdInt8 a) { return _mm256_castsi256_ps(a.v); }
+#else
+inline SimdInt8 ToInt(SimdFloat8 a) {
+  return {ToInt(a.Low()), ToInt(a.High())};
+}
+inline SimdFloat8 ToFloat(SimdInt8 a) {
+  return SimdFloat8(ToFloat(a.Low()), ToFloat(a.High()));
+}
+inline SimdInt8 AsInt(SimdFloat8 a) {
+  return {AsInt(a.Low()), AsInt(a.High())};
+}
+inline SimdFloat8 AsFloat(SimdInt8 a) {
+  return SimdFloat8(AsFloat(a.Low()), AsFloat(a.High()));
+}
+#endif
+
+//============================================================================
+// Lane types for code templated on the float type
+//============================================================================
+// IntLanes<F> is the integer type with F's lane count; plain float pairs
+// with uint32_t, whose ToInt/ToFloat below match the SIMD conversions.
+template <typename F> struct IntLanesOf {
+  using Type = uint32_t;
+};
+template <> struct IntLanesOf<SimdFloat4> {
+  using Type = SimdInt4;
+};
+template <> struct IntLanesOf<SimdFloat8> {
+  using Type = SimdInt8;
+};
+template <typename F> using IntLanes = typename IntLanesOf<F>::Type;
+
+inline uint32_t ToInt(float a) {
+  return static_cast<uint32_t>(static_cast<int32_t>(a));
+}
+inline float ToFloat(uint32_t a) {
+  return static_cast<float>(static_cast<int32_t>(a));
+}
+inline uint32_t AsInt(float a) {
+  uint32_t bits;
+  std::memcpy(&bits, &a, sizeof(bits));
+  return bits;
+}
+inline float AsFloat(uint32_t a) {
+  float value;
+  std::memcpy(&value, &a, sizeof(value));
+  return value;
+}
+
+} // namespace ENGINE_SIMD_NAMESPACE
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
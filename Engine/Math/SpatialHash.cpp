@@ -0,0 +1,428 @@
+#include "SpatialHash.h"
+#include "../Core/JobSystem.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace Engine {
+namespace Math {
+
+namespace {
+
+// Objects per job in Build(), and per job in FindPairs()
+constexpr uint32_t kObjectGrain = 16384;
+constexpr uint32_t kPairGrain = 4096;
+// Build() sorts by the top bits of the bucket first, into up to this many
+// ranges, then sorts each range on its own
+constexpr uint32_t kRangeBits = 6;
+constexpr uint32_t kMaxBucketBits = 30;
+// Bricks are up to 4 cells on a side
+constexpr uint32_t kMaxBrickBits = 2;
+// Cell coordinates stay well inside int32_t, so neighbours never overflow
+constexpr float kMaxCell = 1073741824.0f;
+
+uint32_t BitsFor(uint32_t count) {
+  uint32_t bits = 0;
+  while (bits < kMaxBucketBits && (1u << bits) < count) {
+    ++bits;
+  }
+  return bits;
+}
+
+// Floor without a libm call, which the SSE2 baseline cannot inline
+int32_t Coordinate(float value) {
+  const float clamped = std::min(std::max(value, -kMaxCell), kMaxCell);
+  const int32_t truncated = static_cast<int32_t>(clamped);
+  return truncated - (clamped < static_cast<float>(truncated) ? 1 : 0);
+}
+
+Vec3 CenterOf(const AABB &box) { return (box.min + box.max) * 0.5f; }
+
+// AABB::Intersects() without the early outs, which mispredict on the
+// near misses that neighbouring cells are full of
+bool Touches(const AABB &a, const AABB &b) {
+  return (a.min.x <= b.max.x) & (a.max.x >= b.min.x) & (a.min.y <= b.max.y) &
+         (a.max.y >= b.min.y) & (a.min.z <= b.max.z) & (a.max.z >= b.min.z);
+}
+
+// Chunks a ParallelFor() over 'count' splits into; chunk 'begin /
+// grainSize' runs [begin, end)
+uint32_t ChunkCount(uint32_t count, uint32_t grainSize) {
+  return (count + grainSize - 1) / grainSize;
+}
+
+struct Output {
+  Span<uint32_t> indices;
+  size_t count = 0;
+
+  bool IsFull() const { return count == indices.size(); }
+  void Add(uint32_t object) {
+    if (count < indices.size()) {
+      indices[count++] = object;
+    }
+  }
+};
+
+} // namespace
+
+//============================================================================
+// Cells and buckets
+//============================================================================
+SpatialHash::Cell SpatialHash::CellOf(const Vec3 &point) const {
+  return {Coordinate(point.x * m_InverseCellSize),
+          Coordinate(point.y * m_InverseCellSize),
+          Coordinate(point.z * m_InverseCellSize)};
+}
+
+// Cells group into bricks of up to 4x4x4 that hash with the usual large
+// primes, plus a final mix so that the bits the mask keeps depend on every
+// coordinate. A brick's cells take consecutive buckets, so neighbouring
+// cells mostly share cache lines and their objects sit next to each other.
+uint32_t SpatialHash::BucketOf(const Cell &cell) const {
+  const uint32_t bits = m_BrickBits;
+  const uint32_t mask = (1u << bits) - 1;
+  const uint32_t x = static_cast<uint32_t>(cell.X);
+  const uint32_t y = static_cast<uint32_t>(cell.Y);
+  const uint32_t z = static_cast<uint32_t>(cell.Z);
+  uint32_t hash = (x >> bits) * 73856093u ^ (y >> bits) * 19349663u ^
+                  (z >> bits) * 83492791u;
+  hash ^= hash >> 15;
+  hash *= 0x2C1B3C6Du;
+  hash ^= hash >> 12;
+  const uint32_t local =
+      (x & mask) | (y & mask) << bits | (z & mask) << 2 * bits;
+  return (hash << 3 * bits | local) & m_BucketMask;
+}
+
+size_t SpatialHash::GatherRuns(const Cell &first, const Cell &last,
+                               BucketRun *runs) const {
+  const int32_t brickMask = (1 << m_BrickBits) - 1;
+  size_t count = 0;
+  for (int32_t z = first.Z; z <= last.Z; ++z) {
+    for (int32_t y = first.Y; y <= last.Y; ++y) {
+      for (int32_t x = first.X; x <= last.X;) {
+        // The rest of the row within this brick
+        const int32_t end = std::min(last.X, x | brickMask);
+        runs[count++] = {BucketOf({x, y, z}), BucketOf({end, y, z})};
+        x = end + 1;
+      }
+    }
+  }
+  // Insertion sort, as there are few runs: 9 to 18 for the usual 27 cells.
+  // Bricks sharing buckets give overlapping runs, merged below.
+  for (size_t i = 1; i < count; ++i) {
+    const BucketRun run = runs[i];
+    size_t j = i;
+    for (; j > 0 && runs[j - 1].First > run.First; --j) {
+      runs[j] = runs[j - 1];
+    }
+    runs[j] = run;
+  }
+  size_t merged = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (merged > 0 && runs[i].First <= runs[merged - 1].Last + 1) {
+      runs[merged - 1].Last = std::max(runs[merged - 1].Last, runs[i].Last);
+    } else {
+      runs[merged++] = runs[i];
+    }
+  }
+  return merged;
+}
+
+size_t SpatialHash::GatherRuns(const Cell &first, const Cell &last,
+                               std::vector<BucketRun> &runs) const {
+  const uint64_t rows = static_cast<uint64_t>(int64_t(last.Y) - first.Y + 1) *
+                        static_cast<uint64_t>(int64_t(last.Z) - first.Z + 1);
+  const uint64_t length = static_cast<uint64_t>(int64_t(last.X) - first.X + 1);
+  // As many cells as buckets touch nearly all of them
+  if (rows * length >= GetBucketCount()) {
+    runs.assign(1, {0, m_BucketMask});
+    return 1;
+  }
+  runs.resize(static_cast<size_t>(rows * ((length >> m_BrickBits) + 2)));
+  return GatherRuns(first, last, runs.data());
+}
+
+template <typename Fn>
+void SpatialHash::ForEachRange(const Vec3 &min, const Vec3 &max,
+                               std::vector<BucketRun> &runs, Fn &&fn) const {
+  const size_t count = GatherRuns(CellOf(min), CellOf(max), runs);
+  for (size_t i = 0; i < count; ++i) {
+    const uint32_t begin = m_BucketStart[runs[i].First];
+    const uint32_t end = m_BucketStart[runs[i].Last + 1];
+    if (begin != end) {
+      fn(begin, end);
+    }
+  }
+}
+
+uint32_t SpatialHash::GetBucketOf(const Vec3 &point) const {
+  return BucketOf(CellOf(point));
+}
+
+Span<const uint32_t> SpatialHash::GetObjects(uint32_t bucket) const {
+  const uint32_t begin = m_BucketStart[bucket];
+  return Span<const uint32_t>(m_Objects.data() + begin,
+                              m_BucketStart[bucket + 1] - begin);
+}
+
+Span<const AABB> SpatialHash::GetBounds(uint32_t bucket) const {
+  const uint32_t begin = m_BucketStart[bucket];
+  return Span<const AABB>(m_Bounds.data() + begin,
+                          m_BucketStart[bucket + 1] - begin);
+}
+
+//============================================================================
+// Build
+//============================================================================
+void SpatialHash::Build(Span<const AABB> boxes,
+                        const SpatialHashSettings &settings) {
+  const uint32_t count = static_cast<uint32_t>(boxes.size());
+  std::vector<float> extents(ChunkCount(count, kObjectGrain), 0.0f);
+  JobSystem::ParallelFor(count, kObjectGrain, [&](uint32_t begin,
+                                                  uint32_t end) {
+    float largest = 0.0f;
+    for (uint32_t i = begin; i < end; ++i) {
+      const Vec3 extent = boxes[i].max - boxes[i].min;
+      largest = std::max(largest, std::max(extent.x, std::max(extent.y,
+                                                              extent.z)));
+    }
+    extents[begin / kObjectGrain] = largest;
+  });
+  float largest = 0.0f;
+  for (float extent : extents) {
+    largest = std::max(largest, extent);
+  }
+  BuildFrom(
+      count, [&](uint32_t i) -> const AABB & { return boxes[i]; },
+      largest * 0.5f, settings);
+}
+
+void SpatialHash::Build(Span<const Vec3> points,
+                        const SpatialHashSettings &settings) {
+  BuildFrom(
+      static_cast<uint32_t>(points.size()),
+      [&](uint32_t i) { return AABB(points[i], points[i]); }, 0.0f, settings);
+}
+
+// Counting sort in two passes. The first computes each object's bucket
+// and, per chunk of objects, how many fall in each range of buckets; the
+// chunks then scatter their objects into range order. The second sorts
+// each range by bucket on its own, with the range's slice of the bucket
+// table as counters. Both passes keep object order within a bucket.
+template <typename GetBox>
+void SpatialHash::BuildFrom(uint32_t count, const GetBox &getBox,
+                            float maxHalfExtent,
+                            const SpatialHashSettings &settings) {
+  m_MaxHalfExtent = maxHalfExtent;
+  m_CellSize = settings.CellSize > 0.0f ? settings.CellSize
+                                        : 2.0f * maxHalfExtent;
+  if (!(m_CellSize > 0.0f)) {
+    m_CellSize = 1.0f;
+  }
+  m_InverseCellSize = 1.0f / m_CellSize;
+
+  const uint32_t bucketBits =
+      BitsFor(settings.BucketCount > 0 ? settings.BucketCount : 2 * count);
+  const uint32_t rangeBits = std::min(bucketBits, kRangeBits);
+  const uint32_t rangeShift = bucketBits - rangeBits;
+  const uint32_t rangeCount = 1u << rangeBits;
+  m_BucketMask = (1u << bucketBits) - 1;
+  m_BrickBits = std::min(kMaxBrickBits, bucketBits / 3);
+  m_BucketStart.resize(size_t(m_BucketMask) + 2);
+  m_BucketStart.back() = count;
+  m_Objects.resize(count);
+  m_Bounds.resize(count);
+  m_Entries.resize(count);
+  m_Ranged.resize(count);
+
+  const uint32_t chunkCount = ChunkCount(count, kObjectGrain);
+  m_ChunkCounts.assign(size_t(chunkCount) * rangeCount, 0);
+  JobSystem::ParallelFor(count, kObjectGrain, [&](uint32_t begin,
+                                                  uint32_t end) {
+    uint32_t *counts =
+        m_ChunkCounts.data() + size_t(begin / kObjectGrain) * rangeCount;
+    for (uint32_t i = begin; i < end; ++i) {
+      const uint32_t bucket = BucketOf(CellOf(CenterOf(getBox(i))));
+      m_Entries[i] = {bucket, i};
+      ++counts[bucket >> rangeShift];
+    }
+  });
+
+  // Each chunk's first slot in each range, ranges first; 'rangeStart'
+  // keeps where each range begins
+  std::vector<uint32_t> rangeStart(rangeCount + 1);
+  uint32_t slot = 0;
+  for (uint32_t range = 0; range < rangeCount; ++range) {
+    rangeStart[range] = slot;
+    for (uint32_t chunk = 0; chunk < chunkCount; ++chunk) {
+      uint32_t &entries = m_ChunkCounts[size_t(chunk) * rangeCount + range];
+      const uint32_t chunkEntries = entries;
+      entries = slot;
+      slot += chunkEntries;
+    }
+  }
+  rangeStart[rangeCount] = slot;
+
+  JobSystem::ParallelFor(count, kObjectGrain, [&](uint32_t begin,
+                                                  uint32_t end) {
+    uint32_t *cursor =
+        m_ChunkCounts.data() + size_t(begin / kObjectGrain) * rangeCount;
+    for (uint32_t i = begin; i < end; ++i) {
+      const Entry entry = m_Entries[i];
+      m_Ranged[cursor[entry.Bucket >> rangeShift]++] = entry;
+    }
+  });
+
+  JobSystem::ParallelFor(rangeCount, 1, [&](uint32_t begin, uint32_t end) {
+    for (uint32_t range = begin; range < end; ++range) {
+      uint32_t *start = m_BucketStart.data() + (size_t(range) << rangeShift);
+      const uint32_t bucketCount = 1u << rangeShift;
+      const uint32_t first = rangeStart[range];
+      const uint32_t last = rangeStart[range + 1];
+      std::fill(start, start + bucketCount, 0u);
+      for (uint32_t i = first; i < last; ++i) {
+        ++start[m_Ranged[i].Bucket & (bucketCount - 1)];
+      }
+      // Counts to bucket ends; filling backwards then leaves each counter
+      // at its bucket's start
+      uint32_t end = first;
+      for (uint32_t bucket = 0; bucket < bucketCount; ++bucket) {
+        end += start[bucket];
+        start[bucket] = end;
+      }
+      for (uint32_t i = last; i-- > first;) {
+        const Entry entry = m_Ranged[i];
+        const uint32_t slot = --start[entry.Bucket & (bucketCount - 1)];
+        m_Objects[slot] = entry.Object;
+        m_Bounds[slot] = getBox(entry.Object);
+      }
+    }
+  });
+}
+
+void SpatialHash::Clear() {
+  m_CellSize = 1.0f;
+  m_InverseCellSize = 1.0f;
+  m_MaxHalfExtent = 0.0f;
+  m_BucketMask = 0;
+  m_BrickBits = 0;
+  m_BucketStart.assign(2, 0);
+  m_Objects.clear();
+  m_Bounds.clear();
+  m_Entries.clear();
+  m_Ranged.clear();
+  m_ChunkCounts.clear();
+}
+
+//============================================================================
+// Queries
+//============================================================================
+size_t SpatialHash::Overlap(const Sphere &sphere,
+                            Span<uint32_t> indices) const {
+  Output out{indices};
+  // Boxes reach at most m_MaxHalfExtent past the center that picked their
+  // cell
+  const Vec3 reach(sphere.radius + m_MaxHalfExtent);
+  std::vector<BucketRun> runs;
+  ForEachRange(sphere.center - reach, sphere.center + reach, runs,
+               [&](uint32_t begin, uint32_t end) {
+                 for (uint32_t slot = begin; slot < end; ++slot) {
+                   if (sphere.Intersects(m_Bounds[slot])) {
+                     out.Add(m_Objects[slot]);
+                   }
+                 }
+               });
+  return out.count;
+}
+
+size_t SpatialHash::Overlap(const AABB &box, Span<uint32_t> indices) const {
+  Output out{indices};
+  const Vec3 reach(m_MaxHalfExtent);
+  std::vector<BucketRun> runs;
+  ForEachRange(box.min - reach, box.max + reach, runs,
+               [&](uint32_t begin, uint32_t end) {
+                 for (uint32_t slot = begin; slot < end; ++slot) {
+                   if (box.Intersects(m_Bounds[slot])) {
+                     out.Add(m_Objects[slot]);
+                   }
+                 }
+               });
+  return out.count;
+}
+
+void SpatialHash::Overlap(Span<const Sphere> spheres,
+                          std::vector<uint32_t> &offsets,
+                          std::vector<uint32_t> &indices,
+                          uint32_t grainSize) const {
+  assert(grainSize > 0);
+  const uint32_t count = static_cast<uint32_t>(spheres.size());
+  offsets.assign(size_t(count) + 1, 0);
+  std::vector<std::vector<uint32_t>> found(ChunkCount(count, grainSize));
+  JobSystem::ParallelFor(count, grainSize, [&](uint32_t begin,
+                                               uint32_t end) {
+    std::vector<uint32_t> &out = found[begin / grainSize];
+    std::vector<BucketRun> runs;
+    for (uint32_t i = begin; i < end; ++i) {
+      const Sphere &sphere = spheres[i];
+      const size_t before = out.size();
+      const Vec3 reach(sphere.radius + m_MaxHalfExtent);
+      ForEachRange(sphere.center - reach, sphere.center + reach, runs,
+                   [&](uint32_t first, uint32_t last) {
+                     for (uint32_t slot = first; slot < last; ++slot) {
+                       if (sphere.Intersects(m_Bounds[slot])) {
+                         out.push_back(m_Objects[slot]);
+                       }
+                     }
+                   });
+      offsets[i + 1] = static_cast<uint32_t>(out.size() - before);
+    }
+  });
+
+  for (uint32_t i = 0; i < count; ++i) {
+    offsets[i + 1] += offsets[i];
+  }
+  indices.resize(offsets[count]);
+  for (size_t chunk = 0; chunk < found.size(); ++chunk) {
+    std::copy(found[chunk].begin(), found[chunk].end(),
+              indices.begin() + offsets[chunk * grainSize]);
+  }
+}
+
+// Each object looks for boxes whose centers are within its reach and
+// keeps those in later slots, so a pair is found from its first slot only
+void SpatialHash::FindPairs(std::vector<SpatialPair> &pairs) const {
+  const uint32_t count = static_cast<uint32_t>(m_Objects.size());
+  std::vector<std::vector<SpatialPair>> found(ChunkCount(count, kPairGrain));
+  JobSystem::ParallelFor(count, kPairGrain, [&](uint32_t begin,
+                                                uint32_t end) {
+    std::vector<SpatialPair> &out = found[begin / kPairGrain];
+    std::vector<BucketRun> runs;
+    const Vec3 reach(m_MaxHalfExtent);
+    for (uint32_t slot = begin; slot < end; ++slot) {
+      const AABB &box = m_Bounds[slot];
+      const uint32_t object = m_Objects[slot];
+      ForEachRange(box.min - reach, box.max + reach, runs,
+                   [&](uint32_t first, uint32_t last) {
+                     for (uint32_t other = std::max(first, slot + 1);
+                          other < last; ++other) {
+                       if (Touches(box, m_Bounds[other])) {
+                         const uint32_t second = m_Objects[other];
+                         out.push_back(object < second
+                                           ? SpatialPair(object, second)
+                                           : SpatialPair(second, object));
+                       }
+                     }
+                   });
+    }
+  });
+
+  pairs.clear();
+  for (const std::vector<SpatialPair> &chunk : found) {
+    pairs.insert(pairs.end(), chunk.begin(), chunk.end());
+  }
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
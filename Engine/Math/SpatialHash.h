@@ -0,0 +1,155 @@
+#pragma once
+
+// Hashed uniform grid over boxes or points, rebuilt from scratch every
+// frame. Each object goes to the grid cell holding its center, cells hash
+// into a power-of-two bucket table, and Build() counting-sorts the objects
+// by bucket so that a bucket's objects and boxes are contiguous. With the
+// default cell size, the largest box extent, boxes that overlap sit in
+// neighbouring cells: pairs and neighbours come from the 27 cells around
+// an object.
+//
+// Build() sorts by the top bits of the bucket first and then within each
+// of those ranges, running the chunks of both passes as jobs; FindPairs()
+// and the batched Overlap() split their work into jobs as well.
+
+#include "../Core/Span.h"
+#include "Math.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Engine {
+namespace Math {
+
+struct SpatialHashSettings {
+  // Edge of a grid cell; 0 uses the largest extent of any box, or 1 when
+  // every box is a point
+  float CellSize = 0.0f;
+  // Rounded up to a power of two; 0 uses twice the object count. Cells
+  // sharing a bucket cost time in queries, not correctness.
+  uint32_t BucketCount = 0;
+};
+
+// Two objects, the smaller index first
+using SpatialPair = std::pair<uint32_t, uint32_t>;
+
+//============================================================================
+// SpatialHash - Uniform grid hashed into sorted bucket ranges
+//============================================================================
+// Object i is the i-th box or point passed to Build(). Queries are const
+// and may run concurrently; Build() may not overlap them.
+class SpatialHash {
+public:
+  void Build(Span<const AABB> boxes, const SpatialHashSettings &settings = {});
+  // Points are boxes without extent
+  void Build(Span<const Vec3> points,
+             const SpatialHashSettings &settings = {});
+
+  void Clear();
+
+  // Writes the indices of the objects intersecting the volume, in no
+  // particular order, and returns how many there are; stops once 'indices'
+  // is full
+  size_t Overlap(const Sphere &sphere, Span<uint32_t> indices) const;
+  size_t Overlap(const AABB &box, Span<uint32_t> indices) const;
+  // One sphere query per job chunk: the objects for 'spheres[i]' are
+  // 'indices' from 'offsets[i]' up to 'offsets[i + 1]'
+  void Overlap(Span<const Sphere> spheres, std::vector<uint32_t> &offsets,
+               std::vector<uint32_t> &indices,
+               uint32_t grainSize = 256) const;
+
+  // Every pair of objects whose boxes intersect, each once
+  void FindPairs(std::vector<SpatialPair> &pairs) const;
+
+  // Calls fn(object, box) once for each object in the 27 cells around the
+  // one holding 'point'. Objects of other cells that share their buckets
+  // come along too, so callers still test distances.
+  template <typename Fn> void ForEachNeighbor(const Vec3 &point, Fn &&fn) const;
+
+  bool IsEmpty() const { return m_Objects.empty(); }
+  size_t GetObjectCount() const { return m_Objects.size(); }
+  uint32_t GetBucketCount() const { return m_BucketMask + 1; }
+  float GetCellSize() const { return m_CellSize; }
+  // Half the largest box extent: how far a box reaches past its center
+  float GetMaxHalfExtent() const { return m_MaxHalfExtent; }
+
+  // Bucket of the cell holding a point, and the objects in a bucket, in
+  // increasing order, with their boxes
+  uint32_t GetBucketOf(const Vec3 &point) const;
+  Span<const uint32_t> GetObjects(uint32_t bucket) const;
+  Span<const AABB> GetBounds(uint32_t bucket) const;
+
+private:
+  struct Cell {
+    int32_t X, Y, Z;
+  };
+
+  // An object's bucket, as computed and then sorted by Build()
+  struct Entry {
+    uint32_t Bucket;
+    uint32_t Object;
+  };
+
+  // Buckets 'First' to 'Last', which hold consecutive slots
+  struct BucketRun {
+    uint32_t First, Last;
+  };
+
+  Cell CellOf(const Vec3 &point) const;
+  uint32_t BucketOf(const Cell &cell) const;
+  // Writes the runs of consecutive buckets holding the cells from 'first'
+  // to 'last', in increasing order and without overlaps, and returns how
+  // many there are: at most one per row of cells and brick
+  size_t GatherRuns(const Cell &first, const Cell &last,
+                    BucketRun *runs) const;
+  // The same into 'runs', or a single run of every bucket when there are
+  // as many cells as buckets
+  size_t GatherRuns(const Cell &first, const Cell &last,
+                    std::vector<BucketRun> &runs) const;
+  // Calls fn(begin, end) for the slot ranges of the buckets whose cells
+  // may hold centers between 'min' and 'max'
+  template <typename Fn>
+  void ForEachRange(const Vec3 &min, const Vec3 &max,
+                    std::vector<BucketRun> &runs, Fn &&fn) const;
+  template <typename GetBox>
+  void BuildFrom(uint32_t count, const GetBox &getBox, float maxHalfExtent,
+                 const SpatialHashSettings &settings);
+
+private:
+  float m_CellSize = 1.0f;
+  float m_InverseCellSize = 1.0f;
+  float m_MaxHalfExtent = 0.0f;
+  uint32_t m_BucketMask = 0;
+  // Bricks of cells are 1 << m_BrickBits cells on a side
+  uint32_t m_BrickBits = 0;
+  // Slot of each bucket's first object, plus the object count at the end
+  std::vector<uint32_t> m_BucketStart = {0, 0};
+  // Objects and their boxes, sorted by bucket
+  std::vector<uint32_t> m_Objects;
+  std::vector<AABB> m_Bounds;
+  // Build() scratch, kept from frame to frame
+  std::vector<Entry> m_Entries;
+  std::vector<Entry> m_Ranged;
+  std::vector<uint32_t> m_ChunkCounts;
+};
+
+template <typename Fn>
+void SpatialHash::ForEachNeighbor(const Vec3 &point, Fn &&fn) const {
+  if (IsEmpty()) {
+    return;
+  }
+  const Cell cell = CellOf(point);
+  BucketRun runs[27];
+  const size_t count =
+      GatherRuns({cell.X - 1, cell.Y - 1, cell.Z - 1},
+                 {cell.X + 1, cell.Y + 1, cell.Z + 1}, runs);
+  for (size_t i = 0; i < count; ++i) {
+    const uint32_t end = m_BucketStart[runs[i].Last + 1];
+    for (uint32_t slot = m_BucketStart[runs[i].First]; slot < end; ++slot) {
+      fn(m_Objects[slot], m_Bounds[slot]);
+    }
+  }
+}
+
+} // namespace Math
+} // namespace Engine
\ No newline at end of file
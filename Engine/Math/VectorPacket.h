@@ -0,0 +1,505 @@
+#pragma once
+
+// Structure-of-arrays vector packets for batch math. Each packet holds
+// Width vectors with one SIMD register per component, so dot products,
+// cross products and normalization run on all lanes without horizontal
+// adds or shuffles.
+
+#include "Quaternion.h"
+#include "Simd.h"
+#include "Vector.h"
+#include <cstddef>
+
+namespace Engine {
+namespace Math {
+
+namespace Detail {
+
+// Transposes four rows of four floats ('stride' floats apart) into four
+// component registers
+inline void LoadRows4(const float *rows, size_t stride, SimdFloat4 (&out)[4]) {
+  __m128 r0 = _mm_loadu_ps(rows);
+  __m128 r1 = _mm_loadu_ps(rows + stride);
+  __m128 r2 = _mm_loadu_ps(rows + stride * 2);
+  __m128 r3 = _mm_loadu_ps(rows + stride * 3);
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+  out[0] = r0;
+  out[1] = r1;
+  out[2] = r2;
+  out[3] = r3;
+}
+
+inline void StoreRows4(float *rows, size_t stride,
+                       const SimdFloat4 (&in)[4]) {
+  __m128 r0 = in[0].v, r1 = in[1].v, r2 = in[2].v, r3 = in[3].v;
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+  _mm_storeu_ps(rows, r0);
+  _mm_storeu_ps(rows + stride, r1);
+  _mm_storeu_ps(rows + stride * 2, r2);
+  _mm_storeu_ps(rows + stride * 3, r3);
+}
+
+// Four tightly packed xyz triples (12 floats) to and from components
+inline void LoadPacked4(const float *xyz, SimdFloat4 (&out)[3]) {
+  __m128 p0 = _mm_loadu_ps(xyz);     // x0 y0 z0 x1
+  __m128 p1 = _mm_loadu_ps(xyz + 4); // y1 z1 x2 y2
+  __m128 p2 = _mm_loadu_ps(xyz + 8); // z2 x3 y3 z3
+  __m128 t0 = _mm_shuffle_ps(p1, p2, _MM_SHUFFLE(2, 1, 3, 2)); // x2 y2 x3 y3
+  __m128 t1 = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(1, 0, 2, 1)); // y0 z0 y1 z1
+  out[0] = _mm_shuffle_ps(p0, t0, _MM_SHUFFLE(2, 0, 3, 0));
+  out[1] = _mm_shuffle_ps(t1, t0, _MM_SHUFFLE(3, 1, 2, 0));
+  out[2] = _mm_shuffle_ps(t1, p2, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+inline void StorePacked4(float *xyz, const SimdFloat4 (&in)[3]) {
+  __m128 x = in[0].v, y = in[1].v, z = in[2].v;
+  __m128 xyLow = _mm_unpacklo_ps(x, y);  // x0 y0 x1 y1
+  __m128 xyHigh = _mm_unpackhi_ps(x, y); // x2 y2 x3 y3
+  __m128 m0 = _mm_shuffle_ps(z, xyLow, _MM_SHUFFLE(2, 2, 0, 0));
+  __m128 m1 = _mm_shuffle_ps(xyLow, z, _MM_SHUFFLE(1, 1, 3, 3));
+  __m128 m2 = _mm_shuffle_ps(z, xyHigh, _MM_SHUFFLE(2, 2, 2, 2));
+  __m128 m3 = _mm_shuffle_ps(xyHigh, z, _MM_SHUFFLE(3, 3, 3, 3));
+  _mm_storeu_ps(xyz, _mm_shuffle_ps(xyLow, m0, _MM_SHUFFLE(2, 0, 1, 0)));
+  _mm_storeu_ps(xyz + 4, _mm_shuffle_ps(m1, xyHigh, _MM_SHUFFLE(1, 0, 2, 0)));
+  _mm_storeu_ps(xyz + 8, _mm_shuffle_ps(m2, m3, _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+// Width-generic wrappers; 8-wide packets are handled as two 4-wide halves
+template <typename F, int N>
+void LoadRows(const float *rows, size_t stride, F (&out)[N]) {
+  static_assert(N <= 4, "At most four components per row");
+  SimdFloat4 low[4];
+  LoadRows4(rows, stride, low);
+  if constexpr (F::Width == 4) {
+    for (int i = 0; i < N; ++i) {
+      out[i] = low[i];
+    }
+  } else {
+    SimdFloat4 high[4];
+    LoadRows4(rows + stride * 4, stride, high);
+    for (int i = 0; i < N; ++i) {
+      out[i] = F(low[i], high[i]);
+    }
+  }
+}
+
+template <typename F, int N>
+void StoreRows(float *rows, size_t stride, const F (&in)[N],
+               float fill = 0.0f) {
+  static_assert(N <= 4, "At most four components per row");
+  SimdFloat4 low[4] = {fill, fill, fill, fill};
+  if constexpr (F::Width == 4) {
+    for (int i = 0; i < N; ++i) {
+      low[i] = in[i];
+    }
+    StoreRows4(rows, stride, low);
+  } else {
+    SimdFloat4 high[4] = {fill, fill, fill, fill};
+    for (int i = 0; i < N; ++i) {
+      low[i] = in[i].Low();
+      high[i] = in[i].High();
+    }
+    StoreRows4(rows, stride, low);
+    StoreRows4(rows + stride * 4, stride, high);
+  }
+}
+
+template <typename F> void LoadPacked(const float *xyz, F (&out)[3]) {
+  SimdFloat4 low[3];
+  LoadPacked4(xyz, low);
+  if constexpr (F::Width == 4) {
+    for (int i = 0; i < 3; ++i) {
+      out[i] = low[i];
+    }
+  } else {
+    SimdFloat4 high[3];
+    LoadPacked4(xyz + 12, high);
+    for (int i = 0; i < 3; ++i) {
+      out[i] = F(low[i], high[i]);
+    }
+  }
+}
+
+template <typename F> void StorePacked(float *xyz, const F (&in)[3]) {
+  if constexpr (F::Width == 4) {
+    SimdFloat4 low[3] = {in[0], in[1], in[2]};
+    StorePacked4(xyz, low);
+  } else {
+    SimdFloat4 low[3] = {in[0].Low(), in[1].Low(), in[2].Low()};
+    SimdFloat4 high[3] = {in[0].High(), in[1].High(), in[2].High()};
+    StorePacked4(xyz, low);
+    StorePacked4(xyz + 12, high);
+  }
+}
+
+} // namespace Detail
+
+//============================================================================
+// Vec3Packet - Width 3D vectors in SoA form
+//============================================================================
+template <typename F> struct Vec3Packet {
+  F x, y, z;
+
+  static constexpr int Width = F::Width;
+
+  Vec3Packet() = default;
+  Vec3Packet(F x, F y, F z) : x(x), y(y), z(z) {}
+  explicit Vec3Packet(const Vec3 &v) : x(v.x), y(v.y), z(v.z) {}
+
+  static Vec3Packet Zero() {
+    return Vec3Packet(F::Zero(), F::Zero(), F::Zero());
+  }
+
+  // Width consecutive vectors
+  static Vec3Packet Load(const Vec3 *vectors) {
+    F lanes[3];
+    Detail::LoadRows(&vectors[0].x, 4, lanes);
+    return Vec3Packet(lanes[0], lanes[1], lanes[2]);
+  }
+
+  // The first 'count' lanes from 'vectors', the rest zero
+  static Vec3Packet Load(const Vec3 *vectors, int count) {
+    Vec3 padded[Width];
+    for (int i = 0; i < count && i < Width; ++i) {
+      padded[i] = vectors[i];
+    }
+    return Load(padded);
+  }
+
+  // Width tightly packed x, y, z triples, e.g. vertex positions
+  static Vec3Packet LoadPacked(const float *xyz) {
+    F lanes[3];
+    Detail::LoadPacked(xyz, lanes);
+    return Vec3Packet(lanes[0], lanes[1], lanes[2]);
+  }
+
+  void Store(Vec3 *vectors) const {
+    const F lanes[3] = {x, y, z};
+    Detail::StoreRows(&vectors[0].x, 4, lanes);
+  }
+
+  void Store(Vec3 *vectors, int count) const {
+    Vec3 padded[Width];
+    Store(padded);
+    for (int i = 0; i < count && i < Width; ++i) {
+      vectors[i] = padded[i];
+    }
+  }
+
+  void StorePacked(float *xyz) const {
+    const F lanes[3] = {x, y, z};
+    Detail::StorePacked(xyz, lanes);
+  }
+
+  Vec3 GetLane(int lane) const { return Vec3(x[lane], y[lane], z[lane]); }
+
+  Vec3Packet operator+(const Vec3Packet &o) const {
+    return Vec3Packet(x + o.x, y + o.y, z + o.z);
+  }
+  Vec3Packet operator-(const Vec3Packet &o) const {
+    return Vec3Packet(x - o.x, y - o.y, z - o.z);
+  }
+  Vec3Packet operator*(const Vec3Packet &o) const {
+    return Vec3Packet(x * o.x, y * o.y, z * o.z);
+  }
+  Vec3Packet operator/(const Vec3Packet &o) const {
+    return Vec3Packet(x / o.x, y / o.y, z / o.z);
+  }
+  Vec3Packet operator*(F s) const { return Vec3Packet(x * s, y * s, z * s); }
+  Vec3Packet operator/(F s) const {
+    F inverse = F(1.0f) / s;
+    return Vec3Packet(x * inverse, y * inverse, z * inverse);
+  }
+  Vec3Packet operator-() const { return Vec3Packet(-x, -y, -z); }
+
+  Vec3Packet &operator+=(const Vec3Packet &o) { return *this = *this + o; }
+  Vec3Packet &operator-=(const Vec3Packet &o) { return *this = *this - o; }
+  Vec3Packet &operator*=(F s) { return *this = *this * s; }
+};
+
+template <typename F>
+Vec3Packet<F> operator*(F s, const Vec3Packet<F> &v) {
+  return v * s;
+}
+
+template <typename F> F Dot(const Vec3Packet<F> &a, const Vec3Packet<F> &b) {
+  return MulAdd(a.x, b.x, MulAdd(a.y, b.y, a.z * b.z));
+}
+
+template <typename F>
+Vec3Packet<F> Cross(const Vec3Packet<F> &a, const Vec3Packet<F> &b) {
+  return Vec3Packet<F>(NegMulAdd(a.z, b.y, a.y * b.z),
+                       NegMulAdd(a.x, b.z, a.z * b.x),
+                       NegMulAdd(a.y, b.x, a.x * b.y));
+}
+
+template <typename F> F LengthSquared(const Vec3Packet<F> &v) {
+  return Dot(v, v);
+}
+
+template <typename F> F Length(const Vec3Packet<F> &v) {
+  return Sqrt(Dot(v, v));
+}
+
+// Lanes shorter than EPSILON become zero, matching Vec3::Normalized
+template <typename F> Vec3Packet<F> Normalize(const Vec3Packet<F> &v) {
+  F length = Length(v);
+  F valid = length >= F(EPSILON);
+  F scale = Select(valid, F(1.0f) / length, F::Zero());
+  return v * scale;
+}
+
+// Approximate normalization through RSqrt, ~22 bits; no zero-length guard
+template <typename F> Vec3Packet<F> NormalizeFast(const Vec3Packet<F> &v) {
+  return v * RSqrt(Dot(v, v));
+}
+
+template <typename F>
+Vec3Packet<F> Lerp(const Vec3Packet<F> &a, const Vec3Packet<F> &b, F t) {
+  return Vec3Packet<F>(MulAdd(b.x - a.x, t, a.x), MulAdd(b.y - a.y, t, a.y),
+                       MulAdd(b.z - a.z, t, a.z));
+}
+
+template <typename F>
+Vec3Packet<F> Select(F mask, const Vec3Packet<F> &a, const Vec3Packet<F> &b) {
+  return Vec3Packet<F>(Select(mask, a.x, b.x), Select(mask, a.y, b.y),
+                       Select(mask, a.z, b.z));
+}
+
+template <typename F>
+Vec3Packet<F> Min(const Vec3Packet<F> &a, const Vec3Packet<F> &b) {
+  return Vec3Packet<F>(Min(a.x, b.x), Min(a.y, b.y), Min(a.z, b.z));
+}
+
+template <typename F>
+Vec3Packet<F> Max(const Vec3Packet<F> &a, const Vec3Packet<F> &b) {
+  return Vec3Packet<F>(Max(a.x, b.x), Max(a.y, b.y), Max(a.z, b.z));
+}
+
+//============================================================================
+// Vec4Packet - Width 4D vectors in SoA form
+//============================================================================
+template <typename F> struct Vec4Packet {
+  F x, y, z, w;
+
+  static constexpr int Width = F::Width;
+
+  Vec4Packet() = default;
+  Vec4Packet(F x, F y, F z, F w) : x(x), y(y), z(z), w(w) {}
+  Vec4Packet(const Vec3Packet<F> &xyz, F w)
+      : x(xyz.x), y(xyz.y), z(xyz.z), w(w) {}
+  explicit Vec4Packet(const Vec4 &v) : x(v.x), y(v.y), z(v.z), w(v.w) {}
+
+  static Vec4Packet Zero() {
+    return Vec4Packet(F::Zero(), F::Zero(), F::Zero(), F::Zero());
+  }
+
+  static Vec4Packet Load(const Vec4 *vectors) {
+    F lanes[4];
+    Detail::LoadRows(&vectors[0].x, 4, lanes);
+    return Vec4Packet(lanes[0], lanes[1], lanes[2], lanes[3]);
+  }
+
+  static Vec4Packet Load(const Vec4 *vectors, int count) {
+    Vec4 padded[Width];
+    for (int i = 0; i < count && i < Width; ++i) {
+      padded[i] = vectors[i];
+    }
+    return Load(padded);
+  }
+
+  void Store(Vec4 *vectors) const {
+    const F lanes[4] = {x, y, z, w};
+    Detail::StoreRows(&vectors[0].x, 4, lanes);
+  }
+
+  void Store(Vec4 *vectors, int count) const {
+    Vec4 padded[Width];
+    Store(padded);
+    for (int i = 0; i < count && i < Width; ++i) {
+      vectors[i] = padded[i];
+    }
+  }
+
+  Vec4 GetLane(int lane) const {
+    return Vec4(x[lane], y[lane], z[lane], w[lane]);
+  }
+  Vec3Packet<F> XYZ() const { return Vec3Packet<F>(x, y, z); }
+
+  Vec4Packet operator+(const Vec4Packet &o) const {
+    return Vec4Packet(x + o.x, y + o.y, z + o.z, w + o.w);
+  }
+  Vec4Packet operator-(const Vec4Packet &o) const {
+    return Vec4Packet(x - o.x, y - o.y, z - o.z, w - o.w);
+  }
+  Vec4Packet operator*(const Vec4Packet &o) const {
+    return Vec4Packet(x * o.x, y * o.y, z * o.z, w * o.w);
+  }
+  Vec4Packet operator*(F s) const {
+    return Vec4Packet(x * s, y * s, z * s, w * s);
+  }
+  Vec4Packet operator/(F s) const {
+    F inverse = F(1.0f) / s;
+    return Vec4Packet(x * inverse, y * inverse, z * inverse, w * inverse);
+  }
+  Vec4Packet operator-() const { return Vec4Packet(-x, -y, -z, -w); }
+
+  Vec4Packet &operator+=(const Vec4Packet &o) { return *this = *this + o; }
+  Vec4Packet &operator-=(const Vec4Packet &o) { return *this = *this - o; }
+  Vec4Packet &operator*=(F s) { return *this = *this * s; }
+};
+
+template <typename F> F Dot(const Vec4Packet<F> &a, const Vec4Packet<F> &b) {
+  return MulAdd(a.x, b.x, MulAdd(a.y, b.y, MulAdd(a.z, b.z, a.w * b.w)));
+}
+
+template <typename F> F Length(const Vec4Packet<F> &v) {
+  return Sqrt(Dot(v, v));
+}
+
+template <typename F> Vec4Packet<F> Normalize(const Vec4Packet<F> &v) {
+  F length = Length(v);
+  F valid = length >= F(EPSILON);
+  return v * Select(valid, F(1.0f) / length, F::Zero());
+}
+
+template <typename F>
+Vec4Packet<F> Select(F mask, const Vec4Packet<F> &a, const Vec4Packet<F> &b) {
+  return Vec4Packet<F>(Select(mask, a.x, b.x), Select(mask, a.y, b.y),
+                       Select(mask, a.z, b.z), Select(mask, a.w, b.w));
+}
+
+//============================================================================
+// QuatPacket - Width quaternions in SoA form
+//============================================================================
+template <typename F> struct QuatPacket {
+  F x, y, z, w;
+
+  static constexpr int Width = F::Width;
+
+  QuatPacket() = default;
+  QuatPacket(F x, F y, F z, F w) : x(x), y(y), z(z), w(w) {}
+  explicit QuatPacket(const Quaternion &q) : x(q.x), y(q.y), z(q.z), w(q.w) {}
+
+  static QuatPacket Identity() {
+    return QuatPacket(F::Zero(), F::Zero(), F::Zero(), F(1.0f));
+  }
+
+  static QuatPacket Load(const Quaternion *quaternions) {
+    F lanes[4];
+    Detail::LoadRows(&quaternions[0].x, 4, lanes);
+    return QuatPacket(lanes[0], lanes[1], lanes[2], lanes[3]);
+  }
+
+  static QuatPacket Load(const Quaternion *quaternions, int count) {
+    Quaternion padded[Width];
+    for (int i = 0; i < count && i < Width; ++i) {
+      padded[i] = quaternions[i];
+    }
+    return Load(padded);
+  }
+
+  void Store(Quaternion *quaternions) const {
+    const F lanes[4] = {x, y, z, w};
+    Detail::StoreRows(&quaternions[0].x, 4, lanes);
+  }
+
+  void Store(Quaternion *quaternions, int count) const {
+    Quaternion padded[Width];
+    Store(padded);
+    for (int i = 0; i < count && i < Width; ++i) {
+      quaternions[i] = padded[i];
+    }
+  }
+
+  Quaternion GetLane(int lane) const {
+    return Quaternion(x[lane], y[lane], z[lane], w[lane]);
+  }
+  Vec3Packet<F> XYZ() const { return Vec3Packet<F>(x, y, z); }
+
+  // Hamilton product, same convention as Quaternion::operator*
+  QuatPacket operator*(const QuatPacket &o) const {
+    return QuatPacket(
+        MulAdd(w, o.x, MulAdd(x, o.w, NegMulAdd(z, o.y, y * o.z))),
+        MulAdd(w, o.y, MulAdd(y, o.w, NegMulAdd(x, o.z, z * o.x))),
+        MulAdd(w, o.z, MulAdd(z, o.w, NegMulAdd(y, o.x, x * o.y))),
+        NegMulAdd(x, o.x, NegMulAdd(y, o.y, NegMulAdd(z, o.z, w * o.w))));
+  }
+
+  QuatPacket Conjugate() const { return QuatPacket(-x, -y, -z, w); }
+};
+
+template <typename F> F Dot(const QuatPacket<F> &a, const QuatPacket<F> &b) {
+  return MulAdd(a.x, b.x, MulAdd(a.y, b.y, MulAdd(a.z, b.z, a.w * b.w)));
+}
+
+// Zero-length lanes become the identity, matching Quaternion::Normalized
+template <typename F> QuatPacket<F> Normalize(const QuatPacket<F> &q) {
+  F length = Sqrt(Dot(q, q));
+  F valid = length >= F(EPSILON);
+  F scale = F(1.0f) / Select(valid, length, F(1.0f));
+  QuatPacket<F> normalized(q.x * scale, q.y * scale, q.z * scale,
+                           q.w * scale);
+  QuatPacket<F> identity = QuatPacket<F>::Identity();
+  return QuatPacket<F>(
+      Select(valid, normalized.x, identity.x),
+      Select(valid, normalized.y, identity.y),
+      Select(valid, normalized.z, identity.z),
+      Select(valid, normalized.w, identity.w));
+}
+
+// Rotates by unit quaternions: v + w * t + q.xyz x t with t = 2 (q.xyz x v),
+// two cross products instead of two full quaternion products
+template <typename F>
+Vec3Packet<F> RotateVector(const QuatPacket<F> &q, const Vec3Packet<F> &v) {
+  Vec3Packet<F> axis = q.XYZ();
+  Vec3Packet<F> t = Cross(axis, v) * F(2.0f);
+  Vec3Packet<F> result = Cross(axis, t);
+  result.x = MulAdd(q.w, t.x, result.x + v.x);
+  result.y = MulAdd(q.w, t.y, result.y + v.y);
+  result.z = MulAdd(q.w, t.z, result.z + v.z);
+  return result;
+}
+
+// Normalized lerp along the shorter arc, matching Quaternion::Lerp
+template <typename F>
+QuatPacket<F> Lerp(const QuatPacket<F> &a, const QuatPacket<F> &b, F t) {
+  F wa = F(1.0f) - t;
+  F wb = Select(Dot(a, b) < F::Zero(), -t, t);
+  return Normalize(QuatPacket<F>(MulAdd(a.x, wa, b.x * wb),
+                                 MulAdd(a.y, wa, b.y * wb),
+                                 MulAdd(a.z, wa, b.z * wb),
+                                 MulAdd(a.w, wa, b.w * wb)));
+}
+
+// Polynomial slerp along the shorter arc, matching Quaternion::SlerpFast
+template <typename F>
+QuatPacket<F> SlerpFast(const QuatPacket<F> &a, const QuatPacket<F> &b, F t) {
+  F dot = Dot(a, b);
+  F cosMinusOne = Abs(dot) - F(1.0f);
+  F wa = Detail::SlerpWeight(F(1.0f) - t, cosMinusOne);
+  F wb = Detail::SlerpWeight(t, cosMinusOne);
+  wb = Select(dot < F::Zero(), -wb, wb);
+  return Normalize(QuatPacket<F>(MulAdd(a.x, wa, b.x * wb),
+                                 MulAdd(a.y, wa, b.y * wb),
+                                 MulAdd(a.z, wa, b.z * wb),
+                                 MulAdd(a.w, wa, b.w * wb)));
+}
+
+using Vec3x4 = Vec3Packet<SimdFloat4>;
+using Vec3x8 = Vec3Packet<SimdFloat8>;
+using Vec4x4 = Vec4Packet<SimdFloat4>;
+using Vec4x8 = Vec4Packet<SimdFloat8>;
+using QuatX4 = QuatPacket<SimdFloat4>;
+using QuatX8 = QuatPacket<SimdFloat8>;
+
+} // namespace Math
+} // namespace Engine
+
+// Convenience typedefs matching Math.h
+using Vec3x4 = Engine::Math::Vec3x4;
+using Vec3x8 = Engine::Math::Vec3x8;
+using Vec4x4 = Engine::Math::Vec4x4;
+using Vec4x8 = Engine::Math::Vec4x8;
+using QuatX4 = Engine::Math::QuatX4;
+using QuatX8 = Engine::Math::QuatX8;
\ No newline at end of file
@@ -122,6 +122,37 @@ void Window::SetTitle(const std::string &title) {
   }
 }
 
+GLFWwindow *Window::CreateSharedContext() {
+  if (!s_Window) {
+    ENGINE_LOG_ERROR("Window", "Cannot share context without a main window!");
+    return nullptr;
+  }
+
+  // Context hints from Initialize() still apply; only hide the window
+  glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+  GLFWwindow *context = glfwCreateWindow(1, 1, "Shared Context", nullptr,
+                                         s_Window);
+  glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+
+  if (!context) {
+    ENGINE_LOG_ERROR("Window", "Failed to create shared GL context!");
+    return nullptr;
+  }
+
+  ENGINE_LOG_INFO("Window", "Shared GL context created");
+  return context;
+}
+
+void Window::DestroySharedContext(GLFWwindow *context) {
+  if (context) {
+    glfwDestroyWindow(context);
+  }
+}
+
+void Window::MakeContextCurrent(GLFWwindow *context) {
+  glfwMakeContextCurrent(context);
+}
+
 // GLFW Callbacks
 void Window::GLFWErrorCallback(int error, const char *description) {
   ENGINE_LOG_ERROR("GLFW",
@@ -132,12 +163,12 @@ void Window::GLFWWindowSizeCallback(GLFWwindow *window, int width, int height) {
   s_Width = width;
   s_Height = height;
 
+  // The viewport is owned by the renderer (it may be rendering at a scaled
+  // resolution), so it is updated through the resize event only.
   WindowResizeEvent event(width, height);
   if (s_EventCallback) {
     s_EventCallback(event);
   }
-
-  glViewport(0, 0, width, height);
 }
 
 void Window::GLFWKeyCallback(GLFWwindow *window, int key, int scancode,
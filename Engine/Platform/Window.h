@@ -92,6 +92,13 @@ public:
 
   static void SetTitle(const std::string &title);
 
+  // Hidden 1x1 window whose GL context shares objects with the main window.
+  // Must be created and destroyed on the main thread; the context itself can
+  // then be made current on a worker thread.
+  static GLFWwindow *CreateSharedContext();
+  static void DestroySharedContext(GLFWwindow *context);
+  static void MakeContextCurrent(GLFWwindow *context);
+
 private:
   static GLFWwindow *s_Window;
   static unsigned int s_Width, s_Height;
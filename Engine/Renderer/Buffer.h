@@ -15,6 +15,7 @@ enum class ShaderDataType {
   Float4,
   Mat3,
   Mat4,
+  Mat3x4,
   Int,
   Int2,
   Int3,
@@ -36,6 +37,8 @@ static uint32_t ShaderDataTypeSize(ShaderDataType type) {
     return 4 * 3 * 3;
   case ShaderDataType::Mat4:
     return 4 * 4 * 4;
+  case ShaderDataType::Mat3x4:
+    return 4 * 4 * 3;
   case ShaderDataType::Int:
     return 4;
   case ShaderDataType::Int2:
@@ -63,6 +66,8 @@ struct BufferElement {
       : Name(name), Type(type), Size(ShaderDataTypeSize(type)), Offset(0),
         Normalized(normalized) {}
 
+  // Components per vertex attribute. Matrix types take one attribute per
+  // row (see GetAttributeCount), so this is the width of a single row.
   uint32_t GetComponentCount() const {
     switch (Type) {
     case ShaderDataType::Float:
@@ -77,6 +82,8 @@ struct BufferElement {
       return 3; // 3* float3
     case ShaderDataType::Mat4:
       return 4; // 4* float4
+    case ShaderDataType::Mat3x4:
+      return 4; // float4 per row
     case ShaderDataType::Int:
       return 1;
     case ShaderDataType::Int2:
@@ -90,6 +97,20 @@ struct BufferElement {
     }
     return 0;
   }
+
+  // Vertex attribute slots the element occupies
+  uint32_t GetAttributeCount() const {
+    switch (Type) {
+    case ShaderDataType::Mat3:
+      return 3;
+    case ShaderDataType::Mat4:
+      return 4;
+    case ShaderDataType::Mat3x4:
+      return 3;
+    default:
+      return 1;
+    }
+  }
 };
 
 class BufferLayout {
@@ -0,0 +1,110 @@
+#include "DynamicResolution.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Engine {
+
+DynamicResolutionController::DynamicResolutionController(
+    const DynamicResolutionSettings &settings) {
+  SetSettings(settings);
+}
+
+void DynamicResolutionController::SetSettings(
+    const DynamicResolutionSettings &settings) {
+  m_Settings = settings;
+  // Scales above 1 would supersample into a target larger than the viewport
+  m_Settings.MinScale = std::min(std::max(m_Settings.MinScale, 0.01f), 1.0f);
+  m_Settings.MaxScale =
+      std::min(std::max(m_Settings.MaxScale, m_Settings.MinScale), 1.0f);
+  m_Settings.HistorySize = std::max(m_Settings.HistorySize, 1u);
+  m_Settings.MinSamples =
+      std::min(std::max(m_Settings.MinSamples, 1u), m_Settings.HistorySize);
+  m_Settings.Percentile = std::min(std::max(m_Settings.Percentile, 0.0f), 1.0f);
+
+  m_History.assign(m_Settings.HistorySize, 0.0f);
+  m_SortScratch.reserve(m_Settings.HistorySize);
+  Reset();
+}
+
+void DynamicResolutionController::Reset() {
+  ClearHistory();
+  m_Cooldown = 0;
+  m_Scale = m_Settings.MaxScale;
+  m_PercentileFrameTime = 0.0f;
+}
+
+void DynamicResolutionController::ClearHistory() {
+  m_HistoryHead = 0;
+  m_SampleCount = 0;
+}
+
+float DynamicResolutionController::Update(float frameTimeMs) {
+  if (!(frameTimeMs > 0.0f) || !std::isfinite(frameTimeMs)) {
+    return m_Scale;
+  }
+
+  if (m_Cooldown > 0) {
+    // Frames rendered right after a change still partly reflect the old
+    // resolution (pipelining), so they are not recorded.
+    --m_Cooldown;
+    return m_Scale;
+  }
+
+  m_History[m_HistoryHead] = frameTimeMs;
+  m_HistoryHead = (m_HistoryHead + 1) % m_Settings.HistorySize;
+  m_SampleCount = std::min(m_SampleCount + 1, m_Settings.HistorySize);
+
+  if (m_SampleCount < m_Settings.MinSamples) {
+    return m_Scale;
+  }
+
+  m_PercentileFrameTime = ComputePercentile();
+
+  const float target = m_Settings.TargetFrameTimeMs;
+  const float overBudget = target * (1.0f + m_Settings.DownThreshold);
+  const float underBudget = target * (1.0f - m_Settings.UpThreshold);
+
+  float newScale = m_Scale;
+  if (m_PercentileFrameTime > overBudget) {
+    // Cost scales with pixel count, so the scale moves with the square root
+    // of the budget ratio.
+    float ideal = m_Scale * std::sqrt(target / m_PercentileFrameTime);
+    newScale = std::max(ideal, m_Scale - m_Settings.MaxStepDown);
+  } else if (m_PercentileFrameTime < underBudget) {
+    float ideal = m_Scale * std::sqrt(target / m_PercentileFrameTime);
+    newScale = std::min(ideal, m_Scale + m_Settings.MaxStepUp);
+  }
+
+  newScale = std::min(std::max(newScale, m_Settings.MinScale),
+                      m_Settings.MaxScale);
+
+  if (newScale != m_Scale) {
+    m_Scale = newScale;
+    m_Cooldown = m_Settings.CooldownFrames;
+    ClearHistory();
+  }
+
+  return m_Scale;
+}
+
+uint32_t DynamicResolutionController::ScaleDimension(uint32_t fullSize) const {
+  uint32_t scaled = static_cast<uint32_t>(
+      std::lround(static_cast<float>(fullSize) * m_Scale));
+  return std::max(scaled, 1u);
+}
+
+float DynamicResolutionController::ComputePercentile() const {
+  m_SortScratch.assign(m_History.begin(), m_History.begin() + m_SampleCount);
+
+  size_t index = static_cast<size_t>(
+      std::ceil(m_Settings.Percentile * static_cast<float>(m_SampleCount)));
+  index = index > 0 ? index - 1 : 0;
+  index = std::min(index, m_SortScratch.size() - 1);
+
+  std::nth_element(m_SortScratch.begin(), m_SortScratch.begin() + index,
+                   m_SortScratch.end());
+  return m_SortScratch[index];
+}
+
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+struct DynamicResolutionSettings {
+  // Frame budget the controller tries to stay within
+  float TargetFrameTimeMs = 1000.0f / 60.0f;
+
+  // Render scale limits (fraction of the window size on each axis)
+  float MinScale = 0.5f;
+  float MaxScale = 1.0f;
+
+  // Hysteresis band around the target: the scale only drops once the
+  // percentile frame time is DownThreshold above budget, and only rises once
+  // it is UpThreshold below budget. Anything in between holds the scale.
+  float DownThreshold = 0.05f;
+  float UpThreshold = 0.15f;
+
+  // Largest change applied in a single adjustment
+  float MaxStepDown = 0.15f;
+  float MaxStepUp = 0.05f;
+
+  // Rolling window used to estimate frame cost
+  uint32_t HistorySize = 30;
+  uint32_t MinSamples = 5;
+  float Percentile = 0.9f;
+
+  // Frames to wait after a change before re-evaluating, so the history
+  // reflects the new resolution
+  uint32_t CooldownFrames = 10;
+};
+
+// Frame-time feedback controller for dynamic resolution scaling. It keeps a
+// rolling history of frame times and moves the render scale so that the
+// chosen percentile lands inside the budget. GPU cost is assumed to be
+// proportional to pixel count, i.e. to scale squared.
+//
+// Pure CPU logic: feed it frame times (real or synthetic) and read back the
+// scale.
+class DynamicResolutionController {
+public:
+  DynamicResolutionController(
+      const DynamicResolutionSettings &settings = DynamicResolutionSettings());
+
+  // Records a frame time and returns the scale to use for the next frame
+  float Update(float frameTimeMs);
+
+  void Reset();
+
+  void SetSettings(const DynamicResolutionSettings &settings);
+  const DynamicResolutionSettings &GetSettings() const { return m_Settings; }
+
+  float GetScale() const { return m_Scale; }
+  float GetPercentileFrameTime() const { return m_PercentileFrameTime; }
+  uint32_t GetSampleCount() const { return m_SampleCount; }
+
+  // Applies the current scale to a full-resolution dimension (never below 1)
+  uint32_t ScaleDimension(uint32_t fullSize) const;
+
+private:
+  float ComputePercentile() const;
+  void ClearHistory();
+
+private:
+  DynamicResolutionSettings m_Settings;
+  std::vector<float> m_History;
+  mutable std::vector<float> m_SortScratch;
+  uint32_t m_HistoryHead = 0;
+  uint32_t m_SampleCount = 0;
+  uint32_t m_Cooldown = 0;
+  float m_Scale = 1.0f;
+  float m_PercentileFrameTime = 0.0f;
+};
+
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,510 @@
+#include "FrameGraph.h"
+#include "../Core/Logger.h"
+#include "Buffer.h"
+#include "Framebuffer.h"
+
+#include <algorithm>
+#include <queue>
+
+namespace Engine {
+
+/////////////////////////////////////////////////////////////////////////////
+// FrameGraphBuilder ////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+
+FrameGraphResource
+FrameGraphBuilder::CreateTexture(const std::string &name,
+                                 const FrameGraphTextureDesc &desc) {
+  FrameGraph::ResourceNode node;
+  node.Name = name;
+  node.Type = FrameGraphResourceType::Texture;
+  node.Texture = desc;
+  return m_Graph.AddResource(std::move(node));
+}
+
+FrameGraphResource
+FrameGraphBuilder::CreateBuffer(const std::string &name,
+                                const FrameGraphBufferDesc &desc) {
+  FrameGraph::ResourceNode node;
+  node.Name = name;
+  node.Type = FrameGraphResourceType::Buffer;
+  node.Buffer = desc;
+  return m_Graph.AddResource(std::move(node));
+}
+
+FrameGraphResource FrameGraphBuilder::Read(FrameGraphResource resource) {
+  if (!m_Graph.IsValid(resource)) {
+    ENGINE_LOG_ERROR("FrameGraph", "Pass '" +
+                                       m_Graph.m_Passes[m_PassIndex].Name +
+                                       "' reads an invalid resource");
+    return InvalidFrameGraphResource;
+  }
+
+  auto &reads = m_Graph.m_Passes[m_PassIndex].Reads;
+  if (std::find(reads.begin(), reads.end(), resource) == reads.end()) {
+    reads.push_back(resource);
+  }
+  return resource;
+}
+
+FrameGraphResource FrameGraphBuilder::Write(FrameGraphResource resource) {
+  if (!m_Graph.IsValid(resource)) {
+    ENGINE_LOG_ERROR("FrameGraph", "Pass '" +
+                                       m_Graph.m_Passes[m_PassIndex].Name +
+                                       "' writes an invalid resource");
+    return InvalidFrameGraphResource;
+  }
+
+  auto &writes = m_Graph.m_Passes[m_PassIndex].Writes;
+  if (std::find(writes.begin(), writes.end(), resource) == writes.end()) {
+    writes.push_back(resource);
+  }
+  return resource;
+}
+
+void FrameGraphBuilder::SetSideEffect() {
+  m_Graph.m_Passes[m_PassIndex].SideEffect = true;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// FrameGraphRegistry ///////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+
+std::shared_ptr<Framebuffer>
+FrameGraphRegistry::GetFramebuffer(FrameGraphResource resource) const {
+  if (!m_Graph.IsValid(resource)) {
+    return nullptr;
+  }
+
+  const auto &node = m_Graph.m_Resources[resource];
+  if (node.Imported) {
+    return node.ImportedFramebuffer;
+  }
+  if (node.PhysicalIndex == InvalidFrameGraphIndex ||
+      node.Type != FrameGraphResourceType::Texture) {
+    return nullptr;
+  }
+  return m_Graph.m_FramebufferPool[node.PhysicalIndex];
+}
+
+std::shared_ptr<VertexBuffer>
+FrameGraphRegistry::GetBuffer(FrameGraphResource resource) const {
+  if (!m_Graph.IsValid(resource)) {
+    return nullptr;
+  }
+
+  const auto &node = m_Graph.m_Resources[resource];
+  if (node.Imported) {
+    return node.ImportedBuffer;
+  }
+  if (node.PhysicalIndex == InvalidFrameGraphIndex ||
+      node.Type != FrameGraphResourceType::Buffer) {
+    return nullptr;
+  }
+  return m_Graph.m_BufferPool[node.PhysicalIndex];
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// FrameGraph ///////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+
+FrameGraph::~FrameGraph() = default;
+
+FrameGraphResource
+FrameGraph::ImportTexture(const std::string &name,
+                          const FrameGraphTextureDesc &desc,
+                          const std::shared_ptr<Framebuffer> &framebuffer) {
+  ResourceNode node;
+  node.Name = name;
+  node.Type = FrameGraphResourceType::Texture;
+  node.Texture = desc;
+  node.Imported = true;
+  node.ImportedFramebuffer = framebuffer;
+  return AddResource(std::move(node));
+}
+
+FrameGraphResource
+FrameGraph::ImportBuffer(const std::string &name,
+                         const FrameGraphBufferDesc &desc,
+                         const std::shared_ptr<VertexBuffer> &buffer) {
+  ResourceNode node;
+  node.Name = name;
+  node.Type = FrameGraphResourceType::Buffer;
+  node.Buffer = desc;
+  node.Imported = true;
+  node.ImportedBuffer = buffer;
+  return AddResource(std::move(node));
+}
+
+FrameGraphResource FrameGraph::AddResource(ResourceNode node) {
+  m_Compiled = false;
+  m_Resources.push_back(std::move(node));
+  return static_cast<FrameGraphResource>(m_Resources.size() - 1);
+}
+
+uint32_t FrameGraph::AddPass(const std::string &name, const SetupFn &setup,
+                             const ExecuteFn &execute) {
+  m_Compiled = false;
+
+  uint32_t index = static_cast<uint32_t>(m_Passes.size());
+  PassNode pass;
+  pass.Name = name;
+  pass.Execute = execute;
+  m_Passes.push_back(std::move(pass));
+
+  if (setup) {
+    FrameGraphBuilder builder(*this, index);
+    setup(builder);
+  }
+  return index;
+}
+
+void FrameGraph::Reset() {
+  m_Passes.clear();
+  m_Resources.clear();
+  m_ExecutionOrder.clear();
+  m_Physical.clear();
+  m_Compiled = false;
+}
+
+bool FrameGraph::Compile() {
+  m_Compiled = false;
+  m_ExecutionOrder.clear();
+  m_Physical.clear();
+
+  for (auto &resource : m_Resources) {
+    resource.Writers.clear();
+    resource.Readers.clear();
+    resource.FirstUse = InvalidFrameGraphIndex;
+    resource.LastUse = InvalidFrameGraphIndex;
+    resource.PhysicalIndex = InvalidFrameGraphIndex;
+  }
+
+  for (uint32_t p = 0; p < m_Passes.size(); ++p) {
+    m_Passes[p].Culled = false;
+    for (FrameGraphResource r : m_Passes[p].Reads) {
+      m_Resources[r].Readers.push_back(p);
+    }
+    for (FrameGraphResource r : m_Passes[p].Writes) {
+      m_Resources[r].Writers.push_back(p);
+    }
+  }
+
+  // Reading a transient nobody produces is undefined content
+  for (const auto &resource : m_Resources) {
+    if (!resource.Imported && !resource.Readers.empty() &&
+        resource.Writers.empty()) {
+      ENGINE_LOG_ERROR("FrameGraph", "Transient resource '" + resource.Name +
+                                         "' is read but never written");
+      return false;
+    }
+  }
+
+  CullPasses();
+  if (!SortPasses()) {
+    return false;
+  }
+  ComputeLifetimes();
+  AssignPhysicalResources();
+
+  m_Compiled = true;
+  return true;
+}
+
+void FrameGraph::CullPasses() {
+  // Walk backwards from the passes that produce something observable
+  std::vector<bool> needed(m_Passes.size(), false);
+  std::vector<uint32_t> stack;
+
+  for (uint32_t p = 0; p < m_Passes.size(); ++p) {
+    const auto &pass = m_Passes[p];
+    bool root = pass.SideEffect;
+    for (FrameGraphResource r : pass.Writes) {
+      root |= m_Resources[r].Imported;
+    }
+    if (root) {
+      needed[p] = true;
+      stack.push_back(p);
+    }
+  }
+
+  while (!stack.empty()) {
+    uint32_t p = stack.back();
+    stack.pop_back();
+
+    for (FrameGraphResource r : m_Passes[p].Reads) {
+      for (uint32_t writer : m_Resources[r].Writers) {
+        if (!needed[writer]) {
+          needed[writer] = true;
+          stack.push_back(writer);
+        }
+      }
+    }
+  }
+
+  for (uint32_t p = 0; p < m_Passes.size(); ++p) {
+    m_Passes[p].Culled = !needed[p];
+  }
+}
+
+bool FrameGraph::SortPasses() {
+  // Dependency edges: every writer of a resource precedes its readers, and
+  // writers of the same resource keep declaration order.
+  const size_t passCount = m_Passes.size();
+  std::vector<std::vector<uint32_t>> successors(passCount);
+  std::vector<uint32_t> inDegree(passCount, 0);
+
+  auto addEdge = [&](uint32_t from, uint32_t to) {
+    if (from == to || m_Passes[from].Culled || m_Passes[to].Culled) {
+      return;
+    }
+    auto &edges = successors[from];
+    if (std::find(edges.begin(), edges.end(), to) == edges.end()) {
+      edges.push_back(to);
+      ++inDegree[to];
+    }
+  };
+
+  for (const auto &resource : m_Resources) {
+    for (size_t w = 1; w < resource.Writers.size(); ++w) {
+      addEdge(resource.Writers[w - 1], resource.Writers[w]);
+    }
+    for (uint32_t writer : resource.Writers) {
+      for (uint32_t reader : resource.Readers) {
+        // A pass that reads and writes the same resource (read-modify-write)
+        // only depends on the writers declared before it.
+        bool readerWrites =
+            std::find(resource.Writers.begin(), resource.Writers.end(),
+                      reader) != resource.Writers.end();
+        if (readerWrites && writer > reader) {
+          continue;
+        }
+        addEdge(writer, reader);
+      }
+    }
+  }
+
+  // Kahn's algorithm; ties resolve to declaration order for stable schedules
+  std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>>
+      ready;
+  size_t activeCount = 0;
+  for (uint32_t p = 0; p < passCount; ++p) {
+    if (m_Passes[p].Culled) {
+      continue;
+    }
+    ++activeCount;
+    if (inDegree[p] == 0) {
+      ready.push(p);
+    }
+  }
+
+  while (!ready.empty()) {
+    uint32_t p = ready.top();
+    ready.pop();
+    m_ExecutionOrder.push_back(p);
+
+    for (uint32_t next : successors[p]) {
+      if (--inDegree[next] == 0) {
+        ready.push(next);
+      }
+    }
+  }
+
+  if (m_ExecutionOrder.size() != activeCount) {
+    ENGINE_LOG_ERROR("FrameGraph", "Cycle detected between passes");
+    m_ExecutionOrder.clear();
+    return false;
+  }
+  return true;
+}
+
+void FrameGraph::ComputeLifetimes() {
+  for (uint32_t step = 0; step < m_ExecutionOrder.size(); ++step) {
+    const auto &pass = m_Passes[m_ExecutionOrder[step]];
+
+    auto touch = [&](FrameGraphResource r) {
+      auto &resource = m_Resources[r];
+      if (resource.FirstUse == InvalidFrameGraphIndex) {
+        resource.FirstUse = step;
+      }
+      resource.LastUse = step;
+    };
+
+    for (FrameGraphResource r : pass.Reads) {
+      touch(r);
+    }
+    for (FrameGraphResource r : pass.Writes) {
+      touch(r);
+    }
+  }
+}
+
+void FrameGraph::AssignPhysicalResources() {
+  std::vector<FrameGraphResource> transients;
+  for (FrameGraphResource r = 0; r < m_Resources.size(); ++r) {
+    const auto &resource = m_Resources[r];
+    if (!resource.Imported && resource.FirstUse != InvalidFrameGraphIndex) {
+      transients.push_back(r);
+    }
+  }
+
+  // Greedy interval allocation in order of first use
+  std::stable_sort(transients.begin(), transients.end(),
+                   [&](FrameGraphResource a, FrameGraphResource b) {
+                     return m_Resources[a].FirstUse < m_Resources[b].FirstUse;
+                   });
+
+  for (FrameGraphResource r : transients) {
+    auto &resource = m_Resources[r];
+    uint32_t best = InvalidFrameGraphIndex;
+
+    for (uint32_t slot = 0; slot < m_Physical.size(); ++slot) {
+      const auto &physical = m_Physical[slot];
+      if (physical.Type != resource.Type ||
+          physical.LastUse >= resource.FirstUse) {
+        continue;
+      }
+
+      if (resource.Type == FrameGraphResourceType::Texture) {
+        // Render targets can only be shared when their format matches
+        if (physical.Texture == resource.Texture) {
+          best = slot;
+          break;
+        }
+      } else {
+        // Buffers share a slot sized for the largest user; prefer the
+        // smallest slot that already fits
+        if (best == InvalidFrameGraphIndex) {
+          best = slot;
+          continue;
+        }
+        uint32_t need = resource.Buffer.Size;
+        uint32_t bestSize = m_Physical[best].Buffer.Size;
+        uint32_t size = physical.Buffer.Size;
+        bool fits = size >= need;
+        bool bestFits = bestSize >= need;
+        if ((fits && (!bestFits || size < bestSize)) ||
+            (!fits && !bestFits && size > bestSize)) {
+          best = slot;
+        }
+      }
+    }
+
+    if (best == InvalidFrameGraphIndex) {
+      PhysicalResource physical;
+      physical.Type = resource.Type;
+      physical.Texture = resource.Texture;
+      m_Physical.push_back(physical);
+      best = static_cast<uint32_t>(m_Physical.size() - 1);
+    }
+
+    auto &physical = m_Physical[best];
+    physical.LastUse = resource.LastUse;
+    physical.Buffer.Size = std::max(physical.Buffer.Size, resource.Buffer.Size);
+    resource.PhysicalIndex = best;
+  }
+}
+
+void FrameGraph::RealizePhysicalResources() {
+  m_FramebufferPool.resize(m_Physical.size());
+  m_BufferPool.resize(m_Physical.size());
+  m_BufferPoolSizes.resize(m_Physical.size(), 0);
+
+  for (size_t slot = 0; slot < m_Physical.size(); ++slot) {
+    const auto &physical = m_Physical[slot];
+
+    if (physical.Type == FrameGraphResourceType::Texture) {
+      m_BufferPool[slot].reset();
+      auto &framebuffer = m_FramebufferPool[slot];
+      if (framebuffer && framebuffer->GetSpecification().DepthAttachment !=
+                             physical.Texture.DepthAttachment) {
+        framebuffer.reset();
+      }
+      if (!framebuffer) {
+        FramebufferSpecification spec;
+        spec.Width = physical.Texture.Width;
+        spec.Height = physical.Texture.Height;
+        spec.DepthAttachment = physical.Texture.DepthAttachment;
+        framebuffer = Framebuffer::Create(spec);
+      } else {
+        framebuffer->Resize(physical.Texture.Width, physical.Texture.Height);
+      }
+    } else {
+      m_FramebufferPool[slot].reset();
+      auto &buffer = m_BufferPool[slot];
+      if (!buffer || m_BufferPoolSizes[slot] < physical.Buffer.Size) {
+        buffer = VertexBuffer::Create(physical.Buffer.Size);
+        m_BufferPoolSizes[slot] = physical.Buffer.Size;
+      }
+    }
+  }
+}
+
+void FrameGraph::Execute() {
+  if (!m_Compiled && !Compile()) {
+    ENGINE_LOG_ERROR("FrameGraph", "Skipping execution of invalid graph");
+    return;
+  }
+
+  RealizePhysicalResources();
+
+  FrameGraphRegistry registry(*this);
+  for (uint32_t p : m_ExecutionOrder) {
+    if (m_Passes[p].Execute) {
+      m_Passes[p].Execute(registry);
+    }
+  }
+}
+
+const std::string &FrameGraph::GetPassName(uint32_t pass) const {
+  return m_Passes[pass].Name;
+}
+
+bool FrameGraph::IsPassCulled(uint32_t pass) const {
+  return m_Passes[pass].Culled;
+}
+
+const std::string &
+FrameGraph::GetResourceName(FrameGraphResource resource) const {
+  return m_Resources[resource].Name;
+}
+
+bool FrameGraph::IsImported(FrameGraphResource resource) const {
+  return m_Resources[resource].Imported;
+}
+
+uint32_t FrameGraph::GetPhysicalIndex(FrameGraphResource resource) const {
+  return IsValid(resource) ? m_Resources[resource].PhysicalIndex
+                           : InvalidFrameGraphIndex;
+}
+
+size_t FrameGraph::EstimateSize(const FrameGraphTextureDesc &desc) {
+  size_t pixels = static_cast<size_t>(desc.Width) * desc.Height;
+  // RGBA8 color plus a packed 24/8 depth-stencil attachment
+  return pixels * 4 + (desc.DepthAttachment ? pixels * 4 : 0);
+}
+
+size_t FrameGraph::GetTransientMemory() const {
+  size_t total = 0;
+  for (const auto &physical : m_Physical) {
+    total += physical.Type == FrameGraphResourceType::Texture
+                 ? EstimateSize(physical.Texture)
+                 : physical.Buffer.Size;
+  }
+  return total;
+}
+
+size_t FrameGraph::GetUnaliasedTransientMemory() const {
+  size_t total = 0;
+  for (const auto &resource : m_Resources) {
+    if (resource.Imported || resource.PhysicalIndex == InvalidFrameGraphIndex) {
+      continue;
+    }
+    total += resource.Type == FrameGraphResourceType::Texture
+                 ? EstimateSize(resource.Texture)
+                 : resource.Buffer.Size;
+  }
+  return total;
+}
+
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+// Forward declarations
+class Framebuffer;
+class VertexBuffer;
+class FrameGraph;
+
+using FrameGraphResource = uint32_t;
+static constexpr FrameGraphResource InvalidFrameGraphResource = ~0u;
+static constexpr uint32_t InvalidFrameGraphIndex = ~0u;
+
+enum class FrameGraphResourceType { Texture, Buffer };
+
+struct FrameGraphTextureDesc {
+  uint32_t Width = 0;
+  uint32_t Height = 0;
+  bool DepthAttachment = true;
+
+  bool operator==(const FrameGraphTextureDesc &other) const {
+    return Width == other.Width && Height == other.Height &&
+           DepthAttachment == other.DepthAttachment;
+  }
+};
+
+struct FrameGraphBufferDesc {
+  uint32_t Size = 0;
+};
+
+//============================================================================
+// FrameGraphBuilder - Declares a pass's resource usage during setup
+//============================================================================
+class FrameGraphBuilder {
+public:
+  // Transient resources live only for this frame and may share memory with
+  // other transients whose lifetimes do not overlap.
+  FrameGraphResource CreateTexture(const std::string &name,
+                                   const FrameGraphTextureDesc &desc);
+  FrameGraphResource CreateBuffer(const std::string &name,
+                                  const FrameGraphBufferDesc &desc);
+
+  FrameGraphResource Read(FrameGraphResource resource);
+  FrameGraphResource Write(FrameGraphResource resource);
+
+  // Passes with side effects (readbacks, presentation) are never culled
+  void SetSideEffect();
+
+private:
+  friend class FrameGraph;
+  FrameGraphBuilder(FrameGraph &graph, uint32_t passIndex)
+      : m_Graph(graph), m_PassIndex(passIndex) {}
+
+  FrameGraph &m_Graph;
+  uint32_t m_PassIndex;
+};
+
+//============================================================================
+// FrameGraphRegistry - Resolves resources to GPU objects during execution
+//============================================================================
+class FrameGraphRegistry {
+public:
+  // Imported render targets may resolve to nullptr (default framebuffer)
+  std::shared_ptr<Framebuffer>
+  GetFramebuffer(FrameGraphResource resource) const;
+  std::shared_ptr<VertexBuffer> GetBuffer(FrameGraphResource resource) const;
+
+private:
+  friend class FrameGraph;
+  explicit FrameGraphRegistry(const FrameGraph &graph) : m_Graph(graph) {}
+
+  const FrameGraph &m_Graph;
+};
+
+//============================================================================
+// FrameGraph - Pass scheduling, culling and transient resource aliasing
+//============================================================================
+// Usage per frame: Reset(), import persistent targets, AddPass() for every
+// pass, Compile(), Execute(). Compile() is pure CPU work and never touches
+// the GPU, so schedules can be validated headless.
+//
+// Reads observe the final contents a resource has in the frame: a reader is
+// ordered after every pass that writes the resource, and multiple writers
+// keep their declaration order.
+class FrameGraph {
+public:
+  using SetupFn = std::function<void(FrameGraphBuilder &)>;
+  using ExecuteFn = std::function<void(FrameGraphRegistry &)>;
+
+  FrameGraph() = default;
+  ~FrameGraph();
+
+  FrameGraph(const FrameGraph &) = delete;
+  FrameGraph &operator=(const FrameGraph &) = delete;
+
+  // Persistent resources owned outside the graph. Writes to imported
+  // resources count as outputs, so passes producing them survive culling.
+  FrameGraphResource
+  ImportTexture(const std::string &name, const FrameGraphTextureDesc &desc,
+                const std::shared_ptr<Framebuffer> &framebuffer = nullptr);
+  FrameGraphResource ImportBuffer(const std::string &name,
+                                  const FrameGraphBufferDesc &desc,
+                                  const std::shared_ptr<VertexBuffer> &buffer);
+
+  uint32_t AddPass(const std::string &name, const SetupFn &setup,
+                   const ExecuteFn &execute);
+
+  bool Compile();
+  void Execute();
+
+  // Drops passes and resources; the physical resource pool is kept so
+  // rebuilding the same graph every frame does not reallocate.
+  void Reset();
+
+  // Introspection (valid after Compile)
+  uint32_t GetPassCount() const {
+    return static_cast<uint32_t>(m_Passes.size());
+  }
+  const std::string &GetPassName(uint32_t pass) const;
+  bool IsPassCulled(uint32_t pass) const;
+  const std::vector<uint32_t> &GetExecutionOrder() const {
+    return m_ExecutionOrder;
+  }
+
+  uint32_t GetResourceCount() const {
+    return static_cast<uint32_t>(m_Resources.size());
+  }
+  const std::string &GetResourceName(FrameGraphResource resource) const;
+  bool IsImported(FrameGraphResource resource) const;
+
+  // Physical slot a transient resource is aliased into, or
+  // InvalidFrameGraphIndex for imported and unused resources
+  uint32_t GetPhysicalIndex(FrameGraphResource resource) const;
+  uint32_t GetPhysicalResourceCount() const {
+    return static_cast<uint32_t>(m_Physical.size());
+  }
+
+  // Transient memory with and without aliasing, in bytes
+  size_t GetTransientMemory() const;
+  size_t GetUnaliasedTransientMemory() const;
+
+  static size_t EstimateSize(const FrameGraphTextureDesc &desc);
+
+private:
+  friend class FrameGraphBuilder;
+  friend class FrameGraphRegistry;
+
+  struct ResourceNode {
+    std::string Name;
+    FrameGraphResourceType Type = FrameGraphResourceType::Texture;
+    FrameGraphTextureDesc Texture;
+    FrameGraphBufferDesc Buffer;
+    bool Imported = false;
+    std::shared_ptr<Framebuffer> ImportedFramebuffer;
+    std::shared_ptr<VertexBuffer> ImportedBuffer;
+
+    // Filled by Compile()
+    std::vector<uint32_t> Writers;
+    std::vector<uint32_t> Readers;
+    uint32_t FirstUse = InvalidFrameGraphIndex;
+    uint32_t LastUse = InvalidFrameGraphIndex;
+    uint32_t PhysicalIndex = InvalidFrameGraphIndex;
+  };
+
+  struct PassNode {
+    std::string Name;
+    ExecuteFn Execute;
+    std::vector<FrameGraphResource> Reads;
+    std::vector<FrameGraphResource> Writes;
+    bool SideEffect = false;
+    bool Culled = false;
+  };
+
+  struct PhysicalResource {
+    FrameGraphResourceType Type = FrameGraphResourceType::Texture;
+    FrameGraphTextureDesc Texture;
+    FrameGraphBufferDesc Buffer;
+    uint32_t LastUse = 0;
+  };
+
+  FrameGraphResource AddResource(ResourceNode node);
+  bool IsValid(FrameGraphResource resource) const {
+    return resource < m_Resources.size();
+  }
+
+  void CullPasses();
+  bool SortPasses();
+  void ComputeLifetimes();
+  void AssignPhysicalResources();
+  void RealizePhysicalResources();
+
+private:
+  std::vector<PassNode> m_Passes;
+  std::vector<ResourceNode> m_Resources;
+  std::vector<uint32_t> m_ExecutionOrder;
+  std::vector<PhysicalResource> m_Physical;
+  bool m_Compiled = false;
+
+  // GPU objects backing the physical slots, kept across frames
+  std::vector<std::shared_ptr<Framebuffer>> m_FramebufferPool;
+  std::vector<std::shared_ptr<VertexBuffer>> m_BufferPool;
+  std::vector<uint32_t> m_BufferPoolSizes;
+};
+
+} // namespace Engine
\ No newline at end of file
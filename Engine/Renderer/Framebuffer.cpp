@@ -0,0 +1,126 @@
+#include "Framebuffer.h"
+#include "../Core/Logger.h"
+
+#include <glad/glad.h>
+
+namespace Engine {
+
+class OpenGLFramebuffer : public Framebuffer {
+public:
+  OpenGLFramebuffer(const FramebufferSpecification &spec)
+      : m_Specification(spec) {
+    Invalidate();
+  }
+
+  virtual ~OpenGLFramebuffer() { Release(); }
+
+  virtual void Bind() const override {
+    glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+  }
+
+  virtual void Unbind() const override { glBindFramebuffer(GL_FRAMEBUFFER, 0); }
+
+  virtual void Resize(uint32_t width, uint32_t height) override {
+    if (width == 0 || height == 0) {
+      ENGINE_LOG_WARN("Framebuffer", "Ignoring resize to " +
+                                         std::to_string(width) + "x" +
+                                         std::to_string(height));
+      return;
+    }
+
+    if (width == m_Specification.Width && height == m_Specification.Height) {
+      return;
+    }
+
+    m_Specification.Width = width;
+    m_Specification.Height = height;
+    Invalidate();
+  }
+
+  virtual void BlitToScreen(uint32_t srcWidth, uint32_t srcHeight, int dstX,
+                            int dstY, uint32_t dstWidth,
+                            uint32_t dstHeight) const override {
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, m_RendererID);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+
+    GLenum filter =
+        (srcWidth == dstWidth && srcHeight == dstHeight) ? GL_NEAREST
+                                                         : GL_LINEAR;
+    glBlitFramebuffer(0, 0, static_cast<GLint>(srcWidth),
+                      static_cast<GLint>(srcHeight), dstX, dstY,
+                      dstX + static_cast<GLint>(dstWidth),
+                      dstY + static_cast<GLint>(dstHeight),
+                      GL_COLOR_BUFFER_BIT, filter);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  }
+
+  virtual uint32_t GetColorAttachmentRendererID() const override {
+    return m_ColorAttachment;
+  }
+
+  virtual const FramebufferSpecification &GetSpecification() const override {
+    return m_Specification;
+  }
+
+private:
+  void Invalidate() {
+    Release();
+
+    glGenFramebuffers(1, &m_RendererID);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+
+    glGenTextures(1, &m_ColorAttachment);
+    glBindTexture(GL_TEXTURE_2D, m_ColorAttachment);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, m_Specification.Width,
+                 m_Specification.Height, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                 nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                           m_ColorAttachment, 0);
+
+    if (m_Specification.DepthAttachment) {
+      glGenRenderbuffers(1, &m_DepthAttachment);
+      glBindRenderbuffer(GL_RENDERBUFFER, m_DepthAttachment);
+      glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8,
+                            m_Specification.Width, m_Specification.Height);
+      glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT,
+                                GL_RENDERBUFFER, m_DepthAttachment);
+    }
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+      ENGINE_LOG_ERROR("Framebuffer", "Framebuffer is incomplete!");
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  }
+
+  void Release() {
+    if (m_RendererID) {
+      glDeleteFramebuffers(1, &m_RendererID);
+      glDeleteTextures(1, &m_ColorAttachment);
+      if (m_DepthAttachment) {
+        glDeleteRenderbuffers(1, &m_DepthAttachment);
+      }
+    }
+    m_RendererID = 0;
+    m_ColorAttachment = 0;
+    m_DepthAttachment = 0;
+  }
+
+private:
+  uint32_t m_RendererID = 0;
+  uint32_t m_ColorAttachment = 0;
+  uint32_t m_DepthAttachment = 0;
+  FramebufferSpecification m_Specification;
+};
+
+std::shared_ptr<Framebuffer>
+Framebuffer::Create(const FramebufferSpecification &spec) {
+  return std::make_shared<OpenGLFramebuffer>(spec);
+}
+
+} // namespace Engine
\ No newline at end of file
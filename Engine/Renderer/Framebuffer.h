@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+namespace Engine {
+
+struct FramebufferSpecification {
+  uint32_t Width = 0;
+  uint32_t Height = 0;
+  bool DepthAttachment = true;
+};
+
+// Offscreen render target with an RGBA8 color texture and an optional
+// depth/stencil renderbuffer.
+class Framebuffer {
+public:
+  virtual ~Framebuffer() = default;
+
+  virtual void Bind() const = 0;
+  virtual void Unbind() const = 0;
+
+  virtual void Resize(uint32_t width, uint32_t height) = 0;
+
+  // Copies the (srcWidth x srcHeight) lower-left region of the color
+  // attachment into the given rectangle of the default framebuffer, using
+  // bilinear filtering when the sizes differ.
+  virtual void BlitToScreen(uint32_t srcWidth, uint32_t srcHeight, int dstX,
+                            int dstY, uint32_t dstWidth,
+                            uint32_t dstHeight) const = 0;
+
+  virtual uint32_t GetColorAttachmentRendererID() const = 0;
+  virtual const FramebufferSpecification &GetSpecification() const = 0;
+
+  static std::shared_ptr<Framebuffer>
+  Create(const FramebufferSpecification &spec);
+};
+
+} // namespace Engine
\ No newline at end of file
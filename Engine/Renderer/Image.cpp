@@ -0,0 +1,241 @@
+#include "Image.h"
+#include "../Core/Logger.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Engine {
+
+namespace {
+
+// Images are stored bottom-up; flip decoders that produce top-down rows
+void FlipRows(Image &image) {
+  size_t rowSize = static_cast<size_t>(image.Width) * 4;
+  std::vector<uint8_t> row(rowSize);
+  for (uint32_t y = 0; y < image.Height / 2; ++y) {
+    uint8_t *top = image.GetPixel(0, y);
+    uint8_t *bottom = image.GetPixel(0, image.Height - 1 - y);
+    std::memcpy(row.data(), top, rowSize);
+    std::memcpy(top, bottom, rowSize);
+    std::memcpy(bottom, row.data(), rowSize);
+  }
+}
+
+// TGA stores BGR(A) or grayscale; expand to RGBA
+void StoreTGAPixel(const uint8_t *src, uint32_t bytesPerPixel, uint8_t *dst) {
+  switch (bytesPerPixel) {
+  case 1:
+    dst[0] = dst[1] = dst[2] = src[0];
+    dst[3] = 255;
+    break;
+  case 3:
+    dst[0] = src[2];
+    dst[1] = src[1];
+    dst[2] = src[0];
+    dst[3] = 255;
+    break;
+  default:
+    dst[0] = src[2];
+    dst[1] = src[1];
+    dst[2] = src[0];
+    dst[3] = src[3];
+    break;
+  }
+}
+
+// Skips whitespace and '#' comments in a PPM header
+bool SkipPPMSeparators(const uint8_t *data, size_t size, size_t &offset) {
+  while (offset < size) {
+    uint8_t c = data[offset];
+    if (c == '#') {
+      while (offset < size && data[offset] != '\n') {
+        ++offset;
+      }
+    } else if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+      ++offset;
+    } else {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ReadPPMNumber(const uint8_t *data, size_t size, size_t &offset,
+                   uint32_t &value) {
+  if (!SkipPPMSeparators(data, size, offset)) {
+    return false;
+  }
+  if (data[offset] < '0' || data[offset] > '9') {
+    return false;
+  }
+
+  value = 0;
+  while (offset < size && data[offset] >= '0' && data[offset] <= '9') {
+    value = value * 10 + (data[offset] - '0');
+    if (value > 65535) {
+      return false;
+    }
+    ++offset;
+  }
+  return true;
+}
+
+} // namespace
+
+bool ImageLoader::Load(const std::string &path, Image &image) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file.is_open()) {
+    ENGINE_LOG_ERROR("ImageLoader", "Failed to open image: " + path);
+    return false;
+  }
+
+  std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)),
+                             std::istreambuf_iterator<char>());
+  if (!Decode(bytes.data(), bytes.size(), image)) {
+    ENGINE_LOG_ERROR("ImageLoader", "Unsupported or corrupt image: " + path);
+    return false;
+  }
+  return true;
+}
+
+bool ImageLoader::Decode(const uint8_t *data, size_t size, Image &image) {
+  if (size >= 2 && data[0] == 'P' && data[1] == '6') {
+    return DecodePPM(data, size, image);
+  }
+  // TGA has no magic number; the header is validated while decoding
+  return DecodeTGA(data, size, image);
+}
+
+bool ImageLoader::DecodeTGA(const uint8_t *data, size_t size, Image &image) {
+  const size_t headerSize = 18;
+  if (size < headerSize) {
+    return false;
+  }
+
+  uint8_t idLength = data[0];
+  uint8_t colorMapType = data[1];
+  uint8_t imageType = data[2];
+  uint32_t width = data[12] | (data[13] << 8);
+  uint32_t height = data[14] | (data[15] << 8);
+  uint8_t bitsPerPixel = data[16];
+  uint8_t descriptor = data[17];
+
+  // Truecolor (2), grayscale (3) and their RLE variants (10, 11)
+  bool rle = imageType == 10 || imageType == 11;
+  bool gray = imageType == 3 || imageType == 11;
+  if (colorMapType != 0 || (imageType != 2 && imageType != 3 && !rle)) {
+    return false;
+  }
+  if (gray ? bitsPerPixel != 8 : (bitsPerPixel != 24 && bitsPerPixel != 32)) {
+    return false;
+  }
+  if (width == 0 || height == 0) {
+    return false;
+  }
+
+  uint32_t bytesPerPixel = bitsPerPixel / 8;
+  size_t offset = headerSize + idLength;
+  size_t pixelCount = static_cast<size_t>(width) * height;
+
+  Image result(width, height);
+  uint8_t *dst = result.Pixels.data();
+
+  if (!rle) {
+    if (offset + pixelCount * bytesPerPixel > size) {
+      return false;
+    }
+    for (size_t i = 0; i < pixelCount; ++i) {
+      StoreTGAPixel(data + offset + i * bytesPerPixel, bytesPerPixel,
+                    dst + i * 4);
+    }
+  } else {
+    size_t pixel = 0;
+    while (pixel < pixelCount) {
+      if (offset >= size) {
+        return false;
+      }
+      uint8_t packet = data[offset++];
+      size_t count = (packet & 0x7F) + 1u;
+      if (pixel + count > pixelCount) {
+        return false;
+      }
+
+      if (packet & 0x80) {
+        // Run-length packet: one pixel repeated
+        if (offset + bytesPerPixel > size) {
+          return false;
+        }
+        for (size_t i = 0; i < count; ++i) {
+          StoreTGAPixel(data + offset, bytesPerPixel, dst + (pixel + i) * 4);
+        }
+        offset += bytesPerPixel;
+      } else {
+        // Raw packet
+        if (offset + count * bytesPerPixel > size) {
+          return false;
+        }
+        for (size_t i = 0; i < count; ++i) {
+          StoreTGAPixel(data + offset + i * bytesPerPixel, bytesPerPixel,
+                        dst + (pixel + i) * 4);
+        }
+        offset += count * bytesPerPixel;
+      }
+      pixel += count;
+    }
+  }
+
+  // Descriptor bit 5 set means rows are stored top-down
+  if (descriptor & 0x20) {
+    FlipRows(result);
+  }
+
+  image = std::move(result);
+  return true;
+}
+
+bool ImageLoader::DecodePPM(const uint8_t *data, size_t size, Image &image) {
+  if (size < 2 || data[0] != 'P' || data[1] != '6') {
+    return false;
+  }
+
+  size_t offset = 2;
+  uint32_t width = 0;
+  uint32_t height = 0;
+  uint32_t maxValue = 0;
+  if (!ReadPPMNumber(data, size, offset, width) ||
+      !ReadPPMNumber(data, size, offset, height) ||
+      !ReadPPMNumber(data, size, offset, maxValue)) {
+    return false;
+  }
+  if (width == 0 || height == 0 || maxValue == 0 || maxValue > 255) {
+    return false;
+  }
+
+  // Exactly one whitespace byte separates the header from pixel data
+  ++offset;
+  size_t pixelCount = static_cast<size_t>(width) * height;
+  if (offset + pixelCount * 3 > size) {
+    return false;
+  }
+
+  Image result(width, height);
+  const uint8_t *src = data + offset;
+  uint8_t *dst = result.Pixels.data();
+  for (size_t i = 0; i < pixelCount; ++i) {
+    for (int c = 0; c < 3; ++c) {
+      uint32_t value = src[i * 3 + c];
+      dst[i * 4 + c] = static_cast<uint8_t>(
+          maxValue == 255 ? value : (value * 255 + maxValue / 2) / maxValue);
+    }
+    dst[i * 4 + 3] = 255;
+  }
+
+  // PPM rows run top to bottom
+  FlipRows(result);
+
+  image = std::move(result);
+  return true;
+}
+
+} // namespace Engine
\ No newline at end of file
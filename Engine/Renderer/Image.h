@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+// CPU-side RGBA8 image, rows stored bottom-up to match GL's texture origin
+struct Image {
+  uint32_t Width = 0;
+  uint32_t Height = 0;
+  std::vector<uint8_t> Pixels;
+
+  Image() = default;
+  Image(uint32_t width, uint32_t height)
+      : Width(width), Height(height),
+        Pixels(static_cast<size_t>(width) * height * 4, 0) {}
+
+  bool IsValid() const {
+    return Width > 0 && Height > 0 &&
+           Pixels.size() == static_cast<size_t>(Width) * Height * 4;
+  }
+  size_t GetSize() const { return Pixels.size(); }
+
+  uint8_t *GetPixel(uint32_t x, uint32_t y) {
+    return Pixels.data() + (static_cast<size_t>(y) * Width + x) * 4;
+  }
+  const uint8_t *GetPixel(uint32_t x, uint32_t y) const {
+    return Pixels.data() + (static_cast<size_t>(y) * Width + x) * 4;
+  }
+};
+
+//============================================================================
+// ImageLoader - Decoders for the image formats the engine ships with
+//============================================================================
+// Supports TGA (uncompressed and RLE, 8/24/32 bit) and binary PPM (P6).
+// Decoding is plain CPU work and safe to run on job system workers.
+class ImageLoader {
+public:
+  static bool Load(const std::string &path, Image &image);
+  static bool Decode(const uint8_t *data, size_t size, Image &image);
+
+  static bool DecodeTGA(const uint8_t *data, size_t size, Image &image);
+  static bool DecodePPM(const uint8_t *data, size_t size, Image &image);
+};
+
+} // namespace Engine
\ No newline at end of file
@@ -10,22 +10,27 @@
 
 namespace Engine {
 
-// Vertex structure for 3D meshes
+// Vertex structure for 3D meshes. Stored packed so the struct is exactly
+// the Float3, Float3, Float2, Float3 buffer layout; Load() the members to
+// compute with them.
 struct Vertex {
-  Vec3 Position;
-  Vec3 Normal;
+  Float3 Position;
+  Float3 Normal;
   Vec2 TexCoords;
-  Vec3 Color;
+  Float3 Color;
 
-  Vertex()
+  constexpr Vertex()
       : Position(0.0f), Normal(0.0f, 1.0f, 0.0f), TexCoords(0.0f), Color(1.0f) {
   }
 
-  Vertex(const Vec3 &pos, const Vec3 &normal = Vec3(0.0f, 1.0f, 0.0f),
-         const Vec2 &texCoords = Vec2(0.0f), const Vec3 &color = Vec3(1.0f))
+  constexpr Vertex(const Vec3 &pos, const Vec3 &normal = Vec3(0.0f, 1.0f, 0.0f),
+                   const Vec2 &texCoords = Vec2(0.0f),
+                   const Vec3 &color = Vec3(1.0f))
       : Position(pos), Normal(normal), TexCoords(texCoords), Color(color) {}
 };
 
+static_assert(sizeof(Vertex) == 44, "Vertex must match its buffer layout");
+
 class Mesh {
 public:
   // Mesh data
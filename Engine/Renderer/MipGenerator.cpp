@@ -0,0 +1,264 @@
+#include "MipGenerator.h"
+#include "../Core/JobSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <emmintrin.h>
+
+namespace Engine {
+
+namespace {
+
+// Rows per job when filtering large levels on the job system
+constexpr uint32_t RowsPerJob = 32;
+
+// Kaiser window parameters: support in destination pixels and shape
+constexpr float KaiserRadius = 2.0f;
+constexpr float KaiserAlpha = 4.0f;
+
+uint32_t NextMipDimension(uint32_t size) { return std::max(size / 2, 1u); }
+
+// Zeroth-order modified Bessel function of the first kind
+float BesselI0(float x) {
+  float sum = 1.0f;
+  float term = 1.0f;
+  float halfX = x * 0.5f;
+  for (int k = 1; k < 16; ++k) {
+    term *= (halfX / static_cast<float>(k)) * (halfX / static_cast<float>(k));
+    sum += term;
+  }
+  return sum;
+}
+
+float KaiserSinc(float t) {
+  float x = std::fabs(t);
+  if (x >= KaiserRadius) {
+    return 0.0f;
+  }
+
+  const float pi = 3.14159265358979f;
+  float sinc = x < 1e-6f ? 1.0f : std::sin(pi * x) / (pi * x);
+  float ratio = x / KaiserRadius;
+  float window = BesselI0(KaiserAlpha * std::sqrt(1.0f - ratio * ratio)) /
+                 BesselI0(KaiserAlpha);
+  return sinc * window;
+}
+
+// Normalized filter taps for every destination texel along one axis
+struct FilterTaps {
+  uint32_t TapCount = 0;
+  std::vector<uint32_t> Indices; // [dst * TapCount + tap], clamped to source
+  std::vector<float> Weights;
+};
+
+FilterTaps BuildKaiserTaps(uint32_t srcSize, uint32_t dstSize) {
+  float scale = static_cast<float>(srcSize) / static_cast<float>(dstSize);
+  float support = KaiserRadius * scale;
+
+  FilterTaps taps;
+  taps.TapCount = static_cast<uint32_t>(std::ceil(support * 2.0f)) + 1;
+  taps.Indices.resize(static_cast<size_t>(dstSize) * taps.TapCount);
+  taps.Weights.resize(taps.Indices.size());
+
+  for (uint32_t d = 0; d < dstSize; ++d) {
+    float center = (static_cast<float>(d) + 0.5f) * scale - 0.5f;
+    int first = static_cast<int>(std::floor(center - support)) + 1;
+
+    float total = 0.0f;
+    for (uint32_t t = 0; t < taps.TapCount; ++t) {
+      int source = first + static_cast<int>(t);
+      float weight = KaiserSinc((static_cast<float>(source) - center) / scale);
+      int clamped =
+          std::min(std::max(source, 0), static_cast<int>(srcSize) - 1);
+
+      size_t slot = static_cast<size_t>(d) * taps.TapCount + t;
+      taps.Indices[slot] = static_cast<uint32_t>(clamped);
+      taps.Weights[slot] = weight;
+      total += weight;
+    }
+
+    for (uint32_t t = 0; t < taps.TapCount; ++t) {
+      taps.Weights[static_cast<size_t>(d) * taps.TapCount + t] /= total;
+    }
+  }
+  return taps;
+}
+
+inline __m128 LoadPixel(const uint8_t *pixel) {
+  __m128i bytes = _mm_cvtsi32_si128(
+      static_cast<int>(pixel[0] | (pixel[1] << 8) | (pixel[2] << 16) |
+                       (static_cast<uint32_t>(pixel[3]) << 24)));
+  __m128i zero = _mm_setzero_si128();
+  __m128i words = _mm_unpacklo_epi8(bytes, zero);
+  return _mm_cvtepi32_ps(_mm_unpacklo_epi16(words, zero));
+}
+
+inline void StorePixel(__m128 value, uint8_t *pixel) {
+  // Round, then saturate to [0, 255]; negative lobes can undershoot
+  __m128i ints = _mm_cvtps_epi32(value);
+  __m128i words = _mm_packs_epi32(ints, ints);
+  __m128i bytes = _mm_packus_epi16(words, words);
+  uint32_t packed = static_cast<uint32_t>(_mm_cvtsi128_si32(bytes));
+  pixel[0] = static_cast<uint8_t>(packed);
+  pixel[1] = static_cast<uint8_t>(packed >> 8);
+  pixel[2] = static_cast<uint8_t>(packed >> 16);
+  pixel[3] = static_cast<uint8_t>(packed >> 24);
+}
+
+void BoxFilterRow(const uint8_t *row0, const uint8_t *row1, uint32_t srcWidth,
+                  uint8_t *dst, uint32_t dstWidth) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i rounding = _mm_set1_epi16(2);
+
+  // Four destination pixels (eight source pixels per row) per iteration
+  uint32_t x = 0;
+  if (srcWidth >= 2) {
+    for (; x + 4 <= dstWidth; x += 4) {
+      const uint8_t *a = row0 + x * 8;
+      const uint8_t *b = row1 + x * 8;
+
+      for (int half = 0; half < 2; ++half) {
+        __m128i top = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(a + half * 16));
+        __m128i bottom = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(b + half * 16));
+
+        // Vertical sums of source pixels 0,1 and 2,3 as 16-bit lanes
+        __m128i low = _mm_add_epi16(_mm_unpacklo_epi8(top, zero),
+                                    _mm_unpacklo_epi8(bottom, zero));
+        __m128i high = _mm_add_epi16(_mm_unpackhi_epi8(top, zero),
+                                     _mm_unpackhi_epi8(bottom, zero));
+
+        // Horizontal pairs: (p0 + p1, p2 + p3)
+        __m128i even = _mm_unpacklo_epi64(low, high);
+        __m128i odd = _mm_unpackhi_epi64(low, high);
+        __m128i sum = _mm_add_epi16(_mm_add_epi16(even, odd), rounding);
+        __m128i average = _mm_srli_epi16(sum, 2);
+
+        __m128i packed = _mm_packus_epi16(average, average);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + (x + half * 2) * 4),
+                         packed);
+      }
+    }
+  }
+
+  // Remaining pixels, and 1-pixel-wide sources whose second tap clamps
+  for (; x < dstWidth; ++x) {
+    uint32_t x0 = std::min(x * 2, srcWidth - 1);
+    uint32_t x1 = std::min(x * 2 + 1, srcWidth - 1);
+    for (int c = 0; c < 4; ++c) {
+      uint32_t sum = row0[x0 * 4 + c] + row0[x1 * 4 + c] + row1[x0 * 4 + c] +
+                     row1[x1 * 4 + c];
+      dst[x * 4 + c] = static_cast<uint8_t>((sum + 2) >> 2);
+    }
+  }
+}
+
+} // namespace
+
+uint32_t MipGenerator::CalculateMipCount(uint32_t width, uint32_t height) {
+  uint32_t levels = 1;
+  while (width > 1 || height > 1) {
+    width = NextMipDimension(width);
+    height = NextMipDimension(height);
+    ++levels;
+  }
+  return levels;
+}
+
+MipChain MipGenerator::Generate(Image base, MipFilter filter,
+                                uint32_t maxLevels) {
+  MipChain chain;
+  if (!base.IsValid()) {
+    return chain;
+  }
+
+  uint32_t levels = CalculateMipCount(base.Width, base.Height);
+  if (maxLevels > 0) {
+    levels = std::min(levels, maxLevels);
+  }
+
+  chain.reserve(levels);
+  chain.push_back(std::move(base));
+  for (uint32_t level = 1; level < levels; ++level) {
+    chain.push_back(Downsample(chain.back(), filter));
+  }
+  return chain;
+}
+
+Image MipGenerator::Downsample(const Image &source, MipFilter filter) {
+  return filter == MipFilter::Kaiser ? DownsampleKaiser(source)
+                                     : DownsampleBox(source);
+}
+
+Image MipGenerator::DownsampleBox(const Image &source) {
+  Image result(NextMipDimension(source.Width),
+               NextMipDimension(source.Height));
+
+  JobSystem::ParallelFor(
+      result.Height, RowsPerJob, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t y = begin; y < end; ++y) {
+          uint32_t y0 = std::min(y * 2, source.Height - 1);
+          uint32_t y1 = std::min(y * 2 + 1, source.Height - 1);
+          BoxFilterRow(source.GetPixel(0, y0), source.GetPixel(0, y1),
+                       source.Width, result.GetPixel(0, y), result.Width);
+        }
+      });
+  return result;
+}
+
+Image MipGenerator::DownsampleKaiser(const Image &source) {
+  Image result(NextMipDimension(source.Width),
+               NextMipDimension(source.Height));
+
+  FilterTaps horizontal = BuildKaiserTaps(source.Width, result.Width);
+  FilterTaps vertical = BuildKaiserTaps(source.Height, result.Height);
+
+  // Separable: filter every source row horizontally into float RGBA, then
+  // filter the columns of that intermediate vertically.
+  std::vector<float> intermediate(static_cast<size_t>(result.Width) *
+                                  source.Height * 4);
+
+  JobSystem::ParallelFor(
+      source.Height, RowsPerJob, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t y = begin; y < end; ++y) {
+          const uint8_t *row = source.GetPixel(0, y);
+          float *out =
+              intermediate.data() + static_cast<size_t>(y) * result.Width * 4;
+          for (uint32_t x = 0; x < result.Width; ++x) {
+            size_t first = static_cast<size_t>(x) * horizontal.TapCount;
+            const uint32_t *index = &horizontal.Indices[first];
+            const float *weight = &horizontal.Weights[first];
+            __m128 sum = _mm_setzero_ps();
+            for (uint32_t t = 0; t < horizontal.TapCount; ++t) {
+              sum = _mm_add_ps(sum, _mm_mul_ps(LoadPixel(row + index[t] * 4),
+                                               _mm_set1_ps(weight[t])));
+            }
+            _mm_storeu_ps(out + x * 4, sum);
+          }
+        }
+      });
+
+  JobSystem::ParallelFor(
+      result.Height, RowsPerJob, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t y = begin; y < end; ++y) {
+          const uint32_t *index = &vertical.Indices[y * vertical.TapCount];
+          const float *weight = &vertical.Weights[y * vertical.TapCount];
+          uint8_t *out = result.GetPixel(0, y);
+          for (uint32_t x = 0; x < result.Width; ++x) {
+            __m128 sum = _mm_setzero_ps();
+            for (uint32_t t = 0; t < vertical.TapCount; ++t) {
+              __m128 texel = _mm_loadu_ps(
+                  &intermediate[(static_cast<size_t>(index[t]) * result.Width +
+                                 x) *
+                                4]);
+              sum = _mm_add_ps(sum, _mm_mul_ps(texel, _mm_set1_ps(weight[t])));
+            }
+            StorePixel(sum, out + x * 4);
+          }
+        }
+      });
+  return result;
+}
+
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Image.h"
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+enum class MipFilter {
+  Box,   // 2x2 average, cheapest
+  Kaiser // Kaiser-windowed sinc, sharper and less aliasing
+};
+
+// Level 0 is the full-resolution image, each following level halves both
+// dimensions (rounding down, minimum 1) until 1x1.
+using MipChain = std::vector<Image>;
+
+//============================================================================
+// MipGenerator - CPU mip chain construction with SSE filters
+//============================================================================
+class MipGenerator {
+public:
+  static uint32_t CalculateMipCount(uint32_t width, uint32_t height);
+
+  // Builds the chain from 'base'; maxLevels 0 means down to 1x1
+  static MipChain Generate(Image base, MipFilter filter,
+                           uint32_t maxLevels = 0);
+
+  static Image Downsample(const Image &source, MipFilter filter);
+  static Image DownsampleBox(const Image &source);
+  static Image DownsampleKaiser(const Image &source);
+};
+
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include "RenderQueue.h"
+
+namespace Engine {
+
+void RenderQueue::Submit(const RenderCommand &command) {
+  if (command.Alpha < 1.0f) {
+    m_Transparent.push_back(command);
+    m_TransparentDepths.push_back(command.Depth);
+  } else {
+    m_Opaque.push_back(command);
+    m_OpaqueDepths.push_back(command.Depth);
+  }
+  m_Sorted = false;
+}
+
+void RenderQueue::Sort() {
+  if (m_Sorted) {
+    return;
+  }
+
+  m_OpaqueSort.Sort(m_OpaqueDepths.data(),
+                    static_cast<uint32_t>(m_OpaqueDepths.size()),
+                    SortOrder::Ascending);
+  m_TransparentSort.Sort(m_TransparentDepths.data(),
+                         static_cast<uint32_t>(m_TransparentDepths.size()),
+                         SortOrder::Descending);
+  m_Sorted = true;
+}
+
+void RenderQueue::Clear() {
+  // Capacity is kept, so steady-state frames do not allocate
+  m_Opaque.clear();
+  m_OpaqueDepths.clear();
+  m_Transparent.clear();
+  m_TransparentDepths.clear();
+  m_OpaqueSort.Sort(nullptr, 0);
+  m_TransparentSort.Sort(nullptr, 0);
+  m_Sorted = true;
+}
+
+} // namespace Engine
\ No newline at end of file
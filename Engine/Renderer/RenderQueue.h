@@ -0,0 +1,59 @@
+#pragma once
+
+#include "../Core/RadixSort.h"
+#include "../Math/Math.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+struct RenderCommand {
+  Mat4 MVP;
+  Vec3 Color = Vec3(1.0f, 1.0f, 1.0f);
+  float Alpha = 1.0f;
+
+  // View-space distance along the camera's forward axis
+  float Depth = 0.0f;
+};
+
+//============================================================================
+// RenderQueue - Per-frame draw list split into opaque and transparent passes
+//============================================================================
+// Commands with Alpha below 1 go to the transparent list. Sort() orders
+// opaque commands front-to-back, so early depth testing rejects hidden
+// fragments, and transparent commands back-to-front, so blending composites
+// correctly. Pure CPU; the renderer walks the sorted lists.
+class RenderQueue {
+public:
+  void Submit(const RenderCommand &command);
+  void Sort();
+  void Clear();
+
+  bool IsSorted() const { return m_Sorted; }
+
+  size_t GetOpaqueCount() const { return m_Opaque.size(); }
+  size_t GetTransparentCount() const { return m_Transparent.size(); }
+
+  // Commands in draw order; call Sort() first
+  const RenderCommand &GetOpaque(size_t index) const {
+    return m_Opaque[m_OpaqueSort.GetIndices()[index]];
+  }
+  const RenderCommand &GetTransparent(size_t index) const {
+    return m_Transparent[m_TransparentSort.GetIndices()[index]];
+  }
+
+private:
+  // Depths are kept apart from the commands so the sort reads them densely
+  std::vector<RenderCommand> m_Opaque;
+  std::vector<float> m_OpaqueDepths;
+  RadixSort m_OpaqueSort;
+
+  std::vector<RenderCommand> m_Transparent;
+  std::vector<float> m_TransparentDepths;
+  RadixSort m_TransparentSort;
+
+  bool m_Sorted = true;
+};
+
+} // namespace Engine
\ No newline at end of file
@@ -1,12 +1,18 @@
 #include "Renderer.h"
 #include "../Core/Camera.h"
 #include "../Core/Logger.h"
+#include "../Math/Primitives.h"
+#include "../Platform/Window.h"
 #include "Buffer.h"
+#include "Framebuffer.h"
 #include "Shader.h"
 #include "VertexArray.h"
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <fstream>
+#include <iterator>
 #include <glad/glad.h>
 
 namespace Engine {
@@ -25,23 +31,65 @@ std::shared_ptr<Shader> Renderer::m_cubeShader = nullptr;
 std::shared_ptr<VertexArray> Renderer::m_cubeVAO = nullptr;
 std::shared_ptr<VertexBuffer> Renderer::m_cubeVBO = nullptr;
 std::shared_ptr<IndexBuffer> Renderer::m_cubeIBO = nullptr;
+UploadHandle<VertexBuffer> Renderer::m_cubeVertexUpload;
+UploadHandle<IndexBuffer> Renderer::m_cubeIndexUpload;
+
+std::shared_ptr<Shader> Renderer::m_cubeInstancedShader = nullptr;
+std::shared_ptr<VertexArray> Renderer::m_cubeInstancedVAO = nullptr;
+std::shared_ptr<VertexBuffer> Renderer::m_cubeInstanceVBO = nullptr;
+uint32_t Renderer::m_cubeInstanceCapacity = 0;
 
 std::shared_ptr<Shader> Renderer::m_wireCubeShader = nullptr;
 std::shared_ptr<VertexArray> Renderer::m_wireCubeVAO = nullptr;
 std::shared_ptr<VertexBuffer> Renderer::m_wireCubeVBO = nullptr;
 std::shared_ptr<IndexBuffer> Renderer::m_wireCubeIBO = nullptr;
+UploadHandle<VertexBuffer> Renderer::m_wireCubeVertexUpload;
+UploadHandle<IndexBuffer> Renderer::m_wireCubeIndexUpload;
+
+RenderQueue Renderer::m_renderQueue;
+std::vector<Mat4> Renderer::m_batchMVPs;
+
+// Scaled rendering state
+std::shared_ptr<Framebuffer> Renderer::m_sceneFramebuffer = nullptr;
+DynamicResolutionController Renderer::m_resolutionController;
+bool Renderer::m_dynamicResolution = false;
+bool Renderer::m_frameActive = false;
+float Renderer::m_renderScale = 1.0f;
+int Renderer::m_viewportX = 0;
+int Renderer::m_viewportY = 0;
+int Renderer::m_viewportWidth = 0;
+int Renderer::m_viewportHeight = 0;
+bool Renderer::m_viewportPending = false;
+int Renderer::m_pendingX = 0;
+int Renderer::m_pendingY = 0;
+int Renderer::m_pendingWidth = 0;
+int Renderer::m_pendingHeight = 0;
+
+uint32_t Renderer::m_gpuTimers[kGpuTimerCount] = {};
+bool Renderer::m_gpuTimerPending[kGpuTimerCount] = {};
+int Renderer::m_gpuTimerNext = 0;
+bool Renderer::m_gpuTimerActive = false;
+float Renderer::m_gpuFrameTimeMs = 0.0f;
 
 bool Renderer::Initialize() {
   Logger::Info("Renderer", "Initializing Renderer...");
 
-  // Initialize OpenGL state
+  // Initialize OpenGL state. Blending stays off by default and is enabled
+  // only around draws that need it, so opaque geometry does not pay for it.
   glEnable(GL_DEPTH_TEST);
-  glEnable(GL_BLEND);
+  glDisable(GL_BLEND);
   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
+  // Presentation viewport starts out as the full window
+  SetViewport(0, 0, static_cast<int>(Platform::Window::GetWidth()),
+              static_cast<int>(Platform::Window::GetHeight()));
+
   // Set initial clear color
   Clear(0.1f, 0.1f, 0.1f, 1.0f);
 
+  // Frame timer queries for the dynamic resolution feedback
+  glGenQueries(kGpuTimerCount, m_gpuTimers);
+
   // Create triangle resources
   if (!CreateTriangleResources()) {
     Logger::Error("Renderer", "Failed to create triangle resources!");
@@ -78,6 +126,22 @@ void Renderer::Shutdown() {
   CleanupCubeResources();
   CleanupWireCubeResources();
 
+  m_sceneFramebuffer.reset();
+  m_frameActive = false;
+  m_renderQueue.Clear();
+
+  if (m_gpuTimerActive) {
+    glEndQuery(GL_TIME_ELAPSED);
+  }
+  glDeleteQueries(kGpuTimerCount, m_gpuTimers);
+  for (int i = 0; i < kGpuTimerCount; ++i) {
+    m_gpuTimers[i] = 0;
+    m_gpuTimerPending[i] = false;
+  }
+  m_gpuTimerNext = 0;
+  m_gpuTimerActive = false;
+  m_gpuFrameTimeMs = 0.0f;
+
   Logger::Info("Renderer", "Renderer shutdown complete");
 }
 
@@ -87,7 +151,200 @@ void Renderer::Clear(float r, float g, float b, float a) {
 }
 
 void Renderer::SetViewport(int x, int y, int width, int height) {
-  glViewport(x, y, width, height);
+  m_pendingX = x;
+  m_pendingY = y;
+  m_pendingWidth = width;
+  m_pendingHeight = height;
+  m_viewportPending = true;
+
+  // Resizing the target mid-frame would discard what was drawn to it, so a
+  // resize during a scaled frame waits for the next BeginFrame
+  if (!m_frameActive) {
+    ApplyPendingViewport();
+    UpdateSceneTarget();
+    ApplyViewport();
+  }
+}
+
+void Renderer::BeginFrame() {
+  BeginGpuTimer();
+  ApplyPendingViewport();
+  m_renderQueue.Clear();
+  UpdateSceneTarget();
+
+  // At full scale the target would only be copied 1:1, so draw straight to
+  // the backbuffer; the target stays allocated for when the scale drops
+  m_frameActive = m_sceneFramebuffer != nullptr && m_renderScale < 1.0f;
+  if (m_frameActive) {
+    m_sceneFramebuffer->Bind();
+  }
+  ApplyViewport();
+}
+
+void Renderer::EndFrame() {
+  if (m_frameActive) {
+    m_frameActive = false;
+    m_sceneFramebuffer->BlitToScreen(
+        GetRenderWidth(), GetRenderHeight(), m_viewportX, m_viewportY,
+        static_cast<uint32_t>(m_viewportWidth),
+        static_cast<uint32_t>(m_viewportHeight));
+    ApplyViewport();
+  }
+  EndGpuTimer();
+}
+
+// Reads back the finished queries, oldest first, then times this frame
+// with the next one unless the GPU is still working on its last use
+void Renderer::BeginGpuTimer() {
+  if (m_gpuTimerActive || m_gpuTimers[0] == 0) {
+    return;
+  }
+
+  for (int i = 0; i < kGpuTimerCount; ++i) {
+    const int slot = (m_gpuTimerNext + i) % kGpuTimerCount;
+    if (!m_gpuTimerPending[slot]) {
+      continue;
+    }
+    GLuint available = 0;
+    glGetQueryObjectuiv(m_gpuTimers[slot], GL_QUERY_RESULT_AVAILABLE,
+                        &available);
+    if (!available) {
+      break;
+    }
+    GLuint64 elapsedNs = 0;
+    glGetQueryObjectui64v(m_gpuTimers[slot], GL_QUERY_RESULT, &elapsedNs);
+    m_gpuFrameTimeMs = static_cast<float>(elapsedNs) * 1e-6f;
+    m_gpuTimerPending[slot] = false;
+  }
+
+  if (!m_gpuTimerPending[m_gpuTimerNext]) {
+    glBeginQuery(GL_TIME_ELAPSED, m_gpuTimers[m_gpuTimerNext]);
+    m_gpuTimerActive = true;
+  }
+}
+
+void Renderer::EndGpuTimer() {
+  if (!m_gpuTimerActive) {
+    return;
+  }
+
+  glEndQuery(GL_TIME_ELAPSED);
+  m_gpuTimerPending[m_gpuTimerNext] = true;
+  m_gpuTimerNext = (m_gpuTimerNext + 1) % kGpuTimerCount;
+  m_gpuTimerActive = false;
+}
+
+void Renderer::EnableDynamicResolution(
+    const DynamicResolutionSettings &settings) {
+  m_resolutionController.SetSettings(settings);
+  m_dynamicResolution = true;
+  m_renderScale = m_resolutionController.GetScale();
+  UpdateSceneTarget();
+
+  Logger::Info("Renderer", "Dynamic resolution enabled (scale " +
+                               std::to_string(settings.MinScale) + " - " +
+                               std::to_string(settings.MaxScale) + ")");
+}
+
+void Renderer::DisableDynamicResolution() {
+  m_dynamicResolution = false;
+  SetRenderScale(1.0f);
+}
+
+void Renderer::UpdateDynamicResolution(float frameTimeMs) {
+  if (!m_dynamicResolution) {
+    return;
+  }
+
+  float previousScale = m_renderScale;
+  m_renderScale = m_resolutionController.Update(frameTimeMs);
+
+  if (m_renderScale != previousScale) {
+    ENGINE_LOG_DEBUG("Renderer",
+                     "Render scale " + std::to_string(previousScale) +
+                         " -> " + std::to_string(m_renderScale) + " (p" +
+                         std::to_string(static_cast<int>(
+                             m_resolutionController.GetSettings().Percentile *
+                             100.0f)) +
+                         " frame time " +
+                         std::to_string(
+                             m_resolutionController.GetPercentileFrameTime()) +
+                         " ms)");
+    // The target is allocated at maximum scale, so only the viewport changes
+    UpdateSceneTarget();
+  }
+}
+
+void Renderer::SetRenderScale(float scale) {
+  m_renderScale = Math::Clamp(scale, 0.01f, 1.0f);
+  UpdateSceneTarget();
+}
+
+int Renderer::GetRenderWidth() {
+  int width = static_cast<int>(
+      std::lround(static_cast<float>(m_viewportWidth) * m_renderScale));
+  return width > 0 ? width : 1;
+}
+
+int Renderer::GetRenderHeight() {
+  int height = static_cast<int>(
+      std::lround(static_cast<float>(m_viewportHeight) * m_renderScale));
+  return height > 0 ? height : 1;
+}
+
+void Renderer::UpdateSceneTarget() {
+  if (m_frameActive) {
+    return; // BeginFrame picks the change up
+  }
+
+  bool scaled = m_dynamicResolution || m_renderScale < 1.0f;
+  if (!scaled || m_viewportWidth <= 0 || m_viewportHeight <= 0) {
+    // Render straight to the backbuffer; keep the target around so toggling
+    // scaling back on does not reallocate.
+    if (!scaled && m_sceneFramebuffer) {
+      m_sceneFramebuffer.reset();
+    }
+    return;
+  }
+
+  // Allocate at the largest scale we can reach so scale changes only move the
+  // viewport instead of reallocating attachments every adjustment.
+  float maxScale = m_dynamicResolution
+                       ? m_resolutionController.GetSettings().MaxScale
+                       : m_renderScale;
+  uint32_t width = static_cast<uint32_t>(
+      std::ceil(static_cast<float>(m_viewportWidth) * maxScale));
+  uint32_t height = static_cast<uint32_t>(
+      std::ceil(static_cast<float>(m_viewportHeight) * maxScale));
+
+  if (!m_sceneFramebuffer) {
+    FramebufferSpecification spec;
+    spec.Width = width;
+    spec.Height = height;
+    m_sceneFramebuffer = Framebuffer::Create(spec);
+  } else {
+    m_sceneFramebuffer->Resize(width, height);
+  }
+}
+
+void Renderer::ApplyPendingViewport() {
+  if (!m_viewportPending) {
+    return;
+  }
+
+  m_viewportPending = false;
+  m_viewportX = m_pendingX;
+  m_viewportY = m_pendingY;
+  m_viewportWidth = m_pendingWidth;
+  m_viewportHeight = m_pendingHeight;
+}
+
+void Renderer::ApplyViewport() {
+  if (m_frameActive) {
+    glViewport(0, 0, GetRenderWidth(), GetRenderHeight());
+  } else {
+    glViewport(m_viewportX, m_viewportY, m_viewportWidth, m_viewportHeight);
+  }
 }
 
 void Renderer::DrawTriangle() {
@@ -116,8 +373,11 @@ void Renderer::DrawAnimatedTriangle(float time) {
   m_animatedShader->SetFloat("u_RotationSpeed", 2.0f);
   m_animatedShader->SetFloat("u_ColorSpeed", 3.0f);
 
+  // The animated shader pulses alpha
+  glEnable(GL_BLEND);
   m_triangleVAO->Bind();
   glDrawArrays(GL_TRIANGLES, 0, 3);
+  glDisable(GL_BLEND);
 }
 
 void Renderer::DrawTriangleSpiral(float time, int count) {
@@ -126,6 +386,7 @@ void Renderer::DrawTriangleSpiral(float time, int count) {
 
   m_animatedShader->Bind();
   m_triangleVAO->Bind();
+  glEnable(GL_BLEND);
 
   for (int i = 0; i < count; ++i) {
     float angle = (float)i / count * 6.28318f; // 2*PI
@@ -144,6 +405,8 @@ void Renderer::DrawTriangleSpiral(float time, int count) {
 
     glDrawArrays(GL_TRIANGLES, 0, 3);
   }
+
+  glDisable(GL_BLEND);
 }
 
 void Renderer::DrawColorCyclingTriangles(float time) {
@@ -152,6 +415,7 @@ void Renderer::DrawColorCyclingTriangles(float time) {
 
   m_animatedShader->Bind();
   m_triangleVAO->Bind();
+  glEnable(GL_BLEND);
 
   // Draw multiple triangles in a grid pattern with color cycling
   for (int x = -2; x <= 2; ++x) {
@@ -171,6 +435,8 @@ void Renderer::DrawColorCyclingTriangles(float time) {
       glDrawArrays(GL_TRIANGLES, 0, 3);
     }
   }
+
+  glDisable(GL_BLEND);
 }
 
 void Renderer::DrawMorphingShape(float time) {
@@ -179,6 +445,7 @@ void Renderer::DrawMorphingShape(float time) {
 
   m_animatedShader->Bind();
   m_triangleVAO->Bind();
+  glEnable(GL_BLEND);
 
   // Create a morphing flower-like pattern
   int petals = 8;
@@ -199,46 +466,178 @@ void Renderer::DrawMorphingShape(float time) {
 
     glDrawArrays(GL_TRIANGLES, 0, 3);
   }
+
+  glDisable(GL_BLEND);
 }
 
 // Phase 2: 3D Cube rendering methods
-void Renderer::DrawCube(const Mat4 &mvp, const Vec3 &color) {
-  if (!m_cubeShader || !m_cubeVAO) {
-    Logger::Warn("Renderer", "Cube resources not initialized!");
+void Renderer::DrawCube(const Mat4 &mvp, const Vec3 &color, float alpha) {
+  if (!BindCubeGeometry()) {
     return;
   }
 
-  m_cubeShader->Bind();
+  bool blended = alpha < 1.0f;
+  if (blended) {
+    glEnable(GL_BLEND);
+  }
+
   m_cubeShader->SetMat4("u_MVP", mvp);
   m_cubeShader->SetVec3("u_Color", color);
-
-  m_cubeVAO->Bind();
+  m_cubeShader->SetFloat("u_Alpha", alpha);
   glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+
+  if (blended) {
+    glDisable(GL_BLEND);
+  }
   m_cubeVAO->Unbind();
   m_cubeShader->Unbind();
 }
 
 void Renderer::DrawCube(const Camera &camera, const Transform &transform,
                         const Vec3 &color) {
-  Mat4 model = transform.ToMatrix();
   Mat4 view = camera.GetViewMatrix();
   Mat4 projection = camera.GetProjectionMatrix();
-  Mat4 mvp = projection * view * model;
+  Mat4 mvp = projection * view * transform.ToAffine();
 
   DrawCube(mvp, color);
 }
 
+void Renderer::SubmitCube(const Mat4 &mvp, float depth, const Vec3 &color,
+                          float alpha) {
+  RenderCommand command;
+  command.MVP = mvp;
+  command.Color = color;
+  command.Alpha = alpha;
+  command.Depth = depth;
+  m_renderQueue.Submit(command);
+}
+
+void Renderer::SubmitCube(const Camera &camera, const Transform &transform,
+                          const Vec3 &color, float alpha) {
+  Mat4 view = camera.GetViewMatrix();
+  Mat4 mvp = camera.GetProjectionMatrix() * view * transform.ToAffine();
+
+  // The camera looks down -Z in view space
+  float depth = -view.TransformPoint(transform.position).z;
+  SubmitCube(mvp, depth, color, alpha);
+}
+
+void Renderer::SubmitCubes(const Camera &camera,
+                           Span<const Transform> transforms,
+                           Span<const Vec3> colors, float alpha) {
+  assert(colors.size() == transforms.size() &&
+         "SubmitCubes() needs one color per transform");
+  if (colors.size() != transforms.size()) {
+    Logger::Error("Renderer", "SubmitCubes() got " +
+                                  std::to_string(colors.size()) +
+                                  " colors for " +
+                                  std::to_string(transforms.size()) +
+                                  " transforms");
+    return;
+  }
+  Mat4 view = camera.GetViewMatrix();
+  m_batchMVPs.resize(transforms.size());
+  Math::ComposeTransforms(camera.GetProjectionMatrix() * view, transforms,
+                          m_batchMVPs);
+
+  for (size_t i = 0; i < transforms.size(); ++i) {
+    // The camera looks down -Z in view space
+    float depth = -view.TransformPoint(transforms[i].position).z;
+    SubmitCube(m_batchMVPs[i], depth, colors[i], alpha);
+  }
+}
+
+void Renderer::DrawCubes(const Camera &camera,
+                         Span<const Math::Affine3x4> models,
+                         const Vec3 &color) {
+  if (models.empty() || !m_cubeInstancedShader) {
+    return;
+  }
+  uint32_t count = static_cast<uint32_t>(models.size());
+  if (!ReserveCubeInstances(count)) {
+    return;
+  }
+
+  static_assert(sizeof(Math::Affine3x4) == 12 * sizeof(float),
+                "Instances upload as three packed vec4 rows");
+  m_cubeInstanceVBO->SetData(models.data(),
+                             count * sizeof(Math::Affine3x4));
+
+  m_cubeInstancedShader->Bind();
+  m_cubeInstancedShader->SetMat4("u_ViewProjection",
+                                 camera.GetProjectionMatrix() *
+                                     camera.GetViewMatrix());
+  m_cubeInstancedShader->SetVec3("u_Color", color);
+  m_cubeInstancedShader->SetFloat("u_Alpha", 1.0f);
+  m_cubeInstancedVAO->Bind();
+  glDrawElementsInstanced(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0, count);
+
+  m_cubeInstancedVAO->Unbind();
+  m_cubeInstancedShader->Unbind();
+}
+
+void Renderer::DrawOpaquePass() {
+  m_renderQueue.Sort();
+  if (m_renderQueue.GetOpaqueCount() == 0 || !BindCubeGeometry()) {
+    return;
+  }
+
+  // Front-to-back, so the depth test rejects hidden fragments early
+  m_cubeShader->SetFloat("u_Alpha", 1.0f);
+  for (size_t i = 0; i < m_renderQueue.GetOpaqueCount(); ++i) {
+    const RenderCommand &command = m_renderQueue.GetOpaque(i);
+    m_cubeShader->SetMat4("u_MVP", command.MVP);
+    m_cubeShader->SetVec3("u_Color", command.Color);
+    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+  }
+
+  m_cubeVAO->Unbind();
+  m_cubeShader->Unbind();
+}
+
+void Renderer::DrawTransparentPass() {
+  m_renderQueue.Sort();
+  if (m_renderQueue.GetTransparentCount() == 0 || !BindCubeGeometry()) {
+    return;
+  }
+
+  // Back-to-front with blending; depth is tested against the opaque pass
+  // but not written, so translucent surfaces never hide each other
+  glEnable(GL_BLEND);
+  glDepthMask(GL_FALSE);
+
+  for (size_t i = 0; i < m_renderQueue.GetTransparentCount(); ++i) {
+    const RenderCommand &command = m_renderQueue.GetTransparent(i);
+    m_cubeShader->SetMat4("u_MVP", command.MVP);
+    m_cubeShader->SetVec3("u_Color", command.Color);
+    m_cubeShader->SetFloat("u_Alpha", command.Alpha);
+    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+  }
+
+  glDepthMask(GL_TRUE);
+  glDisable(GL_BLEND);
+
+  m_cubeVAO->Unbind();
+  m_cubeShader->Unbind();
+}
+
 void Renderer::DrawWireCube(const Mat4 &mvp, const Vec3 &color) {
-  if (!m_wireCubeShader || !m_wireCubeVAO) {
+  if (!m_wireCubeShader) {
     Logger::Warn("Renderer", "Wire cube resources not initialized!");
     return;
   }
 
+  if (!ResolveUploadedGeometry(m_wireCubeVertexUpload, m_wireCubeIndexUpload,
+                               m_wireCubeVAO, m_wireCubeVBO, m_wireCubeIBO)) {
+    return;
+  }
+
   glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
   m_wireCubeShader->Bind();
   m_wireCubeShader->SetMat4("u_MVP", mvp);
   m_wireCubeShader->SetVec3("u_Color", color);
+  m_wireCubeShader->SetFloat("u_Alpha", 1.0f);
 
   m_wireCubeVAO->Bind();
   glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
@@ -250,10 +649,9 @@ void Renderer::DrawWireCube(const Mat4 &mvp, const Vec3 &color) {
 
 void Renderer::DrawWireCube(const Camera &camera, const Transform &transform,
                             const Vec3 &color) {
-  Mat4 model = transform.ToMatrix();
   Mat4 view = camera.GetViewMatrix();
   Mat4 projection = camera.GetProjectionMatrix();
-  Mat4 mvp = projection * view * model;
+  Mat4 mvp = projection * view * transform.ToAffine();
 
   DrawWireCube(mvp, color);
 }
@@ -379,49 +777,26 @@ bool Renderer::CreateAnimatedResources() {
 bool Renderer::CreateCubeResources() {
   Logger::Info("Renderer", "Creating cube resources...");
 
-  // Cube vertices with positions and colors
-  float cubeVertices[] = {
+  // Cube corners with one color each, interleaved at compile time
+  static constexpr Vec3 kCubeColors[8] = {
       // Front face
-      -0.5f, -0.5f, 0.5f, 1.0f, 0.0f, 0.0f, // 0
-      0.5f, -0.5f, 0.5f, 0.0f, 1.0f, 0.0f,  // 1
-      0.5f, 0.5f, 0.5f, 0.0f, 0.0f, 1.0f,   // 2
-      -0.5f, 0.5f, 0.5f, 1.0f, 1.0f, 0.0f,  // 3
+      Vec3(1.0f, 0.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f),
+      Vec3(1.0f, 1.0f, 0.0f),
 
       // Back face
-      -0.5f, -0.5f, -0.5f, 1.0f, 0.0f, 1.0f, // 4
-      0.5f, -0.5f, -0.5f, 0.0f, 1.0f, 1.0f,  // 5
-      0.5f, 0.5f, -0.5f, 1.0f, 1.0f, 1.0f,   // 6
-      -0.5f, 0.5f, -0.5f, 0.5f, 0.5f, 0.5f   // 7
-  };
-
-  // Cube indices
-  uint32_t cubeIndices[] = {// Front face
-                            0, 1, 2, 2, 3, 0,
-                            // Back face
-                            4, 5, 6, 6, 7, 4,
-                            // Left face
-                            7, 3, 0, 0, 4, 7,
-                            // Right face
-                            1, 5, 6, 6, 2, 1,
-                            // Top face
-                            3, 2, 6, 6, 7, 3,
-                            // Bottom face
-                            0, 1, 5, 5, 4, 0};
-
-  // Create VAO
-  m_cubeVAO = VertexArray::Create();
-
-  // Create VBO
-  m_cubeVBO = VertexBuffer::Create(cubeVertices, sizeof(cubeVertices));
-  m_cubeVBO->SetLayout({{ShaderDataType::Float3, "a_Position"},
-                        {ShaderDataType::Float3, "a_Color"}});
-
-  // Create IBO
-  m_cubeIBO = IndexBuffer::Create(cubeIndices, 36);
-
-  // Add buffers to VAO
-  m_cubeVAO->AddVertexBuffer(m_cubeVBO);
-  m_cubeVAO->SetIndexBuffer(m_cubeIBO);
+      Vec3(1.0f, 0.0f, 1.0f), Vec3(0.0f, 1.0f, 1.0f), Vec3(1.0f, 1.0f, 1.0f),
+      Vec3(0.5f, 0.5f, 0.5f)};
+  static constexpr auto kCubeVertices =
+      Math::Primitives::InterleavePositionColor(Math::Primitives::kCubeCorners,
+                                                kCubeColors);
+  const auto &cubeIndices = Math::Primitives::kCubeIndices;
+
+  // Upload VBO and IBO off the main thread; the VAO is assembled on the
+  // first draw after both are ready
+  m_cubeVertexUpload = UploadQueue::UploadVertexBuffer(
+      std::vector<float>(kCubeVertices.begin(), kCubeVertices.end()));
+  m_cubeIndexUpload = UploadQueue::UploadIndexBuffer(
+      std::vector<uint32_t>(std::begin(cubeIndices), std::end(cubeIndices)));
 
   // Load cube shader from files
   try {
@@ -440,6 +815,18 @@ bool Renderer::CreateCubeResources() {
                                std::istreambuf_iterator<char>());
 
     m_cubeShader = Shader::Create("CubeShader", vertexSource, fragmentSource);
+
+    // The instanced variant only swaps the vertex stage
+    std::ifstream instancedFile("../Shaders/CubeInstanced.vert");
+    if (!instancedFile.is_open()) {
+      Logger::Error("Renderer", "Failed to open instanced cube shader file");
+      return false;
+    }
+    std::string instancedSource(
+        (std::istreambuf_iterator<char>(instancedFile)),
+        std::istreambuf_iterator<char>());
+    m_cubeInstancedShader = Shader::Create("CubeInstancedShader",
+                                           instancedSource, fragmentSource);
   } catch (const std::exception &e) {
     Logger::Error("Renderer",
                   "Failed to load cube shader: " + std::string(e.what()));
@@ -453,49 +840,17 @@ bool Renderer::CreateCubeResources() {
 bool Renderer::CreateWireCubeResources() {
   Logger::Info("Renderer", "Creating wire cube resources...");
 
-  // Reuse the same vertex data as solid cube
-  float cubeVertices[] = {
-      // Front face
-      -0.5f, -0.5f, 0.5f, 1.0f, 1.0f, 1.0f, // 0
-      0.5f, -0.5f, 0.5f, 1.0f, 1.0f, 1.0f,  // 1
-      0.5f, 0.5f, 0.5f, 1.0f, 1.0f, 1.0f,   // 2
-      -0.5f, 0.5f, 0.5f, 1.0f, 1.0f, 1.0f,  // 3
-
-      // Back face
-      -0.5f, -0.5f, -0.5f, 1.0f, 1.0f, 1.0f, // 4
-      0.5f, -0.5f, -0.5f, 1.0f, 1.0f, 1.0f,  // 5
-      0.5f, 0.5f, -0.5f, 1.0f, 1.0f, 1.0f,   // 6
-      -0.5f, 0.5f, -0.5f, 1.0f, 1.0f, 1.0f   // 7
-  };
-
-  // Same indices as solid cube
-  uint32_t cubeIndices[] = {// Front face
-                            0, 1, 2, 2, 3, 0,
-                            // Back face
-                            4, 5, 6, 6, 7, 4,
-                            // Left face
-                            7, 3, 0, 0, 4, 7,
-                            // Right face
-                            1, 5, 6, 6, 2, 1,
-                            // Top face
-                            3, 2, 6, 6, 7, 3,
-                            // Bottom face
-                            0, 1, 5, 5, 4, 0};
-
-  // Create VAO
-  m_wireCubeVAO = VertexArray::Create();
-
-  // Create VBO
-  m_wireCubeVBO = VertexBuffer::Create(cubeVertices, sizeof(cubeVertices));
-  m_wireCubeVBO->SetLayout({{ShaderDataType::Float3, "a_Position"},
-                            {ShaderDataType::Float3, "a_Color"}});
-
-  // Create IBO
-  m_wireCubeIBO = IndexBuffer::Create(cubeIndices, 36);
+  // Same corners and indices as the solid cube, all white
+  static constexpr auto kCubeVertices =
+      Math::Primitives::InterleavePositionColor(Math::Primitives::kCubeCorners,
+                                                Vec3::One());
+  const auto &cubeIndices = Math::Primitives::kCubeIndices;
 
-  // Add buffers to VAO
-  m_wireCubeVAO->AddVertexBuffer(m_wireCubeVBO);
-  m_wireCubeVAO->SetIndexBuffer(m_wireCubeIBO);
+  // Upload VBO and IBO off the main thread
+  m_wireCubeVertexUpload = UploadQueue::UploadVertexBuffer(
+      std::vector<float>(kCubeVertices.begin(), kCubeVertices.end()));
+  m_wireCubeIndexUpload = UploadQueue::UploadIndexBuffer(
+      std::vector<uint32_t>(std::begin(cubeIndices), std::end(cubeIndices)));
 
   // Reuse the same shader as solid cube
   try {
@@ -525,6 +880,78 @@ bool Renderer::CreateWireCubeResources() {
   return true;
 }
 
+bool Renderer::BindCubeGeometry() {
+  if (!m_cubeShader) {
+    Logger::Warn("Renderer", "Cube resources not initialized!");
+    return false;
+  }
+
+  // Skip drawing until the background upload has finished
+  if (!ResolveUploadedGeometry(m_cubeVertexUpload, m_cubeIndexUpload,
+                               m_cubeVAO, m_cubeVBO, m_cubeIBO)) {
+    return false;
+  }
+
+  m_cubeShader->Bind();
+  m_cubeVAO->Bind();
+  return true;
+}
+
+bool Renderer::ReserveCubeInstances(uint32_t count) {
+  // The shared cube VBO and IBO come from the background upload
+  if (!ResolveUploadedGeometry(m_cubeVertexUpload, m_cubeIndexUpload,
+                               m_cubeVAO, m_cubeVBO, m_cubeIBO)) {
+    return false;
+  }
+  if (m_cubeInstancedVAO && count <= m_cubeInstanceCapacity) {
+    return true;
+  }
+
+  // Grow geometrically so a slowly rising instance count does not
+  // reallocate every frame
+  uint32_t capacity = std::max(count, m_cubeInstanceCapacity * 2);
+  m_cubeInstanceVBO = VertexBuffer::Create(
+      capacity * static_cast<uint32_t>(sizeof(Math::Affine3x4)));
+  m_cubeInstanceVBO->SetLayout({{ShaderDataType::Mat3x4, "a_ModelRow"}});
+  m_cubeInstanceCapacity = capacity;
+
+  m_cubeInstancedVAO = VertexArray::Create();
+  m_cubeInstancedVAO->AddVertexBuffer(m_cubeVBO);
+  m_cubeInstancedVAO->AddVertexBuffer(m_cubeInstanceVBO);
+  m_cubeInstancedVAO->SetIndexBuffer(m_cubeIBO);
+  return true;
+}
+
+bool Renderer::ResolveUploadedGeometry(
+    const UploadHandle<VertexBuffer> &vertexUpload,
+    const UploadHandle<IndexBuffer> &indexUpload,
+    std::shared_ptr<VertexArray> &vertexArray,
+    std::shared_ptr<VertexBuffer> &vertexBuffer,
+    std::shared_ptr<IndexBuffer> &indexBuffer) {
+  if (vertexArray) {
+    return true;
+  }
+
+  if (vertexUpload.IsFailed() || indexUpload.IsFailed()) {
+    Logger::Warn("Renderer", "Geometry upload failed!");
+    return false;
+  }
+
+  vertexBuffer = vertexUpload.Get();
+  indexBuffer = indexUpload.Get();
+  if (!vertexBuffer || !indexBuffer) {
+    return false;
+  }
+
+  // Vertex arrays are per-context, so build it here on the render thread
+  vertexBuffer->SetLayout({{ShaderDataType::Float3, "a_Position"},
+                          {ShaderDataType::Float3, "a_Color"}});
+  vertexArray = VertexArray::Create();
+  vertexArray->AddVertexBuffer(vertexBuffer);
+  vertexArray->SetIndexBuffer(indexBuffer);
+  return true;
+}
+
 void Renderer::CleanupTriangleResources() {
   m_triangleShader.reset();
   m_triangleVAO.reset();
@@ -542,6 +969,12 @@ void Renderer::CleanupCubeResources() {
   m_cubeVAO.reset();
   m_cubeVBO.reset();
   m_cubeIBO.reset();
+  m_cubeVertexUpload = UploadHandle<VertexBuffer>();
+  m_cubeIndexUpload = UploadHandle<IndexBuffer>();
+  m_cubeInstancedShader.reset();
+  m_cubeInstancedVAO.reset();
+  m_cubeInstanceVBO.reset();
+  m_cubeInstanceCapacity = 0;
 }
 
 void Renderer::CleanupWireCubeResources() {
@@ -549,6 +982,8 @@ void Renderer::CleanupWireCubeResources() {
   m_wireCubeVAO.reset();
   m_wireCubeVBO.reset();
   m_wireCubeIBO.reset();
+  m_wireCubeVertexUpload = UploadHandle<VertexBuffer>();
+  m_wireCubeIndexUpload = UploadHandle<IndexBuffer>();
 }
 
 } // namespace Engine
\ No newline at end of file
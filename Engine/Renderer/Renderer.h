@@ -1,8 +1,12 @@
 #pragma once
 
 #include "Core/Logger.h"
+#include "DynamicResolution.h"
 #include "Math/Math.h"
+#include "RenderQueue.h"
+#include "UploadQueue.h"
 #include <memory>
+#include <vector>
 
 namespace Engine {
 
@@ -13,6 +17,7 @@ class VertexBuffer;
 class IndexBuffer;
 class Buffer;
 class Camera;
+class Framebuffer;
 
 class Renderer {
 public:
@@ -23,8 +28,36 @@ public:
   // Rendering operations
   static void Clear(float r = 0.0f, float g = 0.0f, float b = 0.0f,
                     float a = 1.0f);
+  // Sets the presentation viewport (window space). When scaled rendering is
+  // enabled the GL viewport is the scaled region of the offscreen target.
   static void SetViewport(int x, int y, int width, int height);
 
+  // Frame bracketing: BeginFrame clears the render queue and, below full
+  // scale, binds the scene target at the current render scale for EndFrame
+  // to upscale into the presentation viewport; at full scale both draw
+  // straight to the backbuffer.
+  static void BeginFrame();
+  static void EndFrame();
+
+  // Dynamic resolution scaling
+  static void EnableDynamicResolution(
+      const DynamicResolutionSettings &settings = DynamicResolutionSettings());
+  static void DisableDynamicResolution();
+  static bool IsDynamicResolutionEnabled() { return m_dynamicResolution; }
+  static void UpdateDynamicResolution(float frameTimeMs);
+  static const DynamicResolutionController &GetResolutionController() {
+    return m_resolutionController;
+  }
+  // GPU time between BeginFrame and EndFrame of the latest frame whose timer
+  // query has come back, in ms (0 until then)
+  static float GetGpuFrameTime() { return m_gpuFrameTimeMs; }
+
+  // Fixed render scale, used when the controller is disabled
+  static void SetRenderScale(float scale);
+  static float GetRenderScale() { return m_renderScale; }
+  static int GetRenderWidth();
+  static int GetRenderHeight();
+
   // 2D Triangle rendering (Phase 1)
   static void DrawTriangle();
 
@@ -36,10 +69,34 @@ public:
 
   // 3D Cube rendering (Phase 2)
   static void DrawCube(const Mat4 &mvp,
-                       const Vec3 &color = Vec3(1.0f, 1.0f, 1.0f));
+                       const Vec3 &color = Vec3(1.0f, 1.0f, 1.0f),
+                       float alpha = 1.0f);
   static void DrawCube(const Camera &camera, const Transform &transform,
                        const Vec3 &color = Vec3(1.0f, 1.0f, 1.0f));
 
+  // Queued cube rendering: cubes with alpha below 1 are drawn blended in the
+  // transparent pass, back-to-front; the rest front-to-back without blending
+  static void SubmitCube(const Mat4 &mvp, float depth,
+                         const Vec3 &color = Vec3(1.0f, 1.0f, 1.0f),
+                         float alpha = 1.0f);
+  static void SubmitCube(const Camera &camera, const Transform &transform,
+                         const Vec3 &color = Vec3(1.0f, 1.0f, 1.0f),
+                         float alpha = 1.0f);
+  // Many cubes at once, with their MVPs composed by the batch kernels.
+  // 'colors' is parallel to 'transforms'.
+  static void SubmitCubes(const Camera &camera,
+                          Span<const Transform> transforms,
+                          Span<const Vec3> colors, float alpha = 1.0f);
+  static void DrawOpaquePass();
+  static void DrawTransparentPass();
+  static const RenderQueue &GetRenderQueue() { return m_renderQueue; }
+
+  // Instanced cube rendering: one draw call for all 'models', uploaded as
+  // three vec4 rows (48 bytes) per instance. Opaque only.
+  static void DrawCubes(const Camera &camera,
+                        Span<const Math::Affine3x4> models,
+                        const Vec3 &color = Vec3(1.0f, 1.0f, 1.0f));
+
   // 3D Wireframe rendering
   static void DrawWireCube(const Mat4 &mvp,
                            const Vec3 &color = Vec3(1.0f, 1.0f, 1.0f));
@@ -61,17 +118,64 @@ private:
   static std::shared_ptr<VertexArray> m_cubeVAO;
   static std::shared_ptr<VertexBuffer> m_cubeVBO;
   static std::shared_ptr<IndexBuffer> m_cubeIBO;
+  static UploadHandle<VertexBuffer> m_cubeVertexUpload;
+  static UploadHandle<IndexBuffer> m_cubeIndexUpload;
+
+  static std::shared_ptr<Shader> m_cubeInstancedShader;
+  static std::shared_ptr<VertexArray> m_cubeInstancedVAO;
+  static std::shared_ptr<VertexBuffer> m_cubeInstanceVBO;
+  static uint32_t m_cubeInstanceCapacity;
 
   static std::shared_ptr<Shader> m_wireCubeShader;
   static std::shared_ptr<VertexArray> m_wireCubeVAO;
   static std::shared_ptr<VertexBuffer> m_wireCubeVBO;
   static std::shared_ptr<IndexBuffer> m_wireCubeIBO;
+  static UploadHandle<VertexBuffer> m_wireCubeVertexUpload;
+  static UploadHandle<IndexBuffer> m_wireCubeIndexUpload;
+
+  static RenderQueue m_renderQueue;
+  static std::vector<Mat4> m_batchMVPs;
+
+  // Scaled rendering state
+  static std::shared_ptr<Framebuffer> m_sceneFramebuffer;
+  static DynamicResolutionController m_resolutionController;
+  static bool m_dynamicResolution;
+  static bool m_frameActive;
+  static float m_renderScale;
+  static int m_viewportX, m_viewportY;
+  static int m_viewportWidth, m_viewportHeight;
+  // Viewport set while a scaled frame is open, applied by the next BeginFrame
+  static bool m_viewportPending;
+  static int m_pendingX, m_pendingY;
+  static int m_pendingWidth, m_pendingHeight;
+
+  // GPU frame timing: GL_TIME_ELAPSED queries read back a few frames later,
+  // so the CPU never waits on them
+  static constexpr int kGpuTimerCount = 4;
+  static uint32_t m_gpuTimers[kGpuTimerCount];
+  static bool m_gpuTimerPending[kGpuTimerCount];
+  static int m_gpuTimerNext;
+  static bool m_gpuTimerActive;
+  static float m_gpuFrameTimeMs;
 
   // Helper methods
   static bool CreateTriangleResources();
   static bool CreateAnimatedResources();
   static bool CreateCubeResources();
   static bool CreateWireCubeResources();
+  static void UpdateSceneTarget();
+  static void ApplyPendingViewport();
+  static bool ResolveUploadedGeometry(
+      const UploadHandle<VertexBuffer> &vertexUpload,
+      const UploadHandle<IndexBuffer> &indexUpload,
+      std::shared_ptr<VertexArray> &vertexArray,
+      std::shared_ptr<VertexBuffer> &vertexBuffer,
+      std::shared_ptr<IndexBuffer> &indexBuffer);
+  static void ApplyViewport();
+  static void BeginGpuTimer();
+  static void EndGpuTimer();
+  static bool BindCubeGeometry();
+  static bool ReserveCubeInstances(uint32_t count);
 
   static void CleanupTriangleResources();
   static void CleanupAnimatedResources();
@@ -0,0 +1,285 @@
+#include "Texture.h"
+#include "../Core/Logger.h"
+#include "TextureResidency.h"
+
+#include <algorithm>
+#include <cstring>
+#include <glad/glad.h>
+
+namespace Engine {
+
+namespace {
+
+GLenum ToMinFilter(TextureFilter filter, uint32_t levels) {
+  switch (filter) {
+  case TextureFilter::Nearest:
+    return levels > 1 ? GL_NEAREST_MIPMAP_NEAREST : GL_NEAREST;
+  case TextureFilter::Linear:
+    return GL_LINEAR;
+  case TextureFilter::Trilinear:
+    return levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
+  }
+  return GL_LINEAR;
+}
+
+void ApplySampling(GLenum target, const TextureSpecification &spec) {
+  GLint wrap = spec.Wrap == TextureWrap::Repeat ? GL_REPEAT : GL_CLAMP_TO_EDGE;
+  glTexParameteri(target, GL_TEXTURE_MIN_FILTER,
+                  ToMinFilter(spec.Filter, spec.MipLevels));
+  glTexParameteri(target, GL_TEXTURE_MAG_FILTER,
+                  spec.Filter == TextureFilter::Nearest ? GL_NEAREST
+                                                        : GL_LINEAR);
+  glTexParameteri(target, GL_TEXTURE_WRAP_S, wrap);
+  glTexParameteri(target, GL_TEXTURE_WRAP_T, wrap);
+  glTexParameteri(target, GL_TEXTURE_BASE_LEVEL, 0);
+  glTexParameteri(target, GL_TEXTURE_MAX_LEVEL,
+                  static_cast<GLint>(spec.MipLevels) - 1);
+}
+
+TextureSpecification Resolve(TextureSpecification spec) {
+  spec.Width = std::max(spec.Width, 1u);
+  spec.Height = std::max(spec.Height, 1u);
+  spec.Layers = std::max(spec.Layers, 1u);
+
+  uint32_t fullChain = MipGenerator::CalculateMipCount(spec.Width, spec.Height);
+  spec.MipLevels =
+      spec.MipLevels == 0 ? fullChain : std::min(spec.MipLevels, fullChain);
+  return spec;
+}
+
+bool MatchesLevels(const MipChain &chain, const TextureSpecification &spec) {
+  if (chain.empty() || chain.size() > spec.MipLevels) {
+    return false;
+  }
+  for (uint32_t level = 0; level < chain.size(); ++level) {
+    if (!chain[level].IsValid() ||
+        chain[level].Width != std::max(spec.Width >> level, 1u) ||
+        chain[level].Height != std::max(spec.Height >> level, 1u)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Copies the whole chain into one pixel unpack buffer. While it is bound,
+// glTexSubImage* takes byte offsets into it instead of client pointers, and
+// the driver copies to the texture asynchronously.
+class StagingBuffer {
+public:
+  explicit StagingBuffer(const MipChain &chain) {
+    size_t total = 0;
+    for (const Image &level : chain) {
+      m_Offsets.push_back(total);
+      total += level.GetSize();
+    }
+
+    glGenBuffers(1, &m_RendererID);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_RendererID);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(total),
+                 nullptr, GL_STREAM_DRAW);
+
+    auto *mapped = static_cast<uint8_t *>(glMapBufferRange(
+        GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(total),
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+    if (mapped) {
+      for (size_t level = 0; level < chain.size(); ++level) {
+        std::memcpy(mapped + m_Offsets[level], chain[level].Pixels.data(),
+                    chain[level].GetSize());
+      }
+      m_Valid = glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE;
+    }
+
+    if (!m_Valid) {
+      ENGINE_LOG_ERROR("Texture", "Failed to fill texture staging buffer!");
+    }
+  }
+
+  ~StagingBuffer() {
+    // Deletion is deferred by the driver until pending copies finished
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glDeleteBuffers(1, &m_RendererID);
+  }
+
+  bool IsValid() const { return m_Valid; }
+  const void *GetOffset(size_t level) const {
+    return reinterpret_cast<const void *>(m_Offsets[level]);
+  }
+
+private:
+  uint32_t m_RendererID = 0;
+  std::vector<size_t> m_Offsets;
+  bool m_Valid = false;
+};
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////
+// Texture2D ////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+
+class OpenGLTexture2D : public Texture2D {
+public:
+  OpenGLTexture2D(const TextureSpecification &spec)
+      : m_Specification(Resolve(spec)) {
+    m_Specification.Layers = 1;
+
+    glGenTextures(1, &m_RendererID);
+    glBindTexture(GL_TEXTURE_2D, m_RendererID);
+    glTexStorage2D(GL_TEXTURE_2D,
+                   static_cast<GLsizei>(m_Specification.MipLevels), GL_RGBA8,
+                   static_cast<GLsizei>(m_Specification.Width),
+                   static_cast<GLsizei>(m_Specification.Height));
+    ApplySampling(GL_TEXTURE_2D, m_Specification);
+    glBindTexture(GL_TEXTURE_2D, 0);
+  }
+
+  virtual ~OpenGLTexture2D() { glDeleteTextures(1, &m_RendererID); }
+
+  virtual void Bind(uint32_t slot) const override {
+    glActiveTexture(GL_TEXTURE0 + slot);
+    glBindTexture(GL_TEXTURE_2D, m_RendererID);
+  }
+
+  virtual void SetData(const MipChain &chain) override {
+    if (!MatchesLevels(chain, m_Specification)) {
+      ENGINE_LOG_ERROR("Texture", "Mip chain does not match texture size!");
+      return;
+    }
+
+    StagingBuffer staging(chain);
+    if (!staging.IsValid()) {
+      return;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, m_RendererID);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    for (uint32_t level = 0; level < chain.size(); ++level) {
+      glTexSubImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), 0, 0,
+                      static_cast<GLsizei>(chain[level].Width),
+                      static_cast<GLsizei>(chain[level].Height), GL_RGBA,
+                      GL_UNSIGNED_BYTE, staging.GetOffset(level));
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+  }
+
+  virtual uint32_t GetRendererID() const override { return m_RendererID; }
+
+  virtual const TextureSpecification &GetSpecification() const override {
+    return m_Specification;
+  }
+
+  virtual size_t GetMemorySize() const override {
+    return TextureResidency::CalculateMemorySize(
+        m_Specification.Width, m_Specification.Height, 0,
+        m_Specification.MipLevels);
+  }
+
+private:
+  uint32_t m_RendererID = 0;
+  TextureSpecification m_Specification;
+};
+
+std::shared_ptr<Texture2D>
+Texture2D::Create(const TextureSpecification &spec) {
+  return std::make_shared<OpenGLTexture2D>(spec);
+}
+
+std::shared_ptr<Texture2D>
+Texture2D::Create(const MipChain &chain,
+                  const TextureSpecification &settings) {
+  if (chain.empty() || !chain[0].IsValid()) {
+    ENGINE_LOG_ERROR("Texture", "Cannot create texture from empty image!");
+    return nullptr;
+  }
+
+  TextureSpecification spec = settings;
+  spec.Width = chain[0].Width;
+  spec.Height = chain[0].Height;
+  spec.MipLevels = static_cast<uint32_t>(chain.size());
+
+  auto texture = Create(spec);
+  texture->SetData(chain);
+  return texture;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// TextureArray /////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+
+class OpenGLTextureArray : public TextureArray {
+public:
+  OpenGLTextureArray(const TextureSpecification &spec)
+      : m_Specification(Resolve(spec)) {
+    glGenTextures(1, &m_RendererID);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, m_RendererID);
+    glTexStorage3D(GL_TEXTURE_2D_ARRAY,
+                   static_cast<GLsizei>(m_Specification.MipLevels), GL_RGBA8,
+                   static_cast<GLsizei>(m_Specification.Width),
+                   static_cast<GLsizei>(m_Specification.Height),
+                   static_cast<GLsizei>(m_Specification.Layers));
+    ApplySampling(GL_TEXTURE_2D_ARRAY, m_Specification);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+  }
+
+  virtual ~OpenGLTextureArray() { glDeleteTextures(1, &m_RendererID); }
+
+  virtual void Bind(uint32_t slot) const override {
+    glActiveTexture(GL_TEXTURE0 + slot);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, m_RendererID);
+  }
+
+  virtual uint32_t GetLayerCount() const override {
+    return m_Specification.Layers;
+  }
+
+  virtual void SetLayerData(uint32_t layer, const MipChain &chain) override {
+    if (layer >= m_Specification.Layers) {
+      ENGINE_LOG_ERROR("Texture", "Texture array layer out of range!");
+      return;
+    }
+    if (!MatchesLevels(chain, m_Specification)) {
+      ENGINE_LOG_ERROR("Texture", "Mip chain does not match layer size!");
+      return;
+    }
+
+    StagingBuffer staging(chain);
+    if (!staging.IsValid()) {
+      return;
+    }
+
+    glBindTexture(GL_TEXTURE_2D_ARRAY, m_RendererID);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    for (uint32_t level = 0; level < chain.size(); ++level) {
+      glTexSubImage3D(GL_TEXTURE_2D_ARRAY, static_cast<GLint>(level), 0, 0,
+                      static_cast<GLint>(layer),
+                      static_cast<GLsizei>(chain[level].Width),
+                      static_cast<GLsizei>(chain[level].Height), 1, GL_RGBA,
+                      GL_UNSIGNED_BYTE, staging.GetOffset(level));
+    }
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+  }
+
+  virtual uint32_t GetRendererID() const override { return m_RendererID; }
+
+  virtual const TextureSpecification &GetSpecification() const override {
+    return m_Specification;
+  }
+
+  virtual size_t GetMemorySize() const override {
+    return TextureResidency::CalculateMemorySize(
+               m_Specification.Width, m_Specification.Height, 0,
+               m_Specification.MipLevels) *
+           m_Specification.Layers;
+  }
+
+private:
+  uint32_t m_RendererID = 0;
+  TextureSpecification m_Specification;
+};
+
+std::shared_ptr<TextureArray>
+TextureArray::Create(const TextureSpecification &spec) {
+  return std::make_shared<OpenGLTextureArray>(spec);
+}
+
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "MipGenerator.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Engine {
+
+enum class TextureFilter { Nearest, Linear, Trilinear };
+enum class TextureWrap { Repeat, ClampToEdge };
+
+struct TextureSpecification {
+  uint32_t Width = 1;
+  uint32_t Height = 1;
+  uint32_t Layers = 1;    // TextureArray only
+  uint32_t MipLevels = 1; // 0 allocates the full chain down to 1x1
+  TextureFilter Filter = TextureFilter::Trilinear;
+  TextureWrap Wrap = TextureWrap::Repeat;
+};
+
+// RGBA8 textures with immutable storage. Pixel data is uploaded through a
+// pixel unpack (staging) buffer, so uploads may run on the upload thread.
+class Texture {
+public:
+  virtual ~Texture() = default;
+
+  virtual void Bind(uint32_t slot = 0) const = 0;
+
+  virtual uint32_t GetRendererID() const = 0;
+  virtual const TextureSpecification &GetSpecification() const = 0;
+  virtual size_t GetMemorySize() const = 0;
+};
+
+class Texture2D : public Texture {
+public:
+  // Uploads chain[i] into mip level i; level sizes must match the texture
+  virtual void SetData(const MipChain &chain) = 0;
+
+  static std::shared_ptr<Texture2D>
+  Create(const TextureSpecification &spec);
+  static std::shared_ptr<Texture2D>
+  Create(const MipChain &chain,
+         const TextureSpecification &settings = TextureSpecification());
+};
+
+class TextureArray : public Texture {
+public:
+  virtual uint32_t GetLayerCount() const = 0;
+
+  // Uploads chain[i] into mip level i of one layer
+  virtual void SetLayerData(uint32_t layer, const MipChain &chain) = 0;
+
+  static std::shared_ptr<TextureArray>
+  Create(const TextureSpecification &spec);
+};
+
+} // namespace Engine
\ No newline at end of file
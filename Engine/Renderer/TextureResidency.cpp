@@ -0,0 +1,102 @@
+#include "TextureResidency.h"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+namespace Engine {
+
+namespace {
+
+uint32_t MipExtent(const TextureResidencyRequest &request, uint32_t mip) {
+  return std::max(std::max(request.Width, request.Height) >> mip, 1u);
+}
+
+size_t ResidentBytes(const TextureResidencyRequest &request) {
+  return TextureResidency::CalculateMemorySize(
+      request.Width, request.Height, request.ResidentMip, request.MipLevels);
+}
+
+// How far the resident top level oversamples the screen; higher means the
+// level contributes less visible detail per byte
+float Oversampling(const TextureResidencyRequest &request) {
+  float needed = std::max(request.ScreenSize, 1.0f);
+  return static_cast<float>(MipExtent(request, request.ResidentMip)) / needed;
+}
+
+} // namespace
+
+size_t TextureResidency::CalculateMemorySize(uint32_t width, uint32_t height,
+                                             uint32_t firstMip,
+                                             uint32_t mipLevels) {
+  size_t total = 0;
+  for (uint32_t level = firstMip; level < mipLevels; ++level) {
+    size_t levelWidth = std::max(width >> level, 1u);
+    size_t levelHeight = std::max(height >> level, 1u);
+    total += levelWidth * levelHeight * 4;
+  }
+  return total;
+}
+
+uint32_t
+TextureResidency::CalculateDesiredMip(const TextureResidencyRequest &request,
+                                      uint32_t fallbackSize) {
+  uint32_t lastMip = std::max(request.MipLevels, 1u) - 1;
+
+  if (request.ScreenSize <= 0.0f) {
+    uint32_t mip = 0;
+    while (mip < lastMip && MipExtent(request, mip) > fallbackSize) {
+      ++mip;
+    }
+    return mip;
+  }
+
+  // One texel per pixel: every halving of the on-screen size drops a level
+  float extent = static_cast<float>(MipExtent(request, 0));
+  float ratio = extent / std::max(request.ScreenSize, 1.0f);
+  if (ratio <= 1.0f) {
+    return 0;
+  }
+  uint32_t mip = static_cast<uint32_t>(std::floor(std::log2(ratio)));
+  return std::min(mip, lastMip);
+}
+
+size_t TextureResidency::Solve(std::vector<TextureResidencyRequest> &requests,
+                               size_t budget, uint32_t fallbackSize) {
+  size_t total = 0;
+  for (auto &request : requests) {
+    request.ResidentMip = CalculateDesiredMip(request, fallbackSize);
+    total += ResidentBytes(request);
+  }
+
+  if (total <= budget) {
+    return total;
+  }
+
+  // Repeatedly drop the top level of the most oversampled texture. Entries
+  // are re-pushed with their new score after every drop.
+  using Entry = std::pair<float, size_t>;
+  std::priority_queue<Entry> candidates;
+  for (size_t i = 0; i < requests.size(); ++i) {
+    if (requests[i].ResidentMip + 1 < requests[i].MipLevels) {
+      candidates.push({Oversampling(requests[i]), i});
+    }
+  }
+
+  while (total > budget && !candidates.empty()) {
+    size_t index = candidates.top().second;
+    candidates.pop();
+
+    auto &request = requests[index];
+    size_t before = ResidentBytes(request);
+    ++request.ResidentMip;
+    total -= before - ResidentBytes(request);
+
+    if (request.ResidentMip + 1 < request.MipLevels) {
+      candidates.push({Oversampling(request), index});
+    }
+  }
+  return total;
+}
+
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+struct TextureResidencyRequest {
+  uint32_t Width = 0;
+  uint32_t Height = 0;
+  uint32_t MipLevels = 1;
+
+  // Largest on-screen extent of any surface using the texture this frame,
+  // in pixels. Zero means the texture was not seen.
+  float ScreenSize = 0.0f;
+
+  // Output: first resident mip level; levels above it are dropped
+  uint32_t ResidentMip = 0;
+};
+
+//============================================================================
+// TextureResidency - Chooses resident mip levels under a memory budget
+//============================================================================
+// Pure CPU; the streamer feeds it screen-space usage every frame and
+// reallocates textures whose resident level changed.
+class TextureResidency {
+public:
+  // Bytes of RGBA8 mip levels [firstMip, mipLevels)
+  static size_t CalculateMemorySize(uint32_t width, uint32_t height,
+                                    uint32_t firstMip, uint32_t mipLevels);
+
+  // Finest level worth keeping for the given on-screen size. Textures that
+  // were not seen fall back to the first level no larger than
+  // 'fallbackSize' texels.
+  static uint32_t CalculateDesiredMip(const TextureResidencyRequest &request,
+                                      uint32_t fallbackSize);
+
+  // Assigns ResidentMip to every request. Starts from the desired levels,
+  // then drops the least needed top levels until the total fits 'budget'.
+  // Returns the resident total, which can exceed the budget only if every
+  // texture is already down to its smallest level.
+  static size_t Solve(std::vector<TextureResidencyRequest> &requests,
+                      size_t budget, uint32_t fallbackSize = 32);
+};
+
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include "TextureStreamer.h"
+#include "../Core/Logger.h"
+#include "Image.h"
+#include "TextureResidency.h"
+
+namespace Engine {
+
+std::vector<std::shared_ptr<StreamedTexture>> TextureStreamer::s_Textures;
+TextureStreamingSettings TextureStreamer::s_Settings;
+size_t TextureStreamer::s_ResidentMemory = 0;
+
+uint32_t StreamedTexture::GetWidth() const {
+  return IsDecoded() ? m_Mips[0].Width : 0;
+}
+
+uint32_t StreamedTexture::GetHeight() const {
+  return IsDecoded() ? m_Mips[0].Height : 0;
+}
+
+uint32_t StreamedTexture::GetMipLevels() const {
+  return IsDecoded() ? static_cast<uint32_t>(m_Mips.size()) : 0;
+}
+
+void TextureStreamer::Initialize(const TextureStreamingSettings &settings) {
+  s_Settings = settings;
+  s_ResidentMemory = 0;
+  Logger::Info("TextureStreamer",
+               "Texture budget " +
+                   std::to_string(settings.BudgetBytes / (1024 * 1024)) +
+                   " MB");
+}
+
+void TextureStreamer::Shutdown() {
+  // Decode jobs write into the textures; let them finish first
+  for (const auto &texture : s_Textures) {
+    JobSystem::Wait(texture->m_DecodeJob);
+  }
+  s_Textures.clear();
+  s_ResidentMemory = 0;
+}
+
+std::shared_ptr<StreamedTexture>
+TextureStreamer::Load(const std::string &path) {
+  auto texture = std::make_shared<StreamedTexture>();
+  texture->m_Path = path;
+
+  MipFilter filter = s_Settings.Filter;
+  StreamedTexture *target = texture.get();
+  texture->m_DecodeJob = JobSystem::Submit([target, path, filter]() {
+    Image image;
+    if (!ImageLoader::Load(path, image)) {
+      target->m_Failed = true;
+      return;
+    }
+    target->m_Mips = MipGenerator::Generate(std::move(image), filter);
+  });
+
+  s_Textures.push_back(texture);
+  return texture;
+}
+
+void TextureStreamer::Update() {
+  std::vector<StreamedTexture *> decoded;
+  std::vector<TextureResidencyRequest> requests;
+
+  for (const auto &texture : s_Textures) {
+    if (!texture->IsDecoded()) {
+      continue;
+    }
+
+    TextureResidencyRequest request;
+    request.Width = texture->GetWidth();
+    request.Height = texture->GetHeight();
+    request.MipLevels = texture->GetMipLevels();
+    request.ScreenSize = texture->m_ScreenSize;
+    requests.push_back(request);
+    decoded.push_back(texture.get());
+
+    texture->m_ScreenSize = 0.0f;
+  }
+
+  TextureResidency::Solve(requests, s_Settings.BudgetBytes,
+                          s_Settings.FallbackSize);
+
+  for (size_t i = 0; i < decoded.size(); ++i) {
+    StreamedTexture &texture = *decoded[i];
+    uint32_t target = requests[i].ResidentMip;
+
+    // Gaining detail is immediate; losing it waits out the delay unless
+    // the texture has nothing resident yet
+    if (target > texture.m_TargetMip && texture.m_Texture &&
+        ++texture.m_DropFrames < s_Settings.DropDelayFrames) {
+      target = texture.m_TargetMip;
+    } else {
+      texture.m_DropFrames = 0;
+    }
+    texture.m_TargetMip = target;
+  }
+
+  s_ResidentMemory = 0;
+  for (const auto &texture : s_Textures) {
+    if (texture->IsDecoded()) {
+      UpdateTexture(texture);
+    }
+    if (texture->m_Texture) {
+      s_ResidentMemory += texture->m_Texture->GetMemorySize();
+    }
+  }
+}
+
+void TextureStreamer::UpdateTexture(
+    const std::shared_ptr<StreamedTexture> &texture) {
+  if (texture->m_PendingUpload.IsValid()) {
+    if (texture->m_PendingUpload.IsReady()) {
+      // Swapping releases the previous allocation
+      texture->m_Texture = texture->m_PendingUpload.Get();
+      texture->m_ResidentMip = texture->m_PendingMip;
+      texture->m_PendingUpload = UploadHandle<Texture2D>();
+    } else if (texture->m_PendingUpload.IsFailed()) {
+      ENGINE_LOG_ERROR("TextureStreamer",
+                       "Upload failed for " + texture->m_Path);
+      texture->m_PendingUpload = UploadHandle<Texture2D>();
+      texture->m_Failed = true;
+      return;
+    } else {
+      return;
+    }
+  }
+
+  if (texture->m_Texture && texture->m_TargetMip == texture->m_ResidentMip) {
+    return;
+  }
+
+  // Reallocate with only the levels from the target down; the mip data is
+  // immutable once decoded, so the upload thread can read it directly.
+  uint32_t firstMip = texture->m_TargetMip;
+  TextureSpecification settings;
+  settings.Filter = s_Settings.Sampling;
+  settings.Wrap = s_Settings.Wrap;
+
+  texture->m_PendingMip = firstMip;
+  texture->m_PendingUpload =
+      UploadQueue::Submit<Texture2D>([texture, firstMip, settings]() {
+        MipChain levels(texture->m_Mips.begin() + firstMip,
+                        texture->m_Mips.end());
+        return Texture2D::Create(levels, settings);
+      });
+}
+
+} // namespace Engine
\ No newline at end of file
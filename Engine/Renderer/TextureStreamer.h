@@ -0,0 +1,110 @@
+#pragma once
+
+#include "../Core/JobSystem.h"
+#include "MipGenerator.h"
+#include "Texture.h"
+#include "UploadQueue.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+struct TextureStreamingSettings {
+  size_t BudgetBytes = 256u * 1024u * 1024u;
+  MipFilter Filter = MipFilter::Kaiser;
+
+  // Unseen textures keep the first level no larger than this many texels
+  uint32_t FallbackSize = 32;
+
+  // Frames a coarser level must stay requested before detail is dropped,
+  // so on-screen size jitter does not reallocate every frame
+  uint32_t DropDelayFrames = 30;
+
+  TextureFilter Sampling = TextureFilter::Trilinear;
+  TextureWrap Wrap = TextureWrap::Repeat;
+};
+
+//============================================================================
+// StreamedTexture - Texture whose resident mip levels follow screen usage
+//============================================================================
+class StreamedTexture {
+public:
+  // Null until the first upload finished. The streamer swaps in a new
+  // texture whenever residency changes, so fetch it every frame.
+  std::shared_ptr<Texture2D> GetTexture() const { return m_Texture; }
+
+  const std::string &GetPath() const { return m_Path; }
+  bool IsDecoded() const { return m_DecodeJob.IsDone() && !m_Failed; }
+  bool IsFailed() const { return m_DecodeJob.IsDone() && m_Failed; }
+
+  // Full-resolution properties; valid once decoded
+  uint32_t GetWidth() const;
+  uint32_t GetHeight() const;
+  uint32_t GetMipLevels() const;
+
+  // Level the texture object currently starts at, and the level the
+  // residency solver asked for
+  uint32_t GetResidentMip() const { return m_ResidentMip; }
+  uint32_t GetTargetMip() const { return m_TargetMip; }
+
+  // Reports a surface using the texture covering 'pixels' on screen along
+  // its largest axis. Call every frame it is drawn; the largest report wins.
+  void ReportScreenSize(float pixels) {
+    m_ScreenSize = pixels > m_ScreenSize ? pixels : m_ScreenSize;
+  }
+
+private:
+  friend class TextureStreamer;
+
+  std::string m_Path;
+  JobHandle m_DecodeJob;
+  bool m_Failed = false; // set by the decode job or a failed upload
+  MipChain m_Mips;       // written by the decode job
+
+  std::shared_ptr<Texture2D> m_Texture;
+  uint32_t m_ResidentMip = 0;
+  uint32_t m_TargetMip = 0;
+  uint32_t m_DropFrames = 0;
+  float m_ScreenSize = 0.0f;
+
+  UploadHandle<Texture2D> m_PendingUpload;
+  uint32_t m_PendingMip = 0;
+};
+
+//============================================================================
+// TextureStreamer - Worker decoding and budgeted mip residency
+//============================================================================
+// Load() decodes and builds the mip chain on the job system. Update(), once
+// per frame on the render thread, solves residency for all decoded textures
+// and re-uploads those whose resident level changed through UploadQueue.
+// CPU copies of every level are kept so detail can come back without
+// decoding again.
+class TextureStreamer {
+public:
+  static void Initialize(
+      const TextureStreamingSettings &settings = TextureStreamingSettings());
+  static void Shutdown();
+
+  static std::shared_ptr<StreamedTexture> Load(const std::string &path);
+
+  static void Update();
+
+  static void SetBudget(size_t bytes) { s_Settings.BudgetBytes = bytes; }
+  static const TextureStreamingSettings &GetSettings() { return s_Settings; }
+
+  // GPU memory of the textures currently handed out
+  static size_t GetResidentMemory() { return s_ResidentMemory; }
+
+private:
+  static void UpdateTexture(const std::shared_ptr<StreamedTexture> &texture);
+
+private:
+  static std::vector<std::shared_ptr<StreamedTexture>> s_Textures;
+  static TextureStreamingSettings s_Settings;
+  static size_t s_ResidentMemory;
+};
+
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,194 @@
+#include "UploadQueue.h"
+#include "../Core/Logger.h"
+#include "../Platform/Window.h"
+#include "Buffer.h"
+
+#include <atomic>
+#include <deque>
+#include <thread>
+
+#include <glad/glad.h>
+
+namespace Engine {
+
+GLFWwindow *UploadQueue::s_Context = nullptr;
+bool UploadQueue::s_Running = false;
+
+namespace {
+
+struct PendingUpload {
+  std::function<bool()> Run;
+  std::function<void(bool)> Complete;
+};
+
+struct InFlightUpload {
+  std::function<void(bool)> Complete;
+  GLsync Fence = nullptr;
+};
+
+// Worker state shared between the submitting threads and the upload thread
+std::mutex s_QueueMutex;
+std::condition_variable s_QueueSignal;
+std::deque<PendingUpload> s_Queue;
+std::thread s_Worker;
+bool s_StopRequested = false;
+std::atomic<uint32_t> s_PendingCount{0};
+
+// How long the worker blocks on the oldest fence when it has nothing else to
+// do, in nanoseconds
+constexpr GLuint64 FenceWaitTimeout = 1000000;
+
+} // namespace
+
+bool UploadQueue::Initialize() {
+  if (s_Running) {
+    return true;
+  }
+
+  Logger::Info("UploadQueue", "Starting upload thread...");
+
+  s_Context = Platform::Window::CreateSharedContext();
+  if (!s_Context) {
+    Logger::Warn("UploadQueue",
+                 "No shared context, uploads will run synchronously");
+    return false;
+  }
+
+  // Creating the window does not make its context current, so the main
+  // context stays bound here and the worker can claim the new one.
+  s_StopRequested = false;
+  s_Running = true;
+  s_Worker = std::thread(WorkerLoop);
+
+  Logger::Info("UploadQueue", "Upload thread started");
+  return true;
+}
+
+void UploadQueue::Shutdown() {
+  if (!s_Running) {
+    return;
+  }
+
+  Logger::Info("UploadQueue", "Draining uploads and stopping thread...");
+
+  {
+    std::lock_guard<std::mutex> lock(s_QueueMutex);
+    s_StopRequested = true;
+  }
+  s_QueueSignal.notify_all();
+  if (s_Worker.joinable()) {
+    s_Worker.join();
+  }
+
+  s_Running = false;
+  Platform::Window::DestroySharedContext(s_Context);
+  s_Context = nullptr;
+
+  Logger::Info("UploadQueue", "Upload thread stopped");
+}
+
+uint32_t UploadQueue::GetPendingCount() { return s_PendingCount.load(); }
+
+UploadHandle<VertexBuffer>
+UploadQueue::UploadVertexBuffer(std::vector<float> vertices) {
+  auto data = std::make_shared<std::vector<float>>(std::move(vertices));
+  return Submit<VertexBuffer>([data]() {
+    return VertexBuffer::Create(
+        data->data(), static_cast<uint32_t>(data->size() * sizeof(float)));
+  });
+}
+
+UploadHandle<IndexBuffer>
+UploadQueue::UploadIndexBuffer(std::vector<uint32_t> indices) {
+  auto data = std::make_shared<std::vector<uint32_t>>(std::move(indices));
+  return Submit<IndexBuffer>([data]() {
+    return IndexBuffer::Create(data->data(),
+                               static_cast<uint32_t>(data->size()));
+  });
+}
+
+void UploadQueue::Enqueue(std::function<bool()> run,
+                          std::function<void(bool)> complete) {
+  ++s_PendingCount;
+
+  if (!s_Running) {
+    // No upload context: the caller's context is current, finish in place
+    complete(run());
+    --s_PendingCount;
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(s_QueueMutex);
+    s_Queue.push_back({std::move(run), std::move(complete)});
+  }
+  s_QueueSignal.notify_one();
+}
+
+void UploadQueue::WorkerLoop() {
+  Platform::Window::MakeContextCurrent(s_Context);
+
+  // Core profile needs a bound vertex array to bind element buffers. It is
+  // never used for drawing; vertex arrays are not shared across contexts.
+  GLuint scratchVertexArray = 0;
+  glGenVertexArrays(1, &scratchVertexArray);
+  glBindVertexArray(scratchVertexArray);
+
+  // Fences signal in submission order, so only the oldest needs polling
+  std::deque<InFlightUpload> inFlight;
+
+  auto retire = [&inFlight](GLuint64 timeout) {
+    while (!inFlight.empty()) {
+      InFlightUpload &upload = inFlight.front();
+      GLenum result = glClientWaitSync(upload.Fence, 0, timeout);
+      if (result == GL_TIMEOUT_EXPIRED) {
+        return;
+      }
+
+      glDeleteSync(upload.Fence);
+      upload.Complete(result != GL_WAIT_FAILED);
+      --s_PendingCount;
+      inFlight.pop_front();
+      timeout = 0;
+    }
+  };
+
+  while (true) {
+    std::deque<PendingUpload> batch;
+    {
+      std::unique_lock<std::mutex> lock(s_QueueMutex);
+      if (inFlight.empty()) {
+        s_QueueSignal.wait(
+            lock, [] { return s_StopRequested || !s_Queue.empty(); });
+      }
+      if (s_StopRequested && s_Queue.empty() && inFlight.empty()) {
+        break;
+      }
+      batch.swap(s_Queue);
+    }
+
+    for (PendingUpload &upload : batch) {
+      if (!upload.Run()) {
+        upload.Complete(false);
+        --s_PendingCount;
+        continue;
+      }
+      InFlightUpload pending;
+      pending.Complete = std::move(upload.Complete);
+      pending.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+      inFlight.push_back(std::move(pending));
+    }
+
+    // Push the commands and fences to the GPU before waiting on them
+    if (!batch.empty()) {
+      glFlush();
+    }
+    retire(batch.empty() ? FenceWaitTimeout : 0);
+  }
+
+  glBindVertexArray(0);
+  glDeleteVertexArrays(1, &scratchVertexArray);
+  Platform::Window::MakeContextCurrent(nullptr);
+}
+
+} // namespace Engine
\ No newline at end of file
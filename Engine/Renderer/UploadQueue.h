@@ -0,0 +1,143 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+struct GLFWwindow;
+
+namespace Engine {
+
+// Forward declarations
+class VertexBuffer;
+class IndexBuffer;
+
+enum class UploadStatus { Pending, Ready, Failed };
+
+//============================================================================
+// UploadHandle - Completion handle for a resource uploaded asynchronously
+//============================================================================
+// The resource is only handed out once the GPU has finished consuming the
+// upload (its fence signaled), so it is safe to draw with on the render
+// thread as soon as IsReady() returns true.
+template <typename T> class UploadHandle {
+public:
+  UploadHandle() = default;
+
+  bool IsValid() const { return m_State != nullptr; }
+  bool IsReady() const { return GetStatus() == UploadStatus::Ready; }
+  bool IsFailed() const { return GetStatus() == UploadStatus::Failed; }
+
+  UploadStatus GetStatus() const {
+    if (!m_State) {
+      return UploadStatus::Failed;
+    }
+    std::lock_guard<std::mutex> lock(m_State->Mutex);
+    return m_State->Status;
+  }
+
+  // Non-blocking: the resource once ready, nullptr while pending or failed
+  std::shared_ptr<T> Get() const {
+    if (!m_State) {
+      return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(m_State->Mutex);
+    return m_State->Status == UploadStatus::Ready ? m_State->Resource
+                                                  : nullptr;
+  }
+
+  // Blocks until the upload completed; nullptr if it failed
+  std::shared_ptr<T> Wait() const {
+    if (!m_State) {
+      return nullptr;
+    }
+    std::unique_lock<std::mutex> lock(m_State->Mutex);
+    m_State->Completed.wait(
+        lock, [this] { return m_State->Status != UploadStatus::Pending; });
+    return m_State->Status == UploadStatus::Ready ? m_State->Resource
+                                                  : nullptr;
+  }
+
+private:
+  friend class UploadQueue;
+
+  struct State {
+    std::mutex Mutex;
+    std::condition_variable Completed;
+    UploadStatus Status = UploadStatus::Pending;
+    std::shared_ptr<T> Resource;
+  };
+
+  explicit UploadHandle(std::shared_ptr<State> state)
+      : m_State(std::move(state)) {}
+
+  std::shared_ptr<State> m_State;
+};
+
+//============================================================================
+// UploadQueue - Dedicated upload thread with its own shared GL context
+//============================================================================
+// Initialize() must run on the main thread after the window exists. Upload
+// jobs execute on the worker in submission order; each job is followed by a
+// fence and only completes once that fence has signaled.
+//
+// Only buffers and textures are shared between contexts. Container objects
+// such as vertex arrays and framebuffers must be built on the render thread
+// from the uploaded resources.
+//
+// Without a running queue, uploads execute synchronously on the calling
+// thread and their handles are ready immediately.
+class UploadQueue {
+public:
+  static bool Initialize();
+  static void Shutdown();
+
+  static bool IsRunning() { return s_Running; }
+  static uint32_t GetPendingCount();
+
+  static UploadHandle<VertexBuffer>
+  UploadVertexBuffer(std::vector<float> vertices);
+  static UploadHandle<IndexBuffer>
+  UploadIndexBuffer(std::vector<uint32_t> indices);
+
+  // Generic upload: 'upload' runs with the upload context current and
+  // returns the created resource, or nullptr on failure.
+  template <typename T>
+  static UploadHandle<T> Submit(std::function<std::shared_ptr<T>()> upload) {
+    using State = typename UploadHandle<T>::State;
+    auto state = std::make_shared<State>();
+
+    auto run = [state, upload]() {
+      // Only the worker touches Resource until the job completes
+      state->Resource = upload();
+      return state->Resource != nullptr;
+    };
+    auto complete = [state](bool success) {
+      {
+        std::lock_guard<std::mutex> lock(state->Mutex);
+        state->Status = success ? UploadStatus::Ready : UploadStatus::Failed;
+        if (!success) {
+          state->Resource.reset();
+        }
+      }
+      state->Completed.notify_all();
+    };
+
+    Enqueue(run, complete);
+    return UploadHandle<T>(state);
+  }
+
+private:
+  static void Enqueue(std::function<bool()> run,
+                      std::function<void(bool)> complete);
+  static void WorkerLoop();
+
+private:
+  static GLFWwindow *s_Context;
+  static bool s_Running;
+};
+
+} // namespace Engine
\ No newline at end of file
@@ -19,6 +19,8 @@ static GLenum ShaderDataTypeToOpenGLBaseType(ShaderDataType type) {
     return GL_FLOAT;
   case ShaderDataType::Mat4:
     return GL_FLOAT;
+  case ShaderDataType::Mat3x4:
+    return GL_FLOAT;
   case ShaderDataType::Int:
     return GL_INT;
   case ShaderDataType::Int2:
@@ -78,9 +80,12 @@ public:
         break;
       }
       case ShaderDataType::Mat3:
-      case ShaderDataType::Mat4: {
+      case ShaderDataType::Mat4:
+      case ShaderDataType::Mat3x4: {
+        // One attribute per row; Mat3x4 is rows 0..2 of an affine transform
         uint8_t count = element.GetComponentCount();
-        for (uint8_t i = 0; i < count; i++) {
+        uint8_t rows = element.GetAttributeCount();
+        for (uint8_t i = 0; i < rows; i++) {
           glEnableVertexAttribArray(m_VertexBufferIndex);
           glVertexAttribPointer(
               m_VertexBufferIndex, count,
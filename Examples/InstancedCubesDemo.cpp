@@ -0,0 +1,88 @@
+#include "Core/Camera.h"
+#include "Core/Engine.h"
+#include "Math/Math.h"
+#include "Renderer/Renderer.h"
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace Engine;
+
+int main() {
+  std::cout << "🧊 Instanced Cubes Demo" << std::endl;
+  std::cout << "Press ESC to exit" << std::endl;
+
+  // Initialize the engine
+  if (!Engine::Engine::Initialize()) {
+    std::cerr << "❌ Failed to initialize engine!" << std::endl;
+    return -1;
+  }
+
+  // Initialize renderer
+  if (!Renderer::Initialize()) {
+    std::cerr << "❌ Failed to initialize renderer!" << std::endl;
+    Engine::Engine::Shutdown();
+    return -1;
+  }
+
+  std::cout << "✅ Engine and Renderer initialized successfully!" << std::endl;
+
+  // Create camera
+  Camera camera;
+  camera.SetPosition(Vec3(0.0f, 18.0f, 30.0f));
+  camera.LookAt(Vec3(0.0f, 0.0f, 0.0f));
+  camera.SetAspectRatio(800.0f, 600.0f);
+  camera.SetFieldOfView(45.0f);
+
+  // A grid of small cubes, all drawn with one instanced call
+  const int gridSize = 32;
+  const float spacing = 1.2f;
+  std::vector<Transform> transforms(gridSize * gridSize);
+  for (int z = 0; z < gridSize; ++z) {
+    for (int x = 0; x < gridSize; ++x) {
+      Transform &transform = transforms[z * gridSize + x];
+      transform.position = Vec3((x - gridSize * 0.5f) * spacing, 0.0f,
+                                (z - gridSize * 0.5f) * spacing);
+      transform.scale = Vec3(0.4f, 0.4f, 0.4f);
+    }
+  }
+  std::vector<Math::Affine3x4> models(transforms.size());
+
+  std::cout << "🎮 Rendering " << transforms.size()
+            << " cubes in one draw call..." << std::endl;
+
+  // Main loop
+  float time = 0.0f;
+  while (Engine::Engine::IsRunning()) {
+    time += Engine::Engine::GetDeltaTime();
+
+    // Each cube bobs and spins with a phase taken from its grid position
+    for (size_t i = 0; i < transforms.size(); ++i) {
+      Transform &transform = transforms[i];
+      float phase = time * 2.0f + 0.35f * static_cast<float>(i % gridSize) +
+                    0.2f * static_cast<float>(i / gridSize);
+      transform.position.y = 0.6f * std::sin(phase);
+      transform.rotation =
+          Quaternion::FromAxisAngle(Vec3(0.0f, 1.0f, 0.0f), phase);
+    }
+    Math::ComposeTransforms(transforms, models);
+
+    // Clear screen with dark background
+    Renderer::Clear(0.1f, 0.1f, 0.2f, 1.0f);
+
+    // Three vec4 rows per instance, one glDrawElementsInstanced call
+    Renderer::DrawCubes(camera, models, Vec3(0.3f, 0.7f, 0.9f));
+
+    // Update engine (handles events and buffer swapping)
+    Engine::Engine::Update();
+  }
+
+  std::cout << "🛑 Shutting down..." << std::endl;
+
+  // Cleanup
+  Renderer::Shutdown();
+  Engine::Engine::Shutdown();
+
+  std::cout << "✅ Cleanup complete. Goodbye!" << std::endl;
+  return 0;
+}
\ No newline at end of file
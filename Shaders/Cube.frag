@@ -2,8 +2,10 @@
 
 in vec3 v_Color;
 
+uniform float u_Alpha;
+
 out vec4 FragColor;
 
 void main() {
-    FragColor = vec4(v_Color, 1.0);
+    FragColor = vec4(v_Color, u_Alpha);
 }
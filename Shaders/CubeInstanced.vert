@@ -0,0 +1,22 @@
+#version 330 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec3 a_Color;
+
+// Per-instance model matrix rows 0..2; row 3 is always (0, 0, 0, 1)
+layout(location = 2) in vec4 a_ModelRow0;
+layout(location = 3) in vec4 a_ModelRow1;
+layout(location = 4) in vec4 a_ModelRow2;
+
+uniform mat4 u_ViewProjection;
+uniform vec3 u_Color;
+
+out vec3 v_Color;
+
+void main() {
+    vec4 position = vec4(a_Position, 1.0);
+    vec3 world = vec3(dot(a_ModelRow0, position), dot(a_ModelRow1, position),
+                      dot(a_ModelRow2, position));
+    gl_Position = u_ViewProjection * vec4(world, 1.0);
+    v_Color = a_Color * u_Color;
+}
@@ -0,0 +1,232 @@
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("AffineTests", std::string("FAILED: ") + message);           \
+    return false;                                                              \
+  }
+
+// Usable in constant expressions like Mat4
+static_assert(sizeof(Affine3x4) == 48, "Affine3x4 is three packed vec4 rows");
+static_assert(Affine3x4::Translation(Vec3(1.0f, 2.0f, 3.0f))
+                      .TransformPoint(Vec3(1.0f, 1.0f, 1.0f))
+                      .z == 4.0f,
+              "Translation applies to points");
+static_assert((Affine3x4::Translation(Vec3(1.0f, 0.0f, 0.0f)) *
+               Affine3x4::Translation(Vec3(0.0f, 2.0f, 0.0f)))
+                      .GetTranslation()
+                      .y == 2.0f,
+              "Composition adds translations");
+
+static bool Close(float a, float b, float tolerance = 1e-4f) {
+  return std::abs(a - b) <= tolerance * std::max(1.0f, std::abs(b));
+}
+
+static bool Close(const Affine3x4 &a, const Mat4 &b, float tolerance = 1e-4f) {
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      if (!Close(a.m[i][j], b.m[i][j], tolerance)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static bool Close(const Mat4 &a, const Mat4 &b, float tolerance = 1e-4f) {
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      if (!Close(a.m[i][j], b.m[i][j], tolerance)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Random translate * rotate * scale transforms with non-uniform scale
+static std::vector<Transform> MakeTransforms(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+  std::uniform_real_distribution<float> axis(-1.0f, 1.0f);
+  std::uniform_real_distribution<float> angle(-PI, PI);
+  std::uniform_real_distribution<float> scale(0.25f, 4.0f);
+
+  std::vector<Transform> transforms;
+  transforms.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    Vec3 rotationAxis(axis(rng), axis(rng), axis(rng) + 2.0f);
+    transforms.emplace_back(
+        Vec3(position(rng), position(rng), position(rng)),
+        Quaternion::FromAxisAngle(rotationAxis, angle(rng)),
+        Vec3(scale(rng), scale(rng), scale(rng)));
+  }
+  return transforms;
+}
+
+// Translate * rotate * scale as full Mat4 products, the old ToMatrix()
+static Mat4 ReferenceMatrix(const Transform &transform) {
+  return Mat4::Translation(transform.position) *
+         transform.rotation.ToMatrix() * Mat4::Scale(transform.scale);
+}
+
+//============================================================================
+// Construction and Composition
+//============================================================================
+bool TestConstruction() {
+  Logger::Info("AffineTests", "Testing TRS construction...");
+
+  for (const Transform &transform : MakeTransforms(256, 1)) {
+    Mat4 reference = ReferenceMatrix(transform);
+    Affine3x4 affine = transform.ToAffine();
+    TEST_ASSERT(Close(affine, reference), "TRS should match the Mat4 product");
+    TEST_ASSERT(Close(transform.ToMatrix(), reference),
+                "Transform::ToMatrix should match the Mat4 product");
+    TEST_ASSERT(transform.ToMatrix().m[3][3] == 1.0f &&
+                    transform.ToMatrix().m[3][0] == 0.0f,
+                "ToMat4 should append (0, 0, 0, 1)");
+
+    Affine3x4 fromMat4(reference);
+    TEST_ASSERT(Close(fromMat4, reference), "Mat4 constructor drops row 3");
+
+    Vec3 point(1.5f, -2.0f, 0.25f);
+    Vec3 expected = transform.TransformPoint(point);
+    Vec3 actual = affine.TransformPoint(point);
+    TEST_ASSERT(Close(actual.x, expected.x, 1e-3f) &&
+                    Close(actual.y, expected.y, 1e-3f) &&
+                    Close(actual.z, expected.z, 1e-3f),
+                "TransformPoint should match Transform::TransformPoint");
+
+    Vec3 vector = affine.TransformVector(point);
+    Vec3 expectedVector = reference.TransformVector(point);
+    TEST_ASSERT(Close(vector.x, expectedVector.x) &&
+                    Close(vector.y, expectedVector.y) &&
+                    Close(vector.z, expectedVector.z),
+                "TransformVector should ignore translation");
+  }
+
+  Logger::Info("AffineTests", "✅ TRS construction tests passed!");
+  return true;
+}
+
+bool TestComposition() {
+  Logger::Info("AffineTests", "Testing composition...");
+
+  std::vector<Transform> transforms = MakeTransforms(256, 2);
+  for (size_t i = 0; i + 1 < transforms.size(); ++i) {
+    Affine3x4 a = transforms[i].ToAffine();
+    Affine3x4 b = transforms[i + 1].ToAffine();
+    TEST_ASSERT(Close(a * b, a.ToMat4() * b.ToMat4()),
+                "Compose should match the Mat4 product");
+
+    // Projective on the left, e.g. view-projection * model
+    Mat4 projection = Mat4::Perspective(ToRadians(60.0f), 1.5f, 0.1f, 100.0f);
+    Mat4 viewProjection = projection * a.ToMat4();
+    TEST_ASSERT(Close(viewProjection * b, viewProjection * b.ToMat4()),
+                "Mat4 * Affine3x4 should match the Mat4 product");
+  }
+
+  Logger::Info("AffineTests", "✅ Composition tests passed!");
+  return true;
+}
+
+//============================================================================
+// Inverses and Normals
+//============================================================================
+bool TestInverse() {
+  Logger::Info("AffineTests", "Testing inverses...");
+
+  for (const Transform &transform : MakeTransforms(256, 3)) {
+    Affine3x4 affine = transform.ToAffine();
+    TEST_ASSERT(Close(affine.Inverted(), affine.ToMat4().Inverted()),
+                "Inverted should match Mat4::Inverted");
+    TEST_ASSERT(Close(affine * affine.Inverted(), Mat4::Identity(), 1e-3f),
+                "A * A^-1 should be identity");
+    TEST_ASSERT(Close(affine.Determinant(),
+                      transform.scale.x * transform.scale.y *
+                          transform.scale.z,
+                      1e-3f),
+                "Determinant of TRS is the scale product");
+
+    Affine3x4 rigid =
+        Affine3x4::TRS(transform.position, transform.rotation, Vec3::One());
+    TEST_ASSERT(Close(rigid.InvertedRigid(), rigid.ToMat4().Inverted()),
+                "InvertedRigid should match the full inverse");
+  }
+
+  // Shear is not expressible as TRS but still affine
+  Affine3x4 shear(Vec4(1.0f, 0.5f, 0.0f, 3.0f), Vec4(0.0f, 1.0f, 0.25f, -1.0f),
+                  Vec4(0.75f, 0.0f, 2.0f, 4.0f));
+  TEST_ASSERT(Close(shear.Inverted(), shear.ToMat4().Inverted()),
+              "Inverted should handle shear");
+
+  Affine3x4 singular(Vec4(1.0f, 0.0f, 0.0f, 1.0f), Vec4(2.0f, 0.0f, 0.0f, 2.0f),
+                     Vec4(0.0f, 0.0f, 1.0f, 3.0f));
+  TEST_ASSERT(Close(singular.Inverted(), Mat4::Identity()),
+              "Singular matrices should invert to identity");
+
+  Logger::Info("AffineTests", "✅ Inverse tests passed!");
+  return true;
+}
+
+bool TestNormalMatrix() {
+  Logger::Info("AffineTests", "Testing normal matrix...");
+
+  for (const Transform &transform : MakeTransforms(256, 4)) {
+    Affine3x4 affine = transform.ToAffine();
+    Mat4 expected = affine.ToMat4().Inverted().Transposed();
+    Affine3x4 normalMatrix = affine.NormalMatrix();
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        TEST_ASSERT(Close(normalMatrix.m[i][j], expected.m[i][j]),
+                    "NormalMatrix should be the inverse transpose");
+      }
+      TEST_ASSERT(normalMatrix.m[i][3] == 0.0f,
+                  "NormalMatrix should have no translation");
+    }
+
+    // Normals stay perpendicular to transformed tangents
+    Vec3 normal = Vec3(0.3f, 0.8f, -0.5f).Normalized();
+    Vec3 tangent = normal.Cross(Vec3(1.0f, 0.0f, 0.0f));
+    Vec3 transformedNormal = affine.TransformNormal(normal);
+    Vec3 transformedTangent = affine.TransformVector(tangent);
+    TEST_ASSERT(Close(transformedNormal.Length(), 1.0f),
+                "TransformNormal should renormalize");
+    TEST_ASSERT(std::abs(transformedNormal.Dot(transformedTangent)) <
+                    1e-3f * std::max(1.0f, transformedTangent.Length()),
+                "Transformed normal should stay perpendicular");
+  }
+
+  Logger::Info("AffineTests", "✅ Normal matrix tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("AffineTests", "Starting affine transform tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestConstruction();
+  allPassed &= TestComposition();
+  allPassed &= TestInverse();
+  allPassed &= TestNormalMatrix();
+
+  if (allPassed) {
+    Logger::Info("AffineTests", "🎉 ALL AFFINE TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("AffineTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
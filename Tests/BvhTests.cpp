@@ -0,0 +1,434 @@
+#include "Core/JobSystem.h"
+#include "Core/Logger.h"
+#include "Math/Bvh.h"
+#include "Math/Math.h"
+#include "MathTestUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+using namespace Engine::Test;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("BvhTests", std::string("FAILED: ") + message);              \
+    return false;                                                              \
+  }
+
+static const BvhBuilder kBuilders[] = {BvhBuilder::BinnedSah,
+                                       BvhBuilder::Morton};
+
+static std::string Name(BvhBuilder builder) {
+  return builder == BvhBuilder::BinnedSah ? "SAH" : "Morton";
+}
+
+// Sorted indices the tree returned against the per-object test
+static bool MatchesBruteForce(const Frustum &frustum,
+                              const std::vector<AABB> &boxes,
+                              std::vector<uint32_t> visible) {
+  std::sort(visible.begin(), visible.end());
+  if (std::adjacent_find(visible.begin(), visible.end()) != visible.end()) {
+    return false;
+  }
+  size_t next = 0;
+  for (uint32_t i = 0; i < boxes.size(); ++i) {
+    bool found = next < visible.size() && visible[next] == i;
+    next += found;
+    if (found != frustum.Intersects(boxes[i]) &&
+        std::abs(Margin(frustum, boxes[i])) > 1e-3) {
+      return false;
+    }
+  }
+  return next == visible.size();
+}
+
+// Closest box hit by brute force, with the semantics of Ray::IntersectAABB
+static RayHit ClosestBox(const Ray &ray, const std::vector<AABB> &boxes) {
+  RayHit hit;
+  Vec3 invDir = ray.InverseDirection();
+  for (uint32_t i = 0; i < boxes.size(); ++i) {
+    float t;
+    if (ray.IntersectAABB(boxes[i], invDir, t) && t < hit.T) {
+      hit.T = t;
+      hit.Index = i;
+    }
+  }
+  return hit;
+}
+
+//============================================================================
+// Structure
+//============================================================================
+template <int Width>
+static bool CheckStructure(const Bvh<Width> &bvh,
+                           const std::vector<AABB> &boxes,
+                           uint32_t maxLeafSize) {
+  using Node = BvhNode<Width>;
+  Span<const uint32_t> objects = bvh.GetObjects();
+  if (objects.size() != boxes.size()) {
+    return false;
+  }
+  std::vector<uint32_t> sorted(objects.begin(), objects.end());
+  std::sort(sorted.begin(), sorted.end());
+  for (uint32_t i = 0; i < sorted.size(); ++i) {
+    if (sorted[i] != i) {
+      return false;
+    }
+  }
+
+  auto contains = [](const Node &node, int lane, const AABB &box) {
+    return node.Bounds[0][lane] <= box.min.x &&
+           node.Bounds[1][lane] <= box.min.y &&
+           node.Bounds[2][lane] <= box.min.z &&
+           node.Bounds[3][lane] >= box.max.x &&
+           node.Bounds[4][lane] >= box.max.y &&
+           node.Bounds[5][lane] >= box.max.z;
+  };
+
+  Span<const Node> nodes = bvh.GetNodes();
+  for (uint32_t index = 0; index < nodes.size(); ++index) {
+    const Node &node = nodes[index];
+    // Lanes in order cover the node's range without gaps
+    uint32_t next = node.ObjectBegin;
+    bool seenEmpty = false;
+    for (int lane = 0; lane < Width; ++lane) {
+      uint32_t child = node.Children[lane];
+      if (child == Node::kEmpty) {
+        seenEmpty = true;
+        continue;
+      }
+      if (seenEmpty) {
+        return false;
+      }
+      uint32_t begin, count;
+      if (child & Node::kLeaf) {
+        begin = child & ~Node::kLeaf;
+        count = node.Counts[lane];
+        if (count == 0 || count > maxLeafSize) {
+          return false;
+        }
+      } else {
+        if (child <= index || child >= nodes.size()) {
+          return false;
+        }
+        begin = nodes[child].ObjectBegin;
+        count = nodes[child].ObjectCount;
+      }
+      if (begin != next) {
+        return false;
+      }
+      next += count;
+      for (uint32_t i = begin; i < begin + count; ++i) {
+        if (!contains(node, lane, boxes[objects[i]])) {
+          return false;
+        }
+      }
+    }
+    if (next != node.ObjectBegin + node.ObjectCount) {
+      return false;
+    }
+  }
+  return nodes[0].ObjectBegin == 0 && nodes[0].ObjectCount == boxes.size();
+}
+
+bool TestStructure() {
+  Logger::Info("BvhTests", "Testing tree structure...");
+
+  for (size_t count : {1u, 2u, 5u, 100u, 20000u}) {
+    std::vector<AABB> boxes = MakeBoxes(count, 11 + count, 100.0f, 2.0f);
+    for (BvhBuilder builder : kBuilders) {
+      for (uint32_t leafSize : {1u, 4u, 8u}) {
+        BvhBuildSettings settings;
+        settings.Builder = builder;
+        settings.MaxLeafSize = leafSize;
+        settings.SubtreeJobSize = 1000;
+        Bvh4 bvh4;
+        bvh4.Build(boxes, settings);
+        Bvh8 bvh8;
+        bvh8.Build(boxes, settings);
+        std::string name = Name(builder) + " with " +
+                           std::to_string(count) + " objects, leaves of " +
+                           std::to_string(leafSize);
+        TEST_ASSERT(CheckStructure(bvh4, boxes, leafSize),
+                    "Bvh4 is consistent, " + name);
+        TEST_ASSERT(CheckStructure(bvh8, boxes, leafSize),
+                    "Bvh8 is consistent, " + name);
+      }
+    }
+  }
+
+  // Coincident boxes give SAH nothing to split; depth stays bounded
+  std::vector<AABB> stacked(50000, AABB(Vec3(-1.0f), Vec3(1.0f)));
+  for (BvhBuilder builder : kBuilders) {
+    BvhBuildSettings settings;
+    settings.Builder = builder;
+    Bvh4 bvh;
+    bvh.Build(stacked, settings);
+    TEST_ASSERT(CheckStructure(bvh, stacked, settings.MaxLeafSize),
+                "Coincident boxes build a valid tree with " + Name(builder));
+    std::vector<uint32_t> visible(stacked.size());
+    RayHit hit;
+    Ray ray(Vec3(0.0f, 0.0f, -5.0f), Vec3(0.0f, 0.0f, 1.0f));
+    TEST_ASSERT(bvh.Raycast(ray, hit) && std::abs(hit.T - 4.0f) < 1e-5f,
+                "Coincident boxes are hit");
+  }
+
+  Bvh8 empty;
+  empty.Build(Span<const AABB>());
+  std::vector<uint32_t> visible(4);
+  RayHit hit;
+  TEST_ASSERT(empty.IsEmpty() && empty.GetObjectCount() == 0,
+              "An empty build has no nodes");
+  TEST_ASSERT(empty.Cull(Frustum::FromMatrix(Mat4::Identity()), visible) == 0,
+              "An empty tree culls nothing");
+  TEST_ASSERT(!empty.Raycast(Ray(), hit) && !hit.IsHit(),
+              "An empty tree hits nothing");
+
+  Logger::Info("BvhTests", "✅ Structure tests passed!");
+  return true;
+}
+
+//============================================================================
+// Queries
+//============================================================================
+template <int Width>
+static bool CheckCull(const Bvh<Width> &bvh, const std::vector<AABB> &boxes,
+                      const MathKernelTable *table, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::vector<uint32_t> visible(boxes.size());
+  for (int query = 0; query < 8; ++query) {
+    Frustum frustum = MakeFrustum(rng, 100.0f);
+    size_t count = table->CullBvh(frustum.planes, bvh.GetView(),
+                                  visible.data(), visible.size());
+    if (!MatchesBruteForce(
+            frustum, boxes,
+            std::vector<uint32_t>(visible.begin(), visible.begin() + count))) {
+      return false;
+    }
+    // A short output is filled and no further
+    size_t capacity = count / 3;
+    std::vector<uint32_t> partial(capacity + 1, 0xDEADBEEFu);
+    size_t written = table->CullBvh(frustum.planes, bvh.GetView(),
+                                    partial.data(), capacity);
+    if (written != capacity || partial[capacity] != 0xDEADBEEFu) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <int Width>
+static bool CheckRaycast(const Bvh<Width> &bvh, const std::vector<AABB> &boxes,
+                         const MathKernelTable *table, uint32_t seed) {
+  std::vector<Ray> rays = MakeRays(200, seed, 100.0f);
+  std::vector<RayHit> closest(rays.size()), any(rays.size());
+  // Half the any-hit queries get a limit, so some have to miss
+  for (size_t i = 0; i < rays.size(); i += 2) {
+    any[i].T = 20.0f;
+  }
+  table->RaycastBvh(bvh.GetView(), rays.data(), closest.data(), rays.size(),
+                    false);
+  table->RaycastBvh(bvh.GetView(), rays.data(), any.data(), rays.size(),
+                    true);
+
+  for (size_t i = 0; i < rays.size(); ++i) {
+    RayHit expected = ClosestBox(rays[i], boxes);
+    if (closest[i].T != expected.T) {
+      return false;
+    }
+    // Ties may pick another box at the same distance
+    Vec3 invDir = rays[i].InverseDirection();
+    float t;
+    if (closest[i].IsHit() &&
+        (!rays[i].IntersectAABB(boxes[closest[i].Index], invDir, t) ||
+         t != expected.T)) {
+      return false;
+    }
+
+    float limit = i % 2 == 0 ? 20.0f : std::numeric_limits<float>::infinity();
+    if (any[i].IsHit() != (expected.T < limit)) {
+      return false;
+    }
+    if (any[i].IsHit() &&
+        (!rays[i].IntersectAABB(boxes[any[i].Index], invDir, t) ||
+         t != any[i].T || t >= limit)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestQueries() {
+  Logger::Info("BvhTests", "Testing culling and ray queries...");
+
+  std::vector<AABB> boxes = MakeBoxes(30000, 5, 100.0f, 3.0f);
+  for (BvhBuilder builder : kBuilders) {
+    BvhBuildSettings settings;
+    settings.Builder = builder;
+    settings.SubtreeJobSize = 2000;
+    Bvh4 bvh4;
+    bvh4.Build(boxes, settings);
+    Bvh8 bvh8;
+    bvh8.Build(boxes, settings);
+
+    for (const MathKernelTable *table : AvailableTables()) {
+      std::string name = Name(builder) + " on " + Name(table);
+      TEST_ASSERT(CheckCull(bvh4, boxes, table, 21),
+                  "Bvh4 culling matches brute force, " + name);
+      TEST_ASSERT(CheckCull(bvh8, boxes, table, 22),
+                  "Bvh8 culling matches brute force, " + name);
+      TEST_ASSERT(CheckRaycast(bvh4, boxes, table, 23),
+                  "Bvh4 rays match brute force, " + name);
+      TEST_ASSERT(CheckRaycast(bvh8, boxes, table, 24),
+                  "Bvh8 rays match brute force, " + name);
+    }
+  }
+
+  // A frustum around everything copies whole subtrees
+  Bvh8 bvh;
+  bvh.Build(boxes);
+  Frustum all = Frustum::FromMatrix(Mat4::Orthographic(
+      -200.0f, 200.0f, -200.0f, 200.0f, -200.0f, 200.0f));
+  std::vector<uint32_t> visible(boxes.size());
+  size_t count = bvh.Cull(all, visible);
+  visible.resize(count);
+  TEST_ASSERT(count == boxes.size() && MatchesBruteForce(all, boxes, visible),
+              "A frustum around the scene returns every object once");
+
+  // Exact primitives: spheres inscribed in the boxes
+  std::vector<Ray> rays = MakeRays(300, 31, 100.0f);
+  auto sphereOf = [&](uint32_t i) {
+    const AABB &box = boxes[i];
+    Vec3 extents = box.Extents();
+    return Sphere(box.Center(),
+                  std::min({extents.x, extents.y, extents.z}));
+  };
+  for (const Ray &ray : rays) {
+    RayHit expected;
+    for (uint32_t i = 0; i < boxes.size(); ++i) {
+      float t;
+      if (ray.IntersectSphere(sphereOf(i), t) && t < expected.T) {
+        expected.T = t;
+        expected.Index = i;
+      }
+    }
+    RayHit hit;
+    bool found = bvh.Raycast(ray, hit,
+                             [&](uint32_t object, float &t, float &, float &) {
+                               return ray.IntersectSphere(sphereOf(object), t);
+                             });
+    TEST_ASSERT(found == expected.IsHit() && hit.T == expected.T,
+                "Custom primitives find the brute-force closest hit");
+  }
+
+  // Batch queries through the job system match one ray at a time
+  JobSystem::Initialize(3);
+  std::vector<RayHit> batch(rays.size());
+  bvh.Raycast(rays, batch, RayQuery::Closest, 16);
+  JobSystem::Shutdown();
+  for (size_t i = 0; i < rays.size(); ++i) {
+    RayHit single;
+    bvh.Raycast(rays[i], single);
+    TEST_ASSERT(batch[i].T == single.T && batch[i].Index == single.Index,
+                "Parallel batch rays match single rays");
+  }
+
+  Logger::Info("BvhTests", "✅ Query tests passed!");
+  return true;
+}
+
+//============================================================================
+// Refit
+//============================================================================
+bool TestRefit() {
+  Logger::Info("BvhTests", "Testing refit...");
+
+  std::vector<AABB> boxes = MakeBoxes(40000, 9, 100.0f, 3.0f);
+  std::mt19937 rng(17);
+  std::uniform_real_distribution<float> step(-4.0f, 4.0f);
+  std::uniform_real_distribution<float> grow(0.8f, 1.3f);
+
+  for (BvhBuilder builder : kBuilders) {
+    BvhBuildSettings settings;
+    settings.Builder = builder;
+    settings.SubtreeJobSize = 2000;
+    std::vector<AABB> moving = boxes;
+    Bvh4 bvh4;
+    bvh4.Build(moving, settings);
+    Bvh8 bvh8;
+    bvh8.Build(moving, settings);
+
+    JobSystem::Initialize(3);
+    for (int frame = 0; frame < 3; ++frame) {
+      for (AABB &box : moving) {
+        Vec3 offset(step(rng), step(rng), step(rng));
+        Vec3 half = box.Extents() * grow(rng);
+        box = AABB(box.Center() + offset - half, box.Center() + offset + half);
+      }
+      bvh4.Refit(moving);
+      bvh8.Refit(moving);
+    }
+    JobSystem::Shutdown();
+
+    std::string name = " after refit with " + Name(builder);
+    TEST_ASSERT(CheckStructure(bvh4, moving, settings.MaxLeafSize),
+                "Bvh4 bounds contain the moved boxes" + name);
+    TEST_ASSERT(CheckStructure(bvh8, moving, settings.MaxLeafSize),
+                "Bvh8 bounds contain the moved boxes" + name);
+    const MathKernelTable &table = MathKernels::Get();
+    TEST_ASSERT(CheckCull(bvh4, moving, &table, 41) &&
+                    CheckCull(bvh8, moving, &table, 42),
+                "Culling matches brute force" + name);
+    TEST_ASSERT(CheckRaycast(bvh4, moving, &table, 43) &&
+                    CheckRaycast(bvh8, moving, &table, 44),
+                "Rays match brute force" + name);
+
+    // The root bounds are exactly the union of the moved boxes
+    AABB expected = moving[0];
+    for (const AABB &box : moving) {
+      expected.min = Vec3(std::min(expected.min.x, box.min.x),
+                          std::min(expected.min.y, box.min.y),
+                          std::min(expected.min.z, box.min.z));
+      expected.max = Vec3(std::max(expected.max.x, box.max.x),
+                          std::max(expected.max.y, box.max.y),
+                          std::max(expected.max.z, box.max.z));
+    }
+    for (const AABB &bounds : {bvh4.GetBounds(), bvh8.GetBounds()}) {
+      TEST_ASSERT(bounds.min.x == expected.min.x &&
+                      bounds.min.y == expected.min.y &&
+                      bounds.min.z == expected.min.z &&
+                      bounds.max.x == expected.max.x &&
+                      bounds.max.y == expected.max.y &&
+                      bounds.max.z == expected.max.z,
+                  "Root bounds are the union of the boxes" + name);
+    }
+  }
+
+  Logger::Info("BvhTests", "✅ Refit tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("BvhTests", "Starting BVH tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestStructure();
+  allPassed &= TestQueries();
+  allPassed &= TestRefit();
+
+  if (allPassed) {
+    Logger::Info("BvhTests", "🎉 ALL BVH TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("BvhTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include "Math/Primitives.h"
+#include <cstring>
+#include <string>
+
+using namespace Engine;
+using namespace Engine::Math;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("ConstexprMathTests", std::string("FAILED: ") + message);    \
+    return false;                                                              \
+  }
+
+//============================================================================
+// Compile-time checks
+//============================================================================
+static_assert(Sqrt(16.0f) == 4.0f, "constexpr Sqrt");
+static_assert(Sqrt(2.0f) == 1.41421356f, "constexpr Sqrt rounds correctly");
+static_assert(Clamp(Smoothstep(0.0f, 1.0f, 0.5f), 0.0f, 1.0f) == 0.5f,
+              "constexpr scalar helpers");
+
+static_assert((Vec3(1.0f, 2.0f, 3.0f) + Vec3(1.0f)).z == 4.0f,
+              "constexpr Vec3 arithmetic");
+static_assert(Vec3::UnitX().Cross(Vec3::UnitY()).z == 1.0f,
+              "constexpr Cross");
+static_assert(Vec3(3.0f, 0.0f, 4.0f).Length() == 5.0f, "constexpr Length");
+static_assert(Vec4(1.0f, 2.0f, 3.0f, 4.0f).Dot(Vec4::One()) == 10.0f,
+              "constexpr Vec4 Dot");
+static_assert(Vec3(1.0f, 2.0f, 3.0f)[2] == 3.0f, "constexpr indexing");
+
+static_assert(Mat4::Translation(Vec3(1.0f, 2.0f, 3.0f))
+                      .TransformPoint(Vec3::One())
+                      .y == 3.0f,
+              "constexpr TransformPoint");
+static_assert((Mat4::Scale(2.0f) * Mat4::Scale(3.0f)).m[1][1] == 6.0f,
+              "constexpr Mat4 multiply");
+static_assert(Mat4::Scale(2.0f).Determinant() == 8.0f,
+              "constexpr Determinant");
+
+static_assert(Quaternion(0.0f, 0.0f, 1.0f, 0.0f)
+                      .RotateVector(Vec3::UnitX())
+                      .x == -1.0f,
+              "constexpr RotateVector");
+static_assert(AABB(Vec3(-1.0f), Vec3(1.0f)).Contains(Vec3::Zero()),
+              "constexpr AABB");
+
+static_assert(Primitives::kCube.vertices.size() == 24 &&
+                  Primitives::kCube.indices[35] == 20,
+              "constexpr cube");
+
+// Tables built from the math types end up in .rodata
+constexpr Mat4 kBakedModel =
+    Mat4::Translation(Vec3(1.0f, -2.0f, 3.0f)) *
+    Quaternion(0.1f, 0.7f, -0.2f, 0.6f).Normalized().ToMatrix() *
+    Mat4::Scale(Vec3(2.0f, 1.0f, 0.5f));
+constexpr Mat4 kBakedView = Mat4::LookAt(Vec3(4.0f, 3.0f, 5.0f),
+                                         Vec3::Zero(), Vec3::Up());
+constexpr Vec3 kBakedPoint =
+    (kBakedView * kBakedModel).TransformPoint(Vec3(0.5f, -0.25f, 1.0f));
+
+template <typename T> static bool SameBits(const T &a, const T &b) {
+  return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+//============================================================================
+// Runtime Parity Tests
+//============================================================================
+bool TestRuntimeParity() {
+  Logger::Info("ConstexprMathTests",
+               "Testing baked values against the SIMD paths...");
+
+  // volatile keeps the inputs out of the optimizer's constant folding
+  volatile float half = 0.5f;
+  Vec3 translation(1.0f, -2.0f, 3.0f);
+  Quaternion rotation(0.1f, 0.7f, -0.2f, 0.6f);
+  Mat4 model = Mat4::Translation(translation) *
+               rotation.Normalized().ToMatrix() *
+               Mat4::Scale(Vec3(2.0f, 1.0f, 0.5f));
+  Mat4 view =
+      Mat4::LookAt(Vec3(4.0f, 3.0f, 5.0f), Vec3::Zero(), Vec3::Up());
+  Vec3 point = (view * model).TransformPoint(Vec3(half, -0.25f, 1.0f));
+
+  for (int i = 0; i < 16; ++i) {
+    TEST_ASSERT(model.data[i] == kBakedModel.m[i / 4][i % 4],
+                "Baked model matrix matches runtime");
+    TEST_ASSERT(view.data[i] == kBakedView.m[i / 4][i % 4],
+                "Baked view matrix matches runtime");
+  }
+  TEST_ASSERT(point.x == kBakedPoint.x && point.y == kBakedPoint.y &&
+                  point.z == kBakedPoint.z,
+              "Baked point matches runtime");
+
+  float value = 7.0f * half;
+  TEST_ASSERT(Sqrt(value) == std::sqrt(3.5f), "Runtime Sqrt is std::sqrt");
+
+  Logger::Info("ConstexprMathTests", "✅ Runtime parity tests passed!");
+  return true;
+}
+
+//============================================================================
+// Primitive Tests
+//============================================================================
+bool TestPrimitives() {
+  Logger::Info("ConstexprMathTests", "Testing built-in primitives...");
+
+  // Every cube face winds counter-clockwise seen from outside and carries
+  // its outward normal
+  const auto &cube = Primitives::kCube;
+  for (size_t face = 0; face < 6; ++face) {
+    const Primitives::SurfaceVertex *v = &cube.vertices[4 * face];
+    Vec3 winding = (v[1].position - v[0].position)
+                       .Cross(v[2].position - v[0].position);
+    TEST_ASSERT(winding.Dot(v[0].normal) > 0.0f, "Cube face winding");
+    for (int corner = 0; corner < 4; ++corner) {
+      TEST_ASSERT(IsEqual(v[corner].position.Dot(v[corner].normal), 0.5f),
+                  "Cube face lies on the unit cube");
+    }
+  }
+  for (uint32_t index : cube.indices) {
+    TEST_ASSERT(index < cube.vertices.size(), "Cube indices in range");
+  }
+
+  const auto &plane = Primitives::kPlane;
+  Vec3 winding = (plane.vertices[1].position - plane.vertices[0].position)
+                     .Cross(plane.vertices[2].position -
+                            plane.vertices[0].position);
+  TEST_ASSERT(winding.y > 0.0f && plane.vertices[0].normal.y == 1.0f,
+              "Plane faces +Y");
+
+  constexpr auto colored = Primitives::InterleavePositionColor(
+      Primitives::kCubeCorners, Vec3(1.0f, 0.5f, 0.25f));
+  static_assert(colored.size() == 48, "Six floats per corner");
+  TEST_ASSERT(colored[42] == -0.5f && colored[44] == -0.5f &&
+                  colored[47] == 0.25f,
+              "Interleaved position and color");
+
+  TEST_ASSERT(SameBits(Primitives::kCubeCorners[6], Vec3(0.5f, 0.5f, -0.5f)),
+              "Cube corner padding is zero");
+
+  Logger::Info("ConstexprMathTests", "✅ Primitive tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("ConstexprMathTests", "Starting constexpr math tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestRuntimeParity();
+  allPassed &= TestPrimitives();
+
+  if (allPassed) {
+    Logger::Info("ConstexprMathTests", "🎉 ALL CONSTEXPR MATH TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("ConstexprMathTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,264 @@
+#include "Core/Logger.h"
+#include "Renderer/DynamicResolution.h"
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("DynamicResolutionTests", std::string("FAILED: ") + message); \
+    return false;                                                              \
+  }
+
+//============================================================================
+// Synthetic frame-time model
+//============================================================================
+// Simulated frame: fixed CPU cost plus a GPU cost proportional to the number
+// of pixels shaded (scale squared).
+struct FrameModel {
+  float fixedMs;
+  float fullResGpuMs;
+
+  float FrameTime(float scale) const {
+    return fixedMs + fullResGpuMs * scale * scale;
+  }
+};
+
+static float RunTrace(DynamicResolutionController &controller,
+                      const FrameModel &model, int frames,
+                      std::vector<float> *scales = nullptr) {
+  for (int i = 0; i < frames; ++i) {
+    float scale = controller.Update(model.FrameTime(controller.GetScale()));
+    if (scales) {
+      scales->push_back(scale);
+    }
+  }
+  return controller.GetScale();
+}
+
+// With vsync on, frames are measured either by their work time, taken
+// before the swap, or by the interval between swaps: the work rounded up to
+// whole refresh periods
+static float RunVsyncTrace(DynamicResolutionController &controller,
+                           const FrameModel &model, int frames,
+                           float refreshMs, bool swapIntervals) {
+  for (int i = 0; i < frames; ++i) {
+    float workMs = model.FrameTime(controller.GetScale());
+    controller.Update(swapIntervals
+                          ? std::ceil(workMs / refreshMs) * refreshMs
+                          : workMs);
+  }
+  return controller.GetScale();
+}
+
+static int CountScaleChanges(const std::vector<float> &scales) {
+  int changes = 0;
+  for (size_t i = 1; i < scales.size(); ++i) {
+    if (scales[i] != scales[i - 1]) {
+      ++changes;
+    }
+  }
+  return changes;
+}
+
+//============================================================================
+// Controller Tests
+//============================================================================
+bool TestStaysAtMaxWhenUnderBudget() {
+  Logger::Info("DynamicResolutionTests", "Testing light load...");
+
+  DynamicResolutionController controller;
+  FrameModel light{2.0f, 6.0f}; // 8 ms at full resolution
+
+  float scale = RunTrace(controller, light, 300);
+  TEST_ASSERT(scale == controller.GetSettings().MaxScale,
+              "Scale stays at maximum under budget");
+
+  Logger::Info("DynamicResolutionTests", "✅ Light load tests passed!");
+  return true;
+}
+
+bool TestConvergesUnderSustainedLoad() {
+  Logger::Info("DynamicResolutionTests", "Testing sustained heavy load...");
+
+  DynamicResolutionSettings settings;
+  DynamicResolutionController controller(settings);
+  FrameModel heavy{4.0f, 24.0f}; // 28 ms at full resolution
+
+  float scale = RunTrace(controller, heavy, 600);
+  float frameTime = heavy.FrameTime(scale);
+
+  TEST_ASSERT(scale < 1.0f, "Scale drops under heavy load");
+  TEST_ASSERT(scale >= settings.MinScale, "Scale respects minimum");
+  TEST_ASSERT(frameTime <= settings.TargetFrameTimeMs *
+                               (1.0f + settings.DownThreshold),
+              "Frame time brought back within budget");
+  TEST_ASSERT(frameTime >= settings.TargetFrameTimeMs *
+                               (1.0f - settings.UpThreshold) * 0.8f,
+              "Scale does not collapse far below what the budget allows");
+
+  Logger::Info("DynamicResolutionTests",
+               "Converged to scale " + std::to_string(scale) + " at " +
+                   std::to_string(frameTime) + " ms");
+  Logger::Info("DynamicResolutionTests", "✅ Sustained load tests passed!");
+  return true;
+}
+
+bool TestRespectsLimits() {
+  Logger::Info("DynamicResolutionTests", "Testing scale limits...");
+
+  DynamicResolutionSettings settings;
+  settings.MinScale = 0.6f;
+  settings.MaxScale = 0.9f;
+  DynamicResolutionController controller(settings);
+
+  TEST_ASSERT(controller.GetScale() == 0.9f, "Starts at maximum scale");
+
+  // Impossible budget: even the minimum scale is too slow
+  FrameModel hopeless{40.0f, 40.0f};
+  float scale = RunTrace(controller, hopeless, 400);
+  TEST_ASSERT(scale == 0.6f, "Clamped to minimum scale");
+
+  // Trivial load recovers all the way to the maximum
+  FrameModel trivial{1.0f, 1.0f};
+  scale = RunTrace(controller, trivial, 400);
+  TEST_ASSERT(scale == 0.9f, "Recovers to maximum scale");
+
+  TEST_ASSERT(controller.ScaleDimension(1000) == 900,
+              "ScaleDimension applies current scale");
+
+  // Supersampling is not supported
+  settings.MinScale = 1.2f;
+  settings.MaxScale = 1.5f;
+  controller.SetSettings(settings);
+  TEST_ASSERT(controller.GetSettings().MaxScale == 1.0f,
+              "Maximum scale clamped to 1");
+  TEST_ASSERT(controller.GetSettings().MinScale == 1.0f,
+              "Minimum scale clamped to 1");
+
+  Logger::Info("DynamicResolutionTests", "✅ Limit tests passed!");
+  return true;
+}
+
+bool TestSpikeResponse() {
+  Logger::Info("DynamicResolutionTests", "Testing spike response...");
+
+  DynamicResolutionController controller;
+  FrameModel light{2.0f, 8.0f};
+  FrameModel spike{4.0f, 30.0f};
+
+  RunTrace(controller, light, 60);
+  TEST_ASSERT(controller.GetScale() == 1.0f, "Full resolution before spike");
+
+  // Scale must react within a couple of history windows
+  RunTrace(controller, spike, 40);
+  TEST_ASSERT(controller.GetScale() < 1.0f, "Scale reacts to spike");
+
+  // And climb back once the spike is over
+  RunTrace(controller, light, 600);
+  TEST_ASSERT(controller.GetScale() == 1.0f, "Scale recovers after spike");
+
+  Logger::Info("DynamicResolutionTests", "✅ Spike tests passed!");
+  return true;
+}
+
+bool TestRecoversUnderVsync() {
+  Logger::Info("DynamicResolutionTests", "Testing recovery under vsync...");
+
+  const float refreshMs = 1000.0f / 60.0f;
+  FrameModel light{2.0f, 8.0f};
+  FrameModel spike{4.0f, 30.0f};
+
+  // Swap intervals never go below the refresh period, which sits inside
+  // the hysteresis band, so the scale would stay down for good
+  DynamicResolutionController intervals;
+  RunVsyncTrace(intervals, spike, 60, refreshMs, true);
+  TEST_ASSERT(intervals.GetScale() < 1.0f, "Scale reacts to spike");
+  float held = RunVsyncTrace(intervals, light, 600, refreshMs, true);
+  TEST_ASSERT(held < 1.0f, "Swap intervals hold the scale down");
+
+  // Work time taken before the swap climbs back to full resolution
+  DynamicResolutionController work;
+  RunVsyncTrace(work, spike, 60, refreshMs, false);
+  TEST_ASSERT(work.GetScale() < 1.0f, "Scale reacts to spike");
+  float recovered = RunVsyncTrace(work, light, 600, refreshMs, false);
+  TEST_ASSERT(recovered == 1.0f, "Scale recovers from work time");
+
+  Logger::Info("DynamicResolutionTests", "✅ Vsync recovery tests passed!");
+  return true;
+}
+
+bool TestHysteresis() {
+  Logger::Info("DynamicResolutionTests", "Testing hysteresis...");
+
+  DynamicResolutionSettings settings;
+  DynamicResolutionController controller(settings);
+
+  // Noisy trace that hovers around the budget: +-4% jitter stays inside the
+  // hysteresis band and must not cause the scale to oscillate.
+  std::vector<float> scales;
+  float target = settings.TargetFrameTimeMs;
+  for (int i = 0; i < 600; ++i) {
+    float jitter = 0.04f * std::sin(static_cast<float>(i) * 0.7f);
+    scales.push_back(controller.Update(target * (1.0f + jitter)));
+  }
+  TEST_ASSERT(CountScaleChanges(scales) == 0,
+              "No scale changes inside hysteresis band");
+
+  // Under a real load the number of adjustments stays bounded once converged
+  scales.clear();
+  controller.Reset();
+  FrameModel heavy{3.0f, 22.0f};
+  RunTrace(controller, heavy, 1000, &scales);
+  std::vector<float> tail(scales.end() - 500, scales.end());
+  TEST_ASSERT(CountScaleChanges(tail) <= 2,
+              "Scale settles instead of oscillating");
+
+  Logger::Info("DynamicResolutionTests", "✅ Hysteresis tests passed!");
+  return true;
+}
+
+bool TestIgnoresInvalidSamples() {
+  Logger::Info("DynamicResolutionTests", "Testing invalid samples...");
+
+  DynamicResolutionController controller;
+  for (int i = 0; i < 100; ++i) {
+    controller.Update(0.0f);
+    controller.Update(-5.0f);
+    controller.Update(std::nanf(""));
+  }
+  TEST_ASSERT(controller.GetSampleCount() == 0, "Invalid samples ignored");
+  TEST_ASSERT(controller.GetScale() == 1.0f, "Scale untouched");
+
+  Logger::Info("DynamicResolutionTests", "✅ Invalid sample tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("DynamicResolutionTests",
+               "Starting dynamic resolution controller tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestStaysAtMaxWhenUnderBudget();
+  allPassed &= TestConvergesUnderSustainedLoad();
+  allPassed &= TestRespectsLimits();
+  allPassed &= TestSpikeResponse();
+  allPassed &= TestRecoversUnderVsync();
+  allPassed &= TestHysteresis();
+  allPassed &= TestIgnoresInvalidSamples();
+
+  if (allPassed) {
+    Logger::Info("DynamicResolutionTests",
+                 "🎉 ALL DYNAMIC RESOLUTION TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("DynamicResolutionTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,230 @@
+#include "Core/Logger.h"
+#include "Math/FastMath.h"
+#include "Math/Math.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("FastMathTests", std::string("FAILED: ") + message);         \
+    return false;                                                              \
+  }
+
+// Distance in units of the float spacing at the reference value
+static double Ulps(float value, double reference) {
+  float rounded = static_cast<float>(reference);
+  float next = std::nextafter(std::abs(rounded), INFINITY);
+  double spacing = static_cast<double>(next) - std::abs(rounded);
+  return std::abs(value - reference) / spacing;
+}
+
+struct ErrorStats {
+  double absolute = 0.0;
+  double ulps = 0.0;
+
+  void Add(float value, double reference) {
+    absolute = std::max(absolute, std::abs(value - reference));
+    ulps = std::max(ulps, Ulps(value, reference));
+  }
+
+  std::string ToString() const {
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%.2e abs, %.1f ulp", absolute,
+                  ulps);
+    return buffer;
+  }
+};
+
+static std::vector<float> Range(float from, float to, size_t count) {
+  std::vector<float> values(count);
+  for (size_t i = 0; i < count; ++i) {
+    values[i] = from + (to - from) * static_cast<float>(i) / (count - 1);
+  }
+  return values;
+}
+
+//============================================================================
+// Accuracy Tests
+//============================================================================
+template <Accuracy A> static ErrorStats SinCosError(float range) {
+  ErrorStats stats;
+  for (float x : Range(-range, range, 200001)) {
+    float s, c;
+    FastMath::SinCos<A>(x, s, c);
+    stats.Add(s, std::sin(static_cast<double>(x)));
+    stats.Add(c, std::cos(static_cast<double>(x)));
+  }
+  return stats;
+}
+
+template <Accuracy A> static ErrorStats Atan2Error() {
+  ErrorStats stats;
+  std::vector<float> values = Range(-5.0f, 5.0f, 601);
+  for (float y : values) {
+    for (float x : values) {
+      stats.Add(FastMath::Atan2<A>(y, x),
+                std::atan2(static_cast<double>(y), static_cast<double>(x)));
+    }
+  }
+  return stats;
+}
+
+template <Accuracy A> static ErrorStats AcosError() {
+  ErrorStats stats;
+  for (float x : Range(-1.0f, 1.0f, 200001)) {
+    stats.Add(FastMath::Acos<A>(x), std::acos(static_cast<double>(x)));
+  }
+  return stats;
+}
+
+template <Accuracy A> static ErrorStats RSqrtError() {
+  // Relative error, reported in the 'absolute' slot
+  ErrorStats stats;
+  for (float x : Range(1e-3f, 1e3f, 200001)) {
+    double reference = 1.0 / std::sqrt(static_cast<double>(x));
+    float value = FastMath::RSqrt<A>(x);
+    stats.absolute =
+        std::max(stats.absolute, std::abs(value - reference) / reference);
+    stats.ulps = std::max(stats.ulps, Ulps(value, reference));
+  }
+  return stats;
+}
+
+bool TestAccuracy() {
+  Logger::Info("FastMathTests", "Testing accuracy tiers against libm...");
+
+  ErrorStats sinFast = SinCosError<Accuracy::Fast>(100.0f);
+  ErrorStats sinMedium = SinCosError<Accuracy::Medium>(100.0f);
+  ErrorStats sinPrecise = SinCosError<Accuracy::Precise>(100.0f);
+  ErrorStats sinPreciseWide = SinCosError<Accuracy::Precise>(10000.0f);
+  Logger::Info("FastMathTests", "SinCos fast " + sinFast.ToString());
+  Logger::Info("FastMathTests", "SinCos medium " + sinMedium.ToString());
+  Logger::Info("FastMathTests", "SinCos precise " + sinPrecise.ToString());
+  Logger::Info("FastMathTests",
+               "SinCos precise to 1e4 " + sinPreciseWide.ToString());
+  TEST_ASSERT(sinFast.absolute < 2e-5, "Fast SinCos within bound");
+  TEST_ASSERT(sinMedium.absolute < 2e-7, "Medium SinCos within bound");
+  TEST_ASSERT(sinPrecise.ulps <= 2.0, "Precise SinCos within 2 ulp");
+  TEST_ASSERT(sinPreciseWide.ulps <= 3.0, "Precise SinCos holds to 1e4");
+
+  ErrorStats atanFast = Atan2Error<Accuracy::Fast>();
+  ErrorStats atanMedium = Atan2Error<Accuracy::Medium>();
+  ErrorStats atanPrecise = Atan2Error<Accuracy::Precise>();
+  Logger::Info("FastMathTests", "Atan2 fast " + atanFast.ToString());
+  Logger::Info("FastMathTests", "Atan2 medium " + atanMedium.ToString());
+  Logger::Info("FastMathTests", "Atan2 precise " + atanPrecise.ToString());
+  TEST_ASSERT(atanFast.absolute < 3e-4, "Fast Atan2 within bound");
+  TEST_ASSERT(atanMedium.absolute < 1e-5, "Medium Atan2 within bound");
+  TEST_ASSERT(atanPrecise.ulps <= 3.0, "Precise Atan2 within 3 ulp");
+
+  ErrorStats acosFast = AcosError<Accuracy::Fast>();
+  ErrorStats acosMedium = AcosError<Accuracy::Medium>();
+  ErrorStats acosPrecise = AcosError<Accuracy::Precise>();
+  Logger::Info("FastMathTests", "Acos fast " + acosFast.ToString());
+  Logger::Info("FastMathTests", "Acos medium " + acosMedium.ToString());
+  Logger::Info("FastMathTests", "Acos precise " + acosPrecise.ToString());
+  TEST_ASSERT(acosFast.absolute < 1e-4, "Fast Acos within bound");
+  TEST_ASSERT(acosMedium.absolute < 2e-6, "Medium Acos within bound");
+  TEST_ASSERT(acosPrecise.ulps <= 3.0, "Precise Acos within 3 ulp");
+
+  ErrorStats rsqrtFast = RSqrtError<Accuracy::Fast>();
+  ErrorStats rsqrtMedium = RSqrtError<Accuracy::Medium>();
+  ErrorStats rsqrtPrecise = RSqrtError<Accuracy::Precise>();
+  Logger::Info("FastMathTests", "RSqrt fast " + rsqrtFast.ToString());
+  Logger::Info("FastMathTests", "RSqrt medium " + rsqrtMedium.ToString());
+  Logger::Info("FastMathTests", "RSqrt precise " + rsqrtPrecise.ToString());
+  TEST_ASSERT(rsqrtFast.absolute < 4e-4, "Fast RSqrt within bound");
+  TEST_ASSERT(rsqrtMedium.absolute < 5e-7, "Medium RSqrt within bound");
+  TEST_ASSERT(rsqrtPrecise.ulps <= 2.0, "Precise RSqrt within 2 ulp");
+
+  // Quadrant and edge handling
+  TEST_ASSERT(FastMath::Atan2<Accuracy::Precise>(0.0f, 0.0f) == 0.0f,
+              "atan2(0, 0) is 0");
+  TEST_ASSERT(std::abs(FastMath::Atan2<Accuracy::Precise>(0.0f, -1.0f) -
+                       PI) < 1e-6f,
+              "atan2(0, -1) is pi");
+  TEST_ASSERT(FastMath::Acos<Accuracy::Precise>(1.5f) == 0.0f,
+              "Acos clamps its input");
+
+  Logger::Info("FastMathTests", "✅ Accuracy tests passed!");
+  return true;
+}
+
+//============================================================================
+// Packet Tests
+//============================================================================
+template <typename F> static bool PacketsMatchScalar(const char *name) {
+  constexpr int W = F::Width;
+  std::vector<float> angles = Range(-20.0f, 20.0f, W * 64);
+  std::vector<float> unit = Range(-1.0f, 1.0f, W * 64);
+
+  for (size_t i = 0; i < angles.size(); i += W) {
+    alignas(32) float s[W], c[W], atan[W], acos[W], rsqrt[W];
+    F x = F::LoadU(&angles[i]);
+    F sine, cosine;
+    FastMath::SinCos<Accuracy::Precise>(x, sine, cosine);
+    sine.Store(s);
+    cosine.Store(c);
+    FastMath::Atan2<Accuracy::Medium>(F::LoadU(&unit[i]), x).Store(atan);
+    FastMath::Acos<Accuracy::Fast>(F::LoadU(&unit[i])).Store(acos);
+    FastMath::RSqrt<Accuracy::Medium>(Abs(x) + F(1.0f)).Store(rsqrt);
+
+    for (int lane = 0; lane < W; ++lane) {
+      float a = angles[i + lane], u = unit[i + lane];
+      float es, ec;
+      FastMath::SinCos<Accuracy::Precise>(a, es, ec);
+      TEST_ASSERT(std::abs(s[lane] - es) < 1e-6f &&
+                      std::abs(c[lane] - ec) < 1e-6f,
+                  std::string(name) + " SinCos matches scalar");
+      TEST_ASSERT(std::abs(atan[lane] -
+                           FastMath::Atan2<Accuracy::Medium>(u, a)) < 1e-6f,
+                  std::string(name) + " Atan2 matches scalar");
+      TEST_ASSERT(std::abs(acos[lane] - FastMath::Acos<Accuracy::Fast>(u)) <
+                      1e-6f,
+                  std::string(name) + " Acos matches scalar");
+      TEST_ASSERT(std::abs(rsqrt[lane] - FastMath::RSqrt<Accuracy::Medium>(
+                                             std::abs(a) + 1.0f)) < 1e-6f,
+                  std::string(name) + " RSqrt matches scalar");
+    }
+  }
+  return true;
+}
+
+bool TestPackets() {
+  Logger::Info("FastMathTests", "Testing 4- and 8-wide forms...");
+
+  TEST_ASSERT(PacketsMatchScalar<SimdFloat4>("SimdFloat4"),
+              "SimdFloat4 matches scalar");
+  TEST_ASSERT(PacketsMatchScalar<SimdFloat8>("SimdFloat8"),
+              "SimdFloat8 matches scalar");
+
+  Logger::Info("FastMathTests", "✅ Packet tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("FastMathTests", "Starting fast math tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestAccuracy();
+  allPassed &= TestPackets();
+
+  if (allPassed) {
+    Logger::Info("FastMathTests", "🎉 ALL FAST MATH TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("FastMathTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
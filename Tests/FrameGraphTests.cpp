@@ -0,0 +1,379 @@
+#include "Core/Logger.h"
+#include "Renderer/FrameGraph.h"
+#include <string>
+#include <vector>
+
+using namespace Engine;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("FrameGraphTests", std::string("FAILED: ") + message);       \
+    return false;                                                              \
+  }
+
+//============================================================================
+// Helpers
+//============================================================================
+// All tests only compile the graph, so they run without a GL context.
+static FrameGraphTextureDesc MakeTarget(uint32_t width, uint32_t height) {
+  FrameGraphTextureDesc desc;
+  desc.Width = width;
+  desc.Height = height;
+  return desc;
+}
+
+static std::vector<std::string> OrderNames(const FrameGraph &graph) {
+  std::vector<std::string> names;
+  for (uint32_t pass : graph.GetExecutionOrder()) {
+    names.push_back(graph.GetPassName(pass));
+  }
+  return names;
+}
+
+//============================================================================
+// Scheduling Tests
+//============================================================================
+bool TestLinearChain() {
+  Logger::Info("FrameGraphTests", "Testing linear pass chain...");
+
+  FrameGraph graph;
+  FrameGraphResource backbuffer =
+      graph.ImportTexture("Backbuffer", MakeTarget(1280, 720));
+  FrameGraphResource gbuffer = InvalidFrameGraphResource;
+  FrameGraphResource hdr = InvalidFrameGraphResource;
+
+  graph.AddPass(
+      "GBuffer",
+      [&](FrameGraphBuilder &builder) {
+        gbuffer = builder.CreateTexture("GBuffer", MakeTarget(1280, 720));
+        builder.Write(gbuffer);
+      },
+      nullptr);
+  graph.AddPass(
+      "Lighting",
+      [&](FrameGraphBuilder &builder) {
+        builder.Read(gbuffer);
+        hdr = builder.CreateTexture("HDR", MakeTarget(1280, 720));
+        builder.Write(hdr);
+      },
+      nullptr);
+  graph.AddPass(
+      "Tonemap",
+      [&](FrameGraphBuilder &builder) {
+        builder.Read(hdr);
+        builder.Write(backbuffer);
+      },
+      nullptr);
+
+  TEST_ASSERT(graph.Compile(), "Chain compiles");
+  TEST_ASSERT(OrderNames(graph) == std::vector<std::string>(
+                                       {"GBuffer", "Lighting", "Tonemap"}),
+              "Chain keeps producer-consumer order");
+  TEST_ASSERT(graph.GetPhysicalIndex(backbuffer) == InvalidFrameGraphIndex,
+              "Imported resources are not pooled");
+
+  Logger::Info("FrameGraphTests", "✅ Linear chain tests passed!");
+  return true;
+}
+
+bool TestDependencyOrdering() {
+  Logger::Info("FrameGraphTests", "Testing dependency ordering...");
+
+  // The composite pass is declared before the shadow pass it depends on
+  FrameGraph graph;
+  FrameGraphResource backbuffer =
+      graph.ImportTexture("Backbuffer", MakeTarget(800, 600));
+  FrameGraphResource shadowMap = InvalidFrameGraphResource;
+
+  graph.AddPass(
+      "Composite",
+      [&](FrameGraphBuilder &builder) {
+        shadowMap = builder.CreateTexture("ShadowMap", MakeTarget(1024, 1024));
+        builder.Read(shadowMap);
+        builder.Write(backbuffer);
+      },
+      nullptr);
+  graph.AddPass(
+      "Shadow", [&](FrameGraphBuilder &builder) { builder.Write(shadowMap); },
+      nullptr);
+
+  TEST_ASSERT(graph.Compile(), "Graph compiles");
+  TEST_ASSERT(OrderNames(graph) ==
+                  std::vector<std::string>({"Shadow", "Composite"}),
+              "Producer scheduled before consumer");
+
+  // Read-modify-write keeps writers in declaration order
+  graph.Reset();
+  backbuffer = graph.ImportTexture("Backbuffer", MakeTarget(800, 600));
+  graph.AddPass(
+      "Opaque", [&](FrameGraphBuilder &builder) { builder.Write(backbuffer); },
+      nullptr);
+  graph.AddPass(
+      "Transparent",
+      [&](FrameGraphBuilder &builder) {
+        builder.Read(backbuffer);
+        builder.Write(backbuffer);
+      },
+      nullptr);
+  graph.AddPass(
+      "Overlay",
+      [&](FrameGraphBuilder &builder) {
+        builder.Read(backbuffer);
+        builder.Write(backbuffer);
+      },
+      nullptr);
+
+  TEST_ASSERT(graph.Compile(), "Read-modify-write graph compiles");
+  TEST_ASSERT(OrderNames(graph) == std::vector<std::string>(
+                                       {"Opaque", "Transparent", "Overlay"}),
+              "Writers keep declaration order");
+
+  Logger::Info("FrameGraphTests", "✅ Dependency ordering tests passed!");
+  return true;
+}
+
+bool TestCulling() {
+  Logger::Info("FrameGraphTests", "Testing pass culling...");
+
+  FrameGraph graph;
+  FrameGraphResource backbuffer =
+      graph.ImportTexture("Backbuffer", MakeTarget(640, 480));
+  FrameGraphResource debugView = InvalidFrameGraphResource;
+  FrameGraphResource debugBlur = InvalidFrameGraphResource;
+
+  uint32_t main = graph.AddPass(
+      "Main", [&](FrameGraphBuilder &builder) { builder.Write(backbuffer); },
+      nullptr);
+  uint32_t debug = graph.AddPass(
+      "DebugView",
+      [&](FrameGraphBuilder &builder) {
+        debugView = builder.CreateTexture("DebugView", MakeTarget(640, 480));
+        builder.Write(debugView);
+      },
+      nullptr);
+  uint32_t blur = graph.AddPass(
+      "DebugBlur",
+      [&](FrameGraphBuilder &builder) {
+        builder.Read(debugView);
+        debugBlur = builder.CreateTexture("DebugBlur", MakeTarget(320, 240));
+        builder.Write(debugBlur);
+      },
+      nullptr);
+  uint32_t readback = graph.AddPass(
+      "Readback", [&](FrameGraphBuilder &builder) { builder.SetSideEffect(); },
+      nullptr);
+
+  TEST_ASSERT(graph.Compile(), "Graph compiles");
+  TEST_ASSERT(!graph.IsPassCulled(main), "Pass writing import survives");
+  TEST_ASSERT(graph.IsPassCulled(debug), "Unread producer culled");
+  TEST_ASSERT(graph.IsPassCulled(blur), "Unread chain culled");
+  TEST_ASSERT(!graph.IsPassCulled(readback), "Side-effect pass survives");
+  TEST_ASSERT(graph.GetExecutionOrder().size() == 2,
+              "Only live passes scheduled");
+  TEST_ASSERT(graph.GetPhysicalIndex(debugView) == InvalidFrameGraphIndex,
+              "Culled transients get no memory");
+  TEST_ASSERT(graph.GetPhysicalResourceCount() == 0,
+              "No transient memory needed");
+
+  Logger::Info("FrameGraphTests", "✅ Culling tests passed!");
+  return true;
+}
+
+bool TestInvalidGraphs() {
+  Logger::Info("FrameGraphTests", "Testing invalid graphs...");
+
+  // Two passes feeding each other
+  FrameGraph graph;
+  FrameGraphResource a = InvalidFrameGraphResource;
+  FrameGraphResource b = InvalidFrameGraphResource;
+  graph.AddPass(
+      "PassA",
+      [&](FrameGraphBuilder &builder) {
+        a = builder.CreateTexture("A", MakeTarget(64, 64));
+        b = builder.CreateTexture("B", MakeTarget(64, 64));
+        builder.Read(b);
+        builder.Write(a);
+        builder.SetSideEffect();
+      },
+      nullptr);
+  graph.AddPass(
+      "PassB",
+      [&](FrameGraphBuilder &builder) {
+        builder.Read(a);
+        builder.Write(b);
+      },
+      nullptr);
+  TEST_ASSERT(!graph.Compile(), "Cycle rejected");
+  TEST_ASSERT(graph.GetExecutionOrder().empty(), "No schedule for cycle");
+
+  // Reading a transient no pass produces
+  graph.Reset();
+  graph.AddPass(
+      "Orphan",
+      [&](FrameGraphBuilder &builder) {
+        builder.Read(builder.CreateTexture("Never", MakeTarget(64, 64)));
+        builder.SetSideEffect();
+      },
+      nullptr);
+  TEST_ASSERT(!graph.Compile(), "Unwritten transient rejected");
+
+  Logger::Info("FrameGraphTests", "✅ Invalid graph tests passed!");
+  return true;
+}
+
+//============================================================================
+// Aliasing Tests
+//============================================================================
+bool TestTextureAliasing() {
+  Logger::Info("FrameGraphTests", "Testing render target aliasing...");
+
+  // Ping-pong post chain: each intermediate is dead two passes later
+  FrameGraph graph;
+  FrameGraphResource backbuffer =
+      graph.ImportTexture("Backbuffer", MakeTarget(1920, 1080));
+  FrameGraphResource previous = InvalidFrameGraphResource;
+  std::vector<FrameGraphResource> intermediates;
+
+  for (int i = 0; i < 4; ++i) {
+    graph.AddPass(
+        "Post" + std::to_string(i),
+        [&](FrameGraphBuilder &builder) {
+          if (previous != InvalidFrameGraphResource) {
+            builder.Read(previous);
+          }
+          previous = builder.CreateTexture("Post" + std::to_string(i),
+                                           MakeTarget(1920, 1080));
+          builder.Write(previous);
+          intermediates.push_back(previous);
+        },
+        nullptr);
+  }
+
+  // A differently sized target can never share memory with the chain
+  FrameGraphResource bloom = InvalidFrameGraphResource;
+  graph.AddPass(
+      "Bloom",
+      [&](FrameGraphBuilder &builder) {
+        builder.Read(previous);
+        bloom = builder.CreateTexture("Bloom", MakeTarget(960, 540));
+        builder.Write(bloom);
+      },
+      nullptr);
+  graph.AddPass(
+      "Present",
+      [&](FrameGraphBuilder &builder) {
+        builder.Read(bloom);
+        builder.Read(previous);
+        builder.Write(backbuffer);
+      },
+      nullptr);
+
+  TEST_ASSERT(graph.Compile(), "Post chain compiles");
+
+  uint32_t first = graph.GetPhysicalIndex(intermediates[0]);
+  uint32_t second = graph.GetPhysicalIndex(intermediates[1]);
+  TEST_ASSERT(first != second, "Overlapping lifetimes stay separate");
+  TEST_ASSERT(graph.GetPhysicalIndex(intermediates[2]) == first,
+              "Dead target memory reused");
+  TEST_ASSERT(graph.GetPhysicalIndex(intermediates[3]) == second,
+              "Ping-pong alternates between two slots");
+  TEST_ASSERT(graph.GetPhysicalIndex(bloom) != first &&
+                  graph.GetPhysicalIndex(bloom) != second,
+              "Different size does not alias");
+  TEST_ASSERT(graph.GetPhysicalResourceCount() == 3, "Three physical targets");
+
+  size_t fullRes = FrameGraph::EstimateSize(MakeTarget(1920, 1080));
+  size_t halfRes = FrameGraph::EstimateSize(MakeTarget(960, 540));
+  TEST_ASSERT(graph.GetUnaliasedTransientMemory() == 4 * fullRes + halfRes,
+              "Unaliased memory accounts every transient");
+  TEST_ASSERT(graph.GetTransientMemory() == 2 * fullRes + halfRes,
+              "Aliasing halves the chain's memory");
+
+  Logger::Info("FrameGraphTests",
+               "Transient memory " +
+                   std::to_string(graph.GetTransientMemory() / 1024) +
+                   " KB (unaliased " +
+                   std::to_string(graph.GetUnaliasedTransientMemory() / 1024) +
+                   " KB)");
+  Logger::Info("FrameGraphTests", "✅ Texture aliasing tests passed!");
+  return true;
+}
+
+bool TestBufferAliasing() {
+  Logger::Info("FrameGraphTests", "Testing buffer aliasing...");
+
+  FrameGraph graph;
+  FrameGraphResource backbuffer =
+      graph.ImportTexture("Backbuffer", MakeTarget(256, 256));
+  FrameGraphResource small = InvalidFrameGraphResource;
+  FrameGraphResource large = InvalidFrameGraphResource;
+
+  graph.AddPass(
+      "Skinning",
+      [&](FrameGraphBuilder &builder) {
+        FrameGraphBufferDesc desc;
+        desc.Size = 4096;
+        small = builder.CreateBuffer("SkinnedVertices", desc);
+        builder.Write(small);
+      },
+      nullptr);
+  graph.AddPass(
+      "DrawSkinned",
+      [&](FrameGraphBuilder &builder) {
+        builder.Read(small);
+        builder.Write(backbuffer);
+      },
+      nullptr);
+  graph.AddPass(
+      "Particles",
+      [&](FrameGraphBuilder &builder) {
+        FrameGraphBufferDesc desc;
+        desc.Size = 16384;
+        large = builder.CreateBuffer("ParticleVertices", desc);
+        builder.Write(large);
+      },
+      nullptr);
+  graph.AddPass(
+      "DrawParticles",
+      [&](FrameGraphBuilder &builder) {
+        builder.Read(large);
+        builder.Read(backbuffer);
+        builder.Write(backbuffer);
+      },
+      nullptr);
+
+  TEST_ASSERT(graph.Compile(), "Buffer graph compiles");
+  TEST_ASSERT(graph.GetPhysicalIndex(small) == graph.GetPhysicalIndex(large),
+              "Disjoint buffers share one slot");
+  TEST_ASSERT(graph.GetTransientMemory() == 16384,
+              "Shared slot sized for the largest user");
+  TEST_ASSERT(graph.GetUnaliasedTransientMemory() == 4096 + 16384,
+              "Unaliased memory sums both buffers");
+
+  Logger::Info("FrameGraphTests", "✅ Buffer aliasing tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("FrameGraphTests", "Starting frame graph tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestLinearChain();
+  allPassed &= TestDependencyOrdering();
+  allPassed &= TestCulling();
+  allPassed &= TestInvalidGraphs();
+  allPassed &= TestTextureAliasing();
+  allPassed &= TestBufferAliasing();
+
+  if (allPassed) {
+    Logger::Info("FrameGraphTests", "🎉 ALL FRAME GRAPH TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("FrameGraphTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
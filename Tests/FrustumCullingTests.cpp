@@ -0,0 +1,269 @@
+#include "Core/JobSystem.h"
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include "MathTestUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+using namespace Engine::Test;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("FrustumCullingTests", std::string("FAILED: ") + message);   \
+    return false;                                                              \
+  }
+
+// Random scene around a camera looking down -Z, kept as structure of arrays
+// for the batch kernels and as AABB/Sphere objects for the reference loop
+struct TestScene {
+  std::vector<float> centerX, centerY, centerZ;
+  std::vector<float> extentX, extentY, extentZ, radius;
+  std::vector<AABB> boxes;
+  std::vector<Sphere> spheres;
+
+  size_t Size() const { return centerX.size(); }
+
+  SphereBoundsSoA SphereBounds() const {
+    return {centerX, centerY, centerZ, radius};
+  }
+
+  BoxBoundsSoA BoxBounds() const {
+    return {centerX, centerY, centerZ, extentX, extentY, extentZ};
+  }
+};
+
+static TestScene MakeScene(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> lateral(-80.0f, 80.0f);
+  std::uniform_real_distribution<float> depth(-120.0f, 20.0f);
+  std::uniform_real_distribution<float> size(0.0f, 4.0f);
+
+  TestScene scene;
+  for (size_t i = 0; i < count; ++i) {
+    Vec3 center(lateral(rng), lateral(rng), depth(rng));
+    Vec3 extent(size(rng), size(rng), size(rng));
+    float radius = size(rng);
+
+    scene.centerX.push_back(center.x);
+    scene.centerY.push_back(center.y);
+    scene.centerZ.push_back(center.z);
+    scene.extentX.push_back(extent.x);
+    scene.extentY.push_back(extent.y);
+    scene.extentZ.push_back(extent.z);
+    scene.radius.push_back(radius);
+    scene.boxes.push_back(AABB(center - extent, center + extent));
+    scene.spheres.push_back(Sphere(center, radius));
+  }
+  return scene;
+}
+
+static Frustum TestFrustum() {
+  return Frustum::FromMatrix(
+      Mat4::Perspective(ToRadians(60.0f), 1.5f, 0.1f, 100.0f));
+}
+
+// Distance of the element's nearest point past the frustum's worst plane, in
+// double precision. Kernels and the per-object loop may round differently
+// only when this is within float noise of zero.
+static double Margin(const Frustum &frustum, const TestScene &scene, size_t i,
+                     bool boxes) {
+  double worst = 1e30;
+  for (const Vec4 &plane : frustum.planes) {
+    double distance = double(plane.x) * scene.centerX[i] +
+                      double(plane.y) * scene.centerY[i] +
+                      double(plane.z) * scene.centerZ[i] + plane.w;
+    double reach = boxes ? std::abs(double(plane.x)) * scene.extentX[i] +
+                               std::abs(double(plane.y)) * scene.extentY[i] +
+                               std::abs(double(plane.z)) * scene.extentZ[i]
+                         : double(scene.radius[i]);
+    worst = std::min(worst, distance + reach);
+  }
+  return worst;
+}
+
+// Compares a compacted index list with the per-object visibility flags
+static bool MatchesReference(const Frustum &frustum, const TestScene &scene,
+                             const std::vector<uint8_t> &expected,
+                             const uint32_t *indices, size_t visibleCount,
+                             size_t begin, size_t end, bool boxes) {
+  std::vector<uint8_t> actual(end - begin, 0);
+  for (size_t n = 0; n < visibleCount; ++n) {
+    if (indices[n] < begin || indices[n] >= end ||
+        (n > 0 && indices[n] <= indices[n - 1])) {
+      return false;
+    }
+    actual[indices[n] - begin] = 1;
+  }
+  for (size_t i = begin; i < end; ++i) {
+    if (actual[i - begin] != expected[i] &&
+        std::abs(Margin(frustum, scene, i, boxes)) > 1e-4) {
+      return false;
+    }
+  }
+  return true;
+}
+
+//============================================================================
+// Kernel Consistency Tests
+//============================================================================
+bool TestKernelConsistency() {
+  Logger::Info("FrustumCullingTests",
+               "Testing SoA culling against Frustum::Intersects...");
+
+  Frustum frustum = TestFrustum();
+  TestScene scene = MakeScene(20000, 1);
+
+  std::vector<uint8_t> expectedBoxes(scene.Size());
+  std::vector<uint8_t> expectedSpheres(scene.Size());
+  size_t visibleBoxes = 0;
+  for (size_t i = 0; i < scene.Size(); ++i) {
+    expectedBoxes[i] = frustum.Intersects(scene.boxes[i]) ? 1 : 0;
+    expectedSpheres[i] = frustum.Intersects(scene.spheres[i]) ? 1 : 0;
+    visibleBoxes += expectedBoxes[i];
+  }
+  TEST_ASSERT(visibleBoxes > 0 && visibleBoxes < scene.Size(),
+              "Test scene has visible and culled boxes");
+
+  SphereBoundsSoA spheres = scene.SphereBounds();
+  BoxBoundsSoA boxes = scene.BoxBounds();
+  std::vector<uint32_t> indices(scene.Size());
+  for (const MathKernelTable *table : AvailableTables()) {
+    size_t count = table->CullBoxesSoA(frustum.planes, boxes, 0, scene.Size(),
+                                       indices.data());
+    TEST_ASSERT(MatchesReference(frustum, scene, expectedBoxes,
+                                 indices.data(), count, 0, scene.Size(), true),
+                Name(table) + " box culling matches the per-object test");
+
+    count = table->CullSpheresSoA(frustum.planes, spheres, 0, scene.Size(),
+                                  indices.data());
+    TEST_ASSERT(MatchesReference(frustum, scene, expectedSpheres,
+                                 indices.data(), count, 0, scene.Size(),
+                                 false),
+                Name(table) + " sphere culling matches the per-object test");
+  }
+
+  Logger::Info("FrustumCullingTests", "✅ Kernel consistency tests passed!");
+  return true;
+}
+
+//============================================================================
+// Range and Tail Tests
+//============================================================================
+bool TestRangesAndTails() {
+  Logger::Info("FrustumCullingTests", "Testing sub-ranges and tails...");
+
+  Frustum frustum = TestFrustum();
+  TestScene scene = MakeScene(80, 2);
+  std::vector<uint8_t> expected(scene.Size());
+  for (size_t i = 0; i < scene.Size(); ++i) {
+    expected[i] = frustum.Intersects(scene.boxes[i]) ? 1 : 0;
+  }
+
+  // Every element visible, so the output is as long as the range
+  Frustum everything;
+  for (Vec4 &plane : everything.planes) {
+    plane = Vec4(0.0f, 0.0f, 0.0f, 1.0f);
+  }
+
+  BoxBoundsSoA boxes = scene.BoxBounds();
+  const uint32_t sentinel = 0xDEADBEEF;
+  for (const MathKernelTable *table : AvailableTables()) {
+    for (size_t begin = 0; begin < 3; ++begin) {
+      for (size_t end = begin; end <= 40; ++end) {
+        std::vector<uint32_t> indices(end - begin + 1, sentinel);
+        size_t count = table->CullBoxesSoA(frustum.planes, boxes, begin, end,
+                                           indices.data());
+        TEST_ASSERT(MatchesReference(frustum, scene, expected, indices.data(),
+                                     count, begin, end, true),
+                    Name(table) + " sub-range matches the per-object test");
+        TEST_ASSERT(indices[end - begin] == sentinel,
+                    Name(table) + " culling stays in bounds");
+
+        std::fill(indices.begin(), indices.end(), sentinel);
+        count = table->CullBoxesSoA(everything.planes, boxes, begin, end,
+                                    indices.data());
+        TEST_ASSERT(count == end - begin && indices[end - begin] == sentinel,
+                    Name(table) + " full range fills exactly the output");
+        for (size_t n = 0; n < count; ++n) {
+          TEST_ASSERT(indices[n] == begin + n,
+                      Name(table) + " indices are global and ascending");
+        }
+      }
+    }
+  }
+
+  // The Frustum entry point tests every element of the bounds, writing no
+  // further than their count
+  BoxBoundsSoA first = boxes;
+  first.CenterX = first.CenterX.first(9);
+  std::vector<uint32_t> small(10, sentinel);
+  size_t count = everything.Cull(first, Span<uint32_t>(small.data(), 9));
+  TEST_ASSERT(count == 9 && small[9] == sentinel,
+              "Frustum::Cull stops at the shortest stream");
+
+  Logger::Info("FrustumCullingTests", "✅ Range and tail tests passed!");
+  return true;
+}
+
+//============================================================================
+// Parallel Chunking Tests
+//============================================================================
+bool TestParallelChunks() {
+  Logger::Info("FrustumCullingTests", "Testing chunked parallel culling...");
+
+  Frustum frustum = TestFrustum();
+  TestScene scene = MakeScene(10007, 3);
+  SphereBoundsSoA spheres = scene.SphereBounds();
+  BoxBoundsSoA boxes = scene.BoxBounds();
+
+  std::vector<uint32_t> serialBoxes(scene.Size());
+  std::vector<uint32_t> serialSpheres(scene.Size());
+  size_t boxCount = frustum.Cull(boxes, serialBoxes);
+  size_t sphereCount = frustum.Cull(spheres, serialSpheres);
+
+  JobSystem::Initialize(3);
+  bool passed = true;
+  for (uint32_t grainSize : {1u, 7u, 64u, 1000u, 20000u}) {
+    std::vector<uint32_t> indices(scene.Size());
+    size_t count = frustum.Cull(boxes, indices, grainSize);
+    passed &= count == boxCount &&
+              std::equal(indices.begin(), indices.begin() + count,
+                         serialBoxes.begin());
+
+    count = frustum.Cull(spheres, indices, grainSize);
+    passed &= count == sphereCount &&
+              std::equal(indices.begin(), indices.begin() + count,
+                         serialSpheres.begin());
+  }
+  JobSystem::Shutdown();
+  TEST_ASSERT(passed, "Chunked culling matches the serial result");
+
+  Logger::Info("FrustumCullingTests", "✅ Parallel chunking tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("FrustumCullingTests", "Starting frustum culling tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestKernelConsistency();
+  allPassed &= TestRangesAndTails();
+  allPassed &= TestParallelChunks();
+
+  if (allPassed) {
+    Logger::Info("FrustumCullingTests", "🎉 ALL FRUSTUM CULLING TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("FrustumCullingTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,294 @@
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include <algorithm>
+#include <cmath>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("GlmParityTests", std::string("FAILED: ") + message);        \
+    return false;                                                              \
+  }
+
+//============================================================================
+// Conversions
+//============================================================================
+// Both libraries use column vectors, but glm::mat4 stores and indexes
+// columns first, so glm[c][r] is Mat4::m[r][c].
+static glm::vec3 ToGlm(const Vec3 &v) { return glm::vec3(v.x, v.y, v.z); }
+
+// Set by member: the constructor's argument order depends on GLM's
+// configuration macros
+static glm::quat ToGlm(const Quaternion &q) {
+  glm::quat result;
+  result.x = q.x;
+  result.y = q.y;
+  result.z = q.z;
+  result.w = q.w;
+  return result;
+}
+
+static glm::mat4 ToGlm(const Mat4 &m) {
+  glm::mat4 result(1.0f);
+  for (int row = 0; row < 4; ++row) {
+    for (int col = 0; col < 4; ++col) {
+      result[col][row] = m.m[row][col];
+    }
+  }
+  return result;
+}
+
+// Largest element difference relative to the element's magnitude
+static float MaxError(const Mat4 &a, const glm::mat4 &b) {
+  float error = 0.0f;
+  for (int row = 0; row < 4; ++row) {
+    for (int col = 0; col < 4; ++col) {
+      float expected = b[col][row];
+      error = std::max(error, std::abs(a.m[row][col] - expected) /
+                                  std::max(1.0f, std::abs(expected)));
+    }
+  }
+  return error;
+}
+
+static float MaxError(const Vec3 &a, const glm::vec3 &b) {
+  float error = 0.0f;
+  for (int i = 0; i < 3; ++i) {
+    error = std::max(error, std::abs(a[i] - b[i]) /
+                                std::max(1.0f, std::abs(b[i])));
+  }
+  return error;
+}
+
+static float MaxError(const Quaternion &a, const glm::quat &b) {
+  return std::max({std::abs(a.x - b.x), std::abs(a.y - b.y),
+                   std::abs(a.z - b.z), std::abs(a.w - b.w)});
+}
+
+//============================================================================
+// Workloads
+//============================================================================
+// The same random inputs for both libraries
+struct Workload {
+  std::vector<Transform> transforms;
+  std::vector<Quaternion> rotationsB;
+  std::vector<Vec3> points;
+  std::vector<float> factors;
+
+  Workload(size_t count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::normal_distribution<float> rotation(0.0f, 1.0f);
+    std::uniform_real_distribution<float> scale(0.1f, 5.0f);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    auto randomRotation = [&]() {
+      return Quaternion(rotation(rng), rotation(rng), rotation(rng),
+                        rotation(rng))
+          .Normalized();
+    };
+    for (size_t i = 0; i < count; ++i) {
+      transforms.push_back(Transform(
+          Vec3(position(rng), position(rng), position(rng)), randomRotation(),
+          Vec3(scale(rng), scale(rng), scale(rng))));
+      rotationsB.push_back(randomRotation());
+      points.push_back(Vec3(position(rng), position(rng), position(rng)));
+      factors.push_back(unit(rng));
+    }
+  }
+};
+
+static Mat4 EngineTRS(const Transform &t) {
+  return Mat4::Translation(t.position) * t.rotation.ToMatrix() *
+         Mat4::Scale(t.scale);
+}
+
+static glm::mat4 GlmTRS(const Transform &t) {
+  return glm::translate(glm::mat4(1.0f), ToGlm(t.position)) *
+         glm::mat4_cast(ToGlm(t.rotation)) *
+         glm::scale(glm::mat4(1.0f), ToGlm(t.scale));
+}
+
+static const Vec3 kEye(10.0f, 20.0f, 150.0f);
+static const Vec3 kUp(0.0f, 1.0f, 0.0f);
+
+//============================================================================
+// Parity
+//============================================================================
+bool TestTransformParity() {
+  Logger::Info("GlmParityTests", "Testing TRS composition and inverse...");
+
+  Workload workload(1000, 1);
+  for (const Transform &transform : workload.transforms) {
+    glm::mat4 expected = GlmTRS(transform);
+    TEST_ASSERT(MaxError(EngineTRS(transform), expected) < 1e-5f,
+                "Translation * rotation * scale should match GLM");
+    TEST_ASSERT(MaxError(transform.ToMatrix(), expected) < 1e-5f,
+                "Transform::ToMatrix should match GLM");
+    TEST_ASSERT(MaxError(transform.rotation.ToMatrix(),
+                         glm::mat4_cast(ToGlm(transform.rotation))) < 1e-6f,
+                "Quaternion::ToMatrix should match glm::mat4_cast");
+
+    glm::mat4 inverse = glm::inverse(expected);
+    Mat4 matrix = transform.ToMatrix();
+    TEST_ASSERT(MaxError(matrix.Inverted(), inverse) < 1e-4f,
+                "Mat4::Inverted should match glm::inverse");
+    TEST_ASSERT(MaxError(matrix.InvertedAffine(), inverse) < 1e-4f,
+                "Mat4::InvertedAffine should match glm::inverse");
+  }
+
+  // A projective matrix exercises the full 4x4 inverse
+  Mat4 viewProjection =
+      Mat4::Perspective(ToRadians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f) *
+      Mat4::LookAt(kEye, Vec3::Zero(), kUp);
+  TEST_ASSERT(MaxError(viewProjection.Inverted(),
+                       glm::inverse(ToGlm(viewProjection))) < 1e-4f,
+              "Projective Mat4::Inverted should match glm::inverse");
+
+  Logger::Info("GlmParityTests", "✅ Transform parity tests passed!");
+  return true;
+}
+
+bool TestCameraParity() {
+  Logger::Info("GlmParityTests",
+               "Testing LookAt, Perspective and Orthographic...");
+
+  std::mt19937 rng(2);
+  std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+  std::uniform_real_distribution<float> fov(ToRadians(20.0f),
+                                            ToRadians(120.0f));
+  std::uniform_real_distribution<float> aspect(0.5f, 3.0f);
+  std::uniform_real_distribution<float> extent(1.0f, 50.0f);
+
+  for (int i = 0; i < 1000; ++i) {
+    Vec3 eye(position(rng), position(rng), position(rng));
+    Vec3 target(position(rng), position(rng), position(rng));
+    TEST_ASSERT(MaxError(Mat4::LookAt(eye, target, kUp),
+                         glm::lookAt(ToGlm(eye), ToGlm(target),
+                                     ToGlm(kUp))) < 1e-5f,
+                "LookAt should match glm::lookAt");
+
+    float fovy = fov(rng), ratio = aspect(rng);
+    TEST_ASSERT(MaxError(Mat4::Perspective(fovy, ratio, 0.1f, 500.0f),
+                         glm::perspective(fovy, ratio, 0.1f, 500.0f)) < 1e-5f,
+                "Perspective should match glm::perspective");
+
+    float width = extent(rng), height = extent(rng);
+    TEST_ASSERT(MaxError(Mat4::Orthographic(-width, width * 0.5f, -height,
+                                            height * 2.0f, 0.1f, 100.0f),
+                         glm::ortho(-width, width * 0.5f, -height,
+                                    height * 2.0f, 0.1f, 100.0f)) < 1e-5f,
+                "Orthographic should match glm::ortho");
+  }
+
+  // A point in front of the camera lands in clip space with w = depth
+  Vec4 clip = Mat4::Perspective(ToRadians(60.0f), 1.5f, 0.1f, 100.0f) *
+              Vec4(0.0f, 0.0f, -10.0f, 1.0f);
+  TEST_ASSERT(IsEqual(clip.w, 10.0f, 1e-5f) && clip.z / clip.w > -1.0f &&
+                  clip.z / clip.w < 1.0f,
+              "Perspective should put view depth in clip w");
+
+  // Frustum planes come from the rows of the same matrix
+  Mat4 viewProjection =
+      Mat4::Perspective(ToRadians(60.0f), 1.5f, 0.1f, 100.0f) *
+      Mat4::LookAt(Vec3(0.0f, 0.0f, 10.0f), Vec3::Zero(), kUp);
+  Frustum frustum = Frustum::FromMatrix(viewProjection);
+  TEST_ASSERT(frustum.Contains(Vec3::Zero()) &&
+                  !frustum.Contains(Vec3(0.0f, 0.0f, 20.0f)) &&
+                  !frustum.Contains(Vec3(0.0f, 0.0f, -95.0f)) &&
+                  !frustum.Contains(Vec3(20.0f, 0.0f, 0.0f)),
+              "Frustum::FromMatrix should bound the camera's view volume");
+
+  Logger::Info("GlmParityTests", "✅ Camera parity tests passed!");
+  return true;
+}
+
+bool TestRotationParity() {
+  Logger::Info("GlmParityTests", "Testing slerp and vector rotation...");
+
+  Workload workload(1000, 3);
+  for (size_t i = 0; i < workload.transforms.size(); ++i) {
+    const Quaternion &a = workload.transforms[i].rotation;
+    const Quaternion &b = workload.rotationsB[i];
+    float t = workload.factors[i];
+    glm::quat expected = glm::slerp(ToGlm(a), ToGlm(b), t);
+    TEST_ASSERT(MaxError(Quaternion::Slerp(a, b, t), expected) < 1e-5f,
+                "Quaternion::Slerp should match glm::slerp");
+    TEST_ASSERT(MaxError(Quaternion::SlerpFast(a, b, t), expected) < 2e-5f,
+                "Quaternion::SlerpFast should match glm::slerp");
+    TEST_ASSERT(MaxError(a.RotateVector(workload.points[i]),
+                         ToGlm(a) * ToGlm(workload.points[i])) < 1e-5f,
+                "RotateVector should match glm::quat * vec3");
+  }
+
+  Logger::Info("GlmParityTests", "✅ Rotation parity tests passed!");
+  return true;
+}
+
+bool TestBatchParity() {
+  Logger::Info("GlmParityTests", "Testing batch transforms against GLM...");
+
+  Workload workload(1003, 4);
+  Mat4 viewProjection =
+      Mat4::Perspective(ToRadians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f) *
+      Mat4::LookAt(kEye, Vec3::Zero(), kUp);
+  glm::mat4 glmViewProjection = ToGlm(viewProjection);
+
+  std::vector<Vec3> points(workload.points.size());
+  std::vector<Vec3> projected(workload.points.size());
+  viewProjection.TransformPoints(workload.points, points);
+  viewProjection.TransformPointsProjective(workload.points, projected);
+  for (size_t i = 0; i < points.size(); ++i) {
+    glm::vec4 clip = glmViewProjection * glm::vec4(ToGlm(workload.points[i]),
+                                                   1.0f);
+    TEST_ASSERT(MaxError(points[i], glm::vec3(clip.x, clip.y, clip.z)) < 1e-5f,
+                "TransformPoints should match glm::mat4 * vec4");
+    TEST_ASSERT(MaxError(projected[i], glm::vec3(clip.x, clip.y, clip.z) /
+                                           clip.w) < 1e-4f,
+                "TransformPointsProjective should match the GLM divide");
+  }
+
+  std::vector<Quaternion> rotations(workload.transforms.size());
+  std::vector<Vec3> rotated(workload.transforms.size());
+  for (size_t i = 0; i < rotations.size(); ++i) {
+    rotations[i] = workload.transforms[i].rotation;
+  }
+  Quaternion::RotateVectors(rotations, workload.points, rotated);
+  for (size_t i = 0; i < rotated.size(); ++i) {
+    TEST_ASSERT(MaxError(rotated[i], ToGlm(rotations[i]) *
+                                         ToGlm(workload.points[i])) < 1e-4f,
+                "Batch RotateVectors should match glm::quat * vec3");
+  }
+
+  Logger::Info("GlmParityTests", "✅ Batch parity tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("GlmParityTests", "Starting GLM parity tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestTransformParity();
+  allPassed &= TestCameraParity();
+  allPassed &= TestRotationParity();
+  allPassed &= TestBatchParity();
+
+  if (allPassed) {
+    Logger::Info("GlmParityTests", "🎉 ALL GLM PARITY TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("GlmParityTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
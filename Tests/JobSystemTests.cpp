@@ -0,0 +1,97 @@
+#include "Core/JobSystem.h"
+#include "Core/Logger.h"
+#include <atomic>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("JobSystemTests", std::string("FAILED: ") + message);        \
+    return false;                                                              \
+  }
+
+bool TestInlineExecution() {
+  Logger::Info("JobSystemTests", "Testing inline execution...");
+
+  TEST_ASSERT(!JobSystem::IsRunning(), "Not running before Initialize");
+
+  bool ran = false;
+  JobHandle handle = JobSystem::Submit([&ran]() { ran = true; });
+  TEST_ASSERT(ran, "Job ran on the submitting thread");
+  TEST_ASSERT(handle.IsDone(), "Inline handle is complete");
+
+  uint32_t covered = 0;
+  JobSystem::ParallelFor(10, 3, [&covered](uint32_t begin, uint32_t end) {
+    covered += end - begin;
+  });
+  TEST_ASSERT(covered == 10, "Inline ParallelFor covers the range");
+
+  Logger::Info("JobSystemTests", "✅ Inline execution tests passed!");
+  return true;
+}
+
+bool TestWorkerExecution() {
+  Logger::Info("JobSystemTests", "Testing worker execution...");
+
+  JobSystem::Initialize(3);
+  TEST_ASSERT(JobSystem::IsRunning(), "Running after Initialize");
+  TEST_ASSERT(JobSystem::GetWorkerCount() == 3, "Requested worker count");
+
+  std::atomic<uint32_t> counter{0};
+  std::vector<JobHandle> handles;
+  for (int i = 0; i < 100; ++i) {
+    handles.push_back(JobSystem::Submit([&counter]() { counter++; }));
+  }
+  for (const auto &handle : handles) {
+    JobSystem::Wait(handle);
+  }
+  TEST_ASSERT(counter == 100, "All submitted jobs ran");
+
+  // Every index visited exactly once, including a ragged last chunk
+  std::vector<std::atomic<uint32_t>> visits(1001);
+  JobSystem::ParallelFor(1001, 64, [&visits](uint32_t begin, uint32_t end) {
+    for (uint32_t i = begin; i < end; ++i) {
+      visits[i]++;
+    }
+  });
+  bool once = true;
+  for (const auto &visit : visits) {
+    once &= visit == 1;
+  }
+  TEST_ASSERT(once, "ParallelFor visits every index once");
+
+  // Nested ParallelFor from inside a job must not deadlock
+  std::atomic<uint32_t> nested{0};
+  JobHandle outer = JobSystem::Submit([&nested]() {
+    JobSystem::ParallelFor(256, 16, [&nested](uint32_t begin, uint32_t end) {
+      nested += end - begin;
+    });
+  });
+  JobSystem::Wait(outer);
+  TEST_ASSERT(nested == 256, "Nested ParallelFor completes");
+
+  JobSystem::Shutdown();
+  TEST_ASSERT(!JobSystem::IsRunning(), "Stopped after Shutdown");
+
+  Logger::Info("JobSystemTests", "✅ Worker execution tests passed!");
+  return true;
+}
+
+int main() {
+  Logger::Info("JobSystemTests", "Starting job system tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestInlineExecution();
+  allPassed &= TestWorkerExecution();
+
+  if (allPassed) {
+    Logger::Info("JobSystemTests", "🎉 ALL JOB SYSTEM TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("JobSystemTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
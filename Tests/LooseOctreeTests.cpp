@@ -0,0 +1,397 @@
+#include "Core/JobSystem.h"
+#include "Core/Logger.h"
+#include "Math/Bvh.h"
+#include "Math/LooseOctree.h"
+#include "Math/Math.h"
+#include "MathTestUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+using namespace Engine::Test;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("LooseOctreeTests", std::string("FAILED: ") + message);      \
+    return false;                                                              \
+  }
+
+// Moves 'ratio' of the boxes by up to 'distance' per axis and grows or
+// shrinks some of them
+static void MoveBoxes(std::vector<AABB> &boxes, float ratio, float distance,
+                      uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+  std::uniform_real_distribution<float> offset(-distance, distance);
+  for (AABB &box : boxes) {
+    if (unit(rng) >= ratio) {
+      continue;
+    }
+    Vec3 move(offset(rng), offset(rng), offset(rng));
+    Vec3 center = box.Center() + move;
+    Vec3 half = box.Extents() * (0.5f + unit(rng));
+    box = AABB(center - half, center + half);
+  }
+}
+
+static bool SameBox(const AABB &a, const AABB &b) {
+  return a.min.x == b.min.x && a.min.y == b.min.y && a.min.z == b.min.z &&
+         a.max.x == b.max.x && a.max.y == b.max.y && a.max.z == b.max.z;
+}
+
+static bool Encloses(const AABB &outer, const AABB &inner) {
+  return inner.min.x >= outer.min.x && inner.min.y >= outer.min.y &&
+         inner.min.z >= outer.min.z && inner.max.x <= outer.max.x &&
+         inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+}
+
+// Every object stored once, in a node whose loose bounds hold its current
+// box; parent links, depths and cells consistent; no empty leaves
+static bool CheckStructure(const LooseOctree &tree,
+                           const std::vector<AABB> &boxes) {
+  if (tree.GetObjectCount() != boxes.size()) {
+    return false;
+  }
+  if (boxes.empty()) {
+    return tree.GetRoot() == LooseOctreeNode::kNone;
+  }
+  const LooseOctreeSettings &settings = tree.GetSettings();
+  std::vector<int> seen(boxes.size(), 0);
+  size_t nodeCount = 0;
+  std::vector<uint32_t> stack = {tree.GetRoot()};
+  while (!stack.empty()) {
+    uint32_t handle = stack.back();
+    stack.pop_back();
+    ++nodeCount;
+    const LooseOctreeNode &node = tree.GetNode(handle);
+    if (node.Objects.size() != node.Bounds.size() ||
+        node.Depth > settings.MaxDepth) {
+      return false;
+    }
+    bool hasChildren = false;
+    for (int octant = 0; octant < 8; ++octant) {
+      uint32_t child = node.Children[octant];
+      if (child == LooseOctreeNode::kNone) {
+        continue;
+      }
+      hasChildren = true;
+      const LooseOctreeNode &childNode = tree.GetNode(child);
+      Vec3 offset = childNode.Center - node.Center;
+      if (childNode.Parent != handle || childNode.Depth != node.Depth + 1 ||
+          childNode.HalfSize != node.HalfSize * 0.5f ||
+          (offset.x > 0.0f) != bool(octant & 1) ||
+          (offset.y > 0.0f) != bool(octant & 2) ||
+          (offset.z > 0.0f) != bool(octant & 4)) {
+        return false;
+      }
+      stack.push_back(child);
+    }
+    if (node.Depth > 0 && node.Objects.empty() && !hasChildren) {
+      return false;
+    }
+    for (size_t i = 0; i < node.Objects.size(); ++i) {
+      uint32_t object = node.Objects[i];
+      if (object >= boxes.size() || seen[object]++ ||
+          tree.GetNodeOf(object) != handle ||
+          !SameBox(node.Bounds[i], boxes[object]) ||
+          (node.Depth > 0 && !Encloses(node.LooseBounds, boxes[object]))) {
+        return false;
+      }
+    }
+  }
+  return nodeCount == tree.GetNodeCount() &&
+         std::all_of(seen.begin(), seen.end(), [](int n) { return n == 1; });
+}
+
+// Query results against a test of every box, each object at most once;
+// 'borderline' boxes may go either way
+template <typename Test, typename Borderline>
+static bool MatchesBruteForce(std::vector<uint32_t> result,
+                              const std::vector<AABB> &boxes, Test test,
+                              Borderline borderline) {
+  std::sort(result.begin(), result.end());
+  if (std::adjacent_find(result.begin(), result.end()) != result.end()) {
+    return false;
+  }
+  size_t next = 0;
+  for (uint32_t i = 0; i < boxes.size(); ++i) {
+    bool found = next < result.size() && result[next] == i;
+    next += found;
+    if (found != test(boxes[i]) && !borderline(boxes[i])) {
+      return false;
+    }
+  }
+  return next == result.size();
+}
+
+template <typename Test>
+static bool MatchesBruteForce(std::vector<uint32_t> result,
+                              const std::vector<AABB> &boxes, Test test) {
+  return MatchesBruteForce(std::move(result), boxes, test,
+                           [](const AABB &) { return false; });
+}
+
+static bool MatchesBruteForce(const std::vector<uint32_t> &result,
+                              const std::vector<AABB> &boxes,
+                              const Frustum &frustum) {
+  return MatchesBruteForce(
+      result, boxes,
+      [&](const AABB &box) { return frustum.Intersects(box); },
+      [&](const AABB &box) { return std::abs(Margin(frustum, box)) < 1e-3; });
+}
+
+static RayHit ClosestBox(const Ray &ray, const std::vector<AABB> &boxes) {
+  RayHit hit;
+  Vec3 invDir = ray.InverseDirection();
+  for (uint32_t i = 0; i < boxes.size(); ++i) {
+    float t;
+    if (ray.IntersectAABB(boxes[i], invDir, t) && t < hit.T) {
+      hit.T = t;
+      hit.Index = i;
+    }
+  }
+  return hit;
+}
+
+static bool CheckQueries(const LooseOctree &tree,
+                         const std::vector<AABB> &boxes, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+  std::uniform_real_distribution<float> size(1.0f, 30.0f);
+  std::vector<uint32_t> found(boxes.size());
+  auto result = [&](size_t count) {
+    return std::vector<uint32_t>(found.begin(), found.begin() + count);
+  };
+
+  for (int query = 0; query < 6; ++query) {
+    Frustum frustum = MakeFrustum(rng, 100.0f);
+    if (!MatchesBruteForce(result(tree.Cull(frustum, found)), boxes,
+                           frustum)) {
+      return false;
+    }
+    Sphere sphere(Vec3(position(rng), position(rng), position(rng)),
+                  size(rng));
+    if (!MatchesBruteForce(result(tree.Overlap(sphere, found)), boxes,
+                           [&](const AABB &box) {
+                             return sphere.Intersects(box);
+                           })) {
+      return false;
+    }
+    Vec3 center(position(rng), position(rng), position(rng));
+    AABB region(center - Vec3(size(rng)), center + Vec3(size(rng)));
+    if (!MatchesBruteForce(result(tree.Overlap(region, found)), boxes,
+                           [&](const AABB &box) {
+                             return region.Intersects(box);
+                           })) {
+      return false;
+    }
+
+    // A short output is filled and no further
+    size_t count = tree.Cull(frustum, found);
+    size_t capacity = count / 3;
+    std::vector<uint32_t> partial(capacity + 1, 0xDEADBEEFu);
+    if (tree.Cull(frustum, Span<uint32_t>(partial.data(), capacity)) !=
+            capacity ||
+        partial[capacity] != 0xDEADBEEFu) {
+      return false;
+    }
+  }
+
+  for (const Ray &ray : MakeRays(100, seed, 100.0f)) {
+    RayHit expected = ClosestBox(ray, boxes);
+    RayHit closest;
+    if (tree.Raycast(ray, closest) != expected.IsHit() ||
+        closest.T != expected.T) {
+      return false;
+    }
+    // Half the any-hit queries get a limit, so some have to miss
+    RayHit any;
+    any.T = ray.origin.x < 0.0f ? 20.0f : any.T;
+    float limit = any.T;
+    Vec3 invDir = ray.InverseDirection();
+    float t;
+    if (tree.Raycast(ray, any, RayQuery::Any) != (expected.T < limit) ||
+        (any.IsHit() &&
+         (!ray.IntersectAABB(boxes[any.Index], invDir, t) || t != any.T ||
+          t >= limit))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+//============================================================================
+// Structure and queries
+//============================================================================
+bool TestStructure() {
+  Logger::Info("LooseOctreeTests", "Testing tree structure and queries...");
+
+  for (size_t count : {1u, 2u, 17u, 300u, 20000u}) {
+    std::vector<AABB> boxes = MakeBoxes(count, 7 + count, 100.0f, 3.0f);
+    for (float looseness : {1.25f, 2.0f, 3.0f}) {
+      for (uint32_t threshold : {1u, 16u}) {
+        LooseOctreeSettings settings;
+        settings.Looseness = looseness;
+        settings.SplitThreshold = threshold;
+        LooseOctree tree;
+        tree.Build(boxes, settings);
+        std::string name = std::to_string(count) + " objects, looseness " +
+                           std::to_string(looseness) + ", threshold " +
+                           std::to_string(threshold);
+        TEST_ASSERT(CheckStructure(tree, boxes), "Consistent with " + name);
+        TEST_ASSERT(CheckQueries(tree, boxes, 3),
+                    "Queries match brute force with " + name);
+      }
+    }
+  }
+
+  // Depth is capped, and then the deepest cells take every object
+  std::vector<AABB> boxes = MakeBoxes(5000, 9, 100.0f, 0.1f);
+  LooseOctreeSettings shallow;
+  shallow.MaxDepth = 2;
+  LooseOctree tree;
+  tree.Build(boxes, shallow);
+  TEST_ASSERT(CheckStructure(tree, boxes) && tree.GetNodeCount() <= 73,
+              "MaxDepth bounds the tree");
+  shallow.MaxDepth = 0;
+  tree.Build(boxes, shallow);
+  TEST_ASSERT(CheckStructure(tree, boxes) && tree.GetNodeCount() == 1 &&
+                  CheckQueries(tree, boxes, 4),
+              "MaxDepth 0 keeps everything at the root");
+
+  // Coincident boxes cannot be told apart by splitting
+  std::vector<AABB> stacked(100, AABB(Vec3(-1.0f), Vec3(1.0f)));
+  tree.Build(stacked);
+  TEST_ASSERT(CheckStructure(tree, stacked) && CheckQueries(tree, stacked, 5),
+              "Coincident boxes build a valid tree");
+
+  // A frustum around everything takes whole subtrees
+  boxes = MakeBoxes(20000, 10, 100.0f, 3.0f);
+  tree.Build(boxes);
+  Frustum all = Frustum::FromMatrix(Mat4::Orthographic(
+      -400.0f, 400.0f, -400.0f, 400.0f, -400.0f, 400.0f));
+  std::vector<uint32_t> found(boxes.size());
+  size_t count = tree.Cull(all, found);
+  TEST_ASSERT(count == boxes.size() &&
+                  MatchesBruteForce(found, boxes, all),
+              "A frustum around the scene returns every object once");
+
+  LooseOctree empty;
+  empty.Build(Span<const AABB>());
+  RayHit hit;
+  TEST_ASSERT(empty.IsEmpty() && empty.Cull(all, found) == 0 &&
+                  empty.Overlap(Sphere(Vec3(), 10.0f), found) == 0 &&
+                  !empty.Raycast(Ray(), hit),
+              "An empty tree finds nothing");
+
+  Logger::Info("LooseOctreeTests", "✅ Structure and query tests passed!");
+  return true;
+}
+
+//============================================================================
+// Updates
+//============================================================================
+static bool CheckUpdates() {
+  std::vector<AABB> boxes = MakeBoxes(30000, 12, 100.0f, 3.0f);
+  LooseOctree tree;
+  tree.Build(boxes);
+
+  tree.Update(boxes);
+  TEST_ASSERT(tree.GetReinsertedCount() == 0 && CheckStructure(tree, boxes),
+              "Unmoved objects stay in place");
+
+  // Small steps mostly stay within the loose bounds, large ones reinsert;
+  // the last frames push objects out of the root cell altogether
+  const float ratios[] = {0.01f, 0.1f, 0.5f, 1.0f, 1.0f, 1.0f};
+  const float distances[] = {0.5f, 5.0f, 20.0f, 2.0f, 60.0f, 150.0f};
+  for (int frame = 0; frame < 6; ++frame) {
+    MoveBoxes(boxes, ratios[frame], distances[frame], 40 + frame);
+    tree.Update(boxes);
+    std::string name = "after moving " +
+                       std::to_string(int(ratios[frame] * 100.0f)) +
+                       "% by up to " + std::to_string(distances[frame]);
+    TEST_ASSERT(CheckStructure(tree, boxes), "Consistent " + name);
+    TEST_ASSERT(CheckQueries(tree, boxes, 50 + frame),
+                "Queries match brute force " + name);
+  }
+  TEST_ASSERT(tree.GetReinsertedCount() > 0,
+              "Objects leaving their cells are reinserted");
+
+  // Updates for a subset of the objects
+  std::vector<uint32_t> objects;
+  std::vector<AABB> moved;
+  for (uint32_t i = 0; i < boxes.size(); i += 7) {
+    boxes[i] = AABB(boxes[i].min * 0.5f, boxes[i].max * 0.5f);
+    objects.push_back(i);
+    moved.push_back(boxes[i]);
+  }
+  tree.Update(objects, moved);
+  TEST_ASSERT(CheckStructure(tree, boxes) && CheckQueries(tree, boxes, 60),
+              "Updating a subset of the objects");
+
+  // Emptied cells are recycled rather than leaked
+  std::vector<AABB> gathered(boxes.size(), AABB(Vec3(-1.0f), Vec3(1.0f)));
+  tree.Update(gathered);
+  TEST_ASSERT(CheckStructure(tree, gathered),
+              "Gathering every object in one place");
+  tree.Update(boxes);
+  size_t nodes = tree.GetNodeCount();
+  tree.Update(gathered);
+  tree.Update(boxes);
+  TEST_ASSERT(CheckStructure(tree, boxes) && tree.GetNodeCount() == nodes,
+              "Scattering again reuses the same number of nodes");
+  return true;
+}
+
+bool TestUpdates() {
+  Logger::Info("LooseOctreeTests", "Testing updates...");
+
+  TEST_ASSERT(CheckUpdates(), "Updates on one thread");
+  JobSystem::Initialize(3);
+  bool parallel = CheckUpdates();
+  JobSystem::Shutdown();
+  TEST_ASSERT(parallel, "Updates with the job system running");
+
+  // Batch rays through the job system match one ray at a time
+  std::vector<AABB> boxes = MakeBoxes(30000, 13, 100.0f, 3.0f);
+  LooseOctree tree;
+  tree.Build(boxes);
+  std::vector<Ray> rays = MakeRays(300, 14, 100.0f);
+  std::vector<RayHit> batch(rays.size());
+  JobSystem::Initialize(3);
+  tree.Raycast(rays, batch, RayQuery::Closest, 16);
+  JobSystem::Shutdown();
+  for (size_t i = 0; i < rays.size(); ++i) {
+    RayHit single;
+    tree.Raycast(rays[i], single);
+    TEST_ASSERT(batch[i].T == single.T && batch[i].Index == single.Index,
+                "Parallel batch rays match single rays");
+  }
+
+  Logger::Info("LooseOctreeTests", "✅ Update tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("LooseOctreeTests", "Starting loose octree tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestStructure();
+  allPassed &= TestUpdates();
+
+  if (allPassed) {
+    Logger::Info("LooseOctreeTests", "🎉 ALL LOOSE OCTREE TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("LooseOctreeTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,297 @@
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include "MathTestUtils.h"
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+using namespace Engine::Test;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("MathKernelsTests", std::string("FAILED: ") + message);      \
+    return false;                                                              \
+  }
+
+// Relative difference, so projective results with large magnitudes compare
+// on the same footing as unit vectors
+static bool Close(float a, float b, float tolerance = 1e-5f) {
+  return std::abs(a - b) <= tolerance * std::max(1.0f, std::abs(b));
+}
+
+static bool Close(const Vec3 &a, const Vec3 &b) {
+  return Close(a.x, b.x) && Close(a.y, b.y) && Close(a.z, b.z) &&
+         a.w == 0.0f;
+}
+
+static std::vector<Vec3> RandomVectors(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+  std::vector<Vec3> vectors(count);
+  for (auto &v : vectors) {
+    v = Vec3(dist(rng), dist(rng), dist(rng));
+  }
+  return vectors;
+}
+
+static Mat4 TestMatrix() {
+  return Mat4::TRS(Vec3(1.0f, -2.0f, 3.0f), Vec3(0.3f, 1.1f, -0.7f),
+                   Vec3(2.0f, 0.5f, 1.5f));
+}
+
+//============================================================================
+// Detection Tests
+//============================================================================
+bool TestDetection() {
+  Logger::Info("MathKernelsTests", "Testing level detection...");
+
+  SimdLevel cpu = MathKernels::DetectLevel();
+  Logger::Info("MathKernelsTests",
+               std::string("CPU level: ") + GetSimdLevelName(cpu) +
+                   ", active: " + GetSimdLevelName(MathKernels::GetLevel()));
+
+  TEST_ASSERT(MathKernels::GetTable(SimdLevel::Scalar) != nullptr,
+              "Scalar table always exists");
+  TEST_ASSERT(MathKernels::GetLevel() <= cpu,
+              "Active level is supported by the CPU");
+
+  for (SimdLevel level : kLevels) {
+    const MathKernelTable *table = MathKernels::GetTable(level);
+    TEST_ASSERT(!table || table->Level == level, "Table reports its level");
+    TEST_ASSERT(!table || level <= cpu, "No table above the CPU level");
+    TEST_ASSERT(MathKernels::Select(level) == (table != nullptr),
+                "Select succeeds exactly for available tables");
+    TEST_ASSERT(!table || MathKernels::GetLevel() == level,
+                "Select switches the active table");
+  }
+
+  // Leave the best table active for the remaining tests
+  std::vector<const MathKernelTable *> tables = AvailableTables();
+  MathKernels::Select(tables.back()->Level);
+
+  Logger::Info("MathKernelsTests", "✅ Detection tests passed!");
+  return true;
+}
+
+//============================================================================
+// Consistency Tests
+//============================================================================
+bool TestTransformsMatchScalar() {
+  Logger::Info("MathKernelsTests", "Testing transforms against scalar...");
+
+  const MathKernelTable *scalar = MathKernels::GetTable(SimdLevel::Scalar);
+  Mat4 matrix = TestMatrix();
+  Mat4 projection = Mat4::Perspective(ToRadians(60.0f), 1.5f, 0.1f, 100.0f);
+  std::vector<Vec3> source = RandomVectors(64, 1);
+
+  using AoSKernel = void (*)(const Mat4 &, const Vec3 *, Vec3 *, size_t);
+  struct Case {
+    const char *name;
+    AoSKernel MathKernelTable::*kernel;
+    const Mat4 *matrix;
+  };
+  const Case cases[] = {
+      {"TransformPoints", &MathKernelTable::TransformPoints, &matrix},
+      {"TransformVectors", &MathKernelTable::TransformVectors, &matrix},
+      {"TransformPointsProjective",
+       &MathKernelTable::TransformPointsProjective, &projection},
+  };
+
+  for (const MathKernelTable *table : AvailableTables()) {
+    // Odd counts and offsets exercise peeling and tails of every width
+    for (size_t offset = 0; offset < 4; ++offset) {
+      for (size_t count = 0; count + offset <= 37; ++count) {
+        const Vec3 *in = source.data() + offset;
+        for (const Case &c : cases) {
+          std::vector<Vec3> expected(count + 1, Vec3(7.0f));
+          std::vector<Vec3> actual(count + 1, Vec3(7.0f));
+          (scalar->*c.kernel)(*c.matrix, in, expected.data(), count);
+          (table->*c.kernel)(*c.matrix, in, actual.data(), count);
+          for (size_t i = 0; i < count; ++i) {
+            TEST_ASSERT(Close(actual[i], expected[i]),
+                        Name(table) + " " + c.name + " matches scalar");
+          }
+          TEST_ASSERT(actual[count].x == 7.0f,
+                      Name(table) + " " + c.name + " stays in bounds");
+        }
+
+        std::vector<float> sx(count + 1, 7.0f), sy(count), sz(count);
+        std::vector<float> ax(count + 1, 7.0f), ay(count), az(count);
+        for (bool points : {true, false}) {
+          auto kernel = points ? &MathKernelTable::TransformPointsSoA
+                               : &MathKernelTable::TransformVectorsSoA;
+          (scalar->*kernel)(matrix, in, sx.data(), sy.data(), sz.data(),
+                            count);
+          (table->*kernel)(matrix, in, ax.data(), ay.data(), az.data(),
+                           count);
+          for (size_t i = 0; i < count; ++i) {
+            TEST_ASSERT(Close(ax[i], sx[i]) && Close(ay[i], sy[i]) &&
+                            Close(az[i], sz[i]),
+                        Name(table) + " SoA transform matches scalar");
+          }
+          TEST_ASSERT(ax[count] == 7.0f,
+                      Name(table) + " SoA transform stays in bounds");
+        }
+      }
+    }
+
+    // In place
+    std::vector<Vec3> expected(source.size()), actual = source;
+    scalar->TransformPoints(matrix, source.data(), expected.data(),
+                            source.size());
+    table->TransformPoints(matrix, actual.data(), actual.data(),
+                           actual.size());
+    for (size_t i = 0; i < source.size(); ++i) {
+      TEST_ASSERT(Close(actual[i], expected[i]),
+                  Name(table) + " in-place transform matches scalar");
+    }
+  }
+
+  Logger::Info("MathKernelsTests", "✅ Transform consistency tests passed!");
+  return true;
+}
+
+bool TestCullingMatchesScalar() {
+  Logger::Info("MathKernelsTests", "Testing sphere culling against scalar...");
+
+  const MathKernelTable *scalar = MathKernels::GetTable(SimdLevel::Scalar);
+  Mat4 viewProjection =
+      Mat4::Perspective(ToRadians(60.0f), 1.5f, 0.1f, 100.0f) *
+      Mat4::LookAt(Vec3(0.0f, 0.0f, 10.0f), Vec3::Zero(), Vec3::Up());
+  Frustum frustum = Frustum::FromMatrix(viewProjection);
+
+  std::mt19937 rng(2);
+  std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+  std::uniform_real_distribution<float> radius(0.0f, 5.0f);
+  std::vector<Vec4> spheres(200);
+  for (auto &s : spheres) {
+    s = Vec4(position(rng), position(rng), position(rng), radius(rng));
+  }
+
+  // Scalar and the active table agree with the per-sphere Frustum test
+  std::vector<uint8_t> expected(spheres.size());
+  std::vector<uint8_t> batch(spheres.size());
+  scalar->CullSpheres(frustum.planes, spheres.data(), expected.data(),
+                      spheres.size());
+  frustum.Intersects(spheres, batch);
+  size_t visibleCount = 0;
+  for (size_t i = 0; i < spheres.size(); ++i) {
+    const Vec4 &s = spheres[i];
+    bool inside = frustum.Intersects(Sphere(Vec3(s.x, s.y, s.z), s.w));
+    TEST_ASSERT(expected[i] == (inside ? 1 : 0) && batch[i] == expected[i],
+                "Batch culling matches Frustum::Intersects");
+    visibleCount += expected[i];
+  }
+  TEST_ASSERT(visibleCount > 0 && visibleCount < spheres.size(),
+              "Test scene has visible and culled spheres");
+
+  for (const MathKernelTable *table : AvailableTables()) {
+    for (size_t offset = 0; offset < 3; ++offset) {
+      for (size_t count = 0; count + offset <= 70; ++count) {
+        std::vector<uint8_t> actual(count + 1, 7);
+        table->CullSpheres(frustum.planes, spheres.data() + offset,
+                           actual.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+          TEST_ASSERT(actual[i] == expected[i + offset],
+                      Name(table) + " culling matches scalar");
+        }
+        TEST_ASSERT(actual[count] == 7,
+                    Name(table) + " culling stays in bounds");
+      }
+    }
+  }
+
+  Logger::Info("MathKernelsTests", "✅ Culling consistency tests passed!");
+  return true;
+}
+
+bool TestSkinningMatchesScalar() {
+  Logger::Info("MathKernelsTests", "Testing skinning against scalar...");
+
+  const MathKernelTable *scalar = MathKernels::GetTable(SimdLevel::Scalar);
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<float> angle(-PI, PI);
+  std::uniform_real_distribution<float> offset(-5.0f, 5.0f);
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+  std::vector<Mat4> bones(16);
+  for (auto &bone : bones) {
+    bone = Mat4::TRS(Vec3(offset(rng), offset(rng), offset(rng)),
+                     Vec3(angle(rng), angle(rng), angle(rng)), Vec3(1.0f));
+  }
+
+  const size_t count = 41;
+  std::vector<SkinInfluences> influences(count);
+  for (auto &influence : influences) {
+    float total = 0.0f;
+    for (int k = 0; k < 4; ++k) {
+      influence.Bones[k] = static_cast<uint16_t>(rng() % bones.size());
+      influence.Weights[k] = unit(rng);
+      total += influence.Weights[k];
+    }
+    for (float &weight : influence.Weights) {
+      weight /= total;
+    }
+  }
+  // A single rigid influence reproduces the bone transform
+  influences[0] = SkinInfluences();
+  influences[0].Bones[0] = 5;
+
+  std::vector<Vec3> source = RandomVectors(count, 4);
+  Vec3 rigid = bones[5].TransformPoint(source[0]);
+
+  for (const MathKernelTable *table : AvailableTables()) {
+    for (size_t n = 0; n <= count; ++n) {
+      for (bool points : {true, false}) {
+        auto kernel = points ? &MathKernelTable::SkinPoints
+                             : &MathKernelTable::SkinVectors;
+        std::vector<Vec3> expected(n + 1, Vec3(7.0f));
+        std::vector<Vec3> actual(n + 1, Vec3(7.0f));
+        (scalar->*kernel)(bones.data(), influences.data(), source.data(),
+                          expected.data(), n);
+        (table->*kernel)(bones.data(), influences.data(), source.data(),
+                         actual.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+          TEST_ASSERT(Close(actual[i], expected[i]),
+                      Name(table) + " skinning matches scalar");
+        }
+        TEST_ASSERT(actual[n].x == 7.0f,
+                    Name(table) + " skinning stays in bounds");
+      }
+    }
+
+    Vec3 skinned;
+    table->SkinPoints(bones.data(), influences.data(), source.data(),
+                      &skinned, 1);
+    TEST_ASSERT(Close(skinned, rigid),
+                Name(table) + " single influence matches the bone");
+  }
+
+  Logger::Info("MathKernelsTests", "✅ Skinning consistency tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("MathKernelsTests", "Starting math kernel tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestDetection();
+  allPassed &= TestTransformsMatchScalar();
+  allPassed &= TestCullingMatchesScalar();
+  allPassed &= TestSkinningMatchesScalar();
+
+  if (allPassed) {
+    Logger::Info("MathKernelsTests", "🎉 ALL MATH KERNEL TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("MathKernelsTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#pragma once
+
+// Shared inputs for the math tests: the kernel tables each check runs
+// against, and the random scenes of boxes, frusta and rays the spatial
+// structures are compared to brute force on.
+
+#include "Math/Math.h"
+#include "Math/MathKernels.h"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Engine {
+namespace Test {
+
+//============================================================================
+// Kernel tables
+//============================================================================
+inline constexpr Math::SimdLevel kLevels[] = {
+    Math::SimdLevel::Scalar, Math::SimdLevel::SSE2, Math::SimdLevel::SSE41,
+    Math::SimdLevel::AVX2, Math::SimdLevel::AVX512};
+
+// Tables this build and CPU can run, scalar first
+inline std::vector<const Math::MathKernelTable *> AvailableTables() {
+  std::vector<const Math::MathKernelTable *> tables;
+  for (Math::SimdLevel level : kLevels) {
+    if (const Math::MathKernelTable *table =
+            Math::MathKernels::GetTable(level)) {
+      tables.push_back(table);
+    }
+  }
+  return tables;
+}
+
+inline std::string Name(const Math::MathKernelTable *table) {
+  return Math::GetSimdLevelName(table->Level);
+}
+
+//============================================================================
+// Scenes
+//============================================================================
+// Boxes of up to 'size' per axis, clustered the way scene objects are:
+// uniform filler plus dense groups
+inline std::vector<Math::AABB> MakeBoxes(size_t count, uint32_t seed,
+                                         float range, float size) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> position(-range, range);
+  std::uniform_real_distribution<float> extent(0.01f * size, 0.5f * size);
+  std::normal_distribution<float> cluster(0.0f, range * 0.05f);
+  std::vector<Math::Vec3> centers(16);
+  for (Math::Vec3 &center : centers) {
+    center = Math::Vec3(position(rng), position(rng), position(rng));
+  }
+
+  std::vector<Math::AABB> boxes(count);
+  for (size_t i = 0; i < count; ++i) {
+    Math::Vec3 center(position(rng), position(rng), position(rng));
+    if (i % 2 == 0) {
+      center = centers[i % centers.size()] +
+               Math::Vec3(cluster(rng), cluster(rng), cluster(rng));
+    }
+    Math::Vec3 half(extent(rng), extent(rng), extent(rng));
+    boxes[i] = Math::AABB(center - half, center + half);
+  }
+  return boxes;
+}
+
+inline Math::Frustum MakeFrustum(std::mt19937 &rng, float range) {
+  std::uniform_real_distribution<float> position(-range, range);
+  Math::Vec3 eye(position(rng), position(rng), position(rng));
+  Math::Vec3 target(position(rng), position(rng), position(rng));
+  Math::Mat4 view = Math::Mat4::LookAt(eye, target, Math::Vec3::Up());
+  Math::Mat4 projection = Math::Mat4::Perspective(Math::ToRadians(60.0f),
+                                                  1.5f, 0.1f, range * 1.5f);
+  return Math::Frustum::FromMatrix(projection * view);
+}
+
+inline std::vector<Math::Ray> MakeRays(size_t count, uint32_t seed,
+                                       float range) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> position(-range, range);
+  std::vector<Math::Ray> rays(count);
+  for (Math::Ray &ray : rays) {
+    Math::Vec3 origin(position(rng), position(rng), position(rng));
+    Math::Vec3 target(position(rng), position(rng), position(rng));
+    ray = Math::Ray(origin, target - origin);
+  }
+  return rays;
+}
+
+// Distance of the box's farthest corner inside the worst plane, in double
+// precision. A structure and the per-object test may disagree only when
+// this is within float noise of zero.
+inline double Margin(const Math::Frustum &frustum, const Math::AABB &box) {
+  double worst = 1e30;
+  for (const Math::Vec4 &plane : frustum.planes) {
+    double distance =
+        double(plane.x) * (plane.x >= 0.0f ? box.max.x : box.min.x) +
+        double(plane.y) * (plane.y >= 0.0f ? box.max.y : box.min.y) +
+        double(plane.z) * (plane.z >= 0.0f ? box.max.z : box.min.z) +
+        plane.w;
+    worst = std::min(worst, distance);
+  }
+  return worst;
+}
+
+} // namespace Test
+} // namespace Engine
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("MatrixInverseTests", std::string("FAILED: ") + message);    \
+    return false;                                                              \
+  }
+
+// Largest absolute element difference
+static float MaxError(const Mat4 &a, const Mat4 &b) {
+  float error = 0.0f;
+  for (int i = 0; i < 16; ++i) {
+    error = std::max(error, std::abs(a.data[i] - b.data[i]));
+  }
+  return error;
+}
+
+static std::string Scientific(float value) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.2e", value);
+  return buffer;
+}
+
+// Gauss-Jordan with partial pivoting in double precision
+static Mat4 ReferenceInverse(const Mat4 &matrix) {
+  double a[4][8];
+  for (int r = 0; r < 4; ++r) {
+    for (int c = 0; c < 4; ++c) {
+      a[r][c] = matrix.m[r][c];
+      a[r][c + 4] = r == c ? 1.0 : 0.0;
+    }
+  }
+  for (int col = 0; col < 4; ++col) {
+    int pivot = col;
+    for (int r = col + 1; r < 4; ++r) {
+      if (std::abs(a[r][col]) > std::abs(a[pivot][col])) {
+        pivot = r;
+      }
+    }
+    std::swap(a[col], a[pivot]);
+    double inv = 1.0 / a[col][col];
+    for (int c = 0; c < 8; ++c) {
+      a[col][c] *= inv;
+    }
+    for (int r = 0; r < 4; ++r) {
+      if (r != col) {
+        double f = a[r][col];
+        for (int c = 0; c < 8; ++c) {
+          a[r][c] -= f * a[col][c];
+        }
+      }
+    }
+  }
+  Mat4 result;
+  for (int r = 0; r < 4; ++r) {
+    for (int c = 0; c < 4; ++c) {
+      result.m[r][c] = static_cast<float>(a[r][c + 4]);
+    }
+  }
+  return result;
+}
+
+static std::vector<Mat4> MakeTRS(size_t count, bool unitScale,
+                                 uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> angle(-PI, PI);
+  std::uniform_real_distribution<float> offset(-50.0f, 50.0f);
+  std::uniform_real_distribution<float> scale(0.1f, 10.0f);
+  std::vector<Mat4> matrices(count);
+  for (auto &m : matrices) {
+    Vec3 s =
+        unitScale ? Vec3(1.0f) : Vec3(scale(rng), scale(rng), scale(rng));
+    m = Mat4::TRS(Vec3(offset(rng), offset(rng), offset(rng)),
+                  Vec3(angle(rng), angle(rng), angle(rng)), s);
+  }
+  return matrices;
+}
+
+//============================================================================
+// Accuracy Tests
+//============================================================================
+bool TestGeneralInverse() {
+  Logger::Info("MatrixInverseTests", "Testing general inverse...");
+
+  // Dense random matrices, kept well conditioned by a dominant diagonal
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  float worst = 0.0f;
+  for (int i = 0; i < 1000; ++i) {
+    Mat4 m;
+    for (int e = 0; e < 16; ++e) {
+      m.data[e] = dist(rng);
+    }
+    for (int d = 0; d < 4; ++d) {
+      m.m[d][d] += 4.0f;
+    }
+    worst = std::max(worst, MaxError(m.Inverted(), ReferenceInverse(m)));
+    TEST_ASSERT(MaxError(m * m.Inverted(), Mat4::Identity()) < 1e-5f,
+                "M * inverse(M) is identity");
+  }
+  Logger::Info("MatrixInverseTests",
+               "Random matrices max error vs double reference: " +
+                   Scientific(worst));
+  TEST_ASSERT(worst < 1e-5f, "General inverse matches reference");
+
+  // Projection and view matrices
+  Mat4 projection = Mat4::Perspective(ToRadians(60.0f), 1.5f, 0.1f, 100.0f);
+  Mat4 view = Mat4::LookAt(Vec3(3.0f, 4.0f, 10.0f), Vec3::Zero(), Vec3::Up());
+  Mat4 viewProjection = projection * view;
+  TEST_ASSERT(MaxError(projection.Inverted(), ReferenceInverse(projection)) <
+                  1e-4f,
+              "Projection inverse matches reference");
+  TEST_ASSERT(MaxError(viewProjection * viewProjection.Inverted(),
+                       Mat4::Identity()) < 1e-4f,
+              "View-projection inverse round trips");
+
+  // Singular matrices fall back to identity
+  Mat4 singular = Mat4::Scale(Vec3(1.0f, 0.0f, 1.0f));
+  TEST_ASSERT(MaxError(singular.Inverted(), Mat4::Identity()) == 0.0f,
+              "Singular matrix gives identity");
+
+  Logger::Info("MatrixInverseTests", "✅ General inverse tests passed!");
+  return true;
+}
+
+bool TestAffineInverse() {
+  Logger::Info("MatrixInverseTests", "Testing affine and rigid inverses...");
+
+  float worstAffine = 0.0f;
+  for (const Mat4 &m : MakeTRS(1000, false, 2)) {
+    Mat4 reference = ReferenceInverse(m);
+    worstAffine =
+        std::max(worstAffine, MaxError(m.InvertedAffine(), reference));
+    TEST_ASSERT(MaxError(m.InvertedAffine(), m.Inverted()) < 1e-3f,
+                "InvertedAffine matches Inverted");
+  }
+
+  float worstRigid = 0.0f;
+  for (const Mat4 &m : MakeTRS(1000, true, 3)) {
+    worstRigid =
+        std::max(worstRigid, MaxError(m.InvertedRigid(), ReferenceInverse(m)));
+    TEST_ASSERT(MaxError(m * m.InvertedRigid(), Mat4::Identity()) < 1e-4f,
+                "M * InvertedRigid(M) is identity");
+  }
+
+  Logger::Info("MatrixInverseTests",
+               "TRS max error: affine " + Scientific(worstAffine) +
+                   ", rigid " + Scientific(worstRigid));
+  TEST_ASSERT(worstAffine < 1e-4f, "Affine inverse matches reference");
+  TEST_ASSERT(worstRigid < 1e-4f, "Rigid inverse matches reference");
+
+  // The view matrix is rigid; its inverse places the camera
+  Vec3 eye(3.0f, 4.0f, 10.0f);
+  Mat4 view = Mat4::LookAt(eye, Vec3::Zero(), Vec3::Up());
+  Vec3 position = view.InvertedRigid().TransformPoint(Vec3::Zero());
+  TEST_ASSERT(std::abs(position.x - eye.x) < 1e-4f &&
+                  std::abs(position.y - eye.y) < 1e-4f &&
+                  std::abs(position.z - eye.z) < 1e-4f,
+              "Inverse view recovers the eye position");
+
+  // A collapsed axis stays collapsed instead of producing infinities
+  Mat4 flat = Mat4::Scale(Vec3(2.0f, 0.0f, 4.0f));
+  Mat4 flatInverse = flat.InvertedAffine();
+  TEST_ASSERT(flatInverse.m[0][0] == 0.5f && flatInverse.m[1][1] == 0.0f &&
+                  flatInverse.m[2][2] == 0.25f,
+              "Zero scale axis stays zero");
+
+  Logger::Info("MatrixInverseTests", "✅ Affine inverse tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("MatrixInverseTests", "Starting matrix inverse tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestGeneralInverse();
+  allPassed &= TestAffineInverse();
+
+  if (allPassed) {
+    Logger::Info("MatrixInverseTests", "🎉 ALL MATRIX INVERSE TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("MatrixInverseTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
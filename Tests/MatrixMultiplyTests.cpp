@@ -0,0 +1,201 @@
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include "MathTestUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+using namespace Engine::Test;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("MatrixMultiplyTests", std::string("FAILED: ") + message);   \
+    return false;                                                              \
+  }
+
+template <typename T> static bool SameBits(const T &a, const T &b) {
+  return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+// Largest element difference relative to the element's magnitude
+static float MaxError(const Mat4 &a, const Mat4 &b) {
+  float error = 0.0f;
+  for (int i = 0; i < 16; ++i) {
+    error = std::max(error, std::abs(a.data[i] - b.data[i]) /
+                                std::max(1.0f, std::abs(b.data[i])));
+  }
+  return error;
+}
+
+static std::vector<Mat4> RandomMatrices(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+  std::vector<Mat4> matrices(count);
+  for (auto &matrix : matrices) {
+    for (float &element : matrix.data) {
+      element = dist(rng);
+    }
+  }
+  return matrices;
+}
+
+//============================================================================
+// Previous implementation, the bit-for-bit reference for operator*
+//============================================================================
+
+// Gathered B's columns with _mm_set_ps, then four dot products per row
+// reduced through a transpose
+static Mat4 GatherMultiply(const Mat4 &a, const Mat4 &b) {
+  __m128 col0 = _mm_set_ps(b.m[3][0], b.m[2][0], b.m[1][0], b.m[0][0]);
+  __m128 col1 = _mm_set_ps(b.m[3][1], b.m[2][1], b.m[1][1], b.m[0][1]);
+  __m128 col2 = _mm_set_ps(b.m[3][2], b.m[2][2], b.m[1][2], b.m[0][2]);
+  __m128 col3 = _mm_set_ps(b.m[3][3], b.m[2][3], b.m[1][3], b.m[0][3]);
+  Mat4 result;
+  for (int i = 0; i < 4; ++i) {
+    __m128 mul0 = _mm_mul_ps(a.simd_rows[i], col0);
+    __m128 mul1 = _mm_mul_ps(a.simd_rows[i], col1);
+    __m128 mul2 = _mm_mul_ps(a.simd_rows[i], col2);
+    __m128 mul3 = _mm_mul_ps(a.simd_rows[i], col3);
+    _MM_TRANSPOSE4_PS(mul0, mul1, mul2, mul3);
+    result.simd_rows[i] =
+        _mm_add_ps(_mm_add_ps(mul0, mul1), _mm_add_ps(mul2, mul3));
+  }
+  return result;
+}
+
+//============================================================================
+// Accuracy
+//============================================================================
+bool TestProducts() {
+  Logger::Info("MatrixMultiplyTests", "Testing Mat4 products...");
+
+  std::vector<Mat4> a = RandomMatrices(1000, 1);
+  std::vector<Mat4> b = RandomMatrices(1000, 2);
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+
+  for (size_t i = 0; i < a.size(); ++i) {
+    // Same sums in the same order as the constant evaluated path
+    Mat4 expected;
+    for (int r = 0; r < 4; ++r) {
+      for (int c = 0; c < 4; ++c) {
+        expected.m[r][c] =
+            (a[i].m[r][0] * b[i].m[0][c] + a[i].m[r][1] * b[i].m[1][c]) +
+            (a[i].m[r][2] * b[i].m[2][c] + a[i].m[r][3] * b[i].m[3][c]);
+      }
+    }
+    TEST_ASSERT(SameBits(a[i] * b[i], expected),
+                "Mat4 * Mat4 should match the scalar sums bit for bit");
+    TEST_ASSERT(SameBits(a[i] * b[i], GatherMultiply(a[i], b[i])),
+                "Broadcast rows should match the column gather bit for bit");
+
+    Vec4 v(dist(rng), dist(rng), dist(rng), dist(rng));
+    Vec4 product = a[i] * v;
+    for (int r = 0; r < 4; ++r) {
+      float element = (a[i].m[r][0] * v.x + a[i].m[r][2] * v.z) +
+                      (a[i].m[r][1] * v.y + a[i].m[r][3] * v.w);
+      TEST_ASSERT(product[r] == element,
+                  "Mat4 * Vec4 should match the scalar sums bit for bit");
+    }
+  }
+
+  // Baked products agree with runtime ones
+  constexpr Mat4 kLeft = Mat4::Translation(Vec3(1.5f, -2.0f, 0.25f)) *
+                         Mat4::Scale(Vec3(0.3f, 1.7f, 2.9f));
+  constexpr Mat4 kProjection(0.9f, 0.0f, 0.3f, 0.0f, 0.0f, 1.6f, -0.2f, 0.0f,
+                             0.0f, 0.0f, -1.002f, -0.2002f, 0.0f, 0.0f, -1.0f,
+                             0.0f);
+  constexpr Mat4 kRight = kProjection * kLeft;
+  constexpr Vec4 kPoint = kRight * Vec4(0.7f, -1.3f, 2.2f, 1.0f);
+  Mat4 left = Mat4::Translation(Vec3(1.5f, -2.0f, 0.25f)) *
+              Mat4::Scale(Vec3(0.3f, 1.7f, 2.9f));
+  Mat4 projection = kProjection;
+  Mat4 right = projection * left;
+  TEST_ASSERT(SameBits(right, kRight),
+              "Runtime Mat4 * Mat4 should match the baked product");
+  TEST_ASSERT(SameBits(right * Vec4(0.7f, -1.3f, 2.2f, 1.0f), kPoint),
+              "Runtime Mat4 * Vec4 should match the baked product");
+
+  Logger::Info("MatrixMultiplyTests", "✅ Product tests passed!");
+  return true;
+}
+
+bool TestBatchMultiply() {
+  Logger::Info("MatrixMultiplyTests", "Testing batch Mat4 products...");
+
+  const Mat4 b = RandomMatrices(1, 4)[0];
+  for (size_t count : {0, 1, 2, 3, 7, 16, 33}) {
+    std::vector<Mat4> a = RandomMatrices(count, 5);
+    for (const MathKernelTable *table : AvailableTables()) {
+      const std::string level = Name(table) + " count " +
+                                std::to_string(count);
+      std::vector<Mat4> out(count + 1);
+      out[count].m[0][0] = 42.0f;
+      table->MultiplyMatrices(a.data(), b, out.data(), count);
+      for (size_t i = 0; i < count; ++i) {
+        TEST_ASSERT(MaxError(out[i], a[i] * b) < 1e-5f,
+                    level + ": batch product should match operator*");
+        if (table->Level != SimdLevel::AVX2 &&
+            table->Level != SimdLevel::AVX512) {
+          TEST_ASSERT(SameBits(out[i], a[i] * b),
+                      level + ": non-FMA levels should match operator* "
+                              "bit for bit");
+        }
+      }
+      TEST_ASSERT(out[count].m[0][0] == 42.0f,
+                  level + ": kernel should not write past 'count'");
+
+      // In place, and with the output overlapping the right operand
+      std::vector<Mat4> inPlace = a;
+      table->MultiplyMatrices(inPlace.data(), b, inPlace.data(), count);
+      for (size_t i = 0; i < count; ++i) {
+        TEST_ASSERT(SameBits(inPlace[i], out[i]),
+                    level + ": in-place products should match");
+      }
+      if (count > 0) {
+        std::vector<Mat4> overlap = a;
+        Mat4 expected0 = out[0];
+        overlap.push_back(b);
+        table->MultiplyMatrices(overlap.data(), overlap.back(),
+                                overlap.data() + 1, count);
+        TEST_ASSERT(SameBits(overlap[1], expected0),
+                    level + ": 'b' should be read before any output");
+      }
+    }
+  }
+
+  // Span front door clamps to the shorter span
+  std::vector<Mat4> a = RandomMatrices(10, 6);
+  std::vector<Mat4> out(4);
+  Mat4::Multiply(a, b, out);
+  TEST_ASSERT(MaxError(out[3], a[3] * b) < 1e-5f,
+              "Mat4::Multiply should fill the output span");
+
+  Logger::Info("MatrixMultiplyTests", "✅ Batch product tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("MatrixMultiplyTests", "Starting matrix multiply tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestProducts();
+  allPassed &= TestBatchMultiply();
+
+  if (allPassed) {
+    Logger::Info("MatrixMultiplyTests", "🎉 ALL MATRIX MULTIPLY TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("MatrixMultiplyTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,307 @@
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include "MathTestUtils.h"
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+using namespace Engine::Test;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("PackedStorageTests", std::string("FAILED: ") + message);    \
+    return false;                                                              \
+  }
+
+static uint32_t Bits(float value) {
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+static float FromBits(uint32_t bits) {
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// Same bits in x, y, z and a zero padding lane
+static bool SameBits(const Vec3 &a, const Vec3 &b) {
+  return Bits(a.x) == Bits(b.x) && Bits(a.y) == Bits(b.y) &&
+         Bits(a.z) == Bits(b.z) && a.w == 0.0f;
+}
+
+static std::vector<Vec3> RandomVectors(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist(-1000.0f, 1000.0f);
+  std::vector<Vec3> vectors(count);
+  for (auto &vector : vectors) {
+    vector = Vec3(dist(rng), dist(rng), dist(rng));
+  }
+  return vectors;
+}
+
+// Random bit patterns with a share of half range values and specials, so
+// every FloatToHalf path is covered
+static std::vector<Vec3> RandomHalfInputs(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  const float specials[] = {0.0f,
+                            -0.0f,
+                            65504.0f,
+                            65519.99f,
+                            65520.0f,
+                            std::numeric_limits<float>::infinity(),
+                            -std::numeric_limits<float>::infinity(),
+                            std::numeric_limits<float>::quiet_NaN(),
+                            FromBits(0xFFC00001u),
+                            5.9604645e-8f,
+                            2.9802322e-8f,
+                            6.1035156e-5f};
+  auto next = [&]() {
+    uint32_t choice = rng() % 4;
+    if (choice == 0) {
+      return specials[rng() % (sizeof(specials) / sizeof(specials[0]))];
+    }
+    if (choice == 1) {
+      return FromBits(rng());
+    }
+    // Exponents around the half range, denormals included
+    uint32_t exponent = 127 - 26 + rng() % 44;
+    return FromBits((rng() & 0x807FFFFFu) | (exponent << 23));
+  };
+  std::vector<Vec3> vectors(count);
+  for (auto &vector : vectors) {
+    vector = Vec3(next(), next(), next());
+  }
+  return vectors;
+}
+
+//============================================================================
+// Storage types
+//============================================================================
+bool TestStorageTypes() {
+  Logger::Info("PackedStorageTests", "Testing packed storage types...");
+
+  TEST_ASSERT(sizeof(Float3) == 12 && sizeof(Half3) == 6 &&
+                  sizeof(Float4Packed) == 16,
+              "Packed types should have no padding");
+
+  // Usable in constant expressions, like the compute types
+  constexpr Float3 packed(Vec3(1.0f, 2.0f, 3.0f));
+  static_assert(packed.Load().y == 2.0f, "Float3 should load at compile time");
+  constexpr Float4Packed color(0.1f, 0.2f, 0.3f, 1.0f);
+  static_assert(color.Load().w == 1.0f,
+                "Float4Packed should load at compile time");
+
+  // Store writes exactly 12 bytes
+  Float3 pair[2] = {Float3(), Float3(7.0f)};
+  pair[0].Store(Vec3(-1.0f, 2.5f, 4.0f));
+  TEST_ASSERT(pair[0].x == -1.0f && pair[0].y == 2.5f && pair[0].z == 4.0f,
+              "Float3::Store should write x, y and z");
+  TEST_ASSERT(pair[1].x == 7.0f, "Float3::Store should not write past z");
+  TEST_ASSERT(SameBits(pair[0].Load(), Vec3(-1.0f, 2.5f, 4.0f)),
+              "Float3::Load should give a Vec3 with zero padding");
+
+  // Float4Packed at an offset Vec4 could not live at
+  struct {
+    float leading;
+    Float4Packed value;
+  } unaligned;
+  unaligned.value.Store(Vec4(1.0f, -2.0f, 3.0f, -4.0f));
+  Vec4 loaded = unaligned.value.Load();
+  TEST_ASSERT(loaded.x == 1.0f && loaded.y == -2.0f && loaded.z == 3.0f &&
+                  loaded.w == -4.0f,
+              "Float4Packed should round trip at any 4-byte offset");
+
+  Half3 half(Vec3(1.0f, -2.0f, 0.5f));
+  TEST_ASSERT(half.x == 0x3C00 && half.y == 0xC000 && half.z == 0x3800,
+              "Half3 should hold IEEE half bits");
+  TEST_ASSERT(SameBits(half.Load(), Vec3(1.0f, -2.0f, 0.5f)),
+              "Half3 should load exactly representable values");
+
+  // Vertex is exactly its Float3, Float3, Float2, Float3 layout
+  TEST_ASSERT(sizeof(Float3) * 3 + sizeof(Vec2) == 44,
+              "Vertex-sized records should pack to 44 bytes");
+
+  Logger::Info("PackedStorageTests", "✅ Storage type tests passed!");
+  return true;
+}
+
+//============================================================================
+// Half conversion
+//============================================================================
+bool TestHalfConversion() {
+  Logger::Info("PackedStorageTests", "Testing half conversion...");
+
+  using Detail::FloatToHalf;
+  using Detail::HalfToFloat;
+
+  // Every finite half and infinity survives a round trip; NaNs come back
+  // as the quiet NaN with their sign
+  for (uint32_t h = 0; h <= 0xFFFF; ++h) {
+    uint16_t half = static_cast<uint16_t>(h);
+    float value = HalfToFloat(half);
+    bool isNaN = (half & 0x7C00) == 0x7C00 && (half & 0x3FF) != 0;
+    if (isNaN) {
+      TEST_ASSERT(std::isnan(value), "NaN halves should widen to NaN");
+      TEST_ASSERT(FloatToHalf(value) == ((half & 0x8000) | 0x7E00),
+                  "NaN should narrow to the quiet NaN");
+    } else {
+      TEST_ASSERT(FloatToHalf(value) == half,
+                  "Half " + std::to_string(h) + " should round trip");
+    }
+  }
+
+  // Rounding: nearest, ties to even, overflow to infinity
+  TEST_ASSERT(FloatToHalf(65504.0f) == 0x7BFF, "Max half should be exact");
+  TEST_ASSERT(FloatToHalf(65519.0f) == 0x7BFF,
+              "Values below the midpoint should round to max half");
+  TEST_ASSERT(FloatToHalf(65520.0f) == 0x7C00,
+              "Values from the midpoint up should overflow to infinity");
+  TEST_ASSERT(FloatToHalf(1.0f + 1.0f / 2048.0f) == 0x3C00,
+              "Ties should round to the even mantissa");
+  TEST_ASSERT(FloatToHalf(1.0f + 3.0f / 2048.0f) == 0x3C02,
+              "Ties should round to the even mantissa");
+  TEST_ASSERT(FloatToHalf(2.9802322e-8f) == 0x0000,
+              "Half the smallest denormal should tie to zero");
+  TEST_ASSERT(FloatToHalf(-4.4703484e-8f) == 0x8001,
+              "Denormals should round to nearest");
+  TEST_ASSERT(FloatToHalf(1e-10f) == 0 && FloatToHalf(-1e-10f) == 0x8000,
+              "Underflow should keep the sign");
+
+  // Random floats: no other half is closer than the one chosen
+  std::mt19937 rng(5);
+  std::uniform_real_distribution<float> dist(-65504.0f, 65504.0f);
+  for (int i = 0; i < 100000; ++i) {
+    float value = i % 2 ? dist(rng) : dist(rng) * 1e-6f;
+    uint16_t half = FloatToHalf(value);
+    double error = std::abs(double(HalfToFloat(half)) - value);
+    for (int step : {-1, 1}) {
+      uint16_t neighbor = static_cast<uint16_t>(half + step);
+      float other = HalfToFloat(neighbor);
+      if (std::isfinite(other) && (neighbor & 0x7FFF) != 0x7FFF) {
+        TEST_ASSERT(std::abs(double(other) - value) >= error,
+                    "FloatToHalf should pick the nearest half");
+      }
+    }
+  }
+
+  Logger::Info("PackedStorageTests", "✅ Half conversion tests passed!");
+  return true;
+}
+
+//============================================================================
+// Kernels
+//============================================================================
+bool TestKernels() {
+  Logger::Info("PackedStorageTests", "Testing pack/unpack kernels...");
+
+  // Every tail length around the 4-element blocks
+  for (size_t count : {0, 1, 2, 3, 4, 5, 7, 8, 9, 33, 1000}) {
+    std::vector<Vec3> vectors = RandomVectors(count, 1);
+    std::vector<Vec3> halfInputs = RandomHalfInputs(count, 2);
+
+    for (const MathKernelTable *table : AvailableTables()) {
+      const std::string level = Name(table) + " count " +
+                                std::to_string(count);
+      const Float3 floatSentinel(42.0f);
+      Half3 halfSentinel;
+      halfSentinel.x = halfSentinel.y = halfSentinel.z = 0x1234;
+
+      std::vector<Float3> packed(count + 1);
+      std::vector<Half3> halves(count + 1);
+      std::vector<Vec3> unpacked(count + 1, Vec3(42.0f));
+      packed[count] = floatSentinel;
+      halves[count] = halfSentinel;
+
+      table->PackFloat3(vectors.data(), packed.data(), count);
+      table->PackHalf3(halfInputs.data(), halves.data(), count);
+      for (size_t i = 0; i < count; ++i) {
+        TEST_ASSERT(packed[i].x == vectors[i].x &&
+                        packed[i].y == vectors[i].y &&
+                        packed[i].z == vectors[i].z,
+                    level + ": PackFloat3 should copy x, y and z");
+        Half3 expected(halfInputs[i]);
+        TEST_ASSERT(halves[i].x == expected.x && halves[i].y == expected.y &&
+                        halves[i].z == expected.z,
+                    level + ": PackHalf3 should match Half3(const Vec3 &)");
+      }
+      TEST_ASSERT(packed[count].x == 42.0f && halves[count].x == 0x1234,
+                  level + ": packing should not write past 'count'");
+
+      table->UnpackFloat3(packed.data(), unpacked.data(), count);
+      for (size_t i = 0; i < count; ++i) {
+        TEST_ASSERT(SameBits(unpacked[i], vectors[i]),
+                    level + ": UnpackFloat3 should round trip exactly");
+      }
+      TEST_ASSERT(unpacked[count].x == 42.0f,
+                  level + ": UnpackFloat3 should not write past 'count'");
+
+      table->UnpackHalf3(halves.data(), unpacked.data(), count);
+      for (size_t i = 0; i < count; ++i) {
+        TEST_ASSERT(SameBits(unpacked[i], halves[i].Load()),
+                    level + ": UnpackHalf3 should match Half3::Load");
+      }
+      TEST_ASSERT(unpacked[count].x == 42.0f,
+                  level + ": UnpackHalf3 should not write past 'count'");
+    }
+  }
+
+  // Every half bit pattern through the unpack kernels
+  std::vector<Half3> allHalves(0x10000 / 3 + 1);
+  for (size_t i = 0; i < allHalves.size(); ++i) {
+    allHalves[i].x = static_cast<uint16_t>(3 * i);
+    allHalves[i].y = static_cast<uint16_t>(3 * i + 1);
+    allHalves[i].z = static_cast<uint16_t>(3 * i + 2);
+  }
+  for (const MathKernelTable *table : AvailableTables()) {
+    std::vector<Vec3> widened(allHalves.size());
+    table->UnpackHalf3(allHalves.data(), widened.data(), allHalves.size());
+    for (size_t i = 0; i < allHalves.size(); ++i) {
+      TEST_ASSERT(SameBits(widened[i], allHalves[i].Load()),
+                  Name(table) + ": every half should widen as HalfToFloat");
+    }
+  }
+
+  // The Span front doors clamp to the shorter span
+  std::vector<Vec3> vectors = RandomVectors(10, 3);
+  std::vector<Float3> packed(6);
+  Pack(vectors, packed);
+  TEST_ASSERT(packed[5].z == vectors[5].z, "Pack should fill the output span");
+  std::vector<Vec4> colors = {Vec4(1.0f, 0.5f, 0.25f, 1.0f)};
+  std::vector<Float4Packed> packedColors(1);
+  std::vector<Vec4> unpackedColors(1);
+  Pack(colors, packedColors);
+  Unpack(packedColors, unpackedColors);
+  TEST_ASSERT(unpackedColors[0].z == 0.25f,
+              "Float4Packed spans should round trip");
+
+  Logger::Info("PackedStorageTests", "✅ Kernel tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("PackedStorageTests", "Starting packed storage tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestStorageTypes();
+  allPassed &= TestHalfConversion();
+  allPassed &= TestKernels();
+
+  if (allPassed) {
+    Logger::Info("PackedStorageTests", "🎉 ALL PACKED STORAGE TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("PackedStorageTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
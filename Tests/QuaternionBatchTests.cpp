@@ -0,0 +1,248 @@
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("QuaternionBatchTests", std::string("FAILED: ") + message);  \
+    return false;                                                              \
+  }
+
+static std::string Scientific(float value) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.2e", value);
+  return buffer;
+}
+
+static float MaxError(const Quaternion &a, const Quaternion &b) {
+  return std::max({std::abs(a.x - b.x), std::abs(a.y - b.y),
+                   std::abs(a.z - b.z), std::abs(a.w - b.w)});
+}
+
+static float MaxError(const Vec3 &a, const Vec3 &b) {
+  return std::max({std::abs(a.x - b.x), std::abs(a.y - b.y),
+                   std::abs(a.z - b.z)});
+}
+
+static float MaxError(const Mat4 &a, const Mat4 &b) {
+  float error = 0.0f;
+  for (int i = 0; i < 16; ++i) {
+    error = std::max(error, std::abs(a.data[i] - b.data[i]));
+  }
+  return error;
+}
+
+static std::vector<Quaternion> RandomRotations(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::normal_distribution<float> dist(0.0f, 1.0f);
+  std::vector<Quaternion> rotations(count);
+  for (auto &q : rotations) {
+    q = Quaternion(dist(rng), dist(rng), dist(rng), dist(rng)).Normalized();
+  }
+  return rotations;
+}
+
+static std::vector<Vec3> RandomVectors(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+  std::vector<Vec3> vectors(count);
+  for (auto &v : vectors) {
+    v = Vec3(dist(rng), dist(rng), dist(rng));
+  }
+  return vectors;
+}
+
+// Textbook slerp in double precision along the shorter arc
+static Quaternion ReferenceSlerp(const Quaternion &a, const Quaternion &b,
+                                 float t) {
+  double dot = double(a.x) * b.x + double(a.y) * b.y + double(a.z) * b.z +
+               double(a.w) * b.w;
+  double sign = dot < 0.0 ? -1.0 : 1.0;
+  dot = std::min(std::abs(dot), 1.0);
+  double theta = std::acos(dot);
+  double wa = 1.0 - t, wb = t;
+  if (theta > 1e-9) {
+    wa = std::sin((1.0 - t) * theta) / std::sin(theta);
+    wb = std::sin(t * theta) / std::sin(theta);
+  }
+  wb *= sign;
+  return Quaternion(static_cast<float>(wa * a.x + wb * b.x),
+                    static_cast<float>(wa * a.y + wb * b.y),
+                    static_cast<float>(wa * a.z + wb * b.z),
+                    static_cast<float>(wa * a.w + wb * b.w));
+}
+
+//============================================================================
+// Accuracy Tests
+//============================================================================
+bool TestScalarAccuracy() {
+  Logger::Info("QuaternionBatchTests", "Testing scalar accuracy...");
+
+  std::vector<Quaternion> a = RandomRotations(2000, 1);
+  std::vector<Quaternion> b = RandomRotations(2000, 2);
+  std::vector<Vec3> vectors = RandomVectors(2000, 3);
+
+  // The cross product rotation against the two-product sandwich
+  float rotateError = 0.0f;
+  for (size_t i = 0; i < a.size(); ++i) {
+    Quaternion sandwich =
+        a[i] * Quaternion(vectors[i], 0.0f) * a[i].Conjugate();
+    Vec3 expected(sandwich.x, sandwich.y, sandwich.z);
+    rotateError =
+        std::max(rotateError, MaxError(a[i].RotateVector(vectors[i]),
+                                       expected));
+  }
+
+  // Sweep t, including the endpoints, and nearly parallel pairs where the
+  // exact Slerp switches to Lerp
+  float slerpError = 0.0f;
+  float fastError = 0.0f;
+  for (size_t i = 0; i < a.size(); ++i) {
+    Quaternion target = i % 4 == 0 ? (a[i] + b[i] * 1e-3f).Normalized() : b[i];
+    for (int step = 0; step <= 8; ++step) {
+      float t = step / 8.0f;
+      Quaternion reference = ReferenceSlerp(a[i], target, t);
+      slerpError = std::max(
+          slerpError, MaxError(Quaternion::Slerp(a[i], target, t), reference));
+      fastError = std::max(fastError, MaxError(Quaternion::SlerpFast(
+                                                   a[i], target, t),
+                                               reference));
+    }
+  }
+
+  Logger::Info("QuaternionBatchTests",
+               "Max error: RotateVector " + Scientific(rotateError) +
+                   ", Slerp " + Scientific(slerpError) + ", SlerpFast " +
+                   Scientific(fastError));
+  TEST_ASSERT(rotateError < 1e-4f, "RotateVector matches q v q*");
+  TEST_ASSERT(fastError < 1e-5f, "SlerpFast within 1e-5 of slerp");
+
+  Quaternion q = RandomRotations(1, 4)[0];
+  TEST_ASSERT(MaxError(Quaternion::SlerpFast(q, -q, 0.5f), q) < 1e-6f,
+              "SlerpFast takes the shorter arc");
+  TEST_ASSERT(MaxError(Quaternion::SlerpFast(q, b[0], 0.0f), q) < 1e-6f &&
+                  MaxError(Quaternion::SlerpFast(q, b[0], 1.0f), b[0]) <
+                      1e-5f,
+              "SlerpFast hits the endpoints");
+
+  Logger::Info("QuaternionBatchTests", "✅ Scalar accuracy tests passed!");
+  return true;
+}
+
+//============================================================================
+// Batch Consistency Tests
+//============================================================================
+bool TestBatchMatchesScalar() {
+  Logger::Info("QuaternionBatchTests",
+               "Testing every kernel level against scalar...");
+
+  std::vector<Quaternion> a = RandomRotations(48, 5);
+  std::vector<Quaternion> b = RandomRotations(48, 6);
+  std::vector<Vec3> vectors = RandomVectors(48, 7);
+  const float t = 0.3f;
+
+  const SimdLevel levels[] = {SimdLevel::Scalar, SimdLevel::SSE2,
+                              SimdLevel::SSE41, SimdLevel::AVX2,
+                              SimdLevel::AVX512};
+  for (SimdLevel level : levels) {
+    const MathKernelTable *table = MathKernels::GetTable(level);
+    if (!table) {
+      continue;
+    }
+    std::string name = GetSimdLevelName(level);
+
+    // Every count up to a few packets, so each tail length is covered
+    for (size_t count = 0; count <= 19; ++count) {
+      std::vector<Quaternion> q(count + 1, Quaternion(7, 7, 7, 7));
+      table->MultiplyQuaternions(a.data(), b.data(), q.data(), count);
+      for (size_t i = 0; i < count; ++i) {
+        TEST_ASSERT(MaxError(q[i], a[i] * b[i]) < 1e-6f,
+                    name + " multiply matches scalar");
+      }
+      TEST_ASSERT(q[count].x == 7.0f, name + " multiply stays in bounds");
+
+      table->LerpQuaternions(a.data(), b.data(), t, q.data(), count);
+      for (size_t i = 0; i < count; ++i) {
+        TEST_ASSERT(MaxError(q[i], Quaternion::Lerp(a[i], b[i], t)) < 1e-6f,
+                    name + " lerp matches scalar");
+      }
+
+      table->SlerpQuaternions(a.data(), b.data(), t, q.data(), count);
+      for (size_t i = 0; i < count; ++i) {
+        TEST_ASSERT(MaxError(q[i], Quaternion::SlerpFast(a[i], b[i], t)) <
+                        1e-6f,
+                    name + " slerp matches scalar");
+      }
+      TEST_ASSERT(q[count].x == 7.0f, name + " slerp stays in bounds");
+
+      std::vector<Vec3> rotated(count + 1, Vec3(7.0f));
+      table->RotateVectors(a.data(), vectors.data(), rotated.data(), count);
+      for (size_t i = 0; i < count; ++i) {
+        TEST_ASSERT(MaxError(rotated[i], a[i].RotateVector(vectors[i])) <
+                            1e-5f &&
+                        rotated[i].w == 0.0f,
+                    name + " rotate matches scalar");
+      }
+      TEST_ASSERT(rotated[count].x == 7.0f, name + " rotate stays in bounds");
+
+      std::vector<Mat4> matrices(count + 1, Mat4(7.0f));
+      table->QuaternionsToMatrices(a.data(), matrices.data(), count);
+      for (size_t i = 0; i < count; ++i) {
+        TEST_ASSERT(MaxError(matrices[i], a[i].ToMatrix()) < 1e-6f,
+                    name + " ToMatrix matches scalar");
+      }
+      TEST_ASSERT(matrices[count].data[0] == 7.0f,
+                  name + " ToMatrix stays in bounds");
+    }
+
+    // In place, e.g. accumulating a parent rotation into each child
+    std::vector<Quaternion> chain = b;
+    table->MultiplyQuaternions(a.data(), chain.data(), chain.data(),
+                               chain.size());
+    for (size_t i = 0; i < chain.size(); ++i) {
+      TEST_ASSERT(MaxError(chain[i], a[i] * b[i]) < 1e-6f,
+                  name + " in-place multiply matches scalar");
+    }
+  }
+
+  // The Span front end on the active table
+  std::vector<Mat4> matrices(a.size());
+  Quaternion::ToMatrices(a, matrices);
+  std::vector<Vec3> rotated(vectors.size());
+  Quaternion::RotateVectors(a, vectors, rotated);
+  TEST_ASSERT(MaxError(matrices[5].TransformVector(vectors[5]), rotated[5]) <
+                  1e-4f,
+              "Matrix and quaternion rotations agree");
+
+  Logger::Info("QuaternionBatchTests", "✅ Batch consistency tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("QuaternionBatchTests", "Starting quaternion batch tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestScalarAccuracy();
+  allPassed &= TestBatchMatchesScalar();
+
+  if (allPassed) {
+    Logger::Info("QuaternionBatchTests",
+                 "🎉 ALL QUATERNION BATCH TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("QuaternionBatchTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,608 @@
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include "Math/Noise.h"
+#include "Math/Random.h"
+#include "Math/Sequences.h"
+#include "MathTestUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+using namespace Engine::Test;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("RandomNoiseTests", std::string("FAILED: ") + message);      \
+    return false;                                                              \
+  }
+
+static std::vector<float> RandomCoordinates(size_t count, uint32_t seed,
+                                            float range) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist(-range, range);
+  std::vector<float> values(count);
+  for (float &value : values) {
+    value = dist(rng);
+  }
+  return values;
+}
+
+// xoshiro128+ as published, for checking RandomStream
+struct ReferenceXoshiro {
+  uint32_t s[4];
+
+  uint32_t Next() {
+    uint32_t result = s[0] + s[3];
+    uint32_t t = s[1] << 9;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 11) | (s[3] >> 21);
+    return result;
+  }
+};
+
+// Chi-square statistic of 'count' draws over 'buckets' equal buckets
+template <typename Draw>
+static double ChiSquare(int buckets, int count, Draw &&draw) {
+  std::vector<int> histogram(buckets, 0);
+  for (int i = 0; i < count; ++i) {
+    float value = draw();
+    int bucket = std::min(static_cast<int>(value * buckets), buckets - 1);
+    histogram[bucket]++;
+  }
+  double expected = static_cast<double>(count) / buckets, chi = 0.0;
+  for (int observed : histogram) {
+    chi += (observed - expected) * (observed - expected) / expected;
+  }
+  return chi;
+}
+
+//============================================================================
+// Random number generators
+//============================================================================
+bool TestPcg32() {
+  Logger::Info("RandomNoiseTests", "Testing Pcg32...");
+
+  // Known answers from the reference pcg32-demo
+  Pcg32 pcg(42, 54);
+  const uint32_t expected[] = {0xa15c02b7u, 0x7b47f409u, 0xba1d3330u,
+                               0x83d2f293u, 0xbfa4784bu, 0xcbed606eu};
+  for (uint32_t value : expected) {
+    TEST_ASSERT(pcg.Next() == value,
+                "Pcg32 should match the reference sequence");
+  }
+
+  // Advance skips exactly that many outputs
+  Pcg32 stepped(7, 3), skipped(7, 3);
+  for (int i = 0; i < 1000; ++i) {
+    stepped.Next();
+  }
+  skipped.Advance(1000);
+  TEST_ASSERT(stepped.Next() == skipped.Next(),
+              "Advance(n) should equal n calls to Next()");
+
+  // Streams sharing a seed are different sequences
+  Pcg32 streamA(7, 0), streamB(7, 1);
+  int same = 0;
+  for (int i = 0; i < 64; ++i) {
+    same += streamA.Next() == streamB.Next();
+  }
+  TEST_ASSERT(same < 4, "Different streams should not share outputs");
+
+  // Bounded draws stay in range and cover it
+  Pcg32 bounded(11);
+  std::vector<int> seen(7, 0);
+  for (int i = 0; i < 7000; ++i) {
+    uint32_t value = bounded.NextBounded(7);
+    TEST_ASSERT(value < 7, "NextBounded should stay below the bound");
+    seen[value]++;
+  }
+  TEST_ASSERT(*std::min_element(seen.begin(), seen.end()) > 850,
+              "NextBounded should cover the range evenly");
+
+  Pcg32 uniform(5);
+  double chi = ChiSquare(64, 640000, [&]() { return uniform.NextFloat(); });
+  TEST_ASSERT(chi < 110.0, "Pcg32::NextFloat should be uniform (chi2 " +
+                               std::to_string(chi) + ")");
+
+  // Drives <random> distributions as a URBG
+  Pcg32 urbg(3);
+  std::uniform_int_distribution<int> dice(1, 6);
+  int roll = dice(urbg);
+  TEST_ASSERT(roll >= 1 && roll <= 6, "Pcg32 should work as a URBG");
+
+  Logger::Info("RandomNoiseTests", "✅ Pcg32 tests passed!");
+  return true;
+}
+
+bool TestRandomStream() {
+  Logger::Info("RandomNoiseTests", "Testing RandomStream...");
+
+  // RandomStream<float> is xoshiro128+ seeded through SplitMix64
+  {
+    RandomStream<float> stream(99, 5);
+    SplitMix64 mix(99 ^ SplitMix64(5).Next());
+    uint64_t a = mix.Next(), b = mix.Next();
+    ReferenceXoshiro reference{{static_cast<uint32_t>(a),
+                                static_cast<uint32_t>(a >> 32),
+                                static_cast<uint32_t>(b),
+                                static_cast<uint32_t>(b >> 32)}};
+    for (int i = 0; i < 100; ++i) {
+      TEST_ASSERT(stream.Next() == reference.Next(),
+                  "RandomStream<float> should match reference xoshiro128+");
+    }
+  }
+
+  // Each lane of a wide stream is the matching scalar stream
+  {
+    RandomStream<SimdFloat4> wide4(1234, 3);
+    RandomStream<SimdFloat8> wide8(1234, 3);
+    std::vector<RandomStream<float>> lanes4, lanes8;
+    for (int lane = 0; lane < 4; ++lane) {
+      lanes4.emplace_back(1234, 3 * 4 + lane);
+    }
+    for (int lane = 0; lane < 8; ++lane) {
+      lanes8.emplace_back(1234, 3 * 8 + lane);
+    }
+    for (int i = 0; i < 50; ++i) {
+      SimdInt4 value4 = wide4.Next();
+      SimdInt8 value8 = wide8.Next();
+      for (int lane = 0; lane < 4; ++lane) {
+        TEST_ASSERT(value4[lane] == lanes4[lane].Next(),
+                    "SimdFloat4 lanes should match the scalar streams");
+      }
+      for (int lane = 0; lane < 8; ++lane) {
+        TEST_ASSERT(value8[lane] == lanes8[lane].Next(),
+                    "SimdFloat8 lanes should match the scalar streams");
+      }
+    }
+  }
+
+  // Floats stay in [min, max) and fill it evenly
+  {
+    RandomStream<SimdFloat8> stream(77);
+    std::vector<float> values;
+    for (int i = 0; i < 80000; ++i) {
+      SimdFloat8 value = stream.NextFloat(SimdFloat8(-2.0f), SimdFloat8(3.0f));
+      for (int lane = 0; lane < 8; ++lane) {
+        values.push_back(value[lane]);
+      }
+    }
+    auto range = std::minmax_element(values.begin(), values.end());
+    TEST_ASSERT(*range.first >= -2.0f && *range.second < 3.0f,
+                "NextFloat(min, max) should stay in [min, max)");
+    size_t next = 0;
+    double chi = ChiSquare(64, static_cast<int>(values.size()), [&]() {
+      return (values[next++] + 2.0f) / 5.0f;
+    });
+    TEST_ASSERT(chi < 110.0, "RandomStream::NextFloat should be uniform "
+                             "(chi2 " + std::to_string(chi) + ")");
+  }
+
+  Logger::Info("RandomNoiseTests", "✅ RandomStream tests passed!");
+  return true;
+}
+
+bool TestThreadRandom() {
+  Logger::Info("RandomNoiseTests", "Testing per-thread generators...");
+
+  SetRandomSeed(2024);
+  TEST_ASSERT(GetRandomSeed() == 2024, "SetRandomSeed should be visible");
+
+  // Threads seeded after SetRandomSeed take streams 0, 1, ... in order
+  uint32_t first = 0, second = 0;
+  std::thread([&]() { first = ThreadRandom().Next(); }).join();
+  std::thread([&]() { second = ThreadRandom().Next(); }).join();
+  TEST_ASSERT(first == Pcg32(2024, 0).Next() &&
+                  second == Pcg32(2024, 1).Next(),
+              "Per-thread generators should use the seed and thread order");
+  TEST_ASSERT(first != second, "Threads should get different streams");
+
+  // The same thread keeps its generator
+  uint32_t a = 0, b = 0;
+  std::thread([&]() {
+    Pcg32 &generator = ThreadRandom();
+    a = generator.Next();
+    b = ThreadRandom().Next();
+  }).join();
+  TEST_ASSERT(a != b, "A thread's generator should advance between calls");
+
+  // Wide per-thread streams differ across threads too
+  uint32_t laneA = 0, laneB = 0;
+  std::thread([&]() { laneA = ThreadRandomStream<SimdFloat8>().Next()[0]; })
+      .join();
+  std::thread([&]() { laneB = ThreadRandomStream<SimdFloat8>().Next()[0]; })
+      .join();
+  TEST_ASSERT(laneA != laneB, "Per-thread streams should differ");
+
+  Logger::Info("RandomNoiseTests", "✅ Per-thread generator tests passed!");
+  return true;
+}
+
+//============================================================================
+// Noise
+//============================================================================
+// Noise at (x, y[, z[, w]]) in 'dimensions' dimensions through F
+template <typename F>
+static F NoiseAt(const NoiseSettings &settings, int dimensions, F x, F y, F z,
+                 F w) {
+  if (dimensions == 2) {
+    return Noise::Evaluate(settings, x, y);
+  }
+  if (dimensions == 3) {
+    return Noise::Evaluate(settings, x, y, z);
+  }
+  return Noise::Evaluate(settings, x, y, z, w);
+}
+
+static std::string Describe(const NoiseSettings &settings, int dimensions) {
+  const char *type = settings.Type == NoiseType::Value ? "Value" : "Simplex";
+  const char *fractals[] = {"", " FBm", " Ridged"};
+  return std::string(type) + std::to_string(dimensions) + "D" +
+         fractals[static_cast<int>(settings.Fractal)];
+}
+
+static std::vector<NoiseSettings> AllSettings() {
+  std::vector<NoiseSettings> all;
+  for (NoiseType type : {NoiseType::Value, NoiseType::Simplex}) {
+    for (FractalType fractal :
+         {FractalType::None, FractalType::FBm, FractalType::Ridged}) {
+      NoiseSettings settings;
+      settings.Type = type;
+      settings.Fractal = fractal;
+      settings.Seed = 17;
+      settings.Frequency = 0.37f;
+      all.push_back(settings);
+    }
+  }
+  return all;
+}
+
+bool TestNoiseValues() {
+  Logger::Info("RandomNoiseTests", "Testing noise values...");
+
+  const size_t count = 20000;
+  std::vector<float> x = RandomCoordinates(count, 1, 300.0f);
+  std::vector<float> y = RandomCoordinates(count, 2, 300.0f);
+  std::vector<float> z = RandomCoordinates(count, 3, 300.0f);
+  std::vector<float> w = RandomCoordinates(count, 4, 300.0f);
+
+  for (const NoiseSettings &settings : AllSettings()) {
+    for (int dimensions = 2; dimensions <= 4; ++dimensions) {
+      std::string name = Describe(settings, dimensions);
+      bool ridged = settings.Fractal == FractalType::Ridged;
+      float low = 1.0f, high = -1.0f, maxError = 0.0f;
+      for (size_t i = 0; i + 8 <= count; i += 8) {
+        SimdFloat8 wide =
+            NoiseAt(settings, dimensions, SimdFloat8::LoadU(&x[i]),
+                    SimdFloat8::LoadU(&y[i]), SimdFloat8::LoadU(&z[i]),
+                    SimdFloat8::LoadU(&w[i]));
+        SimdFloat4 narrow =
+            NoiseAt(settings, dimensions, SimdFloat4::LoadU(&x[i]),
+                    SimdFloat4::LoadU(&y[i]), SimdFloat4::LoadU(&z[i]),
+                    SimdFloat4::LoadU(&w[i]));
+        for (int lane = 0; lane < 8; ++lane) {
+          size_t j = i + lane;
+          float scalar = NoiseAt(settings, dimensions, x[j], y[j], z[j], w[j]);
+          maxError = std::max(maxError, std::fabs(wide[lane] - scalar));
+          if (lane < 4) {
+            maxError = std::max(maxError, std::fabs(narrow[lane] - scalar));
+          }
+          low = std::min(low, scalar);
+          high = std::max(high, scalar);
+        }
+      }
+      TEST_ASSERT(maxError < 1e-5f,
+                  name + ": float and SIMD lanes should agree (error " +
+                      std::to_string(maxError) + ")");
+      TEST_ASSERT(low >= (ridged ? 0.0f : -1.0f) && high <= 1.0f,
+                  name + " should stay in range");
+      TEST_ASSERT(high - low > (ridged ? 0.3f : 0.8f),
+                  name + " should use most of its range");
+    }
+  }
+
+  // Continuous: short steps give small changes, also across cell edges
+  for (NoiseType type : {NoiseType::Value, NoiseType::Simplex}) {
+    NoiseSettings settings;
+    settings.Type = type;
+    for (int dimensions = 2; dimensions <= 4; ++dimensions) {
+      float maxStep = 0.0f;
+      const float step = 1e-3f;
+      for (size_t line = 0; line < 200; ++line) {
+        float p[4] = {x[line] * 0.1f, y[line] * 0.1f, z[line] * 0.1f,
+                      w[line] * 0.1f};
+        float previous = NoiseAt(settings, dimensions, p[0], p[1], p[2], p[3]);
+        for (int i = 0; i < 2000; ++i) {
+          p[i % dimensions] += step;
+          float value = NoiseAt(settings, dimensions, p[0], p[1], p[2], p[3]);
+          maxStep = std::max(maxStep, std::fabs(value - previous));
+          previous = value;
+        }
+      }
+      TEST_ASSERT(maxStep < 0.05f, Describe(settings, dimensions) +
+                                       " should be continuous (step " +
+                                       std::to_string(maxStep) + ")");
+    }
+  }
+
+  // Simplex vanishes on the lattice; value noise hits its lattice values
+  TEST_ASSERT(Noise::Simplex(0.0f, 0.0f) == 0.0f &&
+                  Noise::Simplex(3.0f, -5.0f, 2.0f) == 0.0f,
+              "Simplex noise should be zero at lattice points");
+  float lattice = Noise::Value(4.0f, -2.0f);
+  TEST_ASSERT(std::fabs(Noise::Value(4.0001f, -2.0f) - lattice) < 1e-3f &&
+                  lattice != Noise::Value(5.0f, -2.0f),
+              "Value noise should interpolate the lattice values");
+
+  // Different seeds give unrelated fields
+  float difference = 0.0f;
+  for (size_t i = 0; i < 1000; ++i) {
+    difference += std::fabs(Noise::Simplex(x[i], y[i], z[i], 1u) -
+                            Noise::Simplex(x[i], y[i], z[i], 2u));
+  }
+  TEST_ASSERT(difference / 1000.0f > 0.1f,
+              "Different seeds should give different noise");
+
+  Logger::Info("RandomNoiseTests", "✅ Noise value tests passed!");
+  return true;
+}
+
+bool TestNoiseKernels() {
+  Logger::Info("RandomNoiseTests", "Testing noise kernels...");
+
+  const size_t maxCount = 1000;
+  std::vector<float> x = RandomCoordinates(maxCount, 5, 50.0f);
+  std::vector<float> y = RandomCoordinates(maxCount, 6, 50.0f);
+  std::vector<float> z = RandomCoordinates(maxCount, 7, 50.0f);
+  std::vector<float> w = RandomCoordinates(maxCount, 8, 50.0f);
+  std::vector<float> out(maxCount + 1), expected(maxCount);
+
+  std::vector<size_t> counts;
+  for (size_t count = 0; count <= 19; ++count) {
+    counts.push_back(count);
+  }
+  counts.push_back(maxCount);
+
+  for (const MathKernelTable *table : AvailableTables()) {
+    for (const NoiseSettings &settings : AllSettings()) {
+      for (int dimensions = 2; dimensions <= 4; ++dimensions) {
+        std::string name = Name(table) + " " + Describe(settings, dimensions);
+        for (size_t count : counts) {
+          out[count] = -7.0f;
+          if (dimensions == 2) {
+            table->Noise2(settings, x.data(), y.data(), out.data(), count);
+          } else if (dimensions == 3) {
+            table->Noise3(settings, x.data(), y.data(), z.data(), out.data(),
+                          count);
+          } else {
+            table->Noise4(settings, x.data(), y.data(), z.data(), w.data(),
+                          out.data(), count);
+          }
+          for (size_t i = 0; i < count; ++i) {
+            float scalar =
+                NoiseAt(settings, dimensions, x[i], y[i], z[i], w[i]);
+            TEST_ASSERT(std::fabs(out[i] - scalar) < 1e-5f,
+                        name + " should match per-sample evaluation");
+          }
+          TEST_ASSERT(out[count] == -7.0f,
+                      name + " should not write past the count");
+        }
+      }
+    }
+  }
+
+  // The Span wrappers use the active table and the shortest input
+  NoiseSettings settings;
+  settings.Fractal = FractalType::FBm;
+  EvaluateNoise(settings, x, y, Span<float>(expected.data(), 100));
+  for (size_t i = 0; i < 100; ++i) {
+    TEST_ASSERT(std::fabs(expected[i] - Noise::Evaluate(settings, x[i],
+                                                        y[i])) < 1e-5f,
+                "EvaluateNoise should fill the output span");
+  }
+
+  Logger::Info("RandomNoiseTests", "✅ Noise kernel tests passed!");
+  return true;
+}
+
+//============================================================================
+// Low-discrepancy sequences
+//============================================================================
+// True if points [start, start + 2^m) hit each interval of width 2^-m once
+static bool Stratified(uint32_t start, int m,
+                       float (*sequence)(uint32_t, int, uint32_t),
+                       int dimension, uint32_t scramble) {
+  uint32_t cells = 1u << m;
+  std::vector<bool> hit(cells, false);
+  for (uint32_t i = 0; i < cells; ++i) {
+    float value = sequence(start + i, dimension, scramble);
+    uint32_t cell = static_cast<uint32_t>(value * cells);
+    if (cell >= cells || hit[cell]) {
+      return false;
+    }
+    hit[cell] = true;
+  }
+  return true;
+}
+
+bool TestSequences() {
+  Logger::Info("RandomNoiseTests", "Testing low-discrepancy sequences...");
+
+  // Radical inverses
+  const float base2[] = {0.0f, 0.5f, 0.25f, 0.75f, 0.125f, 0.625f};
+  const float base3[] = {0.0f, 1.0f / 3.0f, 2.0f / 3.0f, 1.0f / 9.0f,
+                         4.0f / 9.0f, 7.0f / 9.0f};
+  for (uint32_t i = 0; i < 6; ++i) {
+    TEST_ASSERT(Halton(i, 0) == base2[i], "Halton base 2 mismatch");
+    TEST_ASSERT(std::fabs(Halton(i, 1) - base3[i]) < 1e-7f,
+                "Halton base 3 mismatch");
+    TEST_ASSERT(Halton2(i).x == Halton(i, 0) && Halton2(i).y == Halton(i, 1),
+                "Halton2 should be dimensions 0 and 1");
+  }
+  for (uint32_t i = 0; i < 4096; ++i) {
+    TEST_ASSERT(VanDerCorput(i) == Halton(i, 0) &&
+                    Sobol(i, 0) == VanDerCorput(i),
+                "Van der Corput, Halton base 2 and Sobol 0 should agree");
+  }
+  for (int dimension = 0; dimension < kHaltonDimensions; ++dimension) {
+    float value = Halton(0xFFFFFFFFu, dimension);
+    TEST_ASSERT(value >= 0.0f && value < 1.0f, "Halton should stay below 1");
+  }
+  TEST_ASSERT(ReverseBits(1u) == 0x80000000u &&
+                  ReverseBits(0x0000F00Du) == 0xB00F0000u,
+              "ReverseBits mismatch");
+
+  // Sobol dimension 1 in index (not Gray code) order
+  const float sobol1[] = {0.0f, 0.5f, 0.75f, 0.25f, 0.625f, 0.125f};
+  for (uint32_t i = 0; i < 6; ++i) {
+    TEST_ASSERT(Sobol(i, 1) == sobol1[i], "Sobol dimension 1 mismatch");
+  }
+
+  // Every dimension is stratified in aligned blocks, scrambled or not
+  for (int dimension = 0; dimension < kSobolDimensions; ++dimension) {
+    for (int m = 1; m <= 10; ++m) {
+      for (uint32_t scramble : {0u, 0x9E3779B9u}) {
+        TEST_ASSERT(Stratified(3u << m, m, Sobol, dimension, scramble),
+                    "Sobol dimension " + std::to_string(dimension) +
+                        " should be stratified in blocks of 2^" +
+                        std::to_string(m));
+      }
+    }
+  }
+
+  // Dimensions 0 and 1 form a (0, m, 2)-net: one point per elementary
+  // box of every shape 2^-a x 2^-(m-a)
+  const int m = 8;
+  for (int a = 0; a <= m; ++a) {
+    std::vector<bool> hit(1u << m, false);
+    for (uint32_t i = 0; i < (1u << m); ++i) {
+      Vec2 p = Sobol2(i, 0x12345678u);
+      uint32_t cell = (static_cast<uint32_t>(p.x * (1u << a)) << (m - a)) |
+                      static_cast<uint32_t>(p.y * (1u << (m - a)));
+      TEST_ASSERT(!hit[cell], "Sobol2 should form a (0, m, 2)-net");
+      hit[cell] = true;
+    }
+  }
+
+  Logger::Info("RandomNoiseTests", "✅ Sequence tests passed!");
+  return true;
+}
+
+// Mean distance from each of the first 'count' points to its nearest
+// neighbor on the torus
+static float MeanNearestDistance(const std::vector<Vec2> &points, int size) {
+  float total = 0.0f;
+  for (size_t i = 0; i < points.size(); ++i) {
+    float nearest = 1e30f;
+    for (size_t j = 0; j < points.size(); ++j) {
+      if (i == j) {
+        continue;
+      }
+      float dx = std::fabs(points[i].x - points[j].x);
+      float dy = std::fabs(points[i].y - points[j].y);
+      dx = std::min(dx, size - dx);
+      dy = std::min(dy, size - dy);
+      nearest = std::min(nearest, dx * dx + dy * dy);
+    }
+    total += std::sqrt(nearest);
+  }
+  return total / points.size();
+}
+
+bool TestBlueNoise() {
+  Logger::Info("RandomNoiseTests", "Testing blue-noise tiles...");
+
+  const int size = 32;
+  BlueNoiseTile tile(size, 1);
+  TEST_ASSERT(tile.GetSize() == size &&
+                  tile.GetValues().size() == size * size,
+              "Tile should hold size^2 values");
+
+  // Each rank exactly once
+  std::vector<float> sorted(tile.GetValues().begin(), tile.GetValues().end());
+  std::sort(sorted.begin(), sorted.end());
+  for (int i = 0; i < size * size; ++i) {
+    TEST_ASSERT(sorted[i] == static_cast<float>(i) / (size * size),
+                "Tile values should be a permutation of k / size^2");
+  }
+
+  TEST_ASSERT(tile.Sample(3, 5) == tile.Sample(3 + size, 5 + 2 * size),
+              "Sample should wrap");
+  BlueNoiseTile same(size, 1), other(size, 2);
+  TEST_ASSERT(std::equal(same.GetValues().begin(), same.GetValues().end(),
+                         tile.GetValues().begin()),
+              "Tiles should be deterministic per seed");
+  TEST_ASSERT(!std::equal(other.GetValues().begin(), other.GetValues().end(),
+                          tile.GetValues().begin()),
+              "Different seeds should give different tiles");
+
+  // Thresholded at 10% the texels spread out far more than white noise
+  const int pointCount = size * size / 10;
+  std::vector<Vec2> blue, white;
+  Pcg32 random(9);
+  for (int y = 0; y < size; ++y) {
+    for (int x = 0; x < size; ++x) {
+      if (tile.Sample(x, y) < static_cast<float>(pointCount) / (size * size)) {
+        blue.emplace_back(static_cast<float>(x), static_cast<float>(y));
+      }
+    }
+  }
+  for (int i = 0; i < pointCount; ++i) {
+    white.emplace_back(static_cast<float>(random.NextBounded(size)),
+                       static_cast<float>(random.NextBounded(size)));
+  }
+  float blueDistance = MeanNearestDistance(blue, size);
+  float whiteDistance = MeanNearestDistance(white, size);
+  TEST_ASSERT(blueDistance > 1.5f * whiteDistance,
+              "Blue noise should spread points out (" +
+                  std::to_string(blueDistance) + " vs white " +
+                  std::to_string(whiteDistance) + ")");
+
+  // Temporal offset keeps values in [0, 1) and changes every frame
+  for (uint32_t frame = 0; frame < 64; ++frame) {
+    float value = tile.Sample(7, 9, frame);
+    TEST_ASSERT(value >= 0.0f && value < 1.0f,
+                "Animated samples should stay in [0, 1)");
+    TEST_ASSERT(frame == 0 || value != tile.Sample(7, 9, frame - 1),
+                "Animated samples should change per frame");
+  }
+  TEST_ASSERT(tile.Sample(7, 9, 0) == tile.Sample(7, 9),
+              "Frame 0 should be the tile value");
+
+  Logger::Info("RandomNoiseTests", "✅ Blue-noise tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("RandomNoiseTests", "Starting random and noise tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestPcg32();
+  allPassed &= TestRandomStream();
+  allPassed &= TestThreadRandom();
+  allPassed &= TestNoiseValues();
+  allPassed &= TestNoiseKernels();
+  allPassed &= TestSequences();
+  allPassed &= TestBlueNoise();
+
+  if (allPassed) {
+    Logger::Info("RandomNoiseTests", "🎉 ALL RANDOM AND NOISE TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("RandomNoiseTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,318 @@
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include "Math/RayPacket.h"
+#include "MathTestUtils.h"
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+using namespace Engine::Test;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("RayPacketTests", std::string("FAILED: ") + message);        \
+    return false;                                                              \
+  }
+
+static bool Close(float a, float b, float tolerance = 1e-4f) {
+  return std::abs(a - b) <= tolerance * std::max(1.0f, std::abs(b));
+}
+
+// Rays from around the origin toward a cluster of primitives at -Z
+struct TestScene {
+  std::vector<Ray> rays;
+  std::vector<AABB> boxes;
+  std::vector<Sphere> spheres;
+  std::vector<Vec3> vertices;
+  std::vector<uint32_t> indices;
+};
+
+static TestScene MakeScene(size_t rayCount, size_t primitiveCount,
+                           uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> spread(-1.0f, 1.0f);
+  std::uniform_real_distribution<float> lateral(-12.0f, 12.0f);
+  std::uniform_real_distribution<float> depth(-40.0f, -5.0f);
+  std::uniform_real_distribution<float> size(0.2f, 2.0f);
+
+  TestScene scene;
+  for (size_t i = 0; i < rayCount; ++i) {
+    Vec3 origin(spread(rng), spread(rng), spread(rng));
+    Vec3 direction(spread(rng) * 0.4f, spread(rng) * 0.4f, -1.0f);
+    scene.rays.push_back(Ray(origin, direction));
+  }
+  for (size_t i = 0; i < primitiveCount; ++i) {
+    Vec3 center(lateral(rng), lateral(rng), depth(rng));
+    Vec3 extent(size(rng), size(rng), size(rng));
+    scene.boxes.push_back(AABB(center - extent, center + extent));
+    scene.spheres.push_back(Sphere(center, size(rng)));
+
+    uint32_t base = static_cast<uint32_t>(scene.vertices.size());
+    for (int corner = 0; corner < 3; ++corner) {
+      scene.vertices.push_back(
+          center + Vec3(spread(rng), spread(rng), spread(rng)) * 3.0f);
+      scene.indices.push_back(base + corner);
+    }
+  }
+  return scene;
+}
+
+// How far a ray is from the edge of a sphere or triangle hit, in double
+// precision. Packets and Ray may round differently only when this is within
+// float noise of zero.
+static double SphereMargin(const Ray &ray, const Sphere &sphere) {
+  double oc[3] = {double(ray.origin.x) - sphere.center.x,
+                  double(ray.origin.y) - sphere.center.y,
+                  double(ray.origin.z) - sphere.center.z};
+  double d[3] = {ray.direction.x, ray.direction.y, ray.direction.z};
+  double a = d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+  double b = oc[0] * d[0] + oc[1] * d[1] + oc[2] * d[2];
+  double radiusSquared = double(sphere.radius) * sphere.radius;
+  double c = oc[0] * oc[0] + oc[1] * oc[1] + oc[2] * oc[2] - radiusSquared;
+
+  // Tangent rays, and origins on the surface
+  double scale = std::max(radiusSquared, 1.0);
+  return std::min(std::abs(b * b - a * c), std::abs(c)) / scale;
+}
+
+static double TriangleMargin(const Ray &ray, const Vec3 &v0, const Vec3 &v1,
+                             const Vec3 &v2) {
+  auto sub = [](const Vec3 &a, const Vec3 &b, double (&out)[3]) {
+    out[0] = double(a.x) - b.x;
+    out[1] = double(a.y) - b.y;
+    out[2] = double(a.z) - b.z;
+  };
+  auto cross = [](const double (&a)[3], const double (&b)[3],
+                  double (&out)[3]) {
+    out[0] = a[1] * b[2] - a[2] * b[1];
+    out[1] = a[2] * b[0] - a[0] * b[2];
+    out[2] = a[0] * b[1] - a[1] * b[0];
+  };
+  auto dot = [](const double (&a)[3], const double (&b)[3]) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+  };
+
+  double e1[3], e2[3], s[3], p[3], q[3];
+  double d[3] = {ray.direction.x, ray.direction.y, ray.direction.z};
+  sub(v1, v0, e1);
+  sub(v2, v0, e2);
+  sub(ray.origin, v0, s);
+  cross(d, e2, p);
+  double determinant = dot(e1, p);
+  cross(s, e1, q);
+  double u = dot(s, p) / determinant;
+  double v = dot(d, q) / determinant;
+  return std::min({std::abs(u), std::abs(v), std::abs(1.0 - u - v),
+                   std::abs(determinant)});
+}
+
+//============================================================================
+// Packet Lane Tests
+//============================================================================
+template <typename F>
+static bool CheckPackets(const TestScene &scene, const char *label) {
+  const int width = F::Width;
+  std::string name = label;
+  for (size_t r = 0; r + width <= scene.rays.size(); r += width) {
+    RayPacket<F> packet = RayPacket<F>::Load(&scene.rays[r]);
+    for (size_t i = 0; i < scene.boxes.size(); ++i) {
+      F t, u, v;
+      int boxHits = MoveMask(packet.IntersectAABB(scene.boxes[i], t));
+      for (int lane = 0; lane < width; ++lane) {
+        float expected = 0.0f;
+        bool hit = scene.rays[r + lane].IntersectAABB(scene.boxes[i],
+                                                      expected);
+        TEST_ASSERT(hit == (((boxHits >> lane) & 1) != 0),
+                    name + " box hit matches Ray::IntersectAABB");
+        TEST_ASSERT(!hit || t[lane] == expected,
+                    name + " box distance matches Ray::IntersectAABB");
+      }
+
+      const Sphere &sphere = scene.spheres[i];
+      int sphereHits = MoveMask(packet.IntersectSphere(sphere, t));
+      for (int lane = 0; lane < width; ++lane) {
+        const Ray &ray = scene.rays[r + lane];
+        float expected = 0.0f;
+        bool hit = ray.IntersectSphere(sphere, expected);
+        bool packetHit = ((sphereHits >> lane) & 1) != 0;
+        TEST_ASSERT(hit == packetHit || SphereMargin(ray, sphere) < 1e-4,
+                    name + " sphere hit matches Ray::IntersectSphere");
+        TEST_ASSERT(!hit || !packetHit || Close(t[lane], expected),
+                    name + " sphere distance matches Ray::IntersectSphere");
+      }
+
+      const uint32_t *triangle = &scene.indices[3 * i];
+      const Vec3 &v0 = scene.vertices[triangle[0]];
+      const Vec3 &v1 = scene.vertices[triangle[1]];
+      const Vec3 &v2 = scene.vertices[triangle[2]];
+      int triangleHits =
+          MoveMask(packet.IntersectTriangle(v0, v1, v2, t, u, v));
+      for (int lane = 0; lane < width; ++lane) {
+        const Ray &ray = scene.rays[r + lane];
+        float expectedT = 0.0f, expectedU = 0.0f, expectedV = 0.0f;
+        bool hit = ray.IntersectTriangle(v0, v1, v2, expectedT, expectedU,
+                                         expectedV);
+        bool packetHit = ((triangleHits >> lane) & 1) != 0;
+        TEST_ASSERT(hit == packetHit ||
+                        TriangleMargin(ray, v0, v1, v2) < 1e-4,
+                    name + " triangle hit matches Ray::IntersectTriangle");
+        TEST_ASSERT(!hit || !packetHit ||
+                        (Close(t[lane], expectedT) &&
+                         Close(u[lane], expectedU) &&
+                         Close(v[lane], expectedV)),
+                    name + " triangle hit point matches");
+      }
+    }
+  }
+  return true;
+}
+
+bool TestPacketLanes() {
+  Logger::Info("RayPacketTests", "Testing packet lanes against Ray...");
+
+  TestScene scene = MakeScene(256, 64, 1);
+  TEST_ASSERT(CheckPackets<SimdFloat4>(scene, "RayX4"), "RayX4 lanes");
+  TEST_ASSERT(CheckPackets<SimdFloat8>(scene, "RayX8"), "RayX8 lanes");
+
+  // Axis-aligned rays have infinite inverse components on two axes
+  AABB box(Vec3(-1.0f), Vec3(1.0f));
+  const Ray axisRays[4] = {Ray(Vec3(0.5f, 0.5f, 5.0f), -Vec3::UnitZ()),
+                           Ray(Vec3(1.5f, 0.5f, 5.0f), -Vec3::UnitZ()),
+                           Ray(Vec3(-5.0f, 0.0f, 0.25f), Vec3::UnitX()),
+                           Ray(Vec3(0.0f, 0.0f, 0.0f), Vec3::UnitY())};
+  RayX4 packet = RayX4::Load(axisRays);
+  SimdFloat4 t;
+  int hits = MoveMask(packet.IntersectAABB(box, t));
+  TEST_ASSERT(hits == 0xD, "Axis-aligned rays hit the right slabs");
+  TEST_ASSERT(t[0] == 4.0f && t[2] == 4.0f && t[3] == 1.0f,
+              "Axis-aligned distances, inside rays report the exit");
+
+  // Partial loads fill the missing lanes with rays that never hit
+  RayX8 partial = RayX8::Load(axisRays, 3);
+  SimdFloat8 t8;
+  hits = MoveMask(partial.IntersectAABB(AABB(Vec3(-9.0f), Vec3(9.0f)), t8));
+  TEST_ASSERT(hits == 0x7, "Padding lanes of a partial packet miss");
+  hits = MoveMask(partial.IntersectSphere(Sphere(Vec3::Zero(), 9.0f), t8));
+  TEST_ASSERT(hits == 0x7, "Padding lanes miss spheres");
+
+  Logger::Info("RayPacketTests", "✅ Packet lane tests passed!");
+  return true;
+}
+
+//============================================================================
+// Batch Kernel Tests
+//============================================================================
+static bool SameHit(const RayHit &actual, const RayHit &expected) {
+  if (actual.Index == expected.Index) {
+    return !actual.IsHit() ||
+           (Close(actual.T, expected.T) && Close(actual.U, expected.U) &&
+            Close(actual.V, expected.V));
+  }
+  // Another primitive at the same distance, or a grazing hit one side drops
+  return Close(actual.T, expected.T, 1e-3f) || !actual.IsHit() ||
+         !expected.IsHit();
+}
+
+bool TestBatchKernels() {
+  Logger::Info("RayPacketTests", "Testing batch raycast kernels...");
+
+  TestScene scene = MakeScene(203, 48, 2);
+  const MathKernelTable *scalar = MathKernels::GetTable(SimdLevel::Scalar);
+  TEST_ASSERT(scalar, "Scalar table is always available");
+
+  std::vector<RayHit> expected[3];
+  for (auto &hits : expected) {
+    hits.resize(scene.rays.size());
+  }
+  size_t rayCount = scene.rays.size();
+  scalar->RaycastBoxes(scene.rays.data(), expected[0].data(), rayCount,
+                       scene.boxes.data(), scene.boxes.size());
+  scalar->RaycastSpheres(scene.rays.data(), expected[1].data(), rayCount,
+                         scene.spheres.data(), scene.spheres.size());
+  scalar->RaycastTriangles(scene.rays.data(), expected[2].data(), rayCount,
+                           scene.vertices.data(), scene.indices.data(),
+                           scene.spheres.size());
+
+  size_t boxHits = 0;
+  for (size_t r = 0; r < rayCount; ++r) {
+    boxHits += expected[0][r].IsHit() ? 1 : 0;
+  }
+  TEST_ASSERT(boxHits > 0 && boxHits < rayCount,
+              "Test scene has hits and misses");
+
+  for (const MathKernelTable *table : AvailableTables()) {
+    for (size_t count : {rayCount, size_t(0), size_t(1), size_t(7),
+                         size_t(8), size_t(13)}) {
+      std::vector<RayHit> actual[3];
+      for (auto &hits : actual) {
+        hits.resize(count + 1);
+        hits[count] = {-1.0f, 42, 0.0f, 0.0f};
+      }
+      table->RaycastBoxes(scene.rays.data(), actual[0].data(), count,
+                          scene.boxes.data(), scene.boxes.size());
+      table->RaycastSpheres(scene.rays.data(), actual[1].data(), count,
+                            scene.spheres.data(), scene.spheres.size());
+      table->RaycastTriangles(scene.rays.data(), actual[2].data(), count,
+                              scene.vertices.data(), scene.indices.data(),
+                              scene.spheres.size());
+      for (int kind = 0; kind < 3; ++kind) {
+        for (size_t r = 0; r < count; ++r) {
+          TEST_ASSERT(SameHit(actual[kind][r], expected[kind][r]),
+                      Name(table) + " closest hit matches scalar");
+        }
+        TEST_ASSERT(actual[kind][count].Index == 42,
+                    Name(table) + " raycast stays in bounds");
+      }
+    }
+
+    // An existing hit's T bounds the search
+    std::vector<RayHit> bounded(rayCount);
+    for (RayHit &hit : bounded) {
+      hit.T = 20.0f;
+      hit.Index = 1000;
+    }
+    table->RaycastBoxes(scene.rays.data(), bounded.data(), rayCount,
+                        scene.boxes.data(), scene.boxes.size());
+    for (size_t r = 0; r < rayCount; ++r) {
+      const RayHit &reference = expected[0][r];
+      bool closer = reference.IsHit() && reference.T < 20.0f;
+      TEST_ASSERT(closer ? bounded[r].Index == reference.Index
+                         : bounded[r].Index == 1000 && bounded[r].T == 20.0f,
+                  Name(table) + " only closer hits replace existing ones");
+    }
+  }
+
+  // The Span entry points pick the active table
+  std::vector<RayHit> hits(rayCount);
+  Raycast(scene.rays, hits, scene.vertices, scene.indices);
+  for (size_t r = 0; r < rayCount; ++r) {
+    TEST_ASSERT(SameHit(hits[r], expected[2][r]),
+                "Raycast over an indexed mesh matches scalar");
+  }
+
+  Logger::Info("RayPacketTests", "✅ Batch kernel tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("RayPacketTests", "Starting ray packet tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestPacketLanes();
+  allPassed &= TestBatchKernels();
+
+  if (allPassed) {
+    Logger::Info("RayPacketTests", "🎉 ALL RAY PACKET TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("RayPacketTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
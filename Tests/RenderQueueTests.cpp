@@ -0,0 +1,199 @@
+#include "Core/Logger.h"
+#include "Core/RadixSort.h"
+#include "Renderer/RenderQueue.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("RenderQueueTests", std::string("FAILED: ") + message);      \
+    return false;                                                              \
+  }
+
+static std::vector<float> MakeDepths(uint32_t count, uint32_t seed,
+                                     float minDepth, float maxDepth) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist(minDepth, maxDepth);
+  std::vector<float> depths(count);
+  for (auto &depth : depths) {
+    depth = dist(rng);
+  }
+  return depths;
+}
+
+//============================================================================
+// Radix Sort Tests
+//============================================================================
+bool TestFloatKeyOrdering() {
+  Logger::Info("RenderQueueTests", "Testing float key ordering...");
+
+  const float values[] = {-std::numeric_limits<float>::infinity(),
+                          -1e30f,
+                          -2.5f,
+                          -1.0f,
+                          -1e-30f,
+                          -0.0f,
+                          0.0f,
+                          1e-30f,
+                          1.0f,
+                          2.5f,
+                          1e30f,
+                          std::numeric_limits<float>::infinity()};
+  for (size_t i = 1; i < std::size(values); ++i) {
+    TEST_ASSERT(RadixSort::FloatToKey(values[i - 1]) <=
+                    RadixSort::FloatToKey(values[i]),
+                "Keys preserve float ordering at index " + std::to_string(i));
+  }
+  TEST_ASSERT(RadixSort::FloatToKey(-1.0f) < RadixSort::FloatToKey(1.0f),
+              "Negative before positive");
+
+  Logger::Info("RenderQueueTests", "✅ Float key ordering tests passed!");
+  return true;
+}
+
+bool TestRadixSortCorrectness() {
+  Logger::Info("RenderQueueTests", "Testing radix sort correctness...");
+
+  RadixSort sorter;
+
+  // Mixed signs and magnitudes so every pass moves data
+  std::vector<float> keys = MakeDepths(5000, 1, -1000.0f, 1000.0f);
+  keys[10] = 0.0f;
+  keys[20] = -0.0f;
+  keys[30] = 1e-20f;
+
+  const auto &ascending = sorter.Sort(keys.data(), 5000);
+  TEST_ASSERT(ascending.size() == 5000, "Order covers every key");
+  bool sorted = true;
+  for (size_t i = 1; i < ascending.size(); ++i) {
+    sorted &= keys[ascending[i - 1]] <= keys[ascending[i]];
+  }
+  TEST_ASSERT(sorted, "Ascending order");
+
+  std::vector<uint32_t> permutation(ascending);
+  std::sort(permutation.begin(), permutation.end());
+  std::vector<uint32_t> identity(5000);
+  std::iota(identity.begin(), identity.end(), 0u);
+  TEST_ASSERT(permutation == identity, "Result is a permutation");
+
+  const auto &descending =
+      sorter.Sort(keys.data(), 5000, SortOrder::Descending);
+  sorted = true;
+  for (size_t i = 1; i < descending.size(); ++i) {
+    sorted &= keys[descending[i - 1]] >= keys[descending[i]];
+  }
+  TEST_ASSERT(sorted, "Descending order");
+
+  // Equal keys keep submission order in both directions
+  std::vector<float> ties = {3.0f, 1.0f, 3.0f, 1.0f, 3.0f};
+  const auto &stableUp = sorter.Sort(ties.data(), 5);
+  TEST_ASSERT(stableUp == std::vector<uint32_t>({1, 3, 0, 2, 4}),
+              "Stable ascending");
+  const auto &stableDown = sorter.Sort(ties.data(), 5, SortOrder::Descending);
+  TEST_ASSERT(stableDown == std::vector<uint32_t>({0, 2, 4, 1, 3}),
+              "Stable descending");
+
+  TEST_ASSERT(sorter.Sort(nullptr, 0).empty(), "Empty input");
+
+  Logger::Info("RenderQueueTests", "✅ Radix sort correctness tests passed!");
+  return true;
+}
+
+//============================================================================
+// Render Queue Tests
+//============================================================================
+bool TestRenderQueuePasses() {
+  Logger::Info("RenderQueueTests", "Testing render queue passes...");
+
+  RenderQueue queue;
+  TEST_ASSERT(queue.IsSorted(), "Empty queue is sorted");
+
+  const float depths[] = {5.0f, 1.0f, 9.0f, 3.0f, 7.0f, 2.0f};
+  const float alphas[] = {1.0f, 0.5f, 1.0f, 0.25f, 0.75f, 1.0f};
+  for (int i = 0; i < 6; ++i) {
+    RenderCommand command;
+    command.Depth = depths[i];
+    command.Alpha = alphas[i];
+    command.Color = Vec3(static_cast<float>(i), 0.0f, 0.0f);
+    queue.Submit(command);
+  }
+
+  TEST_ASSERT(!queue.IsSorted(), "Submit invalidates order");
+  TEST_ASSERT(queue.GetOpaqueCount() == 3, "Three opaque commands");
+  TEST_ASSERT(queue.GetTransparentCount() == 3, "Three transparent commands");
+
+  queue.Sort();
+  TEST_ASSERT(queue.GetOpaque(0).Depth == 2.0f &&
+                  queue.GetOpaque(1).Depth == 5.0f &&
+                  queue.GetOpaque(2).Depth == 9.0f,
+              "Opaque front-to-back");
+  TEST_ASSERT(queue.GetTransparent(0).Depth == 7.0f &&
+                  queue.GetTransparent(1).Depth == 3.0f &&
+                  queue.GetTransparent(2).Depth == 1.0f,
+              "Transparent back-to-front");
+  TEST_ASSERT(queue.GetTransparent(0).Color.x == 4.0f,
+              "Commands keep their data");
+
+  queue.Clear();
+  TEST_ASSERT(queue.GetOpaqueCount() == 0 && queue.GetTransparentCount() == 0,
+              "Clear empties both passes");
+
+  Logger::Info("RenderQueueTests", "✅ Render queue pass tests passed!");
+  return true;
+}
+
+//============================================================================
+// Reference Comparison
+//============================================================================
+bool TestMatchesStableSort() {
+  Logger::Info("RenderQueueTests", "Testing against std::stable_sort...");
+
+  RadixSort sorter;
+  for (uint32_t count : {1000u, 100000u}) {
+    std::vector<float> depths = MakeDepths(count, count, 0.1f, 500.0f);
+    sorter.Sort(depths.data(), count, SortOrder::Descending);
+
+    std::vector<uint32_t> indices(count);
+    std::iota(indices.begin(), indices.end(), 0u);
+    std::stable_sort(indices.begin(), indices.end(),
+                     [&depths](uint32_t a, uint32_t b) {
+                       return depths[a] > depths[b];
+                     });
+
+    TEST_ASSERT(sorter.GetIndices() == indices,
+                "Radix and comparison sorts agree");
+  }
+
+  Logger::Info("RenderQueueTests", "✅ Reference comparison tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("RenderQueueTests", "Starting render queue tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestFloatKeyOrdering();
+  allPassed &= TestRadixSortCorrectness();
+  allPassed &= TestRenderQueuePasses();
+  allPassed &= TestMatchesStableSort();
+
+  if (allPassed) {
+    Logger::Info("RenderQueueTests", "🎉 ALL RENDER QUEUE TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("RenderQueueTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
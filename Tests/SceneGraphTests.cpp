@@ -0,0 +1,339 @@
+#include "Core/JobSystem.h"
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include "Math/SceneGraph.h"
+#include "MathTestUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+using namespace Engine::Test;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("SceneGraphTests", std::string("FAILED: ") + message);       \
+    return false;                                                              \
+  }
+
+using NodeId = SceneGraph::NodeId;
+
+static Transform MakeLocal(std::mt19937 &rng, float range) {
+  std::uniform_real_distribution<float> position(-range, range);
+  std::uniform_real_distribution<float> angle(0.0f, TWO_PI);
+  std::uniform_real_distribution<float> scale(0.8f, 1.25f);
+  Vec3 axis = Vec3(position(rng), position(rng), position(rng)) + Vec3(0.01f);
+  return Transform(Vec3(position(rng), position(rng), position(rng)),
+                   Quaternion::FromAxisAngle(axis.Normalized(), angle(rng)),
+                   Vec3(scale(rng), scale(rng), scale(rng)));
+}
+
+static AABB MakeBounds(std::mt19937 &rng) {
+  std::uniform_real_distribution<float> extent(0.1f, 2.0f);
+  Vec3 half(extent(rng), extent(rng), extent(rng));
+  return AABB(-half, half);
+}
+
+static bool Near(float a, float b, float tolerance) {
+  return std::abs(a - b) <= tolerance * std::max(1.0f, std::abs(b));
+}
+
+static bool NearTransform(const Affine3x4 &a, const Mat4 &b, float tolerance) {
+  for (int row = 0; row < 3; ++row) {
+    for (int col = 0; col < 4; ++col) {
+      if (!Near(a.m[row][col], b.m[row][col], tolerance)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static bool NearBox(const AABB &a, const AABB &b, float tolerance) {
+  return Near(a.min.x, b.min.x, tolerance) &&
+         Near(a.min.y, b.min.y, tolerance) &&
+         Near(a.min.z, b.min.z, tolerance) &&
+         Near(a.max.x, b.max.x, tolerance) &&
+         Near(a.max.y, b.max.y, tolerance) && Near(a.max.z, b.max.z, tolerance);
+}
+
+// World matrix of a node from its ancestors' locals, one Mat4 product per
+// level
+static Mat4 ReferenceWorld(const SceneGraph &graph, NodeId node) {
+  Mat4 world = graph.GetLocal(node).ToMatrix();
+  for (NodeId parent = graph.GetParent(node); parent != SceneGraph::kNone;
+       parent = graph.GetParent(parent)) {
+    world = graph.GetLocal(parent).ToMatrix() * world;
+  }
+  return world;
+}
+
+// Every node's cached world transform and bounds against the reference, and
+// each parent stored before its children
+static bool MatchesReference(const SceneGraph &graph, float tolerance) {
+  Span<const NodeId> nodes = graph.GetNodes();
+  std::vector<size_t> position;
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    position.resize(std::max<size_t>(position.size(), nodes[i] + 1));
+    position[nodes[i]] = i;
+  }
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    const NodeId node = nodes[i];
+    const NodeId parent = graph.GetParent(node);
+    if (!graph.IsValid(node) ||
+        (parent != SceneGraph::kNone && position[parent] >= i)) {
+      return false;
+    }
+    const Mat4 world = ReferenceWorld(graph, node);
+    if (!NearTransform(graph.GetWorldTransform(node), world, tolerance) ||
+        !NearBox(graph.GetWorldBounds(node),
+                 graph.GetLocalBounds(node).Transformed(world), tolerance)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Nodes in and under 'node'
+static size_t SubtreeSize(const SceneGraph &graph, NodeId node) {
+  size_t count = 0;
+  for (NodeId other : graph.GetNodes()) {
+    for (NodeId i = other; i != SceneGraph::kNone; i = graph.GetParent(i)) {
+      if (i == node) {
+        ++count;
+        break;
+      }
+    }
+  }
+  return count;
+}
+
+// Random forest: each node's parent is an earlier node or, now and then,
+// none
+static std::vector<NodeId> MakeForest(SceneGraph &graph, size_t count,
+                                      uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::vector<NodeId> ids;
+  for (size_t i = 0; i < count; ++i) {
+    NodeId parent = SceneGraph::kNone;
+    if (!ids.empty() && rng() % 8 != 0) {
+      parent = ids[rng() % ids.size()];
+    }
+    ids.push_back(graph.Create(parent, MakeLocal(rng, 5.0f), MakeBounds(rng)));
+  }
+  return ids;
+}
+
+//============================================================================
+// Hierarchy
+//============================================================================
+bool TestHierarchy() {
+  Logger::Info("SceneGraphTests", "Testing hierarchy updates...");
+
+  SceneGraph graph;
+  graph.Update();
+  TEST_ASSERT(graph.GetNodeCount() == 0 && graph.GetLevelCount() == 0,
+              "An empty graph updates to nothing");
+
+  // Parent, child and grandchild
+  std::mt19937 rng(1);
+  NodeId root = graph.Create(SceneGraph::kNone, MakeLocal(rng, 10.0f));
+  NodeId child = graph.Create(root, MakeLocal(rng, 10.0f), MakeBounds(rng));
+  NodeId leaf = graph.Create(child, MakeLocal(rng, 10.0f), MakeBounds(rng));
+  graph.Update();
+  TEST_ASSERT(graph.GetLevelCount() == 3 && graph.GetUpdatedCount() == 3,
+              "A chain of three takes three levels");
+  Mat4 world = graph.GetLocal(root).ToMatrix() *
+               graph.GetLocal(child).ToMatrix() *
+               graph.GetLocal(leaf).ToMatrix();
+  TEST_ASSERT(NearTransform(graph.GetWorldTransform(leaf), world, 1e-5f),
+              "World transform is the product of the locals");
+  TEST_ASSERT(NearBox(graph.GetWorldBounds(leaf),
+                      graph.GetLocalBounds(leaf).Transformed(world), 1e-5f),
+              "World bounds match transforming the eight corners");
+  TEST_ASSERT(NearBox(graph.GetWorldBounds(root),
+                      AABB(graph.GetLocal(root).position,
+                           graph.GetLocal(root).position),
+                      1e-5f),
+              "A node without bounds keeps a point at its origin");
+
+  // Random forests, including out-of-order creation
+  for (size_t count : {1u, 2u, 50u, 3000u}) {
+    SceneGraph forest;
+    std::vector<NodeId> ids = MakeForest(forest, count, 2 + count);
+    std::mt19937 order(count);
+    for (size_t i = 0; i < count / 10; ++i) {
+      NodeId node = ids[order() % count];
+      NodeId parent = ids[order() % count];
+      bool below = false;
+      for (NodeId p = parent; p != SceneGraph::kNone;
+           p = forest.GetParent(p)) {
+        below |= p == node;
+      }
+      if (!below) {
+        forest.SetParent(node, parent);
+      }
+    }
+    forest.Update();
+    TEST_ASSERT(forest.GetUpdatedCount() == count &&
+                    MatchesReference(forest, 1e-4f),
+                "Random forest of " + std::to_string(count) +
+                    " nodes matches the reference");
+  }
+
+  Logger::Info("SceneGraphTests", "✅ Hierarchy tests passed!");
+  return true;
+}
+
+//============================================================================
+// Changes
+//============================================================================
+static bool CheckChanges(uint32_t grainSize) {
+  SceneGraph graph;
+  std::vector<NodeId> ids = MakeForest(graph, 5000, 11);
+  graph.Update(grainSize);
+  std::mt19937 rng(12);
+
+  // Nothing flagged, nothing recomputed
+  graph.Update(grainSize);
+  TEST_ASSERT(graph.GetUpdatedCount() == 0, "A clean update touches nothing");
+
+  // Only the flagged subtrees are recomputed
+  for (int round = 0; round < 5; ++round) {
+    NodeId node = ids[rng() % ids.size()];
+    graph.SetLocal(node, MakeLocal(rng, 5.0f));
+    graph.Update(grainSize);
+    TEST_ASSERT(graph.GetUpdatedCount() == SubtreeSize(graph, node) &&
+                    MatchesReference(graph, 1e-4f),
+                "Moving a node recomputes exactly its subtree");
+  }
+  NodeId resized = ids[rng() % ids.size()];
+  graph.SetLocalBounds(resized, MakeBounds(rng));
+  graph.Update(grainSize);
+  TEST_ASSERT(graph.GetUpdatedCount() == SubtreeSize(graph, resized) &&
+                  MatchesReference(graph, 1e-4f),
+              "New bounds recompute the node's subtree");
+
+  // Reparenting moves a subtree to another depth
+  for (int round = 0; round < 20; ++round) {
+    NodeId node = ids[rng() % ids.size()];
+    NodeId parent = rng() % 4 == 0 ? SceneGraph::kNone
+                                   : ids[rng() % ids.size()];
+    bool below = false;
+    for (NodeId p = parent; p != SceneGraph::kNone; p = graph.GetParent(p)) {
+      below |= p == node;
+    }
+    if (!below) {
+      graph.SetParent(node, parent);
+      TEST_ASSERT(graph.GetParent(node) == parent, "SetParent() links nodes");
+    }
+  }
+  graph.Update(grainSize);
+  TEST_ASSERT(graph.GetNodeCount() == ids.size() &&
+                  MatchesReference(graph, 1e-4f),
+              "Reparented nodes match the reference");
+
+  // Destroying a node takes its subtree along and frees their ids
+  NodeId doomed = graph.GetNodes()[graph.GetNodeCount() / 3];
+  size_t removed = SubtreeSize(graph, doomed);
+  graph.Destroy(doomed);
+  graph.Update(grainSize);
+  TEST_ASSERT(!graph.IsValid(doomed) &&
+                  graph.GetNodeCount() == ids.size() - removed &&
+                  MatchesReference(graph, 1e-4f),
+              "Destroy() removes the subtree");
+  NodeId reused = graph.Create(graph.GetNodes()[0], MakeLocal(rng, 5.0f));
+  TEST_ASSERT(reused < ids.size(), "Freed ids are reused");
+  graph.Update(grainSize);
+  TEST_ASSERT(graph.IsValid(reused) && graph.GetUpdatedCount() == 1 &&
+                  MatchesReference(graph, 1e-4f),
+              "A reused id is a new node");
+
+  graph.Clear();
+  graph.Update(grainSize);
+  TEST_ASSERT(graph.GetNodeCount() == 0 && !graph.IsValid(reused),
+              "Clear() removes every node");
+  return true;
+}
+
+bool TestChanges() {
+  Logger::Info("SceneGraphTests", "Testing changes...");
+
+  TEST_ASSERT(CheckChanges(1024), "Changes on one thread");
+  JobSystem::Initialize(3);
+  bool parallel = CheckChanges(64);
+  JobSystem::Shutdown();
+  TEST_ASSERT(parallel, "Changes with the job system running");
+
+  // Levels split into jobs give the same results bit for bit
+  SceneGraph serial;
+  SceneGraph jobs;
+  MakeForest(serial, 20000, 13);
+  MakeForest(jobs, 20000, 13);
+  serial.Update();
+  JobSystem::Initialize(3);
+  jobs.Update(64);
+  JobSystem::Shutdown();
+  bool same = serial.GetNodeCount() == jobs.GetNodeCount();
+  for (size_t i = 0; same && i < serial.GetNodeCount(); ++i) {
+    const Affine3x4 &a = serial.GetWorldTransforms()[i];
+    const Affine3x4 &b = jobs.GetWorldTransforms()[i];
+    const AABB &boxA = serial.GetWorldBounds()[i];
+    const AABB &boxB = jobs.GetWorldBounds()[i];
+    same = serial.GetNodes()[i] == jobs.GetNodes()[i] &&
+           std::equal(&a.m[0][0], &a.m[0][0] + 12, &b.m[0][0]) &&
+           boxA.min.x == boxB.min.x && boxA.max.z == boxB.max.z;
+  }
+  TEST_ASSERT(same, "Parallel update matches the serial one");
+
+  // Culling the cached bounds
+  std::mt19937 rng(14);
+  for (int round = 0; round < 10; ++round) {
+    std::uniform_real_distribution<float> position(-30.0f, 30.0f);
+    Vec3 eye(position(rng), position(rng), position(rng));
+    Vec3 target(position(rng), position(rng), position(rng));
+    Frustum frustum = Frustum::FromMatrix(
+        Mat4::Perspective(ToRadians(60.0f), 1.5f, 0.1f, 50.0f) *
+        Mat4::LookAt(eye, target, Vec3::Up()));
+    std::vector<NodeId> visible(serial.GetNodeCount());
+    visible.resize(serial.Cull(frustum, visible));
+    std::vector<uint8_t> found(serial.GetNodeCount() * 2);
+    for (NodeId node : visible) {
+      found[node] = 1;
+    }
+    bool matches = true;
+    for (size_t i = 0; i < serial.GetNodeCount(); ++i) {
+      const double margin = Margin(frustum, serial.GetWorldBounds()[i]);
+      if (std::abs(margin) > 1e-4) {
+        matches &= found[serial.GetNodes()[i]] == (margin > 0.0);
+      }
+    }
+    TEST_ASSERT(matches, "Cull() matches testing every box");
+  }
+
+  Logger::Info("SceneGraphTests", "✅ Change tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("SceneGraphTests", "Starting scene graph tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestHierarchy();
+  allPassed &= TestChanges();
+
+  if (allPassed) {
+    Logger::Info("SceneGraphTests", "🎉 ALL SCENE GRAPH TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("SceneGraphTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
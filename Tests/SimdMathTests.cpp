@@ -0,0 +1,273 @@
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include "Math/VectorPacket.h"
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("SimdMathTests", std::string("FAILED: ") + message);         \
+    return false;                                                              \
+  }
+
+static bool Near(float a, float b, float tolerance = 1e-5f) {
+  return std::abs(a - b) <= tolerance * std::max(1.0f, std::abs(b));
+}
+
+static bool Near(const Vec3 &a, const Vec3 &b, float tolerance = 1e-5f) {
+  return Near(a.x, b.x, tolerance) && Near(a.y, b.y, tolerance) &&
+         Near(a.z, b.z, tolerance);
+}
+
+static bool Near(const Quaternion &a, const Quaternion &b,
+                 float tolerance = 1e-5f) {
+  return Near(a.x, b.x, tolerance) && Near(a.y, b.y, tolerance) &&
+         Near(a.z, b.z, tolerance) && Near(a.w, b.w, tolerance);
+}
+
+static std::vector<Vec3> MakeVectors(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+  std::vector<Vec3> vectors(count);
+  for (auto &v : vectors) {
+    v = Vec3(dist(rng), dist(rng), dist(rng));
+  }
+  return vectors;
+}
+
+static std::vector<Quaternion> MakeRotations(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  std::vector<Quaternion> rotations(count);
+  for (auto &q : rotations) {
+    q = Quaternion(dist(rng), dist(rng), dist(rng), dist(rng)).Normalized();
+  }
+  return rotations;
+}
+
+//============================================================================
+// Packet Tests
+//============================================================================
+template <typename F> bool TestVec3PacketOps(const char *name) {
+  Logger::Info("SimdMathTests",
+               std::string("Testing ") + name + " arithmetic...");
+  constexpr int W = F::Width;
+
+  std::vector<Vec3> a = MakeVectors(W, 1);
+  std::vector<Vec3> b = MakeVectors(W, 2);
+  Vec3Packet<F> pa = Vec3Packet<F>::Load(a.data());
+  Vec3Packet<F> pb = Vec3Packet<F>::Load(b.data());
+
+  F dot = Dot(pa, pb);
+  Vec3Packet<F> cross = Cross(pa, pb);
+  Vec3Packet<F> sum = pa + pb * F(2.0f);
+  Vec3Packet<F> normalized = Normalize(pa);
+  Vec3Packet<F> fast = NormalizeFast(pa);
+  Vec3Packet<F> lerp = Lerp(pa, pb, F(0.25f));
+  F length = Length(pa);
+
+  for (int i = 0; i < W; ++i) {
+    TEST_ASSERT(Near(dot[i], a[i].Dot(b[i])), "Dot matches Vec3");
+    TEST_ASSERT(Near(cross.GetLane(i), a[i].Cross(b[i]), 1e-4f),
+                "Cross matches Vec3");
+    TEST_ASSERT(Near(sum.GetLane(i), a[i] + b[i] * 2.0f), "Arithmetic");
+    TEST_ASSERT(Near(normalized.GetLane(i), a[i].Normalized()),
+                "Normalize matches Vec3");
+    TEST_ASSERT(Near(fast.GetLane(i), a[i].Normalized(), 1e-4f),
+                "NormalizeFast within tolerance");
+    TEST_ASSERT(Near(lerp.GetLane(i), a[i].Lerp(b[i], 0.25f)), "Lerp");
+    TEST_ASSERT(Near(length[i], a[i].Length()), "Length");
+  }
+
+  // Zero-length lanes normalize to zero like Vec3::Normalized
+  a[0] = Vec3::Zero();
+  Vec3Packet<F> guarded = Normalize(Vec3Packet<F>::Load(a.data()));
+  TEST_ASSERT(guarded.GetLane(0).x == 0.0f && guarded.GetLane(0).y == 0.0f,
+              "Zero vector stays zero");
+
+  Logger::Info("SimdMathTests",
+               std::string("✅ ") + name + " arithmetic tests passed!");
+  return true;
+}
+
+template <typename F> bool TestLoadStore(const char *name) {
+  Logger::Info("SimdMathTests",
+               std::string("Testing ") + name + " load/store...");
+  constexpr int W = F::Width;
+
+  std::vector<Vec3> vectors = MakeVectors(W, 3);
+  Vec3Packet<F> packet = Vec3Packet<F>::Load(vectors.data());
+  for (int i = 0; i < W; ++i) {
+    TEST_ASSERT(packet.x[i] == vectors[i].x && packet.y[i] == vectors[i].y &&
+                    packet.z[i] == vectors[i].z,
+                "AoS load transposes into lanes");
+  }
+
+  std::vector<Vec3> stored(W);
+  packet.Store(stored.data());
+  bool same = true;
+  for (int i = 0; i < W; ++i) {
+    same &= stored[i].x == vectors[i].x && stored[i].y == vectors[i].y &&
+            stored[i].z == vectors[i].z;
+  }
+  TEST_ASSERT(same, "AoS store round-trips");
+
+  // Tightly packed xyz, as in vertex buffers
+  std::vector<float> packed(W * 3);
+  for (int i = 0; i < W * 3; ++i) {
+    packed[i] = static_cast<float>(i);
+  }
+  Vec3Packet<F> fromPacked = Vec3Packet<F>::LoadPacked(packed.data());
+  for (int i = 0; i < W; ++i) {
+    TEST_ASSERT(fromPacked.x[i] == 3.0f * i &&
+                    fromPacked.y[i] == 3.0f * i + 1 &&
+                    fromPacked.z[i] == 3.0f * i + 2,
+                "Packed load deinterleaves");
+  }
+  std::vector<float> repacked(W * 3, -1.0f);
+  fromPacked.StorePacked(repacked.data());
+  TEST_ASSERT(repacked == packed, "Packed store round-trips");
+
+  // Partial tails leave the rest untouched and load zeros
+  Vec3Packet<F> partial = Vec3Packet<F>::Load(vectors.data(), 3);
+  TEST_ASSERT(partial.x[2] == vectors[2].x && partial.x[3] == 0.0f,
+              "Partial load zero-fills");
+  std::vector<Vec3> tail(W, Vec3(7.0f));
+  packet.Store(tail.data(), 2);
+  TEST_ASSERT(tail[1].x == vectors[1].x && tail[2].x == 7.0f,
+              "Partial store writes only count lanes");
+
+  // Quaternions and Vec4 share the four-row transpose
+  std::vector<Quaternion> rotations = MakeRotations(W, 4);
+  QuatPacket<F> quats = QuatPacket<F>::Load(rotations.data());
+  std::vector<Quaternion> quatsOut(W);
+  quats.Store(quatsOut.data());
+  same = true;
+  for (int i = 0; i < W; ++i) {
+    same &= Near(quatsOut[i], rotations[i], 0.0f);
+  }
+  TEST_ASSERT(same, "Quaternion load/store round-trips");
+
+  std::vector<Vec4> fours(W);
+  for (int i = 0; i < W; ++i) {
+    fours[i] = Vec4(1.0f * i, 2.0f * i, 3.0f * i, 4.0f * i);
+  }
+  Vec4Packet<F> packet4 = Vec4Packet<F>::Load(fours.data());
+  TEST_ASSERT(packet4.w[W - 1] == 4.0f * (W - 1), "Vec4 load");
+  TEST_ASSERT(Near(Dot(packet4, packet4)[1], fours[1].Dot(fours[1])),
+              "Vec4 dot");
+
+  Logger::Info("SimdMathTests",
+               std::string("✅ ") + name + " load/store tests passed!");
+  return true;
+}
+
+template <typename F> bool TestMasks(const char *name) {
+  Logger::Info("SimdMathTests", std::string("Testing ") + name + " masks...");
+  constexpr int W = F::Width;
+
+  alignas(32) float values[8] = {-3.0f, 1.0f, -1.0f, 4.0f,
+                                 0.0f,  -2.0f, 5.0f, -6.0f};
+  F v = F::LoadU(values);
+  F positive = v > F::Zero();
+
+  int expectedBits = 0;
+  for (int i = 0; i < W; ++i) {
+    expectedBits |= (values[i] > 0.0f ? 1 : 0) << i;
+  }
+  TEST_ASSERT(MoveMask(positive) == expectedBits, "Comparison mask bits");
+  TEST_ASSERT(Any(positive) && !All(positive), "Any/All");
+  TEST_ASSERT(None(v > F(100.0f)), "None");
+
+  F clamped = Select(positive, v, F::Zero());
+  F absolute = Abs(v);
+  for (int i = 0; i < W; ++i) {
+    TEST_ASSERT(clamped[i] == std::max(values[i], 0.0f), "Select lanes");
+    TEST_ASSERT(absolute[i] == std::abs(values[i]), "Abs lanes");
+  }
+
+  std::vector<Vec3> a = MakeVectors(W, 5);
+  std::vector<Vec3> b = MakeVectors(W, 6);
+  Vec3Packet<F> pa = Vec3Packet<F>::Load(a.data());
+  Vec3Packet<F> pb = Vec3Packet<F>::Load(b.data());
+  Vec3Packet<F> chosen = Select(positive, pa, pb);
+  Vec3Packet<F> lowest = Min(pa, pb);
+  for (int i = 0; i < W; ++i) {
+    TEST_ASSERT(Near(chosen.GetLane(i), values[i] > 0.0f ? a[i] : b[i]),
+                "Packet select");
+    TEST_ASSERT(lowest.x[i] == std::min(a[i].x, b[i].x), "Packet min");
+  }
+
+  Logger::Info("SimdMathTests",
+               std::string("✅ ") + name + " mask tests passed!");
+  return true;
+}
+
+template <typename F> bool TestQuatPacket(const char *name) {
+  Logger::Info("SimdMathTests",
+               std::string("Testing ") + name + " quaternions...");
+  constexpr int W = F::Width;
+
+  std::vector<Quaternion> qa = MakeRotations(W, 7);
+  std::vector<Quaternion> qb = MakeRotations(W, 8);
+  std::vector<Vec3> vectors = MakeVectors(W, 9);
+
+  QuatPacket<F> pa = QuatPacket<F>::Load(qa.data());
+  QuatPacket<F> pb = QuatPacket<F>::Load(qb.data());
+  QuatPacket<F> product = pa * pb;
+  Vec3Packet<F> rotated =
+      RotateVector(pa, Vec3Packet<F>::Load(vectors.data()));
+
+  for (int i = 0; i < W; ++i) {
+    TEST_ASSERT(Near(product.GetLane(i), qa[i] * qb[i]),
+                "Product matches Quaternion");
+    TEST_ASSERT(Near(rotated.GetLane(i), qa[i].RotateVector(vectors[i]),
+                     1e-4f),
+                "Rotation matches Quaternion::RotateVector");
+  }
+
+  QuatPacket<F> scaled(pa.x * F(3.0f), pa.y * F(3.0f), pa.z * F(3.0f),
+                       pa.w * F(3.0f));
+  QuatPacket<F> normalized = Normalize(scaled);
+  TEST_ASSERT(Near(normalized.GetLane(0), qa[0]), "Normalize");
+
+  Logger::Info("SimdMathTests",
+               std::string("✅ ") + name + " quaternion tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("SimdMathTests", "Starting SIMD packet math tests...");
+#if defined(__AVX__)
+  Logger::Info("SimdMathTests", "SimdFloat8 uses native AVX registers");
+#else
+  Logger::Info("SimdMathTests", "SimdFloat8 emulated with two SSE halves");
+#endif
+
+  bool allPassed = true;
+
+  allPassed &= TestVec3PacketOps<SimdFloat4>("Vec3x4");
+  allPassed &= TestVec3PacketOps<SimdFloat8>("Vec3x8");
+  allPassed &= TestLoadStore<SimdFloat4>("Vec3x4");
+  allPassed &= TestLoadStore<SimdFloat8>("Vec3x8");
+  allPassed &= TestMasks<SimdFloat4>("SimdFloat4");
+  allPassed &= TestMasks<SimdFloat8>("SimdFloat8");
+  allPassed &= TestQuatPacket<SimdFloat4>("QuatX4");
+  allPassed &= TestQuatPacket<SimdFloat8>("QuatX8");
+
+  if (allPassed) {
+    Logger::Info("SimdMathTests", "🎉 ALL SIMD MATH TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("SimdMathTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
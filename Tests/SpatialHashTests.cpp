@@ -0,0 +1,358 @@
+#include "Core/JobSystem.h"
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include "Math/SpatialHash.h"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("SpatialHashTests", std::string("FAILED: ") + message);      \
+    return false;                                                              \
+  }
+
+// Cubes of up to 'size' per axis: uniform filler plus dense groups, as
+// particle systems produce
+static std::vector<AABB> MakeBoxes(size_t count, uint32_t seed, float range,
+                                   float size) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> position(-range, range);
+  std::uniform_real_distribution<float> extent(0.05f * size, 0.5f * size);
+  std::normal_distribution<float> cluster(0.0f, range * 0.05f);
+  std::vector<Vec3> centers(8);
+  for (Vec3 &center : centers) {
+    center = Vec3(position(rng), position(rng), position(rng));
+  }
+
+  std::vector<AABB> boxes(count);
+  for (size_t i = 0; i < count; ++i) {
+    Vec3 center = Vec3(position(rng), position(rng), position(rng));
+    if (i % 2 == 0) {
+      center = centers[i % centers.size()] +
+               Vec3(cluster(rng), cluster(rng), cluster(rng));
+    }
+    Vec3 half(extent(rng));
+    boxes[i] = AABB(center - half, center + half);
+  }
+  return boxes;
+}
+
+static Vec3 CenterOf(const AABB &box) { return (box.min + box.max) * 0.5f; }
+
+static bool SameBox(const AABB &a, const AABB &b) {
+  return a.min.x == b.min.x && a.min.y == b.min.y && a.min.z == b.min.z &&
+         a.max.x == b.max.x && a.max.y == b.max.y && a.max.z == b.max.z;
+}
+
+//============================================================================
+// Invariants and brute force
+//============================================================================
+// Every object once, in the bucket of its center, in increasing order
+// within the bucket and with its own box
+static bool CheckStructure(const SpatialHash &hash,
+                           const std::vector<AABB> &boxes) {
+  TEST_ASSERT(hash.GetObjectCount() == boxes.size(), "Object count");
+  uint32_t buckets = hash.GetBucketCount();
+  TEST_ASSERT(buckets > 0 && (buckets & (buckets - 1)) == 0,
+              "Bucket count is a power of two");
+  std::vector<int> seen(boxes.size(), 0);
+  float largest = 0.0f;
+  for (const AABB &box : boxes) {
+    Vec3 extent = box.max - box.min;
+    largest = std::max(largest, std::max(extent.x, std::max(extent.y,
+                                                            extent.z)));
+  }
+  TEST_ASSERT(hash.GetMaxHalfExtent() == largest * 0.5f, "Largest extent");
+
+  size_t total = 0;
+  for (uint32_t bucket = 0; bucket < buckets; ++bucket) {
+    Span<const uint32_t> objects = hash.GetObjects(bucket);
+    Span<const AABB> bounds = hash.GetBounds(bucket);
+    TEST_ASSERT(objects.size() == bounds.size(), "Bucket arrays match");
+    for (size_t i = 0; i < objects.size(); ++i) {
+      uint32_t object = objects[i];
+      TEST_ASSERT(object < boxes.size() && seen[object]++ == 0,
+                  "Objects appear once");
+      TEST_ASSERT(i == 0 || objects[i - 1] < object,
+                  "Objects increase within a bucket");
+      TEST_ASSERT(SameBox(bounds[i], boxes[object]), "Bounds are current");
+      TEST_ASSERT(hash.GetBucketOf(CenterOf(boxes[object])) == bucket,
+                  "Objects sit in the bucket of their center");
+    }
+    total += objects.size();
+  }
+  TEST_ASSERT(total == boxes.size(), "Every object is stored");
+  return true;
+}
+
+template <typename Test>
+static std::vector<uint32_t> BruteForce(const std::vector<AABB> &boxes,
+                                        const Test &test) {
+  std::vector<uint32_t> expected;
+  for (uint32_t i = 0; i < boxes.size(); ++i) {
+    if (test(boxes[i])) {
+      expected.push_back(i);
+    }
+  }
+  return expected;
+}
+
+static std::vector<SpatialPair>
+BruteForcePairs(const std::vector<AABB> &boxes) {
+  std::vector<SpatialPair> pairs;
+  for (uint32_t i = 0; i < boxes.size(); ++i) {
+    for (uint32_t j = i + 1; j < boxes.size(); ++j) {
+      if (boxes[i].Intersects(boxes[j])) {
+        pairs.push_back({i, j});
+      }
+    }
+  }
+  return pairs;
+}
+
+static std::vector<uint32_t> Sorted(std::vector<uint32_t> values) {
+  std::sort(values.begin(), values.end());
+  return values;
+}
+
+// Sphere and box overlaps, single and batched, pairs and neighbours
+// against brute force
+static bool CheckQueries(const SpatialHash &hash,
+                         const std::vector<AABB> &boxes, float range,
+                         uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> position(-range, range);
+  std::uniform_real_distribution<float> radius(0.0f, range * 0.2f);
+  std::vector<uint32_t> found(boxes.size() + 1);
+
+  std::vector<Sphere> spheres;
+  for (int i = 0; i < 40; ++i) {
+    Vec3 center(position(rng), position(rng), position(rng));
+    if (i % 4 == 0 && !boxes.empty()) {
+      center = CenterOf(boxes[rng() % boxes.size()]);
+    }
+    Sphere sphere(center, i == 0 ? 4.0f * range : radius(rng));
+    spheres.push_back(sphere);
+    size_t count = hash.Overlap(sphere, found);
+    std::vector<uint32_t> result(found.begin(), found.begin() + count);
+    TEST_ASSERT(Sorted(result) == BruteForce(boxes,
+                                             [&](const AABB &box) {
+                                               return sphere.Intersects(box);
+                                             }),
+                "Sphere overlaps match brute force");
+
+    Vec3 half(radius(rng), radius(rng), radius(rng));
+    AABB box(center - half, center + half);
+    count = hash.Overlap(box, found);
+    result.assign(found.begin(), found.begin() + count);
+    TEST_ASSERT(Sorted(result) == BruteForce(boxes,
+                                             [&](const AABB &other) {
+                                               return box.Intersects(other);
+                                             }),
+                "Box overlaps match brute force");
+  }
+
+  // Batches give each sphere the objects of a single query, in order
+  std::vector<uint32_t> offsets, indices;
+  hash.Overlap(spheres, offsets, indices, 7);
+  TEST_ASSERT(offsets.size() == spheres.size() + 1 && offsets[0] == 0 &&
+                  offsets.back() == indices.size(),
+              "Batch offsets cover the indices");
+  for (size_t i = 0; i < spheres.size(); ++i) {
+    size_t count = hash.Overlap(spheres[i], found);
+    TEST_ASSERT(offsets[i + 1] - offsets[i] == count &&
+                    std::equal(found.begin(), found.begin() + count,
+                               indices.begin() + offsets[i]),
+                "Batch sphere overlaps match single queries");
+  }
+
+  // A full output stops the query
+  if (boxes.size() > 1) {
+    std::vector<uint32_t> few(1);
+    TEST_ASSERT(hash.Overlap(spheres[0], few) == 1,
+                "Queries stop at the output's capacity");
+  }
+
+  std::vector<SpatialPair> pairs;
+  hash.FindPairs(pairs);
+  std::sort(pairs.begin(), pairs.end());
+  TEST_ASSERT(pairs == BruteForcePairs(boxes),
+              "Pairs match brute force, each once");
+
+  // Neighbours cover every center less than a cell away on each axis
+  const float cell = hash.GetCellSize();
+  for (int i = 0; i < 20 && !boxes.empty(); ++i) {
+    Vec3 point = CenterOf(boxes[rng() % boxes.size()]);
+    std::vector<int> visits(boxes.size(), 0);
+    hash.ForEachNeighbor(point, [&](uint32_t object, const AABB &box) {
+      visits[object] += SameBox(box, boxes[object]) ? 1 : 100;
+    });
+    for (size_t object = 0; object < boxes.size(); ++object) {
+      Vec3 offset = CenterOf(boxes[object]) - point;
+      bool near = std::abs(offset.x) < cell && std::abs(offset.y) < cell &&
+                  std::abs(offset.z) < cell;
+      TEST_ASSERT(visits[object] <= 1, "Neighbours are visited once");
+      TEST_ASSERT(!near || visits[object] == 1,
+                  "Neighbours include the 27 surrounding cells");
+    }
+  }
+  return true;
+}
+
+//============================================================================
+// Build and queries
+//============================================================================
+bool TestBuild() {
+  Logger::Info("SpatialHashTests", "Testing builds and queries...");
+
+  for (size_t count : {1u, 2u, 17u, 300u, 3000u}) {
+    std::vector<AABB> boxes = MakeBoxes(count, 3 + count, 50.0f, 2.0f);
+    // Default cells, cells smaller than the boxes and much larger ones;
+    // default, single and few buckets
+    for (float cellSize : {0.0f, 0.3f, 20.0f}) {
+      for (uint32_t buckets : {0u, 1u, 8u}) {
+        SpatialHashSettings settings;
+        settings.CellSize = cellSize;
+        settings.BucketCount = buckets;
+        SpatialHash hash;
+        hash.Build(boxes, settings);
+        std::string name = std::to_string(count) + " objects, cell size " +
+                           std::to_string(cellSize) + ", " +
+                           std::to_string(buckets) + " buckets";
+        TEST_ASSERT(CheckStructure(hash, boxes), "Consistent with " + name);
+        TEST_ASSERT(CheckQueries(hash, boxes, 50.0f, 4),
+                    "Queries match brute force with " + name);
+      }
+    }
+  }
+
+  // The default cell is the largest extent, and buckets twice the objects
+  std::vector<AABB> boxes = MakeBoxes(1000, 5, 50.0f, 2.0f);
+  SpatialHash hash;
+  hash.Build(boxes);
+  TEST_ASSERT(hash.GetCellSize() == 2.0f * hash.GetMaxHalfExtent() &&
+                  hash.GetBucketCount() == 2048,
+              "Default cell size and bucket count");
+  SpatialHashSettings odd;
+  odd.BucketCount = 1000;
+  hash.Build(boxes, odd);
+  TEST_ASSERT(hash.GetBucketCount() == 1024,
+              "Bucket counts round up to a power of two");
+
+  // Points, with a cell size as a particle system's interaction radius
+  std::vector<Vec3> points;
+  std::vector<AABB> pointBoxes;
+  for (const AABB &box : MakeBoxes(2000, 6, 20.0f, 1.0f)) {
+    points.push_back(CenterOf(box));
+    pointBoxes.push_back(AABB(points.back(), points.back()));
+  }
+  SpatialHashSettings radius;
+  radius.CellSize = 1.5f;
+  hash.Build(points, radius);
+  TEST_ASSERT(CheckStructure(hash, pointBoxes) &&
+                  CheckQueries(hash, pointBoxes, 20.0f, 7),
+              "Points behave as boxes without extent");
+  hash.Build(points);
+  TEST_ASSERT(hash.GetCellSize() == 1.0f,
+              "Points without a cell size use unit cells");
+
+  // Coincident boxes share one cell
+  std::vector<AABB> stacked(100, AABB(Vec3(-1.0f), Vec3(1.0f)));
+  hash.Build(stacked);
+  std::vector<SpatialPair> pairs;
+  hash.FindPairs(pairs);
+  TEST_ASSERT(CheckStructure(hash, stacked) && pairs.size() == 100 * 99 / 2,
+              "Coincident boxes pair with each other");
+
+  SpatialHash empty;
+  empty.Build(Span<const AABB>());
+  std::vector<uint32_t> found(4);
+  TEST_ASSERT(empty.IsEmpty() &&
+                  empty.Overlap(Sphere(Vec3(), 10.0f), found) == 0,
+              "An empty hash finds nothing");
+  empty.FindPairs(pairs);
+  TEST_ASSERT(pairs.empty(), "An empty hash has no pairs");
+  hash.Clear();
+  TEST_ASSERT(hash.IsEmpty() && hash.Overlap(Sphere(Vec3(), 10.0f), found) ==
+                                    0,
+              "Clear() empties the hash");
+
+  Logger::Info("SpatialHashTests", "✅ Build and query tests passed!");
+  return true;
+}
+
+//============================================================================
+// Parallel builds and queries
+//============================================================================
+// The job system splits the work, but every result comes out as on one
+// thread, in the same order
+bool TestParallel() {
+  Logger::Info("SpatialHashTests", "Testing builds on the job system...");
+
+  std::vector<AABB> boxes = MakeBoxes(200000, 8, 300.0f, 2.0f);
+  std::vector<Sphere> spheres;
+  for (size_t i = 0; i < boxes.size(); i += 97) {
+    spheres.push_back(Sphere(CenterOf(boxes[i]), 3.0f));
+  }
+
+  SpatialHash serial;
+  serial.Build(boxes);
+  std::vector<SpatialPair> serialPairs;
+  serial.FindPairs(serialPairs);
+  std::vector<uint32_t> serialOffsets, serialIndices;
+  serial.Overlap(spheres, serialOffsets, serialIndices, 64);
+
+  JobSystem::Initialize(3);
+  SpatialHash parallel;
+  // Twice, so the second build reuses the first one's storage
+  std::vector<AABB> first = MakeBoxes(50000, 9, 300.0f, 5.0f);
+  parallel.Build(first);
+  parallel.Build(boxes);
+  std::vector<SpatialPair> parallelPairs;
+  parallel.FindPairs(parallelPairs);
+  std::vector<uint32_t> parallelOffsets, parallelIndices;
+  parallel.Overlap(spheres, parallelOffsets, parallelIndices, 64);
+  JobSystem::Shutdown();
+
+  TEST_ASSERT(CheckStructure(parallel, boxes), "Parallel build is consistent");
+  for (uint32_t bucket = 0; bucket < serial.GetBucketCount(); ++bucket) {
+    Span<const uint32_t> a = serial.GetObjects(bucket);
+    Span<const uint32_t> b = parallel.GetObjects(bucket);
+    TEST_ASSERT(a.size() == b.size() &&
+                    std::equal(a.begin(), a.end(), b.begin()),
+                "Parallel build matches the serial one");
+  }
+  TEST_ASSERT(!serialPairs.empty() && parallelPairs == serialPairs,
+              "Parallel pairs match the serial ones");
+  TEST_ASSERT(parallelOffsets == serialOffsets &&
+                  parallelIndices == serialIndices,
+              "Parallel batch queries match the serial ones");
+
+  Logger::Info("SpatialHashTests", "✅ Parallel tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main test runner
+//============================================================================
+int main() {
+  Logger::Info("SpatialHashTests", "Starting spatial hash tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestBuild();
+  allPassed &= TestParallel();
+
+  if (allPassed) {
+    Logger::Info("SpatialHashTests", "🎉 ALL SPATIAL HASH TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("SpatialHashTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,319 @@
+#include "Core/JobSystem.h"
+#include "Core/Logger.h"
+#include "Renderer/Image.h"
+#include "Renderer/MipGenerator.h"
+#include "Renderer/TextureResidency.h"
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("TextureTests", std::string("FAILED: ") + message);          \
+    return false;                                                              \
+  }
+
+//============================================================================
+// Helpers
+//============================================================================
+static Image MakeNoiseImage(uint32_t width, uint32_t height, uint32_t seed) {
+  Image image(width, height);
+  uint32_t state = seed;
+  for (auto &byte : image.Pixels) {
+    state = state * 1664525u + 1013904223u;
+    byte = static_cast<uint8_t>(state >> 24);
+  }
+  return image;
+}
+
+static Image MakeSolidImage(uint32_t width, uint32_t height, uint8_t r,
+                            uint8_t g, uint8_t b, uint8_t a) {
+  Image image(width, height);
+  for (size_t i = 0; i < image.Pixels.size(); i += 4) {
+    image.Pixels[i + 0] = r;
+    image.Pixels[i + 1] = g;
+    image.Pixels[i + 2] = b;
+    image.Pixels[i + 3] = a;
+  }
+  return image;
+}
+
+// Scalar reference for the SSE box filter
+static Image ReferenceBox(const Image &source) {
+  Image result(std::max(source.Width / 2, 1u), std::max(source.Height / 2, 1u));
+  for (uint32_t y = 0; y < result.Height; ++y) {
+    uint32_t y0 = std::min(y * 2, source.Height - 1);
+    uint32_t y1 = std::min(y * 2 + 1, source.Height - 1);
+    for (uint32_t x = 0; x < result.Width; ++x) {
+      uint32_t x0 = std::min(x * 2, source.Width - 1);
+      uint32_t x1 = std::min(x * 2 + 1, source.Width - 1);
+      for (int c = 0; c < 4; ++c) {
+        uint32_t sum = source.GetPixel(x0, y0)[c] + source.GetPixel(x1, y0)[c] +
+                       source.GetPixel(x0, y1)[c] + source.GetPixel(x1, y1)[c];
+        result.GetPixel(x, y)[c] = static_cast<uint8_t>((sum + 2) >> 2);
+      }
+    }
+  }
+  return result;
+}
+
+//============================================================================
+// Decoder Tests
+//============================================================================
+bool TestTGADecoding() {
+  Logger::Info("TextureTests", "Testing TGA decoding...");
+
+  // 2x2 uncompressed 24-bit, bottom-up: blue, green / red, white
+  std::vector<uint8_t> tga = {0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                              2, 0, 2, 0, 24, 0};
+  const uint8_t pixels[] = {255, 0, 0,   0,   255, 0,
+                            0,   0, 255, 255, 255, 255};
+  tga.insert(tga.end(), std::begin(pixels), std::end(pixels));
+
+  Image image;
+  TEST_ASSERT(ImageLoader::Decode(tga.data(), tga.size(), image),
+              "Uncompressed TGA decodes");
+  TEST_ASSERT(image.Width == 2 && image.Height == 2, "TGA dimensions");
+  TEST_ASSERT(image.GetPixel(0, 0)[2] == 255 && image.GetPixel(0, 0)[0] == 0,
+              "BGR swizzled to RGB");
+  TEST_ASSERT(image.GetPixel(1, 0)[1] == 255, "Second pixel green");
+  TEST_ASSERT(image.GetPixel(0, 1)[0] == 255, "Second row red");
+  TEST_ASSERT(image.GetPixel(1, 1)[3] == 255, "Alpha filled for 24-bit");
+
+  // 4x1 RLE 32-bit: run of three, then one raw pixel; top-down flag set
+  std::vector<uint8_t> rle = {0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                              4, 0, 1,  0, 32, 0x20};
+  const uint8_t packets[] = {0x82, 10, 20, 30, 40, 0x00, 1, 2, 3, 4};
+  rle.insert(rle.end(), std::begin(packets), std::end(packets));
+
+  TEST_ASSERT(ImageLoader::DecodeTGA(rle.data(), rle.size(), image),
+              "RLE TGA decodes");
+  TEST_ASSERT(image.Width == 4 && image.Height == 1, "RLE dimensions");
+  TEST_ASSERT(image.GetPixel(2, 0)[0] == 30 && image.GetPixel(2, 0)[3] == 40,
+              "Run-length packet expanded");
+  TEST_ASSERT(image.GetPixel(3, 0)[0] == 3, "Raw packet copied");
+
+  // Truncated data must fail rather than read out of bounds
+  rle.resize(rle.size() - 2);
+  TEST_ASSERT(!ImageLoader::DecodeTGA(rle.data(), rle.size(), image),
+              "Truncated TGA rejected");
+
+  Logger::Info("TextureTests", "✅ TGA decoding tests passed!");
+  return true;
+}
+
+bool TestPPMDecoding() {
+  Logger::Info("TextureTests", "Testing PPM decoding...");
+
+  // 1x2 image, top row red, bottom row blue, with a header comment
+  std::string header = "P6\n# comment\n1 2\n255\n";
+  std::vector<uint8_t> ppm(header.begin(), header.end());
+  const uint8_t pixels[] = {255, 0, 0, 0, 0, 255};
+  ppm.insert(ppm.end(), std::begin(pixels), std::end(pixels));
+
+  Image image;
+  TEST_ASSERT(ImageLoader::Decode(ppm.data(), ppm.size(), image),
+              "PPM decodes");
+  TEST_ASSERT(image.Width == 1 && image.Height == 2, "PPM dimensions");
+  TEST_ASSERT(image.GetPixel(0, 0)[2] == 255, "Rows flipped to bottom-up");
+  TEST_ASSERT(image.GetPixel(0, 1)[0] == 255, "Top row stored last");
+
+  ppm.pop_back();
+  TEST_ASSERT(!ImageLoader::DecodePPM(ppm.data(), ppm.size(), image),
+              "Truncated PPM rejected");
+
+  Logger::Info("TextureTests", "✅ PPM decoding tests passed!");
+  return true;
+}
+
+//============================================================================
+// Mip Generation Tests
+//============================================================================
+bool TestMipChainLayout() {
+  Logger::Info("TextureTests", "Testing mip chain layout...");
+
+  TEST_ASSERT(MipGenerator::CalculateMipCount(1, 1) == 1, "1x1 has one level");
+  TEST_ASSERT(MipGenerator::CalculateMipCount(256, 256) == 9, "256 -> 9");
+  TEST_ASSERT(MipGenerator::CalculateMipCount(300, 17) == 9, "NPOT count");
+
+  MipChain chain =
+      MipGenerator::Generate(MakeNoiseImage(300, 17, 1), MipFilter::Box);
+  TEST_ASSERT(chain.size() == 9, "Full chain generated");
+  TEST_ASSERT(chain[1].Width == 150 && chain[1].Height == 8, "Level 1 size");
+  TEST_ASSERT(chain[5].Width == 9 && chain[5].Height == 1, "Level 5 size");
+  TEST_ASSERT(chain[8].Width == 1 && chain[8].Height == 1, "Last level 1x1");
+
+  MipChain limited =
+      MipGenerator::Generate(MakeNoiseImage(64, 64, 2), MipFilter::Kaiser, 3);
+  TEST_ASSERT(limited.size() == 3, "Level limit respected");
+
+  Logger::Info("TextureTests", "✅ Mip chain layout tests passed!");
+  return true;
+}
+
+bool TestBoxFilter() {
+  Logger::Info("TextureTests", "Testing SIMD box filter...");
+
+  // Sizes exercising the SIMD body, the scalar tail and clamped edges
+  const uint32_t sizes[][2] = {{64, 64}, {37, 23}, {9, 2}, {1, 7}, {3, 1}};
+  for (const auto &size : sizes) {
+    Image source = MakeNoiseImage(size[0], size[1], size[0] * 31 + size[1]);
+    Image simd = MipGenerator::DownsampleBox(source);
+    Image reference = ReferenceBox(source);
+    TEST_ASSERT(simd.Width == reference.Width &&
+                    simd.Height == reference.Height,
+                "Box output size");
+    TEST_ASSERT(simd.Pixels == reference.Pixels,
+                "SIMD box matches scalar reference for " +
+                    std::to_string(size[0]) + "x" + std::to_string(size[1]));
+  }
+
+  Logger::Info("TextureTests", "✅ Box filter tests passed!");
+  return true;
+}
+
+bool TestKaiserFilter() {
+  Logger::Info("TextureTests", "Testing Kaiser filter...");
+
+  // Normalized weights keep flat colors exact
+  Image solid = MakeSolidImage(45, 30, 200, 100, 50, 255);
+  Image filtered = MipGenerator::DownsampleKaiser(solid);
+  bool flat = true;
+  for (size_t i = 0; i < filtered.Pixels.size(); i += 4) {
+    flat &= filtered.Pixels[i] == 200 && filtered.Pixels[i + 1] == 100 &&
+            filtered.Pixels[i + 2] == 50 && filtered.Pixels[i + 3] == 255;
+  }
+  TEST_ASSERT(flat, "Constant image preserved");
+
+  // A one-texel checkerboard is pure Nyquist content and should collapse to
+  // uniform gray. Edge texels are skipped: clamped taps break the symmetry
+  // that cancels the pattern.
+  Image checker(64, 64);
+  for (uint32_t y = 0; y < 64; ++y) {
+    for (uint32_t x = 0; x < 64; ++x) {
+      uint8_t value = ((x + y) & 1) ? 255 : 0;
+      uint8_t *pixel = checker.GetPixel(x, y);
+      pixel[0] = pixel[1] = pixel[2] = value;
+      pixel[3] = 255;
+    }
+  }
+  Image smooth = MipGenerator::DownsampleKaiser(checker);
+  int worst = 0;
+  for (uint32_t y = 2; y + 2 < smooth.Height; ++y) {
+    for (uint32_t x = 2; x + 2 < smooth.Width; ++x) {
+      int value = smooth.GetPixel(x, y)[0];
+      worst = std::max(worst, std::abs(value - 128));
+    }
+  }
+  TEST_ASSERT(worst <= 2, "Nyquist pattern filtered to gray");
+
+  Logger::Info("TextureTests", "✅ Kaiser filter tests passed!");
+  return true;
+}
+
+//============================================================================
+// Residency Tests
+//============================================================================
+bool TestResidencyDesiredMip() {
+  Logger::Info("TextureTests", "Testing desired mip selection...");
+
+  TextureResidencyRequest request;
+  request.Width = 1024;
+  request.Height = 1024;
+  request.MipLevels = 11;
+
+  request.ScreenSize = 2000.0f;
+  TEST_ASSERT(TextureResidency::CalculateDesiredMip(request, 32) == 0,
+              "Magnified texture keeps full detail");
+  request.ScreenSize = 256.0f;
+  TEST_ASSERT(TextureResidency::CalculateDesiredMip(request, 32) == 2,
+              "256 pixels on screen needs level 2");
+  request.ScreenSize = 0.5f;
+  TEST_ASSERT(TextureResidency::CalculateDesiredMip(request, 32) == 10,
+              "Sub-pixel texture drops to last level");
+  request.ScreenSize = 0.0f;
+  TEST_ASSERT(TextureResidency::CalculateDesiredMip(request, 32) == 5,
+              "Unseen texture falls back to 32 texels");
+
+  TEST_ASSERT(TextureResidency::CalculateMemorySize(4, 4, 0, 3) ==
+                  (16 + 4 + 1) * 4,
+              "Chain memory sums all levels");
+
+  Logger::Info("TextureTests", "✅ Desired mip tests passed!");
+  return true;
+}
+
+bool TestResidencyBudget() {
+  Logger::Info("TextureTests", "Testing residency under budget...");
+
+  // Four 2048 textures: two close to the camera, one distant, one unseen
+  std::vector<TextureResidencyRequest> requests(4);
+  const float screenSizes[] = {1800.0f, 1500.0f, 120.0f, 0.0f};
+  for (size_t i = 0; i < requests.size(); ++i) {
+    requests[i].Width = 2048;
+    requests[i].Height = 2048;
+    requests[i].MipLevels = 12;
+    requests[i].ScreenSize = screenSizes[i];
+  }
+
+  // Generous budget: desired levels fit
+  size_t total = TextureResidency::Solve(requests, 1024u * 1024u * 1024u);
+  TEST_ASSERT(requests[0].ResidentMip == 0 && requests[1].ResidentMip == 0,
+              "Close textures fully resident");
+  TEST_ASSERT(requests[2].ResidentMip == 4, "Distant texture drops 4 levels");
+  TEST_ASSERT(requests[3].ResidentMip == 6, "Unseen texture at fallback");
+
+  // Tight budget: roughly one full-resolution chain
+  size_t budget = TextureResidency::CalculateMemorySize(2048, 2048, 0, 12);
+  total = TextureResidency::Solve(requests, budget);
+  TEST_ASSERT(total <= budget, "Solution fits the budget");
+  TEST_ASSERT(requests[0].ResidentMip <= requests[1].ResidentMip,
+              "Larger on-screen texture keeps at least as much detail");
+  TEST_ASSERT(requests[0].ResidentMip <= 1, "Closest texture keeps detail");
+  TEST_ASSERT(requests[2].ResidentMip >= 4 && requests[3].ResidentMip >= 6,
+              "Distant textures never gain detail under pressure");
+
+  // Impossible budget bottoms out at the last level
+  total = TextureResidency::Solve(requests, 1);
+  bool allLast = true;
+  for (const auto &request : requests) {
+    allLast &= request.ResidentMip == request.MipLevels - 1;
+  }
+  TEST_ASSERT(allLast && total == 16, "Everything at 1x1 when over budget");
+
+  Logger::Info("TextureTests", "✅ Residency budget tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("TextureTests", "Starting texture subsystem tests...");
+
+  // Mip filters split large levels across workers
+  JobSystem::Initialize();
+
+  bool allPassed = true;
+
+  allPassed &= TestTGADecoding();
+  allPassed &= TestPPMDecoding();
+  allPassed &= TestMipChainLayout();
+  allPassed &= TestBoxFilter();
+  allPassed &= TestKaiserFilter();
+  allPassed &= TestResidencyDesiredMip();
+  allPassed &= TestResidencyBudget();
+
+  JobSystem::Shutdown();
+
+  if (allPassed) {
+    Logger::Info("TextureTests", "🎉 ALL TEXTURE TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("TextureTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,171 @@
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include "MathTestUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+using namespace Engine::Test;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("TransformBatchTests", std::string("FAILED: ") + message);   \
+    return false;                                                              \
+  }
+
+// Largest element difference relative to the element's magnitude
+static float MaxError(const float *a, const float *b, int count) {
+  float error = 0.0f;
+  for (int i = 0; i < count; ++i) {
+    error = std::max(error, std::abs(a[i] - b[i]) /
+                                std::max(1.0f, std::abs(b[i])));
+  }
+  return error;
+}
+
+static float MaxError(const Affine3x4 &a, const Affine3x4 &b) {
+  return MaxError(a.data, b.data, 12);
+}
+
+static float MaxError(const Mat4 &a, const Mat4 &b) {
+  return MaxError(a.data, b.data, 16);
+}
+
+static std::vector<Transform> RandomTransforms(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+  std::normal_distribution<float> rotation(0.0f, 1.0f);
+  std::uniform_real_distribution<float> scale(0.1f, 5.0f);
+  std::vector<Transform> transforms(count);
+  for (auto &transform : transforms) {
+    transform = Transform(
+        Vec3(position(rng), position(rng), position(rng)),
+        Quaternion(rotation(rng), rotation(rng), rotation(rng), rotation(rng))
+            .Normalized(),
+        Vec3(scale(rng), scale(rng), scale(rng)));
+  }
+  return transforms;
+}
+
+// The same transforms split into component streams
+struct TransformStreams {
+  std::vector<float> px, py, pz, rx, ry, rz, rw, sx, sy, sz;
+
+  explicit TransformStreams(const std::vector<Transform> &transforms) {
+    for (const Transform &t : transforms) {
+      px.push_back(t.position.x);
+      py.push_back(t.position.y);
+      pz.push_back(t.position.z);
+      rx.push_back(t.rotation.x);
+      ry.push_back(t.rotation.y);
+      rz.push_back(t.rotation.z);
+      rw.push_back(t.rotation.w);
+      sx.push_back(t.scale.x);
+      sy.push_back(t.scale.y);
+      sz.push_back(t.scale.z);
+    }
+  }
+
+  TransformComponentsSoA View() const {
+    return TransformComponentsSoA{px, py, pz, rx, ry, rz, rw, sx, sy, sz};
+  }
+};
+
+static Mat4 MakeViewProjection() {
+  return Mat4::Perspective(ToRadians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f) *
+         Mat4::LookAt(Vec3(10.0f, 20.0f, 150.0f), Vec3::Zero(),
+                      Vec3(0.0f, 1.0f, 0.0f));
+}
+
+// Translate * rotate * scale as full Mat4 products, the per-object path
+// before Affine3x4
+static Mat4 ReferenceModel(const Transform &transform) {
+  return Mat4::Translation(transform.position) *
+         transform.rotation.ToMatrix() * Mat4::Scale(transform.scale);
+}
+
+//============================================================================
+// Accuracy
+//============================================================================
+bool TestKernelsMatchPerObject() {
+  Logger::Info("TransformBatchTests",
+               "Testing batch composition against per-object...");
+
+  const Mat4 viewProjection = MakeViewProjection();
+  // Every tail length around the 8- and 16-wide blocks
+  for (size_t count : {0, 1, 3, 7, 8, 9, 15, 16, 17, 31, 100}) {
+    std::vector<Transform> transforms = RandomTransforms(count, 1);
+    TransformStreams streams(transforms);
+
+    for (const MathKernelTable *table : AvailableTables()) {
+      const std::string level = Name(table) + " count " +
+                                std::to_string(count);
+      std::vector<Affine3x4> models(count + 1), streamModels(count + 1);
+      std::vector<Mat4> mvps(count + 1), streamMVPs(count + 1);
+      // Sentinels past the end must survive
+      models[count].m[0][0] = streamModels[count].m[0][0] = 42.0f;
+      mvps[count].m[0][0] = streamMVPs[count].m[0][0] = 42.0f;
+
+      table->TransformsToAffine(transforms.data(), models.data(), count);
+      table->TransformsToMVP(viewProjection, transforms.data(), mvps.data(),
+                             count);
+      table->TransformStreamsToAffine(streams.View(), streamModels.data(),
+                                      count);
+      table->TransformStreamsToMVP(viewProjection, streams.View(),
+                                   streamMVPs.data(), count);
+
+      for (size_t i = 0; i < count; ++i) {
+        Affine3x4 model = transforms[i].ToAffine();
+        Mat4 mvp = viewProjection * ReferenceModel(transforms[i]);
+        TEST_ASSERT(MaxError(models[i], model) < 1e-5f,
+                    level + ": model should match Transform::ToAffine");
+        TEST_ASSERT(MaxError(streamModels[i], model) < 1e-5f,
+                    level + ": stream model should match ToAffine");
+        TEST_ASSERT(MaxError(mvps[i], mvp) < 1e-4f,
+                    level + ": MVP should match the Mat4 products");
+        TEST_ASSERT(MaxError(streamMVPs[i], mvp) < 1e-4f,
+                    level + ": stream MVP should match the Mat4 products");
+      }
+      TEST_ASSERT(models[count].m[0][0] == 42.0f &&
+                      streamModels[count].m[0][0] == 42.0f &&
+                      mvps[count].m[0][0] == 42.0f &&
+                      streamMVPs[count].m[0][0] == 42.0f,
+                  level + ": kernels should not write past 'count'");
+    }
+  }
+
+  // The Span front door clamps to the shorter span
+  std::vector<Transform> transforms = RandomTransforms(20, 2);
+  std::vector<Mat4> mvps(12);
+  ComposeTransforms(viewProjection, transforms, mvps);
+  TEST_ASSERT(MaxError(mvps[11], viewProjection * transforms[11].ToAffine()) <
+                  1e-5f,
+              "ComposeTransforms should fill the output span");
+
+  Logger::Info("TransformBatchTests", "✅ Batch composition tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("TransformBatchTests", "Starting transform batch tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestKernelsMatchPerObject();
+
+  if (allPassed) {
+    Logger::Info("TransformBatchTests",
+                 "🎉 ALL TRANSFORM BATCH TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("TransformBatchTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
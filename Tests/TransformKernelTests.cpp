@@ -0,0 +1,163 @@
+#include "Core/Logger.h"
+#include "Math/Math.h"
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+using namespace Engine::Math;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("TransformKernelTests", std::string("FAILED: ") + message);  \
+    return false;                                                              \
+  }
+
+static bool Near(float a, float b, float tolerance = 1e-5f) {
+  return std::abs(a - b) <= tolerance * std::max(1.0f, std::abs(b));
+}
+
+static bool Near(const Vec3 &a, const Vec3 &b, float tolerance = 1e-5f) {
+  return Near(a.x, b.x, tolerance) && Near(a.y, b.y, tolerance) &&
+         Near(a.z, b.z, tolerance);
+}
+
+static std::vector<Vec3> MakePoints(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+  std::vector<Vec3> points(count);
+  for (auto &p : points) {
+    p = Vec3(dist(rng), dist(rng), dist(rng));
+  }
+  return points;
+}
+
+static Mat4 MakeTransform() {
+  return Mat4::Translation(Vec3(1.5f, -2.0f, 3.25f)) *
+         Mat4::RotationY(0.7f) * Mat4::RotationX(-0.3f) *
+         Mat4::Scale(Vec3(2.0f, 0.5f, 1.25f));
+}
+
+static Mat4 MakeViewProjection() {
+  Mat4 view = Mat4::LookAt(Vec3(4.0f, 3.0f, 30.0f), Vec3::Zero(), Vec3::Up());
+  return Mat4::Perspective(ToRadians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f) *
+         view;
+}
+
+//============================================================================
+// Correctness Tests
+//============================================================================
+bool TestAoSKernels() {
+  Logger::Info("TransformKernelTests", "Testing AoS transform kernels...");
+
+  Mat4 transform = MakeTransform();
+  Mat4 viewProjection = MakeViewProjection();
+
+  // Every length up to a few packets covers the peeled head and the tails
+  for (size_t count = 0; count <= 19; ++count) {
+    std::vector<Vec3> points = MakePoints(count + 1, 1);
+
+    // Offsetting by one element flips the 32-byte alignment of the input
+    for (size_t offset = 0; offset < 2; ++offset) {
+      Span<const Vec3> input(points.data() + offset, count);
+      std::vector<Vec3> p(count), v(count), n(count);
+      transform.TransformPoints(input, p);
+      transform.TransformVectors(input, v);
+      viewProjection.TransformPointsProjective(input, n);
+
+      for (size_t i = 0; i < count; ++i) {
+        const Vec3 &in = input[i];
+        Vec4 clip = viewProjection * Vec4(in, 1.0f);
+        Vec3 ndc = clip.XYZ() / clip.w;
+
+        TEST_ASSERT(Near(p[i], transform.TransformPoint(in)),
+                    "TransformPoints matches TransformPoint at " +
+                        std::to_string(i) + "/" + std::to_string(count));
+        TEST_ASSERT(Near(v[i], transform.TransformVector(in)),
+                    "TransformVectors matches TransformVector");
+        TEST_ASSERT(Near(n[i], ndc, 1e-4f),
+                    "TransformPointsProjective divides by w");
+        TEST_ASSERT(p[i].w == 0.0f && v[i].w == 0.0f && n[i].w == 0.0f,
+                    "Padding lane stays zero");
+      }
+    }
+  }
+
+  // In place, and a short output limits the count
+  std::vector<Vec3> points = MakePoints(11, 2);
+  std::vector<Vec3> expected(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    expected[i] = transform.TransformPoint(points[i]);
+  }
+  transform.TransformPoints(points, points);
+  for (size_t i = 0; i < points.size(); ++i) {
+    TEST_ASSERT(Near(points[i], expected[i]), "In-place transform");
+  }
+
+  std::vector<Vec3> shortOut(4, Vec3(-1.0f));
+  std::vector<Vec3> source = MakePoints(9, 3);
+  transform.TransformPoints(source, Span<Vec3>(shortOut.data(), 3));
+  TEST_ASSERT(Near(shortOut[2], transform.TransformPoint(source[2])) &&
+                  shortOut[3].x == -1.0f,
+              "Output span bounds the write");
+
+  Logger::Info("TransformKernelTests", "✅ AoS kernel tests passed!");
+  return true;
+}
+
+bool TestSoAKernels() {
+  Logger::Info("TransformKernelTests", "Testing SoA output kernels...");
+
+  Mat4 transform = MakeTransform();
+  for (size_t count = 0; count <= 27; ++count) {
+    std::vector<Vec3> points = MakePoints(count, 4);
+
+    // One extra element on each stream catches writes past the end and
+    // starts the streams unaligned
+    std::vector<float> x(count + 2, 7.0f), y(count + 2, 7.0f);
+    std::vector<float> z(count + 2, 7.0f);
+    Span<float> outX(x.data() + 1, count), outY(y.data() + 1, count);
+    Span<float> outZ(z.data() + 1, count);
+
+    transform.TransformPoints(points, outX, outY, outZ);
+    for (size_t i = 0; i < count; ++i) {
+      TEST_ASSERT(Near(Vec3(outX[i], outY[i], outZ[i]),
+                       transform.TransformPoint(points[i])),
+                  "SoA TransformPoints matches TransformPoint");
+    }
+    TEST_ASSERT(x[0] == 7.0f && x[count + 1] == 7.0f && z[count + 1] == 7.0f,
+                "SoA stores stay within the spans");
+
+    transform.TransformVectors(points, outX, outY, outZ);
+    for (size_t i = 0; i < count; ++i) {
+      TEST_ASSERT(Near(Vec3(outX[i], outY[i], outZ[i]),
+                       transform.TransformVector(points[i])),
+                  "SoA TransformVectors matches TransformVector");
+    }
+  }
+
+  Logger::Info("TransformKernelTests", "✅ SoA kernel tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("TransformKernelTests", "Starting batch transform tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestAoSKernels();
+  allPassed &= TestSoAKernels();
+
+  if (allPassed) {
+    Logger::Info("TransformKernelTests",
+                 "🎉 ALL TRANSFORM KERNEL TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("TransformKernelTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
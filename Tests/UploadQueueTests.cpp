@@ -0,0 +1,77 @@
+#include "Core/Logger.h"
+#include "Renderer/UploadQueue.h"
+#include <string>
+
+using namespace Engine;
+
+#define TEST_ASSERT(condition, message)                                        \
+  if (!(condition)) {                                                          \
+    Logger::Error("UploadQueueTests", std::string("FAILED: ") + message);      \
+    return false;                                                              \
+  }
+
+//============================================================================
+// Handle Tests
+//============================================================================
+// These run without a window, so the queue is not running and uploads take
+// the synchronous fallback path. The worker itself needs a GL context.
+bool TestSynchronousFallback() {
+  Logger::Info("UploadQueueTests", "Testing synchronous fallback...");
+
+  TEST_ASSERT(!UploadQueue::IsRunning(), "Queue not running without window");
+
+  int uploads = 0;
+  UploadHandle<int> handle = UploadQueue::Submit<int>([&uploads]() {
+    ++uploads;
+    return std::make_shared<int>(42);
+  });
+
+  TEST_ASSERT(uploads == 1, "Upload executed in place");
+  TEST_ASSERT(handle.IsValid(), "Handle is valid");
+  TEST_ASSERT(handle.IsReady(), "Handle ready immediately");
+  TEST_ASSERT(handle.Get() && *handle.Get() == 42, "Resource available");
+  TEST_ASSERT(handle.Wait() == handle.Get(), "Wait returns the resource");
+  TEST_ASSERT(UploadQueue::GetPendingCount() == 0, "Nothing left pending");
+
+  Logger::Info("UploadQueueTests", "✅ Synchronous fallback tests passed!");
+  return true;
+}
+
+bool TestFailedUpload() {
+  Logger::Info("UploadQueueTests", "Testing failed uploads...");
+
+  UploadHandle<int> failed =
+      UploadQueue::Submit<int>([]() { return std::shared_ptr<int>(); });
+  TEST_ASSERT(failed.IsFailed(), "Null resource marks upload as failed");
+  TEST_ASSERT(!failed.IsReady(), "Failed upload is never ready");
+  TEST_ASSERT(failed.Get() == nullptr, "Failed upload yields no resource");
+  TEST_ASSERT(failed.Wait() == nullptr, "Wait does not block on failure");
+
+  UploadHandle<int> empty;
+  TEST_ASSERT(!empty.IsValid(), "Default handle is invalid");
+  TEST_ASSERT(empty.IsFailed(), "Default handle reports failure");
+  TEST_ASSERT(empty.Wait() == nullptr, "Default handle does not block");
+
+  Logger::Info("UploadQueueTests", "✅ Failed upload tests passed!");
+  return true;
+}
+
+//============================================================================
+// Main Test Runner
+//============================================================================
+int main() {
+  Logger::Info("UploadQueueTests", "Starting upload queue tests...");
+
+  bool allPassed = true;
+
+  allPassed &= TestSynchronousFallback();
+  allPassed &= TestFailedUpload();
+
+  if (allPassed) {
+    Logger::Info("UploadQueueTests", "🎉 ALL UPLOAD QUEUE TESTS PASSED!");
+    return 0;
+  } else {
+    Logger::Error("UploadQueueTests", "❌ Some tests failed!");
+    return -1;
+  }
+}
\ No newline at end of file
@@ -44,6 +44,9 @@ typedef double GLclampd;
 typedef char GLchar;
 typedef ptrdiff_t GLintptr;
 typedef ptrdiff_t GLsizeiptr;
+typedef khronos_int64_t GLint64;
+typedef khronos_uint64_t GLuint64;
+typedef struct __GLsync *GLsync;
 
 #define GL_DEPTH_BUFFER_BIT 0x00000100
 #define GL_STENCIL_BUFFER_BIT 0x00000400
@@ -74,6 +77,45 @@ typedef ptrdiff_t GLsizeiptr;
 #define GL_FRONT_AND_BACK 0x0408
 #define GL_LINE 0x1B01
 #define GL_FILL 0x1B02
+#define GL_TEXTURE_2D 0x0DE1
+#define GL_TEXTURE_MIN_FILTER 0x2801
+#define GL_TEXTURE_MAG_FILTER 0x2800
+#define GL_TEXTURE_WRAP_S 0x2802
+#define GL_TEXTURE_WRAP_T 0x2803
+#define GL_NEAREST 0x2600
+#define GL_LINEAR 0x2601
+#define GL_CLAMP_TO_EDGE 0x812F
+#define GL_RGBA8 0x8058
+#define GL_DEPTH24_STENCIL8 0x88F0
+#define GL_FRAMEBUFFER 0x8D40
+#define GL_READ_FRAMEBUFFER 0x8CA8
+#define GL_DRAW_FRAMEBUFFER 0x8CA9
+#define GL_RENDERBUFFER 0x8D41
+#define GL_COLOR_ATTACHMENT0 0x8CE0
+#define GL_DEPTH_STENCIL_ATTACHMENT 0x821A
+#define GL_FRAMEBUFFER_COMPLETE 0x8CD5
+#define GL_TIME_ELAPSED 0x88BF
+#define GL_QUERY_RESULT 0x8866
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#define GL_ALREADY_SIGNALED 0x911A
+#define GL_TIMEOUT_EXPIRED 0x911B
+#define GL_CONDITION_SATISFIED 0x911C
+#define GL_WAIT_FAILED 0x911D
+#define GL_TIMEOUT_IGNORED 0xFFFFFFFFFFFFFFFFull
+#define GL_TEXTURE_2D_ARRAY 0x8C1A
+#define GL_TEXTURE0 0x84C0
+#define GL_REPEAT 0x2901
+#define GL_LINEAR_MIPMAP_LINEAR 0x2703
+#define GL_NEAREST_MIPMAP_NEAREST 0x2700
+#define GL_TEXTURE_BASE_LEVEL 0x813C
+#define GL_TEXTURE_MAX_LEVEL 0x813D
+#define GL_UNPACK_ALIGNMENT 0x0CF5
+#define GL_PIXEL_UNPACK_BUFFER 0x88EC
+#define GL_STREAM_DRAW 0x88E0
+#define GL_MAP_WRITE_BIT 0x0002
+#define GL_MAP_INVALIDATE_BUFFER_BIT 0x0008
 
 typedef void(APIENTRYP PFNGLCLEARPROC)(GLbitfield mask);
 typedef void(APIENTRYP PFNGLCLEARCOLORPROC)(GLfloat red, GLfloat green,
@@ -150,6 +192,101 @@ typedef void(APIENTRYP PFNGLUNIFORMMATRIX4FVPROC)(GLint location, GLsizei count,
 typedef void(APIENTRYP PFNGLPOLYGONMODEPROC)(GLenum face, GLenum mode);
 typedef const GLubyte *(APIENTRYP PFNGLGETSTRINGPROC)(GLenum name);
 
+typedef void(APIENTRYP PFNGLGENTEXTURESPROC)(GLsizei n, GLuint *textures);
+typedef void(APIENTRYP PFNGLBINDTEXTUREPROC)(GLenum target, GLuint texture);
+typedef void(APIENTRYP PFNGLDELETETEXTURESPROC)(GLsizei n,
+                                                const GLuint *textures);
+typedef void(APIENTRYP PFNGLTEXIMAGE2DPROC)(GLenum target, GLint level,
+                                            GLint internalformat, GLsizei width,
+                                            GLsizei height, GLint border,
+                                            GLenum format, GLenum type,
+                                            const void *pixels);
+typedef void(APIENTRYP PFNGLTEXPARAMETERIPROC)(GLenum target, GLenum pname,
+                                               GLint param);
+typedef void(APIENTRYP PFNGLGENFRAMEBUFFERSPROC)(GLsizei n,
+                                                 GLuint *framebuffers);
+typedef void(APIENTRYP PFNGLBINDFRAMEBUFFERPROC)(GLenum target,
+                                                 GLuint framebuffer);
+typedef void(APIENTRYP PFNGLDELETEFRAMEBUFFERSPROC)(GLsizei n,
+                                                    const GLuint *framebuffers);
+typedef void(APIENTRYP PFNGLFRAMEBUFFERTEXTURE2DPROC)(GLenum target,
+                                                      GLenum attachment,
+                                                      GLenum textarget,
+                                                      GLuint texture,
+                                                      GLint level);
+typedef void(APIENTRYP PFNGLFRAMEBUFFERRENDERBUFFERPROC)(GLenum target,
+                                                         GLenum attachment,
+                                                         GLenum renderbuffertarget,
+                                                         GLuint renderbuffer);
+typedef GLenum(APIENTRYP PFNGLCHECKFRAMEBUFFERSTATUSPROC)(GLenum target);
+typedef void(APIENTRYP PFNGLBLITFRAMEBUFFERPROC)(GLint srcX0, GLint srcY0,
+                                                 GLint srcX1, GLint srcY1,
+                                                 GLint dstX0, GLint dstY0,
+                                                 GLint dstX1, GLint dstY1,
+                                                 GLbitfield mask,
+                                                 GLenum filter);
+typedef void(APIENTRYP PFNGLGENRENDERBUFFERSPROC)(GLsizei n,
+                                                  GLuint *renderbuffers);
+typedef void(APIENTRYP PFNGLBINDRENDERBUFFERPROC)(GLenum target,
+                                                  GLuint renderbuffer);
+typedef void(APIENTRYP PFNGLDELETERENDERBUFFERSPROC)(GLsizei n,
+                                                     const GLuint *renderbuffers);
+typedef void(APIENTRYP PFNGLRENDERBUFFERSTORAGEPROC)(GLenum target,
+                                                     GLenum internalformat,
+                                                     GLsizei width,
+                                                     GLsizei height);
+
+typedef void(APIENTRYP PFNGLGENQUERIESPROC)(GLsizei n, GLuint *ids);
+typedef void(APIENTRYP PFNGLDELETEQUERIESPROC)(GLsizei n, const GLuint *ids);
+typedef void(APIENTRYP PFNGLBEGINQUERYPROC)(GLenum target, GLuint id);
+typedef void(APIENTRYP PFNGLENDQUERYPROC)(GLenum target);
+typedef void(APIENTRYP PFNGLGETQUERYOBJECTUIVPROC)(GLuint id, GLenum pname,
+                                                   GLuint *params);
+typedef void(APIENTRYP PFNGLGETQUERYOBJECTUI64VPROC)(GLuint id, GLenum pname,
+                                                     GLuint64 *params);
+typedef void(APIENTRYP PFNGLFLUSHPROC)(void);
+typedef GLsync(APIENTRYP PFNGLFENCESYNCPROC)(GLenum condition,
+                                             GLbitfield flags);
+typedef GLenum(APIENTRYP PFNGLCLIENTWAITSYNCPROC)(GLsync sync, GLbitfield flags,
+                                                  GLuint64 timeout);
+typedef void(APIENTRYP PFNGLWAITSYNCPROC)(GLsync sync, GLbitfield flags,
+                                          GLuint64 timeout);
+typedef void(APIENTRYP PFNGLDELETESYNCPROC)(GLsync sync);
+
+typedef void(APIENTRYP PFNGLACTIVETEXTUREPROC)(GLenum texture);
+typedef void(APIENTRYP PFNGLPIXELSTOREIPROC)(GLenum pname, GLint param);
+typedef void(APIENTRYP PFNGLTEXSTORAGE2DPROC)(GLenum target, GLsizei levels,
+                                              GLenum internalformat,
+                                              GLsizei width, GLsizei height);
+typedef void(APIENTRYP PFNGLTEXSTORAGE3DPROC)(GLenum target, GLsizei levels,
+                                              GLenum internalformat,
+                                              GLsizei width, GLsizei height,
+                                              GLsizei depth);
+typedef void(APIENTRYP PFNGLTEXSUBIMAGE2DPROC)(GLenum target, GLint level,
+                                               GLint xoffset, GLint yoffset,
+                                               GLsizei width, GLsizei height,
+                                               GLenum format, GLenum type,
+                                               const void *pixels);
+typedef void(APIENTRYP PFNGLTEXSUBIMAGE3DPROC)(GLenum target, GLint level,
+                                               GLint xoffset, GLint yoffset,
+                                               GLint zoffset, GLsizei width,
+                                               GLsizei height, GLsizei depth,
+                                               GLenum format, GLenum type,
+                                               const void *pixels);
+typedef void *(APIENTRYP PFNGLMAPBUFFERRANGEPROC)(GLenum target,
+                                                  GLintptr offset,
+                                                  GLsizeiptr length,
+                                                  GLbitfield access);
+typedef GLboolean(APIENTRYP PFNGLUNMAPBUFFERPROC)(GLenum target);
+
+typedef void(APIENTRYP PFNGLDEPTHMASKPROC)(GLboolean flag);
+
+typedef void(APIENTRYP PFNGLDRAWELEMENTSINSTANCEDPROC)(GLenum mode,
+                                                       GLsizei count,
+                                                       GLenum type,
+                                                       const void *indices,
+                                                       GLsizei instancecount);
+
 #define GL_VENDOR 0x1F00
 #define GL_RENDERER 0x1F01
 #define GL_VERSION 0x1F02
@@ -196,6 +333,43 @@ GLAPI PFNGLUNIFORM4FPROC glad_glUniform4f;
 GLAPI PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv;
 GLAPI PFNGLPOLYGONMODEPROC glad_glPolygonMode;
 GLAPI PFNGLGETSTRINGPROC glad_glGetString;
+GLAPI PFNGLGENTEXTURESPROC glad_glGenTextures;
+GLAPI PFNGLBINDTEXTUREPROC glad_glBindTexture;
+GLAPI PFNGLDELETETEXTURESPROC glad_glDeleteTextures;
+GLAPI PFNGLTEXIMAGE2DPROC glad_glTexImage2D;
+GLAPI PFNGLTEXPARAMETERIPROC glad_glTexParameteri;
+GLAPI PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers;
+GLAPI PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer;
+GLAPI PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers;
+GLAPI PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D;
+GLAPI PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer;
+GLAPI PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus;
+GLAPI PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer;
+GLAPI PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers;
+GLAPI PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer;
+GLAPI PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers;
+GLAPI PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage;
+GLAPI PFNGLGENQUERIESPROC glad_glGenQueries;
+GLAPI PFNGLDELETEQUERIESPROC glad_glDeleteQueries;
+GLAPI PFNGLBEGINQUERYPROC glad_glBeginQuery;
+GLAPI PFNGLENDQUERYPROC glad_glEndQuery;
+GLAPI PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv;
+GLAPI PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v;
+GLAPI PFNGLFLUSHPROC glad_glFlush;
+GLAPI PFNGLFENCESYNCPROC glad_glFenceSync;
+GLAPI PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync;
+GLAPI PFNGLWAITSYNCPROC glad_glWaitSync;
+GLAPI PFNGLDELETESYNCPROC glad_glDeleteSync;
+GLAPI PFNGLACTIVETEXTUREPROC glad_glActiveTexture;
+GLAPI PFNGLPIXELSTOREIPROC glad_glPixelStorei;
+GLAPI PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D;
+GLAPI PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D;
+GLAPI PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D;
+GLAPI PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D;
+GLAPI PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange;
+GLAPI PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer;
+GLAPI PFNGLDEPTHMASKPROC glad_glDepthMask;
+GLAPI PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced;
 
 #define glClear glad_glClear
 #define glClearColor glad_glClearColor
@@ -239,6 +413,43 @@ GLAPI PFNGLGETSTRINGPROC glad_glGetString;
 #define glUniformMatrix4fv glad_glUniformMatrix4fv
 #define glPolygonMode glad_glPolygonMode
 #define glGetString glad_glGetString
+#define glGenTextures glad_glGenTextures
+#define glBindTexture glad_glBindTexture
+#define glDeleteTextures glad_glDeleteTextures
+#define glTexImage2D glad_glTexImage2D
+#define glTexParameteri glad_glTexParameteri
+#define glGenFramebuffers glad_glGenFramebuffers
+#define glBindFramebuffer glad_glBindFramebuffer
+#define glDeleteFramebuffers glad_glDeleteFramebuffers
+#define glFramebufferTexture2D glad_glFramebufferTexture2D
+#define glFramebufferRenderbuffer glad_glFramebufferRenderbuffer
+#define glCheckFramebufferStatus glad_glCheckFramebufferStatus
+#define glBlitFramebuffer glad_glBlitFramebuffer
+#define glGenRenderbuffers glad_glGenRenderbuffers
+#define glBindRenderbuffer glad_glBindRenderbuffer
+#define glDeleteRenderbuffers glad_glDeleteRenderbuffers
+#define glRenderbufferStorage glad_glRenderbufferStorage
+#define glGenQueries glad_glGenQueries
+#define glDeleteQueries glad_glDeleteQueries
+#define glBeginQuery glad_glBeginQuery
+#define glEndQuery glad_glEndQuery
+#define glGetQueryObjectuiv glad_glGetQueryObjectuiv
+#define glGetQueryObjectui64v glad_glGetQueryObjectui64v
+#define glFlush glad_glFlush
+#define glFenceSync glad_glFenceSync
+#define glClientWaitSync glad_glClientWaitSync
+#define glWaitSync glad_glWaitSync
+#define glDeleteSync glad_glDeleteSync
+#define glActiveTexture glad_glActiveTexture
+#define glPixelStorei glad_glPixelStorei
+#define glTexStorage2D glad_glTexStorage2D
+#define glTexStorage3D glad_glTexStorage3D
+#define glTexSubImage2D glad_glTexSubImage2D
+#define glTexSubImage3D glad_glTexSubImage3D
+#define glMapBufferRange glad_glMapBufferRange
+#define glUnmapBuffer glad_glUnmapBuffer
+#define glDepthMask glad_glDepthMask
+#define glDrawElementsInstanced glad_glDrawElementsInstanced
 
 #ifdef __cplusplus
 extern "C" {
@@ -111,6 +111,43 @@ PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv = NULL;
 PFNGLPOLYGONMODEPROC glad_glPolygonMode = NULL;
 PFNGLGETSTRINGPROC glad_glGetString = NULL;
 PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = NULL;
+PFNGLGENTEXTURESPROC glad_glGenTextures = NULL;
+PFNGLBINDTEXTUREPROC glad_glBindTexture = NULL;
+PFNGLDELETETEXTURESPROC glad_glDeleteTextures = NULL;
+PFNGLTEXIMAGE2DPROC glad_glTexImage2D = NULL;
+PFNGLTEXPARAMETERIPROC glad_glTexParameteri = NULL;
+PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers = NULL;
+PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = NULL;
+PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = NULL;
+PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D = NULL;
+PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer = NULL;
+PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = NULL;
+PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = NULL;
+PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers = NULL;
+PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = NULL;
+PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers = NULL;
+PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage = NULL;
+PFNGLGENQUERIESPROC glad_glGenQueries = NULL;
+PFNGLDELETEQUERIESPROC glad_glDeleteQueries = NULL;
+PFNGLBEGINQUERYPROC glad_glBeginQuery = NULL;
+PFNGLENDQUERYPROC glad_glEndQuery = NULL;
+PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv = NULL;
+PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = NULL;
+PFNGLFLUSHPROC glad_glFlush = NULL;
+PFNGLFENCESYNCPROC glad_glFenceSync = NULL;
+PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = NULL;
+PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
+PFNGLDELETESYNCPROC glad_glDeleteSync = NULL;
+PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
+PFNGLPIXELSTOREIPROC glad_glPixelStorei = NULL;
+PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D = NULL;
+PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D = NULL;
+PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = NULL;
+PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = NULL;
+PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = NULL;
+PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer = NULL;
+PFNGLDEPTHMASKPROC glad_glDepthMask = NULL;
+PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = NULL;
 
 static void load_GL_functions(void) {
   glad_glClear = (PFNGLCLEARPROC)get_proc("glClear");
@@ -166,6 +203,57 @@ static void load_GL_functions(void) {
       (PFNGLUNIFORMMATRIX4FVPROC)get_proc("glUniformMatrix4fv");
   glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)get_proc("glPolygonMode");
   glad_glGetString = (PFNGLGETSTRINGPROC)get_proc("glGetString");
+  glad_glGenTextures = (PFNGLGENTEXTURESPROC)get_proc("glGenTextures");
+  glad_glBindTexture = (PFNGLBINDTEXTUREPROC)get_proc("glBindTexture");
+  glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)get_proc("glDeleteTextures");
+  glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)get_proc("glTexImage2D");
+  glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)get_proc("glTexParameteri");
+  glad_glGenFramebuffers =
+      (PFNGLGENFRAMEBUFFERSPROC)get_proc("glGenFramebuffers");
+  glad_glBindFramebuffer =
+      (PFNGLBINDFRAMEBUFFERPROC)get_proc("glBindFramebuffer");
+  glad_glDeleteFramebuffers =
+      (PFNGLDELETEFRAMEBUFFERSPROC)get_proc("glDeleteFramebuffers");
+  glad_glFramebufferTexture2D =
+      (PFNGLFRAMEBUFFERTEXTURE2DPROC)get_proc("glFramebufferTexture2D");
+  glad_glFramebufferRenderbuffer =
+      (PFNGLFRAMEBUFFERRENDERBUFFERPROC)get_proc("glFramebufferRenderbuffer");
+  glad_glCheckFramebufferStatus =
+      (PFNGLCHECKFRAMEBUFFERSTATUSPROC)get_proc("glCheckFramebufferStatus");
+  glad_glBlitFramebuffer =
+      (PFNGLBLITFRAMEBUFFERPROC)get_proc("glBlitFramebuffer");
+  glad_glGenRenderbuffers =
+      (PFNGLGENRENDERBUFFERSPROC)get_proc("glGenRenderbuffers");
+  glad_glBindRenderbuffer =
+      (PFNGLBINDRENDERBUFFERPROC)get_proc("glBindRenderbuffer");
+  glad_glDeleteRenderbuffers =
+      (PFNGLDELETERENDERBUFFERSPROC)get_proc("glDeleteRenderbuffers");
+  glad_glRenderbufferStorage =
+      (PFNGLRENDERBUFFERSTORAGEPROC)get_proc("glRenderbufferStorage");
+  glad_glGenQueries = (PFNGLGENQUERIESPROC)get_proc("glGenQueries");
+  glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)get_proc("glDeleteQueries");
+  glad_glBeginQuery = (PFNGLBEGINQUERYPROC)get_proc("glBeginQuery");
+  glad_glEndQuery = (PFNGLENDQUERYPROC)get_proc("glEndQuery");
+  glad_glGetQueryObjectuiv =
+      (PFNGLGETQUERYOBJECTUIVPROC)get_proc("glGetQueryObjectuiv");
+  glad_glGetQueryObjectui64v =
+      (PFNGLGETQUERYOBJECTUI64VPROC)get_proc("glGetQueryObjectui64v");
+  glad_glFlush = (PFNGLFLUSHPROC)get_proc("glFlush");
+  glad_glFenceSync = (PFNGLFENCESYNCPROC)get_proc("glFenceSync");
+  glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)get_proc("glClientWaitSync");
+  glad_glWaitSync = (PFNGLWAITSYNCPROC)get_proc("glWaitSync");
+  glad_glDeleteSync = (PFNGLDELETESYNCPROC)get_proc("glDeleteSync");
+  glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)get_proc("glActiveTexture");
+  glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)get_proc("glPixelStorei");
+  glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)get_proc("glTexStorage2D");
+  glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)get_proc("glTexStorage3D");
+  glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)get_proc("glTexSubImage2D");
+  glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)get_proc("glTexSubImage3D");
+  glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)get_proc("glMapBufferRange");
+  glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)get_proc("glUnmapBuffer");
+  glad_glDepthMask = (PFNGLDEPTHMASKPROC)get_proc("glDepthMask");
+  glad_glDrawElementsInstanced =
+      (PFNGLDRAWELEMENTSINSTANCEDPROC)get_proc("glDrawElementsInstanced");
 }
 
 int gladLoadGL(void) {